@@ -0,0 +1,216 @@
+// chunk_collider_bench.cpp
+// 区块碰撞体基准：逐行段静态体（旧） vs 整块复合体（极大矩形 / 链形轮廓）
+//
+// 视野：3x1（横向单行模式）与 9x9 区块，每块 8x8 瓦片，地表 + 随机洞穴。每种模式统计：
+//   - 物理体数、broadphase 代理数（= 形状数，链形每条线段一个代理）、静态树高度
+//   - 整视野加载 / 卸载碰撞体耗时
+//   - 每个区块列上方落下若干动态体，b2World_Step 平均耗时
+//
+// 与 Chunk::rebuildPhysicsBodies 相同的几何换算，直接走 PhysicsManager 的批量 / 复合接口。
+// 用法：chunk_collider_bench [steps]
+#include "../src/engine/physics/physics_manager.h"
+#include "../src/engine/world/chunk_collider_builder.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+    using engine::physics::PhysicsManager;
+    using engine::physics::StaticBoxDesc;
+    using engine::world::ChunkColliderBuilder;
+    using engine::world::ChunkColliderMode;
+    using engine::world::ChunkColliderOutline;
+    using engine::world::ChunkColliderRect;
+    using engine::world::ChunkTiles;
+    using engine::world::TileData;
+    using engine::world::TileType;
+    using engine::world::WorldConfig;
+
+    constexpr int SIZE = WorldConfig::CHUNK_SIZE;
+    constexpr float TILE_METERS = WorldConfig::TILE_SIZE.x / WorldConfig::PIXELS_PER_METER;
+    constexpr int SURFACE_Y = 12; // 地表大致位于第 2 行区块内
+    constexpr int BODIES_PER_COLUMN = 8;
+
+    double msSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    uint32_t hash2(int x, int y)
+    {
+        uint32_t h = static_cast<uint32_t>(x) * 374761393u + static_cast<uint32_t>(y) * 668265263u;
+        h = (h ^ (h >> 13)) * 1274126177u;
+        return h ^ (h >> 16);
+    }
+
+    int surfaceAt(int wx)
+    {
+        return SURFACE_Y + static_cast<int>(std::lround(3.0 * std::sin(wx * 0.21) + 1.5 * std::sin(wx * 0.57)));
+    }
+
+    // 地表以下为实心，按哈希挖出约 12% 的洞穴瓦片（成团出现，制造非矩形边界）
+    void generateChunk(int cx, int cy, ChunkTiles &tiles)
+    {
+        for (int ly = 0; ly < SIZE; ++ly)
+        {
+            for (int lx = 0; lx < SIZE; ++lx)
+            {
+                const int wx = cx * SIZE + lx;
+                const int wy = cy * SIZE + ly;
+                bool solid = wy >= surfaceAt(wx);
+                if (solid && wy > surfaceAt(wx) + 2 && hash2(wx / 2, wy / 2) % 100 < 12)
+                    solid = false;
+                tiles[ly * SIZE + lx] = TileData(solid ? (wy == surfaceAt(wx) ? TileType::Grass : TileType::Stone) : TileType::Air);
+            }
+        }
+    }
+
+    struct View
+    {
+        const char *name;
+        int chunksX;
+        int chunksY;
+        int firstChunkY;
+    };
+
+    struct LoadedChunk
+    {
+        int cx = 0;
+        int cy = 0;
+        ChunkTiles tiles{};
+        std::vector<b2BodyId> bodies;
+    };
+
+    void createColliders(PhysicsManager &physics, LoadedChunk &chunk, ChunkColliderMode mode)
+    {
+        const b2Vec2 origin = {chunk.cx * SIZE * TILE_METERS, chunk.cy * SIZE * TILE_METERS};
+        if (mode == ChunkColliderMode::RowRuns)
+        {
+            std::vector<StaticBoxDesc> boxes;
+            ChunkColliderRect runs[ChunkColliderBuilder::MAX_RUNS_PER_ROW];
+            for (int ly = 0; ly < SIZE; ++ly)
+            {
+                const int count = ChunkColliderBuilder::buildRowRuns(chunk.tiles, ly, runs);
+                for (int i = 0; i < count; ++i)
+                {
+                    const float halfW = runs[i].w * TILE_METERS * 0.5f;
+                    boxes.push_back({{origin.x + runs[i].x * TILE_METERS + halfW, origin.y + (ly + 0.5f) * TILE_METERS},
+                                     {halfW, TILE_METERS * 0.5f}});
+                }
+            }
+            chunk.bodies.resize(boxes.size());
+            physics.createStaticBodies(boxes.data(), static_cast<int>(boxes.size()), chunk.bodies.data());
+            return;
+        }
+
+        if (mode == ChunkColliderMode::Rectangles)
+        {
+            std::vector<ChunkColliderRect> rects;
+            ChunkColliderBuilder::buildRectangles(chunk.tiles, rects);
+            std::vector<StaticBoxDesc> boxes;
+            for (const auto &rect : rects)
+            {
+                const float halfW = rect.w * TILE_METERS * 0.5f;
+                const float halfH = rect.h * TILE_METERS * 0.5f;
+                boxes.push_back({{rect.x * TILE_METERS + halfW, rect.y * TILE_METERS + halfH}, {halfW, halfH}});
+            }
+            chunk.bodies.push_back(physics.createStaticCompoundBody(origin, boxes.data(), static_cast<int>(boxes.size())));
+            return;
+        }
+
+        ChunkColliderOutline outline;
+        ChunkColliderBuilder::buildOutline(chunk.tiles, outline);
+        std::vector<b2Vec2> points;
+        for (const auto &p : outline.points)
+            points.push_back({p.x * TILE_METERS, p.y * TILE_METERS});
+        chunk.bodies.push_back(physics.createStaticChainBody(origin, points.data(), outline.loopSizes.data(),
+                                                             static_cast<int>(outline.loopSizes.size())));
+    }
+
+    const char *modeName(ChunkColliderMode mode)
+    {
+        switch (mode)
+        {
+        case ChunkColliderMode::RowRuns:
+            return "row-runs";
+        case ChunkColliderMode::Rectangles:
+            return "rects";
+        case ChunkColliderMode::Chains:
+            return "chains";
+        }
+        return "?";
+    }
+
+    void run(const View &view, ChunkColliderMode mode, int steps)
+    {
+        PhysicsManager physics;
+        physics.init({0.0f, 10.0f});
+
+        std::vector<LoadedChunk> chunks;
+        for (int y = 0; y < view.chunksY; ++y)
+        {
+            for (int x = 0; x < view.chunksX; ++x)
+            {
+                LoadedChunk chunk;
+                chunk.cx = x;
+                chunk.cy = view.firstChunkY + y;
+                generateChunk(chunk.cx, chunk.cy, chunk.tiles);
+                chunks.push_back(std::move(chunk));
+            }
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (auto &chunk : chunks)
+            createColliders(physics, chunk, mode);
+        const double loadMs = msSince(start);
+
+        const b2Counters counters = b2World_GetCounters(physics.getWorldId());
+        const size_t staticBodies = physics.getBodyCount();
+
+        // 每个区块列上方落下一排动态体
+        for (int x = 0; x < view.chunksX; ++x)
+        {
+            for (int i = 0; i < BODIES_PER_COLUMN; ++i)
+            {
+                const int wx = x * SIZE + i;
+                const float px = (wx + 0.5f) * TILE_METERS;
+                const float py = (surfaceAt(wx) - 3 - (i & 1)) * TILE_METERS;
+                physics.createDynamicBody({px, py}, {TILE_METERS * 0.4f, TILE_METERS * 0.4f}, nullptr);
+            }
+        }
+
+        for (int i = 0; i < 30; ++i)
+            physics.update(1.0f / 60.0f, 4);
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < steps; ++i)
+            physics.update(1.0f / 60.0f, 4);
+        const double stepMs = msSince(start) / steps;
+
+        start = std::chrono::steady_clock::now();
+        for (auto &chunk : chunks)
+            physics.destroyBodies(chunk.bodies.data(), static_cast<int>(chunk.bodies.size()));
+        const double unloadMs = msSince(start);
+
+        std::printf("  %-4s %-9s bodies %5zu  proxies %5d  static tree h %2d  load %7.3f ms  unload %7.3f ms  step %7.4f ms\n",
+                    view.name, modeName(mode), staticBodies, counters.shapeCount, counters.staticTreeHeight,
+                    loadMs, unloadMs, stepMs);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const int steps = argc > 1 ? std::max(1, std::atoi(argv[1])) : 600;
+    const View views[] = {{"3x1", 3, 1, 1}, {"9x9", 9, 9, 0}};
+    const ChunkColliderMode modes[] = {ChunkColliderMode::RowRuns, ChunkColliderMode::Rectangles, ChunkColliderMode::Chains};
+
+    std::printf("chunk colliders (%dx%d tiles/chunk, %d dynamic bodies per chunk column, step avg of %d)\n",
+                SIZE, SIZE, BODIES_PER_COLUMN, steps);
+    for (const View &view : views)
+        for (ChunkColliderMode mode : modes)
+            run(view, mode, steps);
+    return 0;
+}
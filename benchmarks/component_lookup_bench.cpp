@@ -0,0 +1,289 @@
+// component_lookup_bench.cpp
+// 组件查找基准：旧版 type_index 哈希表 vs TYPE_ID 槽位数组 vs resolveSiblings 缓存指针
+//
+// 模拟 500 个怪物的每帧热路径（与 ActorManager / MonsterAIComponent / PhysicsComponent /
+// ControllerComponent 的查找模式一致）：
+//   - AI：取自身 Transform / Physics / Sprite / Controller 与目标的 Transform
+//   - Controller：取 Physics；Physics：取 Transform 写回位置
+//   - 渲染排序：按 Transform.y 排序，比较器内每次各取一次 Transform
+// 三种实现跑同样的逻辑，核对最终位置一致。
+// 用法：component_lookup_bench [actorCount] [frames]
+#include "../src/engine/object/game_object.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    using engine::component::Component;
+    using engine::component::ComponentTypeId;
+    namespace component_type = engine::component::component_type;
+
+    enum class LookupMode
+    {
+        Legacy, // 旧版 unordered_map<type_index, ...>
+        Slot,   // 每次 getComponent，走槽位数组
+        Cached, // resolveSiblings 缓存的指针
+    };
+
+    class LegacyObject;
+
+    struct BTransform;
+    struct BPhysics;
+    struct BSprite;
+    struct BController;
+
+    // 所有基准组件共用：按模式选择查找方式
+    struct BenchComponent : Component
+    {
+        LookupMode mode = LookupMode::Slot;
+        LegacyObject *legacy = nullptr;
+
+        template <typename T>
+        T *sibling();
+
+        virtual void step(float dt) = 0;
+        void update(float dt) override { step(dt); }
+        void render() override {}
+    };
+
+    // ── 旧版 GameObject 的组件表（逐行复刻 getComponent） ──
+    // update 按添加顺序遍历（旧版按哈希表顺序），只为三种实现结果可比，不影响查找开销
+    class LegacyObject
+    {
+    public:
+        std::unordered_map<std::type_index, std::unique_ptr<BenchComponent>> components;
+        std::vector<BenchComponent *> order;
+
+        template <typename T>
+        T *add(LookupMode mode)
+        {
+            auto component = std::make_unique<T>();
+            component->mode = mode;
+            component->legacy = this;
+            T *ptr = component.get();
+            order.push_back(ptr);
+            components[std::type_index(typeid(T))] = std::move(component);
+            return ptr;
+        }
+
+        template <typename T>
+        T *getComponent() const
+        {
+            auto type_index = std::type_index(typeid(T));
+            if (components.find(type_index) == components.end())
+                return nullptr;
+            return static_cast<T *>(components.at(type_index).get());
+        }
+
+        void update(float dt)
+        {
+            for (BenchComponent *component : order)
+                component->step(dt);
+        }
+    };
+
+    template <typename T>
+    T *BenchComponent::sibling()
+    {
+        return mode == LookupMode::Legacy ? legacy->getComponent<T>() : _owner->getComponent<T>();
+    }
+
+    struct BTransform final : BenchComponent
+    {
+        static constexpr ComponentTypeId TYPE_ID = component_type::Transform;
+        float x = 0.0f, y = 0.0f;
+        void step(float) override {}
+    };
+
+    struct BPhysics final : BenchComponent
+    {
+        static constexpr ComponentTypeId TYPE_ID = component_type::Physics;
+        float px = 0.0f, py = 0.0f, vx = 0.0f, vy = 0.0f;
+        BTransform *cachedTransform = nullptr;
+
+        void resolveSiblings() override { cachedTransform = _owner->getComponent<BTransform>(); }
+        void step(float dt) override
+        {
+            px += vx * dt;
+            py += vy * dt;
+            BTransform *t = mode == LookupMode::Cached ? cachedTransform : sibling<BTransform>();
+            if (t)
+            {
+                t->x = px;
+                t->y = py;
+            }
+        }
+    };
+
+    struct BSprite final : BenchComponent
+    {
+        static constexpr ComponentTypeId TYPE_ID = component_type::Sprite;
+        bool flipped = false;
+        void step(float) override {}
+    };
+
+    struct BController final : BenchComponent
+    {
+        static constexpr ComponentTypeId TYPE_ID = component_type::Controller;
+        float inputX = 0.0f;
+        BPhysics *cachedPhysics = nullptr;
+
+        void resolveSiblings() override { cachedPhysics = _owner->getComponent<BPhysics>(); }
+        void step(float) override
+        {
+            BPhysics *p = mode == LookupMode::Cached ? cachedPhysics : sibling<BPhysics>();
+            if (p)
+                p->vx += inputX * 0.01f;
+        }
+    };
+
+    struct BAI final : BenchComponent
+    {
+        static constexpr ComponentTypeId TYPE_ID = component_type::GAME_BASE + 1;
+        const BTransform *target = nullptr;
+        BTransform *cachedTransform = nullptr;
+        BPhysics *cachedPhysics = nullptr;
+        BSprite *cachedSprite = nullptr;
+        BController *cachedController = nullptr;
+
+        void resolveSiblings() override
+        {
+            cachedTransform = _owner->getComponent<BTransform>();
+            cachedPhysics = _owner->getComponent<BPhysics>();
+            cachedSprite = _owner->getComponent<BSprite>();
+            cachedController = _owner->getComponent<BController>();
+        }
+
+        void step(float) override
+        {
+            const bool cached = mode == LookupMode::Cached;
+            // getTargetDelta + 状态函数 + 受控分支，与 MonsterAIComponent 的查找次数相当
+            BTransform *self = cached ? cachedTransform : sibling<BTransform>();
+            BPhysics *physics = cached ? cachedPhysics : sibling<BPhysics>();
+            BSprite *sprite = cached ? cachedSprite : sibling<BSprite>();
+            BController *controller = cached ? cachedController : sibling<BController>();
+            BPhysics *physicsAgain = cached ? cachedPhysics : sibling<BPhysics>();
+            BSprite *spriteAgain = cached ? cachedSprite : sibling<BSprite>();
+            if (!self || !physics || !sprite || !controller || !target)
+                return;
+            const float dx = target->x - self->x;
+            const float dir = dx >= 0.0f ? 1.0f : -1.0f;
+            sprite->flipped = dir < 0.0f;
+            physics->vx = physics->vx * 0.9f + dir * 0.5f;
+            physicsAgain->vy = (target->y - self->y) * 0.05f;
+            controller->inputX = dir;
+            spriteAgain->flipped = sprite->flipped;
+        }
+    };
+
+    double msSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    template <typename Object>
+    void initComponents(Object &obj, int i, const BTransform *target, LookupMode mode)
+    {
+        BPhysics *physics = nullptr;
+        BAI *ai = nullptr;
+        if constexpr (std::is_same_v<Object, LegacyObject>)
+        {
+            obj.template add<BTransform>(mode);
+            physics = obj.template add<BPhysics>(mode);
+            obj.template add<BSprite>(mode);
+            obj.template add<BController>(mode);
+            ai = obj.template add<BAI>(mode);
+        }
+        else
+        {
+            for (BenchComponent *c : std::initializer_list<BenchComponent *>{
+                     obj.template addComponent<BTransform>(), physics = obj.template addComponent<BPhysics>(),
+                     obj.template addComponent<BSprite>(), obj.template addComponent<BController>(),
+                     ai = obj.template addComponent<BAI>()})
+                c->mode = mode;
+        }
+        physics->px = static_cast<float>(i % 97) * 13.0f;
+        physics->py = static_cast<float>(i % 31) * 7.0f;
+        ai->target = target;
+    }
+
+    struct Result
+    {
+        double msPerFrame = 0.0;
+        double checksum = 0.0;
+    };
+
+    template <typename Object, typename MakeObject>
+    Result run(int actors, int frames, LookupMode mode, MakeObject makeObject)
+    {
+        std::vector<std::unique_ptr<Object>> objects;
+        BTransform target;
+        target.x = 600.0f;
+        target.y = 120.0f;
+        for (int i = 0; i < actors; ++i)
+        {
+            objects.push_back(makeObject());
+            initComponents(*objects.back(), i, &target, mode);
+        }
+        std::vector<Object *> drawOrder;
+        for (auto &obj : objects)
+            drawOrder.push_back(obj.get());
+
+        constexpr float dt = 1.0f / 60.0f;
+        const auto start = std::chrono::steady_clock::now();
+        for (int f = 0; f < frames; ++f)
+        {
+            for (auto &obj : objects)
+                obj->update(dt);
+            // ActorManager::render 的 Y 排序：比较器内查 Transform
+            std::stable_sort(drawOrder.begin(), drawOrder.end(), [](const Object *lhs, const Object *rhs) {
+                auto *lt = lhs->template getComponent<BTransform>();
+                auto *rt = rhs->template getComponent<BTransform>();
+                return (lt ? lt->y : 0.0f) < (rt ? rt->y : 0.0f);
+            });
+        }
+        Result result;
+        result.msPerFrame = msSince(start) / frames;
+        for (auto *obj : drawOrder)
+        {
+            auto *t = obj->template getComponent<BTransform>();
+            result.checksum += t->x + t->y;
+        }
+        return result;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const int actors = argc > 1 ? std::max(1, std::atoi(argv[1])) : 500;
+    const int frames = argc > 2 ? std::max(1, std::atoi(argv[2])) : 600;
+
+    // 基准组件不访问 Context，GameObject 只保存其地址
+    alignas(std::max_align_t) static unsigned char contextStorage[64];
+    auto &context = reinterpret_cast<engine::core::Context &>(contextStorage);
+    spdlog::set_level(spdlog::level::warn);
+
+    auto makeLegacy = [] { return std::make_unique<LegacyObject>(); };
+    auto makeGameObject = [&] { return std::make_unique<engine::object::GameObject>(context, "bench", "monster"); };
+
+    const Result legacy = run<LegacyObject>(actors, frames, LookupMode::Legacy, makeLegacy);
+    const Result slot = run<engine::object::GameObject>(actors, frames, LookupMode::Slot, makeGameObject);
+    const Result cached = run<engine::object::GameObject>(actors, frames, LookupMode::Cached, makeGameObject);
+
+    std::printf("component lookup, %d actors x %d frames (update + Y sort)\n", actors, frames);
+    std::printf("  %-26s %8.3f ms/frame\n", "legacy type_index map", legacy.msPerFrame);
+    std::printf("  %-26s %8.3f ms/frame  x%.2f\n", "TYPE_ID slot array", slot.msPerFrame, legacy.msPerFrame / slot.msPerFrame);
+    std::printf("  %-26s %8.3f ms/frame  x%.2f\n", "slot + cached siblings", cached.msPerFrame, legacy.msPerFrame / cached.msPerFrame);
+
+    const bool ok = legacy.checksum == slot.checksum && legacy.checksum == cached.checksum;
+    std::printf("  checksum: %.3f / %.3f / %.3f%s\n", legacy.checksum, slot.checksum, cached.checksum, ok ? "" : "  MISMATCH");
+    return ok ? 0 : 1;
+}
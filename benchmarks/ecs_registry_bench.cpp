@@ -0,0 +1,285 @@
+// ecs_registry_bench.cpp
+// ECS 存储基准：旧版嵌套哈希表 Registry vs 稀疏集 Registry（view / 拥有型 group）
+//
+// 旧版按改造前的 engine::ecs::Registry 原样复刻：type_index → (Entity → shared_ptr<void>)，
+// view<T>() 返回实体列表拷贝，其余组件逐个 get。
+// 每个实体都带 Position / Velocity / Mass，分别测一、二、三组件的遍历：
+//   - 一组件：pos += 1
+//   - 二组件：pos += vel * dt
+//   - 三组件：vel += force / mass 后 pos += vel * dt
+// 同时测实体创建 + 加组件的耗时，并核对各实现遍历后的位置总和一致。
+// 用法：ecs_registry_bench [entityCount] [repeats]
+#include "../src/engine/ecs/registry.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    using engine::ecs::Entity;
+
+    struct Position
+    {
+        float x = 0.0f, y = 0.0f;
+    };
+
+    struct Velocity
+    {
+        float x = 0.0f, y = 0.0f;
+    };
+
+    struct Mass
+    {
+        float invMass = 1.0f;
+    };
+
+    constexpr float kDt = 1.0f / 60.0f;
+    constexpr float kForceY = -9.8f;
+
+    // ── 旧版 Registry（逐行复刻） ──
+    class LegacyRegistry
+    {
+    private:
+        Entity _next_entity = 1;
+        std::unordered_map<std::type_index, std::unordered_map<Entity, std::shared_ptr<void>>> _components;
+
+    public:
+        Entity create() { return _next_entity++; }
+
+        template <typename T, typename... Args>
+        T &add(Entity entity, Args &&...args)
+        {
+            auto component = std::make_shared<T>(std::forward<Args>(args)...);
+            _components[typeid(T)][entity] = component;
+            return *component;
+        }
+
+        template <typename T>
+        T *get(Entity entity)
+        {
+            auto type_it = _components.find(typeid(T));
+            if (type_it == _components.end())
+                return nullptr;
+            auto entity_it = type_it->second.find(entity);
+            if (entity_it == type_it->second.end())
+                return nullptr;
+            return static_cast<T *>(entity_it->second.get());
+        }
+
+        template <typename T>
+        std::vector<Entity> view()
+        {
+            std::vector<Entity> result;
+            auto it = _components.find(typeid(T));
+            if (it != _components.end())
+            {
+                for (const auto &[entity, _] : it->second)
+                    result.push_back(entity);
+            }
+            return result;
+        }
+    };
+
+    double msSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    Velocity initialVelocity(int i) { return {static_cast<float>(i % 17) * 0.5f, static_cast<float>(i % 5)}; }
+    Mass initialMass(int i) { return {1.0f / (1.0f + static_cast<float>(i % 7))}; }
+
+    template <typename Registry>
+    void populate(Registry &registry, int count)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            const Entity e = registry.create();
+            registry.template add<Position>(e, Position{static_cast<float>(i), 0.0f});
+            registry.template add<Velocity>(e, initialVelocity(i));
+            registry.template add<Mass>(e, initialMass(i));
+        }
+    }
+
+    // 位置总和（按实体 id 求和与遍历顺序无关，用于核对结果）
+    template <typename Registry>
+    double positionSum(Registry &registry, const std::vector<Entity> &entities)
+    {
+        double sum = 0.0;
+        for (Entity e : entities)
+        {
+            const Position *p = registry.template get<Position>(e);
+            sum += p->x + p->y;
+        }
+        return sum;
+    }
+
+    struct Timing
+    {
+        double create = 0.0;
+        double one = 0.0;
+        double two = 0.0;
+        double three = 0.0;
+        double checksum = 0.0;
+    };
+
+    void printRow(const char *name, const Timing &t, const Timing &base, int count, int repeats)
+    {
+        auto perEntity = [&](double ms) { return ms * 1e6 / (static_cast<double>(count) * repeats); };
+        std::printf("  %-18s create %8.2f ms | 1c %7.2f ns/e x%5.1f | 2c %7.2f ns/e x%5.1f | 3c %7.2f ns/e x%5.1f\n",
+                    name, t.create,
+                    perEntity(t.one), base.one / t.one,
+                    perEntity(t.two), base.two / t.two,
+                    perEntity(t.three), base.three / t.three);
+    }
+
+    Timing runLegacy(int count, int repeats)
+    {
+        Timing t;
+        LegacyRegistry registry;
+        auto start = std::chrono::steady_clock::now();
+        populate(registry, count);
+        t.create = msSince(start);
+
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeats; ++r)
+        {
+            for (Entity e : registry.view<Position>())
+                registry.get<Position>(e)->x += 1.0f;
+        }
+        t.one = msSince(start);
+
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeats; ++r)
+        {
+            for (Entity e : registry.view<Position>())
+            {
+                Position *p = registry.get<Position>(e);
+                const Velocity *v = registry.get<Velocity>(e);
+                if (!v)
+                    continue;
+                p->x += v->x * kDt;
+                p->y += v->y * kDt;
+            }
+        }
+        t.two = msSince(start);
+
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeats; ++r)
+        {
+            for (Entity e : registry.view<Position>())
+            {
+                Position *p = registry.get<Position>(e);
+                Velocity *v = registry.get<Velocity>(e);
+                const Mass *m = registry.get<Mass>(e);
+                if (!v || !m)
+                    continue;
+                v->y += kForceY * m->invMass * kDt;
+                p->x += v->x * kDt;
+                p->y += v->y * kDt;
+            }
+        }
+        t.three = msSince(start);
+
+        t.checksum = positionSum(registry, registry.view<Position>());
+        return t;
+    }
+
+    // useGroup：二、三组件分别用拥有型分组遍历（两种分组不能共存，各用一个注册表）
+    Timing runSparse(int count, int repeats, bool useGroup)
+    {
+        Timing t;
+        engine::ecs::Registry registry;
+        engine::ecs::Registry registry3;
+        auto start = std::chrono::steady_clock::now();
+        populate(registry, count);
+        t.create = msSince(start);
+        if (useGroup)
+            populate(registry3, count);
+
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeats; ++r)
+            registry.view<Position>().each([](Entity, Position &p) { p.x += 1.0f; });
+        if (useGroup)
+        {
+            for (int r = 0; r < repeats; ++r)
+                registry3.view<Position>().each([](Entity, Position &p) { p.x += 1.0f; });
+        }
+        t.one = msSince(start) / (useGroup ? 2.0 : 1.0);
+
+        auto integrate = [](Entity, Position &p, const Velocity &v) {
+            p.x += v.x * kDt;
+            p.y += v.y * kDt;
+        };
+        auto integrateForce = [](Entity, Position &p, Velocity &v, const Mass &m) {
+            v.y += kForceY * m.invMass * kDt;
+            p.x += v.x * kDt;
+            p.y += v.y * kDt;
+        };
+
+        if (useGroup)
+        {
+            auto group2 = registry.group<Position, Velocity>();
+            auto group3 = registry3.group<Position, Velocity, Mass>();
+
+            start = std::chrono::steady_clock::now();
+            for (int r = 0; r < repeats; ++r)
+                group2.each(integrate);
+            t.two = msSince(start);
+
+            // registry3 也要走一遍二组件遍历，保证两边状态相同以便核对
+            for (int r = 0; r < repeats; ++r)
+                group3.each([&](Entity e, Position &p, Velocity &v, Mass &) { integrate(e, p, v); });
+
+            start = std::chrono::steady_clock::now();
+            for (int r = 0; r < repeats; ++r)
+                group3.each(integrateForce);
+            t.three = msSince(start);
+
+            std::vector<Entity> all = registry3.view<Position>().entities();
+            t.checksum = positionSum(registry3, all);
+        }
+        else
+        {
+            start = std::chrono::steady_clock::now();
+            for (int r = 0; r < repeats; ++r)
+                registry.view<Position, Velocity>().each(integrate);
+            t.two = msSince(start);
+
+            start = std::chrono::steady_clock::now();
+            for (int r = 0; r < repeats; ++r)
+                registry.view<Position, Velocity, Mass>().each(integrateForce);
+            t.three = msSince(start);
+
+            std::vector<Entity> all = registry.view<Position>().entities();
+            t.checksum = positionSum(registry, all);
+        }
+        return t;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const int count = argc > 1 ? std::max(1, std::atoi(argv[1])) : 100000;
+    const int repeats = argc > 2 ? std::max(1, std::atoi(argv[2])) : 20;
+
+    std::printf("ECS iteration, %d entities x%d passes (Position + Velocity + Mass on every entity)\n", count, repeats);
+    const Timing legacy = runLegacy(count, repeats);
+    const Timing view = runSparse(count, repeats, false);
+    const Timing group = runSparse(count, repeats, true);
+
+    printRow("legacy hash map", legacy, legacy, count, repeats);
+    printRow("sparse-set view", view, legacy, count, repeats);
+    printRow("sparse-set group", group, legacy, count, repeats);
+
+    const auto close = [](double a, double b) { return std::abs(a - b) <= 1e-6 * std::max(1.0, std::abs(a)); };
+    const bool ok = close(legacy.checksum, view.checksum) && close(legacy.checksum, group.checksum);
+    std::printf("  checksum: legacy %.3f, view %.3f, group %.3f%s\n", legacy.checksum, view.checksum, group.checksum,
+                ok ? "" : "  MISMATCH");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,164 @@
+#include "bench_report.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+
+namespace bench
+{
+    namespace
+    {
+        // 最近秩：第 ceil(p * n) 个样本（1 起），n = 1 时各百分位都等于唯一样本
+        double percentile(const std::vector<double> &sorted, double p)
+        {
+            const size_t rank = static_cast<size_t>(std::ceil(p * static_cast<double>(sorted.size())));
+            return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+        }
+
+        void compareStat(const std::string &label, const nlohmann::json &base, const nlohmann::json &cur,
+                         double tolerancePct, double noiseFloorMs, int &regressions)
+        {
+            for (const char *key : {"p50", "p95"})
+            {
+                if (!base.contains(key) || !cur.contains(key))
+                    continue;
+                const double before = base[key].get<double>();
+                const double after = cur[key].get<double>();
+                const double deltaPct = before > 0.0 ? (after - before) / before * 100.0 : 0.0;
+                const bool regressed = deltaPct > tolerancePct && after - before > noiseFloorMs;
+                if (regressed)
+                    ++regressions;
+                std::printf("  %-36s %-4s %9.3f -> %9.3f ms  %+7.1f%%%s\n", label.c_str(), key, before, after, deltaPct,
+                            regressed ? "  REGRESSION" : "");
+            }
+        }
+    }
+
+    SampleStats summarize(std::vector<double> samples)
+    {
+        SampleStats stats;
+        stats.count = samples.size();
+        if (samples.empty())
+            return stats;
+        std::sort(samples.begin(), samples.end());
+        stats.min = samples.front();
+        stats.max = samples.back();
+        stats.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(samples.size());
+        stats.p50 = percentile(samples, 0.50);
+        stats.p90 = percentile(samples, 0.90);
+        stats.p95 = percentile(samples, 0.95);
+        stats.p99 = percentile(samples, 0.99);
+        return stats;
+    }
+
+    nlohmann::json toJson(const SampleStats &stats)
+    {
+        return {{"count", stats.count}, {"min", stats.min}, {"mean", stats.mean}, {"p50", stats.p50},
+                {"p90", stats.p90},     {"p95", stats.p95}, {"p99", stats.p99},   {"max", stats.max}};
+    }
+
+    // ── ScenarioRecorder ──
+
+    void ScenarioRecorder::beginFrame()
+    {
+        m_frameStart = std::chrono::steady_clock::now();
+        if (m_measuring && m_frameMs.empty())
+            m_firstMeasured = m_frameStart;
+        for (Series &s : m_series)
+            s.frameAccum = 0.0;
+    }
+
+    void ScenarioRecorder::endFrame()
+    {
+        const auto now = std::chrono::steady_clock::now();
+        LSL_PROFILE_FRAME();
+        if (!m_measuring)
+        {
+            ++m_warmupFrames;
+            return;
+        }
+        m_frameMs.push_back(std::chrono::duration<double, std::milli>(now - m_frameStart).count());
+        m_wallMs = std::chrono::duration<double, std::milli>(now - m_firstMeasured).count();
+        // 本帧未执行的子系统记 0，保证各子系统样本与帧一一对应
+        for (Series &s : m_series)
+            s.samples.push_back(s.frameAccum);
+    }
+
+    ScenarioRecorder::Series &ScenarioRecorder::series(const char *subsystem)
+    {
+        for (Series &s : m_series)
+        {
+            if (s.name == subsystem)
+                return s;
+        }
+        m_series.push_back({subsystem, {}, 0.0});
+        return m_series.back();
+    }
+
+    void ScenarioRecorder::addSample(const char *subsystem, double ms)
+    {
+        Series &s = series(subsystem);
+        s.frameAccum += ms;
+    }
+
+    nlohmann::json ScenarioRecorder::toJson() const
+    {
+        nlohmann::json subsystems = nlohmann::json::object();
+        for (const Series &s : m_series)
+            subsystems[s.name] = bench::toJson(summarize(s.samples));
+
+        return {{"warmupFrames", m_warmupFrames},
+                {"frames", m_frameMs.size()},
+                {"wallMs", m_wallMs},
+                {"frameMs", bench::toJson(summarize(m_frameMs))},
+                {"subsystems", subsystems},
+                {"counters", m_counters}};
+    }
+
+    // ── 与旧报告比较 ──
+
+    int compareWithBaseline(const nlohmann::json &current, const std::string &baselinePath,
+                            double tolerancePct, double noiseFloorMs)
+    {
+        std::ifstream file(baselinePath);
+        if (!file.is_open())
+        {
+            std::printf("baseline %s: cannot open\n", baselinePath.c_str());
+            return -1;
+        }
+        nlohmann::json baseline = nlohmann::json::parse(file, nullptr, false);
+        if (baseline.is_discarded() || !baseline.contains("scenarios"))
+        {
+            std::printf("baseline %s: not a benchmark report\n", baselinePath.c_str());
+            return -1;
+        }
+        if (baseline.value("build", nlohmann::json::object()).value("type", "") !=
+            current["build"].value("type", ""))
+            std::printf("warning: baseline build type differs, results are not comparable\n");
+
+        int regressions = 0;
+        std::printf("compare with %s (tolerance %.1f%%, noise floor %.3f ms)\n", baselinePath.c_str(), tolerancePct,
+                    noiseFloorMs);
+        for (const auto &scenario : current["scenarios"].items())
+        {
+            const std::string &name = scenario.key();
+            if (!baseline["scenarios"].contains(name))
+            {
+                std::printf("  %-36s (new)\n", name.c_str());
+                continue;
+            }
+            const nlohmann::json &base = baseline["scenarios"][name];
+            const nlohmann::json &cur = scenario.value();
+            compareStat(name + " frame", base["frameMs"], cur["frameMs"], tolerancePct, noiseFloorMs, regressions);
+            for (const auto &subsystem : cur["subsystems"].items())
+            {
+                if (base["subsystems"].contains(subsystem.key()))
+                    compareStat(name + "." + subsystem.key(), base["subsystems"][subsystem.key()], subsystem.value(),
+                                tolerancePct, noiseFloorMs, regressions);
+            }
+        }
+        std::printf("%d regression(s)\n", regressions);
+        return regressions;
+    }
+} // namespace bench
@@ -0,0 +1,91 @@
+// headless 基准的采样与报告
+// bench_report.h
+//   - ScenarioRecorder 按帧收集整帧与各子系统耗时（毫秒），子系统按首次出现的顺序输出
+//   - 统计量：min / mean / p50 / p90 / p95 / p99 / max（最近秩百分位，不插值，结果可逐位复现）
+//   - 报告为 JSON；compareWithBaseline 读取旧报告，按 p50 / p95 判定回归
+//   - 每个子系统同时是一个剖析区段（名称须为字符串字面量），--trace 时可在 Chrome trace 里查看单帧细节
+#pragma once
+#include "../../src/engine/core/profiler.h"
+#include <nlohmann/json.hpp>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bench
+{
+    struct SampleStats
+    {
+        size_t count = 0;
+        double min = 0.0;
+        double mean = 0.0;
+        double p50 = 0.0;
+        double p90 = 0.0;
+        double p95 = 0.0;
+        double p99 = 0.0;
+        double max = 0.0;
+    };
+
+    SampleStats summarize(std::vector<double> samples);
+    nlohmann::json toJson(const SampleStats &stats);
+
+    class ScenarioRecorder
+    {
+    public:
+        explicit ScenarioRecorder(std::string name) : m_name(std::move(name)) {}
+
+        // 预热帧不计入统计，只推进模拟
+        void setMeasuring(bool measuring) { m_measuring = measuring; }
+        bool isMeasuring() const { return m_measuring; }
+
+        void beginFrame();
+        void endFrame();
+
+        /** @brief 计时执行 fn，耗时计入当前帧的 subsystem（同一帧内同名多次调用累加） */
+        template <typename Fn>
+        void measure(const char *subsystem, Fn &&fn)
+        {
+            LSL_PROFILE_ZONE(subsystem);
+            const auto start = std::chrono::steady_clock::now();
+            fn();
+            addSample(subsystem, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        }
+        void addSample(const char *subsystem, double ms);
+
+        /** @brief 场景结束时的计数（加载区块数、存活怪物数等），原样写入报告 */
+        void setCounter(const std::string &name, double value) { m_counters[name] = value; }
+
+        const std::string &name() const { return m_name; }
+        size_t measuredFrames() const { return m_frameMs.size(); }
+        nlohmann::json toJson() const;
+
+    private:
+        struct Series
+        {
+            std::string name;
+            std::vector<double> samples;
+            double frameAccum = 0.0;
+        };
+
+        Series &series(const char *subsystem);
+
+        std::string m_name;
+        bool m_measuring = false;
+        int m_warmupFrames = 0;
+        std::chrono::steady_clock::time_point m_frameStart;
+        std::chrono::steady_clock::time_point m_firstMeasured;
+        double m_wallMs = 0.0;
+        std::vector<double> m_frameMs;
+        std::vector<Series> m_series;
+        nlohmann::json m_counters = nlohmann::json::object();
+    };
+
+    /**
+     * @brief 与旧报告比较，逐场景打印整帧与子系统 p50 / p95 的变化
+     * 变慢超过 tolerancePct 且绝对差超过 noiseFloorMs 记为回归
+     * @return 回归项数量；旧报告无法读取时返回 -1
+     */
+    int compareWithBaseline(const nlohmann::json &current, const std::string &baselinePath,
+                            double tolerancePct, double noiseFloorMs);
+} // namespace bench
@@ -0,0 +1,43 @@
+#include "headless_engine.h"
+#include <SDL3/SDL.h>
+#include <spdlog/spdlog.h>
+
+namespace bench
+{
+    HeadlessEngine::HeadlessEngine(const glm::vec2 &viewportSize)
+        : m_camera(viewportSize)
+    {
+        // 音频走 dummy 驱动：AudioManager 照常创建混音器与语音池，但不打开真实设备
+        SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+        if (!SDL_InitSubSystem(SDL_INIT_AUDIO))
+            spdlog::warn("HeadlessEngine: 音频子系统初始化失败: {}", SDL_GetError());
+
+        m_renderer.setLogicalSize(viewportSize);
+        m_config = std::make_unique<engine::core::Config>("assets/config.json");
+        m_time = std::make_unique<engine::core::Time>();
+        m_resources = std::make_unique<engine::resource::ResourceManager>(nullptr, nullptr);
+        m_resources->initHeadless();
+        m_renderer.setResourceManager(m_resources.get());
+        m_input = std::make_unique<engine::input::InputManager>(&m_renderer, m_config.get());
+        m_context = std::make_unique<engine::core::Context>(*m_input, m_renderer, m_camera, *m_resources, *m_time);
+    }
+
+    HeadlessEngine::~HeadlessEngine()
+    {
+        m_context.reset();
+        m_input.reset();
+        m_resources.reset();
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    }
+
+    void HeadlessEngine::beginFrame()
+    {
+        m_resources->processTextureUploads(static_cast<size_t>(m_config->_texture_upload_budget_kb) * 1024);
+        m_renderer.clearScreen();
+    }
+
+    void HeadlessEngine::endFrame()
+    {
+        m_renderer.present();
+    }
+} // namespace bench
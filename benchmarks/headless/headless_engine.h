@@ -0,0 +1,48 @@
+// headless 基准的引擎外壳
+// headless_engine.h
+//   - 与 GameApp 相同的 Context 组成（输入 / 渲染 / 相机 / 资源 / 时间 / 任务系统），但不创建窗口与图形设备
+//   - 渲染走 NullRenderer，纹理只解码取尺寸；音频使用 SDL 的 dummy 驱动
+//   - 场景按固定 dt 推进，不读取真实时间，帧序列可复现
+#pragma once
+#include "../../src/engine/core/config.h"
+#include "../../src/engine/core/context.h"
+#include "../../src/engine/core/time.h"
+#include "../../src/engine/input/input_manager.h"
+#include "../../src/engine/render/camera.h"
+#include "../../src/engine/render/null_renderer.h"
+#include "../../src/engine/resource/resource_manager.h"
+#include <memory>
+
+namespace bench
+{
+    class HeadlessEngine
+    {
+    public:
+        static constexpr float FRAME_DT = 1.0f / 60.0f;
+
+        explicit HeadlessEngine(const glm::vec2 &viewportSize = {1280.0f, 720.0f});
+        ~HeadlessEngine();
+
+        HeadlessEngine(const HeadlessEngine &) = delete;
+        HeadlessEngine &operator=(const HeadlessEngine &) = delete;
+
+        engine::core::Context &context() { return *m_context; }
+        engine::render::NullRenderer &renderer() { return m_renderer; }
+        engine::render::Camera &camera() { return m_camera; }
+        engine::resource::ResourceManager &resources() { return *m_resources; }
+
+        /** @brief 帧开始：与 GameApp 相同的纹理上传预算，再清屏 */
+        void beginFrame();
+        /** @brief 帧结束：提交空渲染器的本帧统计 */
+        void endFrame();
+
+    private:
+        engine::render::NullRenderer m_renderer;
+        engine::render::Camera m_camera;
+        std::unique_ptr<engine::core::Config> m_config;
+        std::unique_ptr<engine::core::Time> m_time;
+        std::unique_ptr<engine::resource::ResourceManager> m_resources;
+        std::unique_ptr<engine::input::InputManager> m_input;
+        std::unique_ptr<engine::core::Context> m_context;
+    };
+} // namespace bench
@@ -0,0 +1,207 @@
+// headless 基准入口
+// main.cpp
+//   不打开窗口、不需要 GPU：按固定 dt 运行 scenarios.h 中的场景，输出每个场景整帧与各子系统耗时的百分位（JSON）。
+//   同一台机器、同一构建类型下的两次结果可直接比较；--baseline 读取旧报告并按 p50 / p95 判定回归。
+//
+// 用法（在仓库根目录运行，资源按相对路径加载）：
+//   lsl_benchmarks [--list] [--scenario 名称]... [--frames N] [--warmup N] [--scale S] [--seed N]
+//                  [--out 报告.json] [--baseline 旧报告.json] [--tolerance 百分比] [--noise-floor 毫秒]
+//                  [--trace trace.json] [--label 文本] [--verbose]
+// 退出码：0 正常，1 参数错误或场景失败，2 相对 baseline 有回归
+#include "bench_report.h"
+#include "scenarios.h"
+#include "../../src/engine/core/profiler.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef LSL_BENCH_BUILD_TYPE
+#define LSL_BENCH_BUILD_TYPE "unknown"
+#endif
+
+namespace
+{
+    struct Args
+    {
+        std::vector<std::string> scenarios;
+        bench::ScenarioOptions options;
+        std::string out = "benchmark_results.json";
+        std::string baseline;
+        std::string trace;
+        std::string label;
+        double tolerancePct = 10.0;
+        double noiseFloorMs = 0.05;
+        bool list = false;
+        bool verbose = false;
+    };
+
+    void printUsage()
+    {
+        std::printf("usage: lsl_benchmarks [--list] [--scenario name]... [--frames N] [--warmup N] [--scale S] [--seed N]\n"
+                    "                      [--out report.json] [--baseline old.json] [--tolerance pct] [--noise-floor ms]\n"
+                    "                      [--trace trace.json] [--label text] [--verbose]\n");
+    }
+
+    bool parseArgs(int argc, char **argv, Args &args)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const char *arg = argv[i];
+            const auto value = [&]() -> const char * { return i + 1 < argc ? argv[++i] : nullptr; };
+            const char *v = nullptr;
+            if (std::strcmp(arg, "--list") == 0)
+                args.list = true;
+            else if (std::strcmp(arg, "--verbose") == 0)
+                args.verbose = true;
+            else if (std::strcmp(arg, "--scenario") == 0 && (v = value()))
+                args.scenarios.emplace_back(v);
+            else if (std::strcmp(arg, "--frames") == 0 && (v = value()))
+                args.options.frames = std::max(1, std::atoi(v));
+            else if (std::strcmp(arg, "--warmup") == 0 && (v = value()))
+                args.options.warmupFrames = std::max(0, std::atoi(v));
+            else if (std::strcmp(arg, "--scale") == 0 && (v = value()))
+                args.options.scale = std::max(0.01f, static_cast<float>(std::atof(v)));
+            else if (std::strcmp(arg, "--seed") == 0 && (v = value()))
+                args.options.seed = static_cast<uint32_t>(std::strtoul(v, nullptr, 10));
+            else if (std::strcmp(arg, "--out") == 0 && (v = value()))
+                args.out = v;
+            else if (std::strcmp(arg, "--baseline") == 0 && (v = value()))
+                args.baseline = v;
+            else if (std::strcmp(arg, "--tolerance") == 0 && (v = value()))
+                args.tolerancePct = std::atof(v);
+            else if (std::strcmp(arg, "--noise-floor") == 0 && (v = value()))
+                args.noiseFloorMs = std::atof(v);
+            else if (std::strcmp(arg, "--trace") == 0 && (v = value()))
+                args.trace = v;
+            else if (std::strcmp(arg, "--label") == 0 && (v = value()))
+                args.label = v;
+            else
+                return false;
+        }
+        return true;
+    }
+
+    void printSummary(const std::string &name, const nlohmann::json &report)
+    {
+        const nlohmann::json &frame = report["frameMs"];
+        std::printf("%-16s %5d frames  p50 %8.3f  p95 %8.3f  p99 %8.3f  max %8.3f ms\n", name.c_str(),
+                    report["frames"].get<int>(), frame["p50"].get<double>(), frame["p95"].get<double>(),
+                    frame["p99"].get<double>(), frame["max"].get<double>());
+        for (const auto &subsystem : report["subsystems"].items())
+        {
+            const nlohmann::json &stats = subsystem.value();
+            std::printf("  %-14s p50 %8.3f  p95 %8.3f  p99 %8.3f  max %8.3f ms\n", subsystem.key().c_str(),
+                        stats["p50"].get<double>(), stats["p95"].get<double>(), stats["p99"].get<double>(),
+                        stats["max"].get<double>());
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Args args;
+    if (!parseArgs(argc, argv, args))
+    {
+        printUsage();
+        return 1;
+    }
+
+    const std::vector<bench::ScenarioInfo> &scenarios = bench::allScenarios();
+    if (args.list)
+    {
+        for (const bench::ScenarioInfo &info : scenarios)
+            std::printf("%-16s %5d frames  %s\n", info.name, info.defaultFrames, info.description);
+        return 0;
+    }
+
+    std::vector<const bench::ScenarioInfo *> selected;
+    for (const bench::ScenarioInfo &info : scenarios)
+    {
+        if (args.scenarios.empty() ||
+            std::find(args.scenarios.begin(), args.scenarios.end(), info.name) != args.scenarios.end())
+            selected.push_back(&info);
+    }
+    if (selected.size() < args.scenarios.size())
+    {
+        std::printf("unknown scenario; use --list\n");
+        return 1;
+    }
+
+    spdlog::set_level(args.verbose ? spdlog::level::info : spdlog::level::warn);
+#ifndef NDEBUG
+    std::printf("warning: assertions enabled (%s build), timings are not representative\n", LSL_BENCH_BUILD_TYPE);
+#endif
+    if (!args.trace.empty())
+        engine::core::Profiler::setEnabled(true);
+
+    nlohmann::json report;
+    report["schema"] = 1;
+    report["label"] = args.label;
+    report["build"] = {{"type", LSL_BENCH_BUILD_TYPE},
+#ifdef __VERSION__
+                       {"compiler", __VERSION__},
+#endif
+#ifdef NDEBUG
+                       {"assertions", false},
+#else
+                       {"assertions", true},
+#endif
+                       {"profiler", LSL_PROFILER != 0}};
+    report["host"] = {{"hardwareThreads", std::thread::hardware_concurrency()}};
+    report["options"] = {{"seed", args.options.seed}, {"scale", args.options.scale}};
+    report["scenarios"] = nlohmann::json::object();
+
+    bool failed = false;
+    for (const bench::ScenarioInfo *info : selected)
+    {
+        bench::ScenarioOptions options = args.options;
+        if (options.frames <= 0)
+            options.frames = info->defaultFrames;
+        if (options.warmupFrames < 0)
+            options.warmupFrames = info->defaultWarmupFrames;
+
+        bench::ScenarioRecorder recorder(info->name);
+        info->run(options, recorder);
+        if (recorder.measuredFrames() == 0)
+        {
+            std::printf("%-16s FAILED (no frames measured)\n", info->name);
+            failed = true;
+        }
+        const nlohmann::json scenario = recorder.toJson();
+        report["scenarios"][info->name] = scenario;
+        if (recorder.measuredFrames() > 0)
+            printSummary(info->name, scenario);
+    }
+
+    if (!args.out.empty())
+    {
+        std::ofstream file(args.out);
+        if (!file.is_open())
+        {
+            std::printf("cannot write %s\n", args.out.c_str());
+            return 1;
+        }
+        file << report.dump(2) << '\n';
+        std::printf("report: %s\n", args.out.c_str());
+    }
+    if (!args.trace.empty())
+        std::printf("trace: %s %s\n", args.trace.c_str(),
+                    engine::core::Profiler::exportChromeTrace(args.trace) ? "written" : "FAILED");
+
+    int exitCode = failed ? 1 : 0;
+    if (!args.baseline.empty())
+    {
+        const int regressions = bench::compareWithBaseline(report, args.baseline, args.tolerancePct, args.noiseFloorMs);
+        if (regressions < 0)
+            exitCode = 1;
+        else if (regressions > 0 && exitCode == 0)
+            exitCode = 2;
+    }
+    return exitCode;
+}
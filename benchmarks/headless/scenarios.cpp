@@ -0,0 +1,396 @@
+#include "scenarios.h"
+#include "headless_engine.h"
+#include "../../src/engine/actor/actor_manager.h"
+#include "../../src/engine/component/transform_component.h"
+#include "../../src/engine/core/job_system.h"
+#include "../../src/engine/object/game_object.h"
+#include "../../src/engine/physics/physics_manager.h"
+#include "../../src/engine/physics/physics_stress.h"
+#include "../../src/engine/render/sprite_render_system.h"
+#include "../../src/engine/statemachine/sm_loader.h"
+#include "../../src/engine/statemachine/state_controller.h"
+#include "../../src/engine/world/chunk_manager.h"
+#include "../../src/engine/world/perlin_noise_generator.h"
+#include "../../src/game/monster/monster_manager.h"
+#include "../../src/game/scene/voxel_mesher.h"
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace bench
+{
+    namespace
+    {
+        constexpr float kDt = HeadlessEngine::FRAME_DT;
+        constexpr const char *kTileAtlas = "assets/textures/Tiles/tileset.svg";
+
+        // 跨平台逐位一致的伪随机数（标准库分布的实现因平台而异，不用）
+        struct Lcg
+        {
+            uint32_t state = 1;
+
+            uint32_t next()
+            {
+                state = state * 1664525u + 1013904223u;
+                return state >> 8;
+            }
+            int range(int lo, int hi) { return lo + static_cast<int>(next() % static_cast<uint32_t>(hi - lo + 1)); }
+        };
+
+        int scaled(int base, float scale) { return std::max(1, static_cast<int>(std::lround(base * scale))); }
+
+        template <typename Fn>
+        void runFrames(const ScenarioOptions &options, ScenarioRecorder &recorder, Fn &&frame)
+        {
+            const int total = options.warmupFrames + options.frames;
+            for (int i = 0; i < total; ++i)
+            {
+                recorder.setMeasuring(i >= options.warmupFrames);
+                recorder.beginFrame();
+                frame(i);
+                recorder.endFrame();
+            }
+        }
+
+        // ── chunk_streaming ──
+
+        // 相机路径：水平巡航 + 纵向正弦起伏，每 10 秒向前瞬移一大段（模拟传送 / 快速旅行，整片视野重新流送）
+        glm::vec2 cameraPathAt(float t, float surfaceY)
+        {
+            const float x = 700.0f * t + 20000.0f * std::floor(t / 10.0f);
+            const float y = surfaceY + 900.0f * std::sin(t * 0.4f);
+            return {x, y};
+        }
+
+        void runChunkStreaming(const ScenarioOptions &options, ScenarioRecorder &recorder)
+        {
+            constexpr int kViewDistance = 3;
+            HeadlessEngine engine;
+            engine::core::Context &ctx = engine.context();
+
+            engine::physics::PhysicsManager physics;
+            physics.init({0.0f, 10.0f}, &ctx.getJobSystem());
+
+            engine::world::WorldConfig config;
+            config.loadFromFile("assets/world_config.json");
+            config.seed = options.seed;
+            const glm::ivec2 tileSize(engine::world::WorldConfig::TILE_SIZE);
+            const float surfaceY = static_cast<float>(config.seaLevel * tileSize.y);
+
+            engine::world::ChunkManager chunks(kTileAtlas, tileSize, &engine.resources(), &physics);
+            chunks.setTerrainGenerator(std::make_unique<engine::world::PerlinNoiseGenerator>(config));
+
+            Lcg rng{options.seed};
+            const glm::vec2 viewport = engine.camera().getViewportSize();
+            runFrames(options, recorder, [&](int frame) {
+                const glm::vec2 focus = cameraPathAt(static_cast<float>(frame) * kDt, surfaceY);
+                engine.camera().setPosition(focus - viewport * 0.5f);
+
+                recorder.measure("textures", [&] { engine.beginFrame(); });
+                recorder.measure("visible", [&] { chunks.updateVisibleChunks(focus, kViewDistance); });
+                recorder.measure("streaming", [&] { chunks.updateStreaming(); });
+                // 每半秒在视野中心附近挖一个 5x5 的坑：碰撞按行立即更新，网格进入脏队列
+                if (frame % 30 == 0)
+                {
+                    recorder.measure("edit", [&] {
+                        const glm::ivec2 center = chunks.worldToTile(focus) + glm::ivec2(rng.range(-20, 20), rng.range(-10, 10));
+                        for (int dy = -2; dy <= 2; ++dy)
+                            for (int dx = -2; dx <= 2; ++dx)
+                                chunks.setTile(center.x + dx, center.y + dy, engine::world::TileData(engine::world::TileType::Air));
+                    });
+                }
+                recorder.measure("rebuild", [&] { chunks.rebuildDirtyChunks(1.0f); });
+                recorder.measure("physics", [&] { physics.advance(kDt); });
+                recorder.measure("render", [&] {
+                    chunks.renderAll(ctx);
+                    engine.endFrame();
+                });
+            });
+
+            const engine::world::ChunkStreamStats stream = chunks.getStreamStats();
+            recorder.setCounter("loadedChunks", static_cast<double>(chunks.loadedChunkCount()));
+            recorder.setCounter("pendingChunks", static_cast<double>(chunks.pendingChunkLoadCount()));
+            recorder.setCounter("streamedChunks", static_cast<double>(stream.finishedTotal));
+            recorder.setCounter("cancelledChunks", static_cast<double>(stream.cancelledTotal));
+            recorder.setCounter("generateAvgMs", stream.generateAvgMs);
+            recorder.setCounter("meshAvgMs", stream.meshAvgMs);
+            recorder.setCounter("uploadAvgMs", stream.uploadAvgMs);
+            recorder.setCounter("uploadedMB", static_cast<double>(engine.renderer().getUploadedBytes()) / (1024.0 * 1024.0));
+            recorder.setCounter("drawCalls", engine.renderer().getRenderStats().drawCalls);
+        }
+
+        // ── monster_crowd ──
+
+        void runMonsterCrowd(const ScenarioOptions &options, ScenarioRecorder &recorder)
+        {
+            // 与 GameScene 一致：地面走廊固定在一行区块上，2.5D 无重力
+            constexpr float kGroundRowY = 80.0f;
+            HeadlessEngine engine;
+            engine::core::Context &ctx = engine.context();
+
+            engine::physics::PhysicsManager physics;
+            physics.init({0.0f, 0.0f}, &ctx.getJobSystem());
+            physics.setSubStepCount(2);
+
+            engine::world::ChunkManager chunks(kTileAtlas, glm::ivec2(engine::world::WorldConfig::TILE_SIZE),
+                                               &engine.resources(), nullptr);
+            chunks.setHorizontalOnly(true, kGroundRowY);
+            chunks.updateVisibleChunks({0.0f, kGroundRowY}, 3);
+
+            engine::actor::ActorManager actors(ctx);
+            engine::object::GameObject *player = actors.createActor("player");
+            auto *playerTransform = player->addComponent<engine::component::TransformComponent>(glm::vec2{0.0f, kGroundRowY});
+
+            game::monster::MonsterManager monsters(ctx, actors, physics, chunks, player);
+            const int crowd = scaled(200, options.scale);
+            monsters.setMaxMonsters(static_cast<size_t>(crowd));
+            const int spawned = monsters.spawnBatch(crowd);
+
+            const glm::vec2 viewport = engine.camera().getViewportSize();
+            runFrames(options, recorder, [&](int frame) {
+                // 玩家在 ±360px 内往返，怪物持续追击、转向与分离
+                const float t = static_cast<float>(frame) * kDt;
+                const glm::vec2 playerPos{360.0f * std::sin(t * 0.6f), kGroundRowY + 24.0f * std::sin(t * 1.7f)};
+                playerTransform->setPosition(playerPos);
+                engine.camera().setPosition(playerPos - viewport * 0.5f);
+
+                recorder.measure("textures", [&] { engine.beginFrame(); });
+                recorder.measure("monsters", [&] { monsters.update(kDt); });
+                recorder.measure("actors", [&] { actors.update(kDt); });
+                recorder.measure("physics", [&] { physics.advance(kDt); });
+                recorder.measure("render", [&] {
+                    ctx.getSpriteRenderSystem().renderAll(ctx);
+                    actors.render();
+                    engine.endFrame();
+                });
+            });
+
+            recorder.setCounter("spawned", spawned);
+            recorder.setCounter("aliveMonsters", static_cast<double>(monsters.monsterCount()));
+            recorder.setCounter("actors", static_cast<double>(actors.actorCount()));
+            recorder.setCounter("spriteQuads", engine.renderer().getRenderStats().quads);
+        }
+
+        // ── physics_stress ──
+
+        void runPhysicsStress(const ScenarioOptions &options, ScenarioRecorder &recorder)
+        {
+            engine::core::JobSystem jobs;
+            engine::physics::PhysicsManager physics;
+            physics.init({0.0f, 10.0f}, &jobs);
+            // 关闭休眠，保证测量期间所有物体都参与求解（与 --physics-stress 相同）
+            b2World_EnableSleeping(physics.getWorldId(), false);
+            const int bodies = scaled(3000, options.scale);
+            engine::physics::buildStressScene(physics, bodies);
+
+            runFrames(options, recorder, [&](int) {
+                recorder.measure("step", [&] { physics.update(kDt, 4); });
+            });
+
+            recorder.setCounter("bodies", bodies);
+            recorder.setCounter("awakeBodies", b2World_GetAwakeBodyCount(physics.getWorldId()));
+            recorder.setCounter("solverWorkers", physics.getSolverWorkerCount());
+        }
+
+        // ── state_machine ──
+
+        void runStateMachine(const ScenarioOptions &options, ScenarioRecorder &recorder)
+        {
+            using namespace engine::statemachine;
+            const std::string path = "assets/textures/Actors/GhostSwordsman.sm.json";
+            const std::shared_ptr<const CompiledStateMachine> machine = SmLoader::loadCompiled(path);
+            if (!machine)
+            {
+                recorder.setCounter("loadFailed", 1);
+                return;
+            }
+
+            const int count = scaled(1000, options.scale);
+            std::vector<StateController> controllers(static_cast<size_t>(count));
+            std::vector<Lcg> inputs(static_cast<size_t>(count));
+            for (int i = 0; i < count; ++i)
+            {
+                controllers[static_cast<size_t>(i)].init(machine);
+                inputs[static_cast<size_t>(i)].state = options.seed ^ (0x9E3779B9u * static_cast<uint32_t>(i + 1));
+            }
+
+            // 与 GameScene::tickPlayerSM 相同的触发器；状态机未引用的名称解析为无效 ID，置位无效果
+            const StateController &probe = controllers.front();
+            const TriggerId grounded = probe.triggerId("GROUNDED"), airborne = probe.triggerId("AIRBORNE"),
+                            moveL = probe.triggerId("KEY_MOVE_L"), moveR = probe.triggerId("KEY_MOVE_R"),
+                            noInput = probe.triggerId("NO_INPUT"), moving = probe.triggerId("IS_MOVING"),
+                            land = probe.triggerId("LAND"), attack = probe.triggerId("KEY_ATTACK"),
+                            jump = probe.triggerId("KEY_JUMP"), dash = probe.triggerId("KEY_DASH"),
+                            skill = probe.triggerId("KEY_SKILL_1");
+
+            std::vector<TriggerMask> masks(static_cast<size_t>(count));
+            double events = 0.0;
+            float time = 0.0f;
+            runFrames(options, recorder, [&](int) {
+                time += kDt;
+                recorder.measure("input", [&] {
+                    for (int i = 0; i < count; ++i)
+                    {
+                        Lcg &rng = inputs[static_cast<size_t>(i)];
+                        StateController &sm = controllers[static_cast<size_t>(i)];
+                        TriggerMask &mask = masks[static_cast<size_t>(i)];
+                        mask.clear();
+                        const uint32_t r = rng.next();
+                        const bool airborneNow = (r >> 20) % 11 == 0;
+                        mask.set(airborneNow ? airborne : grounded);
+                        if (!airborneNow && (r >> 18) % 7 == 0)
+                            mask.set(land);
+                        const uint32_t move = (r >> 4) & 3;
+                        if (move == 1) mask.set(moveL);
+                        if (move == 2) mask.set(moveR);
+                        mask.set(move == 1 || move == 2 ? moving : noInput);
+                        if ((r >> 8) % 9 == 0)   sm.pushInput(attack, time);
+                        if ((r >> 12) % 53 == 0) sm.pushInput(jump, time);
+                        if ((r >> 14) % 97 == 0) sm.pushInput(dash, time);
+                        if ((r >> 16) % 131 == 0) sm.pushInput(skill, time);
+                    }
+                });
+                recorder.measure("tick", [&] {
+                    for (int i = 0; i < count; ++i)
+                    {
+                        const TickResult &result = controllers[static_cast<size_t>(i)].tick(kDt, masks[static_cast<size_t>(i)], time);
+                        if (recorder.isMeasuring())
+                            events += static_cast<double>(result.firedEvents.size());
+                    }
+                });
+            });
+
+            recorder.setCounter("controllers", count);
+            recorder.setCounter("states", static_cast<double>(machine->states.size()));
+            recorder.setCounter("frameEvents", events);
+        }
+
+        // ── voxel_meshing ──
+
+        // VoxelScene 的区块规格与 Plains 地形公式（与 voxel_mesh_bench 相同）
+        constexpr int kVoxelY = 24;
+        constexpr int kVoxelXZ = 16;
+        constexpr int kVoxelGrid = 9;
+
+        struct VoxelWorld
+        {
+            std::vector<uint8_t> voxels; // 整个网格，x + y * W + z * W * Y
+
+            static constexpr int width() { return kVoxelGrid * kVoxelXZ; }
+
+            void generate()
+            {
+                voxels.assign(static_cast<size_t>(width() * kVoxelY * width()), 0);
+                for (int z = 0; z < width(); ++z)
+                {
+                    for (int x = 0; x < width(); ++x)
+                    {
+                        const float wx = static_cast<float>(x);
+                        const float wz = static_cast<float>(z);
+                        const float macroWave = std::sin(wx * 0.021f) * 5.8f + std::cos(wz * 0.018f) * 4.9f
+                                              + std::sin((wx + wz) * 0.010f) * 2.8f;
+                        const float ridgeWave = std::sin(wx * 0.006f + wz * 0.004f) * 7.0f;
+                        const int height = std::clamp(8 + static_cast<int>((macroWave + ridgeWave) * 0.45f), 4, kVoxelY - 3);
+                        for (int y = 0; y <= height; ++y)
+                            set(x, y, z, y == height ? 1 : (y >= height - 2 ? 2 : 3));
+                    }
+                }
+            }
+
+            uint8_t at(int x, int y, int z) const
+            {
+                if (x < 0 || x >= width() || y < 0 || y >= kVoxelY || z < 0 || z >= width())
+                    return 0;
+                return voxels[static_cast<size_t>(x + y * width() + z * width() * kVoxelY)];
+            }
+            void set(int x, int y, int z, uint8_t value) { voxels[static_cast<size_t>(x + y * width() + z * width() * kVoxelY)] = value; }
+
+            // 主线程边界拷贝：区块体素 + 四周一圈邻块
+            void copyPadded(int chunkX, int chunkZ, game::scene::VoxelPaddedChunk &out) const
+            {
+                out.reset(kVoxelXZ, kVoxelY, kVoxelXZ);
+                const int ox = chunkX * kVoxelXZ;
+                const int oz = chunkZ * kVoxelXZ;
+                for (int z = -1; z <= kVoxelXZ; ++z)
+                    for (int y = 0; y < kVoxelY; ++y)
+                        for (int x = -1; x <= kVoxelXZ; ++x)
+                            out.set(x, y, z, at(ox + x, y, oz + z));
+            }
+        };
+
+        void runVoxelMeshing(const ScenarioOptions &options, ScenarioRecorder &recorder)
+        {
+            VoxelWorld world;
+            world.generate();
+            constexpr int kChunks = kVoxelGrid * kVoxelGrid;
+            std::vector<std::vector<game::scene::VoxelPackedVertex>> meshes(kChunks);
+            std::vector<uint8_t> dirty(kChunks, 1);
+            game::scene::VoxelPaddedChunk padded;
+            Lcg rng{options.seed};
+            const int streamPerFrame = scaled(4, options.scale);
+            int streamCursor = 0;
+
+            const auto markDirty = [&](int chunkX, int chunkZ) {
+                if (chunkX >= 0 && chunkX < kVoxelGrid && chunkZ >= 0 && chunkZ < kVoxelGrid)
+                    dirty[static_cast<size_t>(chunkX + chunkZ * kVoxelGrid)] = 1;
+            };
+
+            runFrames(options, recorder, [&](int) {
+                // 每帧挖掉一处 3x3 地表，落在区块边缘时连带邻块重建
+                recorder.measure("edit", [&] {
+                    const int x = rng.range(1, VoxelWorld::width() - 2);
+                    const int z = rng.range(1, VoxelWorld::width() - 2);
+                    for (int dz = -1; dz <= 1; ++dz)
+                        for (int dx = -1; dx <= 1; ++dx)
+                            for (int y = kVoxelY - 1; y > 0; --y)
+                                if (world.at(x + dx, y, z + dz))
+                                {
+                                    world.set(x + dx, y, z + dz, 0);
+                                    markDirty((x + dx) / kVoxelXZ, (z + dz) / kVoxelXZ);
+                                    markDirty((x + dx + 1) / kVoxelXZ, (z + dz) / kVoxelXZ);
+                                    markDirty((x + dx - 1) / kVoxelXZ, (z + dz) / kVoxelXZ);
+                                    markDirty((x + dx) / kVoxelXZ, (z + dz + 1) / kVoxelXZ);
+                                    markDirty((x + dx) / kVoxelXZ, (z + dz - 1) / kVoxelXZ);
+                                    break;
+                                }
+                });
+                // 另按轮转重建若干区块，模拟相机移动时的流送网格
+                for (int i = 0; i < streamPerFrame; ++i)
+                {
+                    dirty[static_cast<size_t>(streamCursor)] = 1;
+                    streamCursor = (streamCursor + 1) % kChunks;
+                }
+
+                for (int index = 0; index < kChunks; ++index)
+                {
+                    if (!dirty[static_cast<size_t>(index)])
+                        continue;
+                    dirty[static_cast<size_t>(index)] = 0;
+                    recorder.measure("pad", [&] { world.copyPadded(index % kVoxelGrid, index / kVoxelGrid, padded); });
+                    recorder.measure("mesh", [&] { game::scene::VoxelMesher::build(padded, meshes[static_cast<size_t>(index)]); });
+                }
+            });
+
+            size_t vertices = 0;
+            for (const auto &mesh : meshes)
+                vertices += mesh.size();
+            recorder.setCounter("chunks", kChunks);
+            recorder.setCounter("remeshPerFrame", streamPerFrame);
+            recorder.setCounter("vertices", static_cast<double>(vertices));
+        }
+    }
+
+    const std::vector<ScenarioInfo> &allScenarios()
+    {
+        static const std::vector<ScenarioInfo> scenarios = {
+            {"chunk_streaming", "terrain streaming along a scripted camera path", runChunkStreaming, 1800, 60},
+            {"monster_crowd", "MonsterManager crowd chasing a moving player", runMonsterCrowd, 1200, 120},
+            {"physics_stress", "stacked dynamic boxes, fixed step", runPhysicsStress, 600, 120},
+            {"state_machine", "StateController ticks on the shipped state machine", runStateMachine, 1200, 60},
+            {"voxel_meshing", "voxel chunk edits and greedy remeshing", runVoxelMeshing, 600, 30},
+        };
+        return scenarios;
+    }
+} // namespace bench
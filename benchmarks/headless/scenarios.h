@@ -0,0 +1,36 @@
+// headless 基准场景
+// scenarios.h
+//   - chunk_streaming：沿脚本化相机路径流送地形区块（生成 / 网格 / 碰撞 / 集成），定期挖坑触发脏区块重建
+//   - monster_crowd：MonsterManager 一次生成整群怪物，玩家来回移动，测 AI / 组件 / 物理 / 精灵提交
+//   - physics_stress：与 --physics-stress 相同的堆叠场景，固定步长求解
+//   - state_machine：大量 StateController 共享游戏内状态机，按确定性伪随机输入 tick
+//   - voxel_meshing：VoxelScene 规格的体素区块，每帧挖掘并重建若干区块网格
+// 所有场景固定 dt、固定种子；只有计时结果随机器浮动
+#pragma once
+#include "bench_report.h"
+#include <cstdint>
+#include <vector>
+
+namespace bench
+{
+    struct ScenarioOptions
+    {
+        int frames = 0;        // 测量帧数，0 = 场景默认值
+        int warmupFrames = -1; // 预热帧数，< 0 = 场景默认值
+        uint32_t seed = 1337;
+        float scale = 1.0f;    // 规模系数：怪物数、刚体数、控制器数、每帧重建区块数按此缩放
+    };
+
+    using ScenarioFn = void (*)(const ScenarioOptions &options, ScenarioRecorder &recorder);
+
+    struct ScenarioInfo
+    {
+        const char *name;
+        const char *description;
+        ScenarioFn run;
+        int defaultFrames;
+        int defaultWarmupFrames;
+    };
+
+    const std::vector<ScenarioInfo> &allScenarios();
+} // namespace bench
@@ -0,0 +1,251 @@
+// monster_query_bench.cpp
+// 怪物空间查询基准：旧版逐对 / 逐个线性扫描 vs SpatialGrid 均匀网格
+//
+// 模拟 MonsterManager 每帧的查询负载（怪物在 DNF 式地面带上以恒定密度分布并游走）：
+//   - 分离计数：每只怪物统计 2.5D 距离 260 内的同伴（旧版 O(n²)）
+//   - 投射物爆炸：n/10 个（至少 16 个）半径 40 的 blast 查询
+//   - 近战挥砍：8 次 slash（射程 80，深度 ±72，朝向过滤）
+//   - 锁定目标：8 次 findNearestMonster（2.5D 距离 180）
+// 只计数不移除，两种实现跑同样的数据，核对计数与最近距离一致。
+// 用法：monster_query_bench [frames] [monsterCounts...]   默认 120 帧，100 / 1000 / 5000
+#include "../src/engine/utils/spatial_grid.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+    constexpr float kDepthWeight = 0.42f;
+    constexpr float kAllyRadius = 260.0f;
+    constexpr float kGridCellSize = 256.0f;
+    constexpr float kBandMinY = 16.0f;
+    constexpr float kBandMaxY = 96.0f;
+    constexpr float kSpacingX = 16.0f; // 每只怪物平均占用的地面宽度（像素）
+
+    float distance2p5d(const glm::vec2 &a, const glm::vec2 &b)
+    {
+        const glm::vec2 d = a - b;
+        return std::sqrt(d.x * d.x + d.y * d.y * kDepthWeight * kDepthWeight);
+    }
+
+    struct Rng
+    {
+        uint32_t state;
+        float next()
+        {
+            state = state * 1664525u + 1013904223u;
+            return static_cast<float>(state >> 8) / 16777216.0f;
+        }
+    };
+
+    struct Query
+    {
+        enum Kind { Blast, Slash, Nearest } kind;
+        glm::vec2 pos;
+        float facing;
+    };
+
+    struct Frame
+    {
+        std::vector<glm::vec2> positions;
+        std::vector<Query> queries;
+    };
+
+    // 预生成全部帧的位置与查询，计时只覆盖查询本身
+    std::vector<Frame> makeFrames(int count, int frames)
+    {
+        const float width = count * kSpacingX;
+        Rng rng{0xC0FFEEu + static_cast<uint32_t>(count)};
+        std::vector<glm::vec2> pos(count), vel(count);
+        for (int i = 0; i < count; ++i)
+        {
+            pos[i] = {rng.next() * width, kBandMinY + rng.next() * (kBandMaxY - kBandMinY)};
+            vel[i] = {(rng.next() - 0.5f) * 8.0f, (rng.next() - 0.5f) * 2.0f};
+        }
+
+        const int blasts = std::max(16, count / 10);
+        std::vector<Frame> out(frames);
+        for (Frame &frame : out)
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                pos[i] += vel[i];
+                if (pos[i].x < 0.0f || pos[i].x > width) vel[i].x = -vel[i].x;
+                if (pos[i].y < kBandMinY || pos[i].y > kBandMaxY) vel[i].y = -vel[i].y;
+            }
+            frame.positions = pos;
+            auto randomPoint = [&] {
+                return glm::vec2{rng.next() * width, kBandMinY + rng.next() * (kBandMaxY - kBandMinY)};
+            };
+            for (int i = 0; i < blasts; ++i)
+                frame.queries.push_back({Query::Blast, randomPoint(), 1.0f});
+            for (int i = 0; i < 8; ++i)
+                frame.queries.push_back({Query::Slash, randomPoint(), rng.next() < 0.5f ? -1.0f : 1.0f});
+            for (int i = 0; i < 8; ++i)
+                frame.queries.push_back({Query::Nearest, randomPoint(), 1.0f});
+        }
+        return out;
+    }
+
+    struct Result
+    {
+        double msPerFrame = 0.0;
+        long long allies = 0;
+        long long hits = 0;
+        double nearest = 0.0;
+    };
+
+    constexpr float kBlastRadius = 40.0f;
+    constexpr float kSlashRange = 80.0f;
+    constexpr float kSlashHalfHeight = 72.0f;
+    constexpr float kNearestMax = 180.0f;
+
+    bool slashHit(const glm::vec2 &delta, float facing)
+    {
+        return glm::dot(delta, delta) <= kSlashRange * kSlashRange && delta.x * facing >= -18.0f &&
+               std::abs(delta.y) <= kSlashHalfHeight;
+    }
+
+    // ── 旧版：逐行复刻 MonsterManager 的线性扫描 ──
+    Result runLegacy(const std::vector<Frame> &frames)
+    {
+        Result result;
+        const auto start = std::chrono::steady_clock::now();
+        for (const Frame &frame : frames)
+        {
+            const auto &p = frame.positions;
+            const size_t n = p.size();
+            for (size_t i = 0; i < n; ++i)
+            {
+                int nearbyAllies = 0;
+                for (size_t j = 0; j < n; ++j)
+                {
+                    if (j == i)
+                        continue;
+                    if (distance2p5d(p[j], p[i]) <= kAllyRadius)
+                        ++nearbyAllies;
+                }
+                result.allies += nearbyAllies;
+            }
+
+            for (const Query &q : frame.queries)
+            {
+                if (q.kind == Query::Nearest)
+                {
+                    float bestDistanceSq = kNearestMax * kNearestMax;
+                    bool found = false;
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        const float d = distance2p5d(p[i], q.pos);
+                        if (d * d <= bestDistanceSq)
+                        {
+                            bestDistanceSq = d * d;
+                            found = true;
+                        }
+                    }
+                    if (found)
+                        result.nearest += std::sqrt(bestDistanceSq);
+                    continue;
+                }
+                for (size_t i = 0; i < n; ++i)
+                {
+                    const glm::vec2 delta = p[i] - q.pos;
+                    if (q.kind == Query::Blast ? glm::dot(delta, delta) <= kBlastRadius * kBlastRadius
+                                               : slashHit(delta, q.facing))
+                        ++result.hits;
+                }
+            }
+        }
+        result.msPerFrame = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() /
+                            frames.size();
+        return result;
+    }
+
+    // ── 网格：每帧 clear/insert/build 一次，查询走候选 + 精确判定 ──
+    Result runGrid(const std::vector<Frame> &frames)
+    {
+        engine::utils::SpatialGrid<int> grid({kGridCellSize, kGridCellSize / kDepthWeight});
+        std::vector<int> nearest;
+        Result result;
+        const auto start = std::chrono::steady_clock::now();
+        for (const Frame &frame : frames)
+        {
+            const auto &p = frame.positions;
+            const int n = static_cast<int>(p.size());
+            grid.clear();
+            for (int i = 0; i < n; ++i)
+                grid.insert(i, p[i]);
+            grid.build();
+
+            const glm::vec2 allyExtent{kAllyRadius, kAllyRadius / kDepthWeight};
+            for (int i = 0; i < n; ++i)
+            {
+                int nearbyAllies = 0;
+                grid.queryRect(p[i] - allyExtent, p[i] + allyExtent, [&](int other, const glm::vec2 &otherPos) {
+                    if (other != i && distance2p5d(otherPos, p[i]) <= kAllyRadius)
+                        ++nearbyAllies;
+                });
+                result.allies += nearbyAllies;
+            }
+
+            for (const Query &q : frame.queries)
+            {
+                switch (q.kind)
+                {
+                case Query::Nearest:
+                    if (grid.queryNearest(q.pos, 1, kNearestMax, kDepthWeight, nearest, [](int) { return true; }))
+                    {
+                        const float d = distance2p5d(p[nearest[0]], q.pos);
+                        result.nearest += std::sqrt(d * d);
+                    }
+                    break;
+                case Query::Blast:
+                    grid.queryRadius(q.pos, kBlastRadius, [&](int, const glm::vec2 &) { ++result.hits; });
+                    break;
+                case Query::Slash:
+                {
+                    const glm::vec2 extent{kSlashRange, std::min(kSlashRange, kSlashHalfHeight)};
+                    grid.queryRect(q.pos - extent, q.pos + extent, [&](int, const glm::vec2 &pos) {
+                        if (slashHit(pos - q.pos, q.facing))
+                            ++result.hits;
+                    });
+                    break;
+                }
+                }
+            }
+        }
+        result.msPerFrame = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() /
+                            frames.size();
+        return result;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const int frames = argc > 1 ? std::max(1, std::atoi(argv[1])) : 120;
+    std::vector<int> counts;
+    for (int i = 2; i < argc; ++i)
+        counts.push_back(std::max(1, std::atoi(argv[i])));
+    if (counts.empty())
+        counts = {100, 1000, 5000};
+
+    bool ok = true;
+    std::printf("monster spatial queries, %d frames (separation + blasts + 8 slashes + 8 nearest)\n", frames);
+    std::printf("  %8s %14s %14s %9s  %s\n", "monsters", "linear ms/f", "grid ms/f", "speedup", "allies / hits");
+    for (int count : counts)
+    {
+        const std::vector<Frame> data = makeFrames(count, frames);
+        const Result legacy = runLegacy(data);
+        const Result grid = runGrid(data);
+        const bool same = legacy.allies == grid.allies && legacy.hits == grid.hits &&
+                          std::abs(legacy.nearest - grid.nearest) <= 1e-3 * std::max(1.0, legacy.nearest);
+        ok = ok && same;
+        std::printf("  %8d %14.3f %14.3f %8.1fx  %lld / %lld%s\n", count, legacy.msPerFrame, grid.msPerFrame,
+                    legacy.msPerFrame / grid.msPerFrame, legacy.allies, legacy.hits, same ? "" : "  MISMATCH");
+    }
+    return ok ? 0 : 1;
+}
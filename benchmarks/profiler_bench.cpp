@@ -0,0 +1,91 @@
+// profiler_bench.cpp
+// 剖析器开销基准：未开启采集 / 开启采集时每个 LSL_PROFILE_ZONE 的耗时，以及多线程同时记录时的吞吐
+//
+// 未开启时区段只有一次 relaxed 原子读，应在 1~2ns 量级；开启时主要成本是两次单调时钟读取。
+// 最后导出一次 Chrome trace，确认输出可被 JSON 解析器读取。
+// 用法：profiler_bench [zones] [threads] [tracePath]
+#include "../src/engine/core/profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using engine::core::Profiler;
+
+    // 防止编译器把空区段整体消掉
+    volatile int g_sink = 0;
+
+    double zoneNs(int zones)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < zones; ++i)
+        {
+            LSL_PROFILE_ZONE("bench");
+            g_sink = g_sink + 1;
+        }
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / zones;
+    }
+
+    void nested(int depth)
+    {
+        LSL_PROFILE_ZONE("nested");
+        std::vector<int> scratch(16); // 每层一次分配，验证区段分配计数
+        g_sink = g_sink + static_cast<int>(scratch.size());
+        if (depth > 0)
+            nested(depth - 1);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const int zones = argc > 1 ? std::max(1000, std::atoi(argv[1])) : 10000000;
+    const int threads = argc > 2 ? std::max(1, std::atoi(argv[2])) : 4;
+    const std::string tracePath = argc > 3 ? argv[3] : "profiler_bench_trace.json";
+
+    LSL_PROFILE_THREAD("bench main");
+    const double disabledNs = zoneNs(zones);
+
+    Profiler::setEnabled(true);
+    const double enabledNs = zoneNs(zones);
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([zones, threads] {
+            LSL_PROFILE_THREAD("bench worker");
+            for (int i = 0; i < zones / threads / 8; ++i)
+                nested(7);
+        });
+    }
+    for (int frame = 0; frame < 60; ++frame)
+    {
+        LSL_PROFILE_FRAME();
+        nested(3);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    LSL_PROFILE_FRAME();
+    for (auto &worker : workers)
+        worker.join();
+    const double threadedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    const auto frames = Profiler::frames();
+    const bool exported = Profiler::exportChromeTrace(tracePath);
+    const auto stats = Profiler::getStats();
+
+    std::printf("profiler zone overhead, %d zones\n", zones);
+    std::printf("  %-22s %8.2f ns / zone\n", "disabled", disabledNs);
+    std::printf("  %-22s %8.2f ns / zone\n", "enabled", enabledNs);
+    std::printf("  %d threads x %d nested zones: %.1f ms, %llu events recorded, %zu frames\n", threads, zones / threads,
+                threadedMs, static_cast<unsigned long long>(stats.events), frames.size());
+    if (!frames.empty())
+        std::printf("  last frame allocations: %llu (%llu bytes)\n", static_cast<unsigned long long>(frames.back().allocs),
+                    static_cast<unsigned long long>(frames.back().allocBytes));
+    std::printf("  trace: %s %s\n", tracePath.c_str(), exported ? "written" : "FAILED");
+    return exported ? 0 : 1;
+}
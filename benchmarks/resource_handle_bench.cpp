@@ -0,0 +1,103 @@
+// resource_handle_bench.cpp
+// 纹理查询基准：旧版按路径哈希的 unordered_map vs 驻留句柄的槽位数组
+//
+// 模拟每帧的精灵热路径（与 SpriteComponent::draw + 渲染器 drawSprite 的查询模式一致）：
+//   每个精灵先取一次纹理尺寸算 UV，再取一次 GL 纹理，共两次查询
+// 路径取自真实资源目录的长度分布（assets/textures/... 约 40~60 字节），两种实现核对结果一致。
+// 用法：resource_handle_bench [spriteCount] [textureCount] [frames]
+#include "../src/engine/resource/resource_handle.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    using engine::resource::TextureHandle;
+    using engine::resource::TextureRegistry;
+
+    // 与 TextureResource 同样关心的字段
+    struct BenchTexture
+    {
+        unsigned int gl_tex = 0;
+        float w = 0.0f, h = 0.0f;
+    };
+
+    struct Result
+    {
+        double msPerFrame = 0.0;
+        double checksum = 0.0;
+    };
+
+    template <typename Lookup>
+    Result run(int frames, size_t spriteCount, Lookup &&lookup)
+    {
+        Result result;
+        const auto start = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < frames; ++frame)
+        {
+            for (size_t i = 0; i < spriteCount; ++i)
+            {
+                const BenchTexture &sized = lookup(i);
+                const float u = 16.0f / sized.w;
+                const BenchTexture &bound = lookup(i);
+                result.checksum += u + static_cast<double>(bound.gl_tex);
+            }
+        }
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        result.msPerFrame = ms / frames;
+        return result;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const size_t sprites = argc > 1 ? static_cast<size_t>(std::max(1, std::atoi(argv[1]))) : 4000;
+    const size_t textures = argc > 2 ? static_cast<size_t>(std::max(1, std::atoi(argv[2]))) : 200;
+    const int frames = argc > 3 ? std::max(1, std::atoi(argv[3])) : 600;
+
+    std::vector<std::string> paths;
+    paths.reserve(textures);
+    for (size_t i = 0; i < textures; ++i)
+        paths.push_back("assets/textures/Actors/generated_sprite_sheet_" + std::to_string(i) + ".png");
+
+    // 旧版：TextureManager::_cache
+    std::unordered_map<std::string, BenchTexture> legacyCache;
+    // 新版：驻留表 + 槽位数组
+    std::vector<BenchTexture> slots;
+    for (size_t i = 0; i < textures; ++i)
+    {
+        const BenchTexture tex{static_cast<unsigned int>(i + 1), 32.0f + static_cast<float>(i % 7) * 16.0f, 64.0f};
+        legacyCache[paths[i]] = tex;
+        const TextureHandle handle = TextureRegistry::shared().acquire(paths[i]);
+        if (handle.index() >= slots.size())
+            slots.resize(handle.index() + 1);
+        slots[handle.index()] = tex;
+    }
+
+    // 精灵各自持有路径（旧版 Sprite::_texture_id）与加载期取得的句柄
+    std::vector<std::string> spritePaths(sprites);
+    std::vector<TextureHandle> spriteHandles(sprites);
+    for (size_t i = 0; i < sprites; ++i)
+    {
+        spritePaths[i] = paths[(i * 7919) % textures];
+        spriteHandles[i] = TextureRegistry::shared().acquire(spritePaths[i]);
+    }
+
+    const Result legacy = run(frames, sprites, [&](size_t i) -> const BenchTexture & {
+        return legacyCache.find(spritePaths[i])->second;
+    });
+    const Result handle = run(frames, sprites, [&](size_t i) -> const BenchTexture & {
+        return slots[spriteHandles[i].index()];
+    });
+
+    std::printf("texture lookup, %zu sprites x %zu textures x %d frames (2 lookups / sprite)\n", sprites, textures, frames);
+    std::printf("  %-26s %8.4f ms/frame\n", "legacy string hash map", legacy.msPerFrame);
+    std::printf("  %-26s %8.4f ms/frame  x%.2f\n", "interned handle slots", handle.msPerFrame, legacy.msPerFrame / handle.msPerFrame);
+    const bool ok = legacy.checksum == handle.checksum;
+    std::printf("  checksum: %.3f / %.3f%s\n", legacy.checksum, handle.checksum, ok ? "" : "  MISMATCH");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,615 @@
+// state_machine_bench.cpp
+// 状态机基准：旧版字符串 StateController vs 编译为整数 ID 的 StateController
+//
+// 1000 个控制器共享同一份 8 状态攻击连段状态机（含连招窗口、帧事件、根位移、2 个自定义条件），
+// 每帧按 GameScene::tickPlayerSM 的方式构建输入：
+//   - 旧版：vector<string> activeInputs + 字符串 pushInput + std::function 条件，逐行复刻改造前实现
+//   - 兼容：新版 update(dt, vector<string>, time)，名称在入口处转换为 ID
+//   - 编译：TriggerMask + tick()，触发器 ID 加载时解析一次，条件为函数指针
+// 三种实现输入序列相同，核对最终状态、帧事件数和根位移总和一致。
+// 用法：state_machine_bench [controllers] [frames]
+#include "../src/engine/statemachine/sm_loader.h"
+#include "../src/engine/statemachine/state_controller.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    using namespace engine::statemachine;
+
+    // ── 旧版 InputBuffer / StateController（逐行复刻字符串实现） ──
+    class LegacyInputBuffer
+    {
+    public:
+        float windowSeconds = 0.20f;
+
+        void push(const std::string &action, float currentTime)
+        {
+            if (!m_buffer.empty())
+            {
+                auto &back = m_buffer.back();
+                if (back.action == action && (currentTime - back.timestamp) < 0.016f)
+                    return;
+            }
+            m_buffer.push_back({action, currentTime, false});
+        }
+
+        void update(float currentTime)
+        {
+            float cutoff = currentTime - windowSeconds;
+            while (!m_buffer.empty())
+            {
+                auto &front = m_buffer.front();
+                if (front.consumed || front.timestamp < cutoff)
+                    m_buffer.pop_front();
+                else
+                    break;
+            }
+        }
+
+        bool consume(const std::string &action, float currentTime)
+        {
+            float cutoff = currentTime - windowSeconds;
+            for (auto &e : m_buffer)
+            {
+                if (!e.consumed && e.timestamp >= cutoff && e.action == action)
+                {
+                    e.consumed = true;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool has(const std::string &action, float currentTime) const
+        {
+            float cutoff = currentTime - windowSeconds;
+            for (const auto &e : m_buffer)
+            {
+                if (!e.consumed && e.timestamp >= cutoff && e.action == action)
+                    return true;
+            }
+            return false;
+        }
+
+    private:
+        struct Entry
+        {
+            std::string action;
+            float timestamp = 0.0f;
+            bool consumed = false;
+        };
+        std::deque<Entry> m_buffer;
+    };
+
+    class LegacyStateController
+    {
+    public:
+        using ConditionFn = std::function<bool(const LegacyStateController &)>;
+
+        void init(const StateMachineData *data)
+        {
+            m_data = data;
+            m_currentStateName.clear();
+            m_currentState = nullptr;
+            m_stateTime = 0.0f;
+            m_currentFrame = 0;
+            m_lastEventFrame = -1;
+            if (data && !data->initialState.empty())
+            {
+                UpdateResult dummy;
+                doTransition(data->initialState, dummy);
+            }
+        }
+
+        void registerCondition(const std::string &name, ConditionFn fn) { m_conditions[name] = std::move(fn); }
+        void pushInput(const std::string &action, float time) { m_inputBuffer.push(action, time); }
+        const std::string &getCurrentState() const { return m_currentStateName; }
+
+        UpdateResult update(float dt, const std::vector<std::string> &activeInputs, float time)
+        {
+            UpdateResult result;
+            if (!m_data || !m_currentState)
+            {
+                result.currentState = m_currentStateName;
+                return result;
+            }
+            m_inputBuffer.update(time);
+
+            std::vector<std::string> injectInputs;
+            for (const auto &[name, fn] : m_conditions)
+            {
+                if (fn && fn(*this))
+                    injectInputs.push_back(name);
+            }
+
+            m_stateTime += dt;
+            int totalFrames = std::max(1, m_currentState->totalFrames);
+            float animDuration = totalFrames * m_frameDuration;
+            int prevFrame = m_currentFrame;
+            int newFrame = static_cast<int>(m_stateTime / m_frameDuration);
+            bool animEnded = false;
+            if (!m_currentState->loop && newFrame >= totalFrames)
+            {
+                newFrame = totalFrames - 1;
+                animEnded = true;
+            }
+            else if (m_currentState->loop && newFrame >= totalFrames)
+            {
+                newFrame = newFrame % totalFrames;
+                m_stateTime = std::fmod(m_stateTime, animDuration);
+            }
+            m_currentFrame = newFrame;
+
+            int winType = currentWindowType();
+            bool inComboOrCancel = (winType == 1 || winType == 2);
+
+            std::vector<std::string> effectiveInputs;
+            effectiveInputs.reserve(activeInputs.size() + injectInputs.size());
+            effectiveInputs.insert(effectiveInputs.end(), activeInputs.begin(), activeInputs.end());
+            for (const auto &name : injectInputs)
+            {
+                if (std::find(effectiveInputs.begin(), effectiveInputs.end(), name) == effectiveInputs.end())
+                    effectiveInputs.push_back(name);
+            }
+            if (inComboOrCancel)
+            {
+                for (const auto &preset : {"KEY_ATTACK", "KEY_JUMP", "KEY_DASH",
+                                           "KEY_SKILL_1", "KEY_SKILL_2", "KEY_SKILL_3"})
+                {
+                    if (m_inputBuffer.has(preset, time))
+                    {
+                        if (std::find(effectiveInputs.begin(), effectiveInputs.end(), preset) == effectiveInputs.end())
+                            effectiveInputs.push_back(preset);
+                    }
+                }
+            }
+            if (animEnded)
+                effectiveInputs.push_back("ANIM_END");
+
+            collectRootMotion(prevFrame, newFrame, result);
+            collectFrameEvents(prevFrame, newFrame, result);
+            tryTransitions(effectiveInputs, time, result);
+
+            result.currentState = m_currentStateName;
+            result.currentFrame = m_currentFrame;
+            result.stateTimeRatio = (animDuration > 0.0f) ? std::min(1.0f, m_stateTime / animDuration) : 0.0f;
+            return result;
+        }
+
+    private:
+        int currentWindowType() const
+        {
+            if (!m_currentState)
+                return -1;
+            for (const auto &w : m_currentState->windows)
+            {
+                if (m_currentFrame >= w.startFrame && m_currentFrame <= w.endFrame)
+                    return static_cast<int>(w.type);
+            }
+            return -1;
+        }
+
+        void doTransition(const std::string &stateName, UpdateResult &result)
+        {
+            auto it = m_data->states.find(stateName);
+            if (it == m_data->states.end())
+                return;
+            m_currentStateName = stateName;
+            m_currentState = &it->second;
+            m_stateTime = 0.0f;
+            m_currentFrame = 0;
+            m_lastEventFrame = -1;
+            result.stateChanged = true;
+            result.currentState = stateName;
+        }
+
+        bool tryTransitions(const std::vector<std::string> &activeInputs, float time, UpdateResult &result)
+        {
+            std::vector<const Transition *> sorted;
+            sorted.reserve(m_currentState->transitions.size());
+            for (const auto &t : m_currentState->transitions)
+                sorted.push_back(&t);
+            std::sort(sorted.begin(), sorted.end(),
+                      [](const Transition *a, const Transition *b) { return a->priority > b->priority; });
+
+            for (const Transition *t : sorted)
+            {
+                if (t->requireWindow)
+                {
+                    int wt = currentWindowType();
+                    if (wt != static_cast<int>(t->windowType))
+                        continue;
+                }
+                bool triggered = false;
+                for (const auto &input : activeInputs)
+                {
+                    if (input == t->trigger)
+                    {
+                        triggered = true;
+                        break;
+                    }
+                }
+                if (!triggered)
+                    continue;
+                m_inputBuffer.consume(t->trigger, time);
+                doTransition(t->targetState, result);
+                return true;
+            }
+            return false;
+        }
+
+        void collectFrameEvents(int prevFrame, int newFrame, UpdateResult &result)
+        {
+            for (const auto &fe : m_currentState->frameEvents)
+            {
+                if (fe.frame > prevFrame && fe.frame <= newFrame && fe.frame > m_lastEventFrame)
+                    result.firedEvents.push_back(fe.event);
+            }
+            if (newFrame > m_lastEventFrame)
+                m_lastEventFrame = newFrame;
+        }
+
+        void collectRootMotion(int prevFrame, int newFrame, UpdateResult &result)
+        {
+            for (const auto &rm : m_currentState->rootMotion)
+            {
+                if (rm.frame > prevFrame && rm.frame <= newFrame)
+                {
+                    result.rootMotionDx += rm.dx;
+                    result.rootMotionDy += rm.dy;
+                }
+            }
+        }
+
+        const StateMachineData *m_data = nullptr;
+        std::string m_currentStateName;
+        const StateNode *m_currentState = nullptr;
+        float m_stateTime = 0.0f;
+        int m_currentFrame = 0;
+        int m_lastEventFrame = -1;
+        float m_frameDuration = 0.1f;
+        LegacyInputBuffer m_inputBuffer;
+        std::unordered_map<std::string, ConditionFn> m_conditions;
+    };
+
+    // ── 测试用状态机：移动 / 跳跃 / 四段连招 / 冲刺 / 格挡 ──
+    Transition makeTransition(const char *trigger, const char *target, int priority, int window = -1)
+    {
+        Transition t;
+        t.trigger = trigger;
+        t.targetState = target;
+        t.priority = priority;
+        t.requireWindow = window >= 0;
+        if (window >= 0)
+            t.windowType = static_cast<WindowType>(window);
+        return t;
+    }
+
+    StateMachineData buildMachine()
+    {
+        StateMachineData data;
+        data.characterId = "bench";
+        data.initialState = "IDLE";
+
+        StateNode idle;
+        idle.animationId = "idle";
+        idle.totalFrames = 8;
+        idle.transitions = {makeTransition("IS_MOVING", "RUN", 1), makeTransition("KEY_ATTACK", "ATTACK_1", 10),
+                            makeTransition("KEY_JUMP", "JUMP", 5), makeTransition("AIRBORNE", "FALL", 3),
+                            makeTransition("IS_LOW_HP", "GUARD", 8), makeTransition("KEY_DASH", "DASH", 7)};
+        data.states["IDLE"] = idle;
+
+        StateNode run;
+        run.animationId = "run";
+        run.totalFrames = 6;
+        run.transitions = {makeTransition("NO_INPUT", "IDLE", 1), makeTransition("KEY_ATTACK", "ATTACK_1", 10),
+                           makeTransition("KEY_JUMP", "JUMP", 5), makeTransition("AIRBORNE", "FALL", 3),
+                           makeTransition("KEY_DASH", "DASH", 7)};
+        run.rootMotion = {{1, 0.5f, 0.0f}, {4, 0.5f, 0.0f}};
+        run.frameEvents = {{2, "play_sound:step"}, {5, "play_sound:step"}};
+        data.states["RUN"] = run;
+
+        StateNode jump;
+        jump.animationId = "jump";
+        jump.loop = false;
+        jump.totalFrames = 4;
+        jump.transitions = {makeTransition("FALLING", "FALL", 2), makeTransition("ANIM_END", "FALL", 1)};
+        jump.rootMotion = {{1, 0.0f, -4.0f}};
+        data.states["JUMP"] = jump;
+
+        StateNode fall;
+        fall.animationId = "fall";
+        fall.totalFrames = 4;
+        fall.transitions = {makeTransition("LAND", "IDLE", 5), makeTransition("GROUNDED", "IDLE", 1)};
+        data.states["FALL"] = fall;
+
+        for (int n = 1; n <= 4; ++n)
+        {
+            StateNode attack;
+            attack.animationId = "attack" + std::to_string(n);
+            attack.loop = false;
+            attack.totalFrames = 6;
+            attack.windows = {{0, 1, WindowType::Locked}, {2, 4, WindowType::ComboWindow}, {5, 5, WindowType::Cancelable}};
+            const std::string next = n < 4 ? "ATTACK_" + std::to_string(n + 1) : "ATTACK_1";
+            attack.transitions = {makeTransition(n < 4 ? "KEY_ATTACK" : "TARGET_NEAR", next.c_str(), 10, n < 4 ? 1 : 2),
+                                  makeTransition("KEY_JUMP", "JUMP", 5, 2), makeTransition("KEY_DASH", "DASH", 6, 2),
+                                  makeTransition("ANIM_END", "IDLE", 1)};
+            attack.frameEvents = {{1, "play_sound:swing_" + std::to_string(n)},
+                                  {2, "spawn_hitbox:" + std::to_string(n)},
+                                  {4, "spawn_vfx:slash"}};
+            attack.rootMotion = {{2, 3.0f, 0.0f}, {3, 1.0f, 0.0f}};
+            data.states["ATTACK_" + std::to_string(n)] = attack;
+        }
+
+        StateNode dash;
+        dash.animationId = "dash";
+        dash.loop = false;
+        dash.totalFrames = 3;
+        dash.transitions = {makeTransition("ANIM_END", "IDLE", 1)};
+        dash.rootMotion = {{1, 6.0f, 0.0f}, {2, 4.0f, 0.0f}};
+        data.states["DASH"] = dash;
+
+        StateNode guard;
+        guard.animationId = "guard";
+        guard.loop = false;
+        guard.totalFrames = 5;
+        guard.transitions = {makeTransition("ANIM_END", "IDLE", 1)};
+        guard.frameEvents = {{1, "shake_screen"}};
+        data.states["GUARD"] = guard;
+        return data;
+    }
+
+    // ── 确定性输入：每个控制器一条独立的伪随机按键序列 ──
+    struct Actor
+    {
+        uint32_t seed = 1;
+        bool grounded = true;
+        bool prevGrounded = true;
+        float vy = 0.0f;
+        float hp = 100.0f;
+        float targetDist = 200.0f;
+        bool moveL = false, moveR = false;
+        bool pressAttack = false, pressJump = false, pressDash = false;
+
+        uint32_t next()
+        {
+            seed = seed * 1664525u + 1013904223u;
+            return seed >> 8;
+        }
+
+        void step(int frame)
+        {
+            const uint32_t r = next();
+            if (frame % 20 == 0)
+            {
+                moveL = (r & 3) == 1;
+                moveR = (r & 3) == 2;
+            }
+            pressAttack = (r >> 2) % 9 == 0;
+            pressJump = (r >> 6) % 53 == 0;
+            pressDash = (r >> 12) % 97 == 0;
+            prevGrounded = grounded;
+            if (pressJump && grounded)
+            {
+                grounded = false;
+                vy = -3.0f;
+            }
+            else if (!grounded)
+            {
+                vy += 0.25f;
+                if (vy > 3.0f)
+                    grounded = true;
+            }
+            hp = 50.0f + 49.0f * std::sin(frame * 0.01f + static_cast<float>(seed & 255));
+            targetDist = static_cast<float>((r >> 4) % 120);
+        }
+    };
+
+    bool isLowHp(const StateController &, void *user) { return static_cast<const Actor *>(user)->hp < 8.0f; }
+    bool isTargetNear(const StateController &, void *user) { return static_cast<const Actor *>(user)->targetDist < 40.0f; }
+
+    double msSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    struct Result
+    {
+        double ms = 0.0;
+        std::vector<std::string> finalStates;
+        long long events = 0;
+        double rootMotion = 0.0;
+    };
+
+    constexpr float kDt = 1.0f / 60.0f;
+
+    std::vector<Actor> makeActors(int count)
+    {
+        std::vector<Actor> actors(count);
+        for (int i = 0; i < count; ++i)
+            actors[i].seed = 0x9E3779B9u * static_cast<uint32_t>(i + 1);
+        return actors;
+    }
+
+    Result runLegacy(const StateMachineData &data, int count, int frames)
+    {
+        std::vector<Actor> actors = makeActors(count);
+        std::vector<LegacyStateController> sms(count);
+        for (int i = 0; i < count; ++i)
+        {
+            sms[i].init(&data);
+            Actor *actor = &actors[i];
+            sms[i].registerCondition("IS_LOW_HP", [actor](const LegacyStateController &) { return actor->hp < 8.0f; });
+            sms[i].registerCondition("TARGET_NEAR", [actor](const LegacyStateController &) { return actor->targetDist < 40.0f; });
+        }
+
+        Result result;
+        float time = 0.0f;
+        const auto start = std::chrono::steady_clock::now();
+        for (int f = 0; f < frames; ++f)
+        {
+            time += kDt;
+            for (int i = 0; i < count; ++i)
+            {
+                Actor &a = actors[i];
+                a.step(f);
+                std::vector<std::string> activeInputs;
+                activeInputs.reserve(8);
+                if (a.grounded) activeInputs.push_back("GROUNDED");
+                else            activeInputs.push_back("AIRBORNE");
+                if (a.vy < -0.5f) activeInputs.push_back("RISING");
+                if (a.vy > 0.5f)  activeInputs.push_back("FALLING");
+                if (!a.prevGrounded && a.grounded) activeInputs.push_back("LAND");
+                if (a.moveL) activeInputs.push_back("KEY_MOVE_L");
+                if (a.moveR) activeInputs.push_back("KEY_MOVE_R");
+                if (!a.moveL && !a.moveR) activeInputs.push_back("NO_INPUT");
+                if (a.moveL || a.moveR)   activeInputs.push_back("IS_MOVING");
+                if (sms[i].getCurrentState().find("ATTACK") != std::string::npos)
+                    activeInputs.push_back("IS_ATTACKING");
+                if (a.pressAttack) sms[i].pushInput("KEY_ATTACK", time);
+                if (a.pressJump)   sms[i].pushInput("KEY_JUMP", time);
+                if (a.pressDash)   sms[i].pushInput("KEY_DASH", time);
+
+                const UpdateResult r = sms[i].update(kDt, activeInputs, time);
+                result.events += static_cast<long long>(r.firedEvents.size());
+                result.rootMotion += r.rootMotionDx + r.rootMotionDy;
+            }
+        }
+        result.ms = msSince(start);
+        for (const auto &sm : sms)
+            result.finalStates.push_back(sm.getCurrentState());
+        return result;
+    }
+
+    // useTick = false 时走兼容接口 update(dt, vector<string>, time)
+    Result runCompiled(const std::shared_ptr<const CompiledStateMachine> &machine, int count, int frames, bool useTick)
+    {
+        std::vector<Actor> actors = makeActors(count);
+        std::vector<StateController> sms(count);
+        for (int i = 0; i < count; ++i)
+        {
+            sms[i].init(machine);
+            sms[i].registerCondition("IS_LOW_HP", isLowHp, &actors[i]);
+            sms[i].registerCondition("TARGET_NEAR", isTargetNear, &actors[i]);
+        }
+        const auto id = [&](const char *name) { return sms[0].triggerId(name); };
+        const TriggerId grounded = id("GROUNDED"), airborne = id("AIRBORNE"), rising = id("RISING"),
+                        falling = id("FALLING"), land = id("LAND"), moveL = id("KEY_MOVE_L"),
+                        moveR = id("KEY_MOVE_R"), noInput = id("NO_INPUT"), isMoving = id("IS_MOVING"),
+                        isAttacking = id("IS_ATTACKING"), keyAttack = id("KEY_ATTACK"), keyJump = id("KEY_JUMP"),
+                        keyDash = id("KEY_DASH");
+
+        Result result;
+        float time = 0.0f;
+        const auto start = std::chrono::steady_clock::now();
+        for (int f = 0; f < frames; ++f)
+        {
+            time += kDt;
+            for (int i = 0; i < count; ++i)
+            {
+                Actor &a = actors[i];
+                a.step(f);
+                if (useTick)
+                {
+                    TriggerMask inputs;
+                    if (a.grounded) inputs.set(grounded);
+                    else            inputs.set(airborne);
+                    if (a.vy < -0.5f) inputs.set(rising);
+                    if (a.vy > 0.5f)  inputs.set(falling);
+                    if (!a.prevGrounded && a.grounded) inputs.set(land);
+                    if (a.moveL) inputs.set(moveL);
+                    if (a.moveR) inputs.set(moveR);
+                    if (!a.moveL && !a.moveR) inputs.set(noInput);
+                    if (a.moveL || a.moveR)   inputs.set(isMoving);
+                    if (sms[i].getCurrentState().find("ATTACK") != std::string::npos)
+                        inputs.set(isAttacking);
+                    if (a.pressAttack) sms[i].pushInput(keyAttack, time);
+                    if (a.pressJump)   sms[i].pushInput(keyJump, time);
+                    if (a.pressDash)   sms[i].pushInput(keyDash, time);
+
+                    const TickResult &r = sms[i].tick(kDt, inputs, time);
+                    result.events += static_cast<long long>(r.firedEvents.size());
+                    result.rootMotion += r.rootMotionDx + r.rootMotionDy;
+                }
+                else
+                {
+                    std::vector<std::string> activeInputs;
+                    activeInputs.reserve(8);
+                    if (a.grounded) activeInputs.push_back("GROUNDED");
+                    else            activeInputs.push_back("AIRBORNE");
+                    if (a.vy < -0.5f) activeInputs.push_back("RISING");
+                    if (a.vy > 0.5f)  activeInputs.push_back("FALLING");
+                    if (!a.prevGrounded && a.grounded) activeInputs.push_back("LAND");
+                    if (a.moveL) activeInputs.push_back("KEY_MOVE_L");
+                    if (a.moveR) activeInputs.push_back("KEY_MOVE_R");
+                    if (!a.moveL && !a.moveR) activeInputs.push_back("NO_INPUT");
+                    if (a.moveL || a.moveR)   activeInputs.push_back("IS_MOVING");
+                    if (sms[i].getCurrentState().find("ATTACK") != std::string::npos)
+                        activeInputs.push_back("IS_ATTACKING");
+                    if (a.pressAttack) sms[i].pushInput("KEY_ATTACK", time);
+                    if (a.pressJump)   sms[i].pushInput("KEY_JUMP", time);
+                    if (a.pressDash)   sms[i].pushInput("KEY_DASH", time);
+
+                    const UpdateResult r = sms[i].update(kDt, activeInputs, time);
+                    result.events += static_cast<long long>(r.firedEvents.size());
+                    result.rootMotion += r.rootMotionDx + r.rootMotionDy;
+                }
+            }
+        }
+        result.ms = msSince(start);
+        for (const auto &sm : sms)
+            result.finalStates.push_back(sm.getCurrentState());
+        return result;
+    }
+
+    bool sameResult(const Result &a, const Result &b)
+    {
+        return a.finalStates == b.finalStates && a.events == b.events && a.rootMotion == b.rootMotion;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const int count = argc > 1 ? std::max(1, std::atoi(argv[1])) : 1000;
+    const int frames = argc > 2 ? std::max(1, std::atoi(argv[2])) : 600;
+
+    const StateMachineData data = buildMachine();
+    auto compiled = std::make_shared<CompiledStateMachine>();
+    if (!SmLoader::compile(data, *compiled))
+    {
+        std::printf("compile failed: %s\n", SmLoader::lastError().c_str());
+        return 1;
+    }
+    const std::shared_ptr<const CompiledStateMachine> machine = compiled;
+
+    const Result legacy = runLegacy(data, count, frames);
+    const Result compat = runCompiled(machine, count, frames, false);
+    const Result tick = runCompiled(machine, count, frames, true);
+
+    const double ticks = static_cast<double>(count) * frames;
+    const auto row = [&](const char *name, const Result &r) {
+        std::printf("  %-28s %8.2f ms  %10.0f ticks/s  x%.2f\n", name, r.ms, ticks / (r.ms / 1000.0), legacy.ms / r.ms);
+    };
+    std::printf("state machine, %d controllers x %d frames (%zu states, %zu triggers)\n",
+                count, frames, compiled->states.size(), compiled->triggerNames.size());
+    row("legacy string controller", legacy);
+    row("compiled, update(strings)", compat);
+    row("compiled, tick(TriggerMask)", tick);
+
+    const bool ok = sameResult(legacy, compat) && sameResult(legacy, tick);
+    std::printf("  events: %lld / %lld / %lld, root motion: %.1f / %.1f / %.1f%s\n",
+                legacy.events, compat.events, tick.events,
+                legacy.rootMotion, compat.rootMotion, tick.rootMotion, ok ? "" : "  MISMATCH");
+    return ok ? 0 : 1;
+}
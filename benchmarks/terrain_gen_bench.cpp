@@ -0,0 +1,216 @@
+// terrain_gen_bench.cpp
+// 地形生成基准：逐瓦片旧路径 vs 批量新路径（tiles/s）
+//
+// 旧路径按改造前的 PerlinNoiseGenerator::generateChunk 原样复刻：std::function 查生物群系、
+// 每个瓦片重新计算地表高度、逐瓦片调用 FastNoiseLite::GetNoise 采样洞穴噪声。
+// 新路径分别测 generateChunk（逐区块）与 generateRegion（整区一次）。
+// 三条路径的输出逐瓦片比较，不一致时报告并返回非零。
+// 用法：terrain_gen_bench [regionWidth] [regionHeight] [repeats]
+#include "../src/engine/world/perlin_noise_generator.h"
+#include "../src/engine/world/FastNoiseLite.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+namespace
+{
+    using engine::world::BiomeStrip;
+    using engine::world::ChunkTiles;
+    using engine::world::PerlinBatch;
+    using engine::world::PerlinNoiseGenerator;
+    using engine::world::TileData;
+    using engine::world::TileType;
+    using engine::world::WorldConfig;
+
+    constexpr int CS = WorldConfig::CHUNK_SIZE;
+
+    // ── 改造前的逐瓦片实现 ──
+    class LegacyGenerator
+    {
+    public:
+        LegacyGenerator(const WorldConfig &config, std::function<int(int)> biomeByZone)
+            : m_config(config), m_biomeByZone(std::move(biomeByZone))
+        {
+            m_noise.SetSeed(static_cast<int>(config.seed));
+            m_noise.SetNoiseType(FastNoiseLite::NoiseType_Perlin);
+            m_noise.SetFrequency(config.noiseScale);
+            m_caveNoise.SetSeed(static_cast<int>(config.seed) ^ 0x7A3F1B2C);
+            m_caveNoise.SetNoiseType(FastNoiseLite::NoiseType_Perlin);
+            m_caveNoise.SetFrequency(0.035f);
+        }
+
+        void generateChunk(int chunkX, int chunkY, ChunkTiles &outTiles) const
+        {
+            for (int ly = 0; ly < CS; ++ly)
+            {
+                for (int lx = 0; lx < CS; ++lx)
+                {
+                    const int worldX = chunkX * CS + lx;
+                    const int worldY = chunkY * CS + ly;
+                    const int biome = m_biomeByZone ? m_biomeByZone(worldX) : 0;
+
+                    float ampMult = 1.0f;
+                    switch (biome)
+                    {
+                    case 2: ampMult = 1.8f; break;
+                    case 3: ampMult = 1.5f; break;
+                    case 4: ampMult = 1.6f; break;
+                    case 1: ampMult = 0.7f; break;
+                    default: ampMult = 1.0f; break;
+                    }
+
+                    const float noiseVal = m_noise.GetNoise(static_cast<float>(worldX), 0.0f);
+                    const float heightOffset = m_config.amplitude * ampMult * (noiseVal * 0.5f + 0.5f);
+                    const int surfaceY = m_config.seaLevel - static_cast<int>(heightOffset);
+
+                    TileType type = TileType::Air;
+                    if (worldY >= surfaceY)
+                    {
+                        switch (biome)
+                        {
+                        case 1:
+                            type = worldY == surfaceY ? TileType::Grass
+                                 : worldY < surfaceY + m_config.grassDepth * 4 ? TileType::Dirt
+                                                                               : TileType::Stone;
+                            break;
+                        case 2:
+                            type = worldY == surfaceY ? TileType::Gravel
+                                 : worldY <= surfaceY + 1 ? TileType::Dirt
+                                                          : TileType::Stone;
+                            break;
+                        case 3:
+                        case 4:
+                            type = TileType::Stone;
+                            break;
+                        default:
+                            type = worldY == surfaceY ? TileType::Grass
+                                 : worldY < surfaceY + m_config.grassDepth ? TileType::Dirt
+                                                                           : TileType::Stone;
+                            break;
+                        }
+                    }
+
+                    if (type != TileType::Air && worldY > surfaceY + 2)
+                    {
+                        float thresh = 0.0f;
+                        switch (biome)
+                        {
+                        case 4: thresh = 0.30f; break;
+                        case 2: thresh = 0.14f; break;
+                        case 3: thresh = 0.11f; break;
+                        case 1: thresh = 0.05f; break;
+                        default: thresh = 0.08f; break;
+                        }
+                        const float cv = m_caveNoise.GetNoise(static_cast<float>(worldX), static_cast<float>(worldY));
+                        if (std::abs(cv) < thresh)
+                            type = TileType::Air;
+                    }
+
+                    outTiles[ly * CS + lx] = TileData(type);
+                }
+            }
+        }
+
+    private:
+        WorldConfig m_config;
+        std::function<int(int)> m_biomeByZone;
+        FastNoiseLite m_noise;
+        FastNoiseLite m_caveNoise;
+    };
+
+    double secondsSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // 按区块生成再拷进区域缓冲（区域左上角须对齐区块）
+    template <typename Gen>
+    void generateByChunks(const Gen &gen, int tileX, int tileY, int width, int height, std::vector<TileData> &out)
+    {
+        ChunkTiles chunk;
+        for (int cy = 0; cy < height / CS; ++cy)
+        {
+            for (int cx = 0; cx < width / CS; ++cx)
+            {
+                gen.generateChunk(tileX / CS + cx, tileY / CS + cy, chunk);
+                for (int ly = 0; ly < CS; ++ly)
+                    std::copy(chunk.begin() + ly * CS, chunk.begin() + (ly + 1) * CS,
+                              out.begin() + (cy * CS + ly) * width + cx * CS);
+            }
+        }
+    }
+
+    size_t countMismatches(const std::vector<TileData> &a, const std::vector<TileData> &b)
+    {
+        size_t bad = 0;
+        for (size_t i = 0; i < a.size(); ++i)
+            bad += a[i].type != b[i].type ? 1 : 0;
+        return bad;
+    }
+
+    void report(const char *name, double seconds, size_t tiles, double baseline)
+    {
+        const double rate = tiles / seconds;
+        std::printf("  %-22s %8.2f ms  %8.2f Mtiles/s  x%.2f\n", name, seconds * 1000.0, rate / 1e6,
+                    baseline > 0.0 ? baseline / seconds : 1.0);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const int width = std::max(CS, (argc > 1 ? std::atoi(argv[1]) : 2000) / CS * CS);
+    const int height = std::max(CS, (argc > 2 ? std::atoi(argv[2]) : 128) / CS * CS);
+    const int repeats = argc > 3 ? std::max(1, std::atoi(argv[3])) : 5;
+
+    WorldConfig config;
+    config.seed = 20240611;
+
+    // 20 个路线段，地形轮流覆盖全部 5 种生物群系
+    BiomeStrip strip;
+    strip.zoneWidth = 100;
+    for (int i = 0; i < 20; ++i)
+        strip.zones.push_back(static_cast<uint8_t>((i * 3) % 5));
+
+    LegacyGenerator legacy(config, [&strip](int tileX) { return strip.biomeAt(tileX); });
+    PerlinNoiseGenerator batched(config);
+    batched.setBiomeStrip(strip);
+
+    // 区域覆盖地表上方的空气与下方的洞穴层
+    const int tileX = 0;
+    const int tileY = (config.seaLevel - static_cast<int>(config.amplitude * 2.0f)) / CS * CS;
+    const size_t tiles = static_cast<size_t>(width) * height * repeats;
+
+    std::vector<TileData> legacyOut(static_cast<size_t>(width) * height);
+    std::vector<TileData> chunkOut(legacyOut.size());
+    std::vector<TileData> regionOut(legacyOut.size());
+
+    std::printf("terrain generation %dx%d tiles x%d (cave kernel: %s)\n", width, height, repeats, PerlinBatch::kernelName());
+
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+        generateByChunks(legacy, tileX, tileY, width, height, legacyOut);
+    const double legacySec = secondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+        generateByChunks(batched, tileX, tileY, width, height, chunkOut);
+    const double chunkSec = secondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+        batched.generateRegion(tileX, tileY, width, height, regionOut.data());
+    const double regionSec = secondsSince(start);
+
+    report("legacy per-tile", legacySec, tiles, legacySec);
+    report("batched generateChunk", chunkSec, tiles, legacySec);
+    report("batched generateRegion", regionSec, tiles, legacySec);
+
+    const size_t chunkBad = countMismatches(legacyOut, chunkOut);
+    const size_t regionBad = countMismatches(legacyOut, regionOut);
+    std::printf("  mismatches: chunk %zu, region %zu\n", chunkBad, regionBad);
+    return chunkBad == 0 && regionBad == 0 ? 0 : 1;
+}
@@ -0,0 +1,213 @@
+// tile_storage_bench.cpp
+// 瓦片存储内存基准：旧版 TileData（vec4 + TileType + std::string）vs 2 字节 POD TileData
+//
+// 模拟 10k 个已加载区块，分别统计：
+//   - 每块大小与累计堆分配字节数（含 std::string 与临时 vector）
+//   - 生成阶段的堆分配次数（旧版经 std::vector<TileData> 输出）
+//   - 编辑器快照（整块拷贝）耗时与分配次数
+//
+// 用法：tile_storage_bench [chunkCount] [repeat]
+#include "../src/engine/world/tile_info.h"
+#include "../src/engine/world/tile_kind_table.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+// ── 全局分配计数 ──
+namespace
+{
+    std::atomic<size_t> g_allocCount{0};
+    std::atomic<size_t> g_allocBytes{0};
+}
+
+void *operator new(std::size_t size)
+{
+    g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    g_allocBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+namespace
+{
+    using engine::world::ChunkTiles;
+    using engine::world::TileData;
+    using engine::world::TileType;
+    using engine::world::WorldConfig;
+
+    constexpr int kTilesPerChunk = WorldConfig::CHUNK_SIZE * WorldConfig::CHUNK_SIZE;
+
+    // ── 旧版布局（逐字段复刻） ──
+    struct LegacyTileData
+    {
+        glm::vec4 uv_rect{0.0f};
+        TileType type = TileType::Air;
+        std::string texture_id;
+
+        LegacyTileData() = default;
+        explicit LegacyTileData(TileType t)
+            : uv_rect(static_cast<float>(static_cast<int>(t)) * 16.0f, 0.0f, 16.0f, 16.0f), type(t) {}
+    };
+
+    struct LegacyChunk
+    {
+        LegacyTileData tiles[kTilesPerChunk];
+    };
+
+    struct AllocScope
+    {
+        size_t count0 = g_allocCount.load();
+        size_t bytes0 = g_allocBytes.load();
+        size_t count() const { return g_allocCount.load() - count0; }
+        size_t bytes() const { return g_allocBytes.load() - bytes0; }
+    };
+
+    double msSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // 与地形生成器等价的简单分层：地表以上为空气，其下为草/土/石
+    TileType sampleType(int chunkX, int ly)
+    {
+        const int surface = 3 + (chunkX & 3);
+        if (ly > surface) return TileType::Air;
+        if (ly == surface) return TileType::Grass;
+        if (ly > surface - 3) return TileType::Dirt;
+        return TileType::Stone;
+    }
+
+    // 旧版生成路径：每块输出一个 std::vector<TileData>
+    void legacyGenerate(int chunkX, std::vector<LegacyTileData> &out, bool multiTexture)
+    {
+        out.resize(kTilesPerChunk);
+        for (int ly = 0; ly < WorldConfig::CHUNK_SIZE; ++ly)
+        {
+            const TileType type = sampleType(chunkX, ly);
+            for (int lx = 0; lx < WorldConfig::CHUNK_SIZE; ++lx)
+            {
+                LegacyTileData tile(type);
+                if (multiTexture && type != TileType::Air)
+                    tile.texture_id = "assets/textures/Tiles/ground_tileset.png";
+                out[ly * WorldConfig::CHUNK_SIZE + lx] = std::move(tile);
+            }
+        }
+    }
+
+    // 新版生成路径：直接填充定长数组
+    void compactGenerate(int chunkX, ChunkTiles &out)
+    {
+        for (int ly = 0; ly < WorldConfig::CHUNK_SIZE; ++ly)
+        {
+            const TileData tile(sampleType(chunkX, ly));
+            for (int lx = 0; lx < WorldConfig::CHUNK_SIZE; ++lx)
+                out[ly * WorldConfig::CHUNK_SIZE + lx] = tile;
+        }
+    }
+
+    void runLegacy(int chunkCount, int repeat, bool multiTexture)
+    {
+        AllocScope gen;
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::unique_ptr<LegacyChunk>> chunks;
+        chunks.reserve(static_cast<size_t>(chunkCount));
+        for (int c = 0; c < chunkCount; ++c)
+        {
+            std::vector<LegacyTileData> tiles; // 旧 ChunkManager::loadChunk 每块新建
+            legacyGenerate(c, tiles, multiTexture);
+            auto chunk = std::make_unique<LegacyChunk>();
+            for (int i = 0; i < kTilesPerChunk; ++i)
+                chunk->tiles[i] = std::move(tiles[static_cast<size_t>(i)]);
+            chunks.push_back(std::move(chunk));
+        }
+        const double genMs = msSince(start);
+        const size_t genAllocs = gen.count();
+        const size_t heapBytes = gen.bytes();
+
+        double snapMs = 0.0;
+        size_t snapAllocs = 0;
+        for (int r = 0; r < repeat; ++r)
+        {
+            AllocScope snap;
+            start = std::chrono::steady_clock::now();
+            std::vector<LegacyTileData> snapshot;
+            snapshot.reserve(static_cast<size_t>(chunkCount) * kTilesPerChunk);
+            for (const auto &chunk : chunks)
+                snapshot.insert(snapshot.end(), std::begin(chunk->tiles), std::end(chunk->tiles));
+            snapMs += msSince(start);
+            snapAllocs += snap.count();
+        }
+
+        std::printf("  legacy%-6s sizeof(tile)=%3zu  chunk=%6zu B  heap=%8.2f MiB  gen: %7.2f ms, %7zu allocs"
+                    "  snapshot: %7.2f ms, %7zu allocs\n",
+                    multiTexture ? "+tex" : "", sizeof(LegacyTileData), sizeof(LegacyChunk),
+                    static_cast<double>(heapBytes) / (1024.0 * 1024.0), genMs, genAllocs,
+                    snapMs / repeat, snapAllocs / static_cast<size_t>(repeat));
+    }
+
+    void runCompact(int chunkCount, int repeat)
+    {
+        AllocScope gen;
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::unique_ptr<ChunkTiles>> chunks;
+        chunks.reserve(static_cast<size_t>(chunkCount));
+        for (int c = 0; c < chunkCount; ++c)
+        {
+            auto tiles = std::make_unique<ChunkTiles>();
+            compactGenerate(c, *tiles);
+            chunks.push_back(std::move(tiles));
+        }
+        const double genMs = msSince(start);
+        const size_t genAllocs = gen.count();
+        const size_t heapBytes = gen.bytes();
+
+        // UV 经共享种类表解析，确认查表不分配
+        float uvChecksum = 0.0f;
+        const auto &kinds = engine::world::TileKindTable::shared();
+        for (const auto &tiles : chunks)
+            uvChecksum += kinds.uvRect((*tiles)[0]).x;
+
+        double snapMs = 0.0;
+        size_t snapAllocs = 0;
+        for (int r = 0; r < repeat; ++r)
+        {
+            AllocScope snap;
+            start = std::chrono::steady_clock::now();
+            std::vector<ChunkTiles> snapshot(static_cast<size_t>(chunkCount));
+            for (size_t i = 0; i < chunks.size(); ++i)
+                snapshot[i] = *chunks[i]; // memcpy
+            snapMs += msSince(start);
+            snapAllocs += snap.count();
+        }
+
+        std::printf("  compact     sizeof(tile)=%3zu  chunk=%6zu B  heap=%8.2f MiB  gen: %7.2f ms, %7zu allocs"
+                    "  snapshot: %7.2f ms, %7zu allocs  (uv checksum %.0f)\n",
+                    sizeof(TileData), sizeof(ChunkTiles),
+                    static_cast<double>(heapBytes) / (1024.0 * 1024.0), genMs, genAllocs,
+                    snapMs / repeat, snapAllocs / static_cast<size_t>(repeat), uvChecksum);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const int chunkCount = argc > 1 ? std::max(1, std::atoi(argv[1])) : 10000;
+    const int repeat = argc > 2 ? std::max(1, std::atoi(argv[2])) : 5;
+
+    engine::world::TileKindTable::shared(); // 预先构造，避免计入分配统计
+
+    std::printf("tile storage @ %d chunks x %d tiles (snapshot avg of %d)\n", chunkCount, kTilesPerChunk, repeat);
+    runLegacy(chunkCount, repeat, false);
+    runLegacy(chunkCount, repeat, true);
+    runCompact(chunkCount, repeat);
+    return 0;
+}
@@ -0,0 +1,128 @@
+// voice_pool_bench.cpp
+// 语音分配基准：大规模战斗下旧版“每次触发都新开一个声部”与 VoiceAllocator 的同时发声数与决策开销
+//
+// 模拟 60 FPS 的战斗：每秒 eventsPerSec 次挥砍 / 爆炸，音效在 8 种里随机，位置在听者周围 ±1600px 随机，
+// 每个音效时长 0.25~1.2 秒。旧版 MIX_PlayAudio 不设上限，同时发声数随触发频率线性增长；
+// 新版经过距离剔除、合并、单音效并发上限与优先级抢占后，发声数不超过语音池大小。
+// 用法：voice_pool_bench [eventsPerSec] [seconds] [voiceCount]
+#include "../src/engine/audio/voice_pool.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using namespace engine::audio;
+
+    struct BenchSound
+    {
+        SoundDesc desc;
+        double durationMs = 0.0;
+    };
+
+    struct Playing
+    {
+        double endMs = 0.0;
+    };
+}
+
+int main(int argc, char **argv)
+{
+    const int eventsPerSec = argc > 1 ? std::max(1, std::atoi(argv[1])) : 120;
+    const int seconds = argc > 2 ? std::max(1, std::atoi(argv[2])) : 30;
+    const int voiceCount = argc > 3 ? std::max(1, std::atoi(argv[3])) : VoicePool::DEFAULT_VOICE_COUNT;
+
+    std::mt19937 rng(1234);
+    std::vector<BenchSound> sounds(8);
+    for (size_t i = 0; i < sounds.size(); ++i)
+    {
+        sounds[i].desc.priority = static_cast<uint8_t>(i < 2 ? 200 : 100); // 两种高优先级（爆炸 / 受击）
+        sounds[i].desc.maxInstances = 4;
+        sounds[i].durationMs = 250.0 + 950.0 * static_cast<double>(i) / static_cast<double>(sounds.size() - 1);
+    }
+
+    std::uniform_int_distribution<size_t> pickSound(0, sounds.size() - 1);
+    std::uniform_real_distribution<float> pickOffset(-1600.0f, 1600.0f);
+    std::uniform_real_distribution<double> jitter(0.0, 1.0);
+
+    VoiceAllocator allocator(voiceCount);
+    std::vector<double> slotEnd(static_cast<size_t>(voiceCount), 0.0);
+    std::vector<Playing> legacy;
+
+    uint64_t events = 0, started = 0, replaced = 0, stolen = 0, coalesced = 0, culled = 0, rejected = 0;
+    size_t legacyPeak = 0;
+    int pooledPeak = 0;
+    double decisionNs = 0.0;
+
+    const double frameMs = 1000.0 / 60.0;
+    const int frames = seconds * 60;
+    double carry = 0.0;
+    PlayId nextPlay = 1;
+    for (int frame = 0; frame < frames; ++frame)
+    {
+        const double now = frame * frameMs;
+        legacy.erase(std::remove_if(legacy.begin(), legacy.end(), [&](const Playing &p) { return p.endMs <= now; }), legacy.end());
+        for (int slot = 0; slot < voiceCount; ++slot)
+        {
+            if (allocator.slot(slot).active && slotEnd[static_cast<size_t>(slot)] <= now)
+                allocator.release(slot);
+        }
+
+        carry += eventsPerSec / 60.0;
+        const int count = static_cast<int>(carry);
+        carry -= count;
+        for (int e = 0; e < count; ++e)
+        {
+            ++events;
+            const size_t soundIndex = pickSound(rng);
+            const BenchSound &sound = sounds[soundIndex];
+            const double eventMs = now + jitter(rng) * frameMs;
+            legacy.push_back({eventMs + sound.durationMs});
+
+            const float distance = std::hypot(pickOffset(rng), pickOffset(rng));
+            VoiceRequest request;
+            request.sound = static_cast<SoundId>(soundIndex);
+            request.priority = sound.desc.priority;
+            request.maxInstances = sound.desc.maxInstances;
+            request.minIntervalMs = sound.desc.minIntervalMs;
+            request.gain = distance >= sound.desc.maxDistance
+                               ? 0.0f
+                               : sound.desc.gain * VoiceAllocator::attenuation(distance, sound.desc.minDistance, sound.desc.maxDistance);
+
+            const auto start = std::chrono::steady_clock::now();
+            const VoiceChoice choice = allocator.choose(request, eventMs);
+            if (choice.slot >= 0)
+                allocator.start(choice.slot, request, nextPlay++, eventMs);
+            decisionNs += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+            switch (choice.decision)
+            {
+            case VoiceDecision::Start: ++started; break;
+            case VoiceDecision::Replace: ++replaced; break;
+            case VoiceDecision::Steal: ++stolen; break;
+            case VoiceDecision::Coalesced: ++coalesced; break;
+            case VoiceDecision::Culled: ++culled; break;
+            case VoiceDecision::Rejected: ++rejected; break;
+            }
+            if (choice.slot >= 0)
+                slotEnd[static_cast<size_t>(choice.slot)] = eventMs + sound.durationMs;
+        }
+        legacyPeak = std::max(legacyPeak, legacy.size());
+        pooledPeak = std::max(pooledPeak, allocator.activeCount());
+    }
+
+    std::printf("voice allocation, %d events/s x %d s, %d voices\n", eventsPerSec, seconds, voiceCount);
+    std::printf("  %-24s peak voices %5zu\n", "legacy MIX_PlayAudio", legacyPeak);
+    std::printf("  %-24s peak voices %5d  (%.0f ns / decision)\n", "VoiceAllocator", pooledPeak,
+                events ? decisionNs / static_cast<double>(events) : 0.0);
+    std::printf("  events %llu: start %llu, replace %llu, steal %llu, coalesce %llu, cull %llu, reject %llu\n",
+                static_cast<unsigned long long>(events), static_cast<unsigned long long>(started),
+                static_cast<unsigned long long>(replaced), static_cast<unsigned long long>(stolen),
+                static_cast<unsigned long long>(coalesced), static_cast<unsigned long long>(culled),
+                static_cast<unsigned long long>(rejected));
+    return pooledPeak <= voiceCount ? 0 : 1;
+}
@@ -0,0 +1,265 @@
+// voxel_mesh_bench.cpp
+// VoxelScene 区块网格基准：旧版逐体素逐面网格 vs 带边界缓冲的贪婪网格
+//
+// 场景与 VoxelScene 一致：16x24x16 区块，LOAD_CHUNK_RADIUS = 4（9x9 = 81 个区块），
+// 地形按 generateChunk 的 Plains 公式生成。统计：
+//   - 每区块构建耗时（旧版含逐邻居哈希查找；新版拆分为主线程边界拷贝 + 工作线程构建）
+//   - 顶点数与显存占用
+//
+// 用法：voxel_mesh_bench [repeat]
+#include "../src/game/scene/voxel_mesher.h"
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    using game::scene::VoxelMesher;
+    using game::scene::VoxelPackedVertex;
+    using game::scene::VoxelPaddedChunk;
+
+    constexpr int WORLD_Y = 24;
+    constexpr int CHUNK_SIZE_X = 16;
+    constexpr int CHUNK_SIZE_Z = 16;
+    constexpr int LOAD_CHUNK_RADIUS = 4;
+    constexpr int GRID = LOAD_CHUNK_RADIUS * 2 + 1;
+
+    struct Chunk
+    {
+        int chunkX = 0;
+        int chunkZ = 0;
+        std::vector<unsigned char> voxels;
+    };
+
+    // 旧版顶点布局
+    struct LegacyVertex
+    {
+        glm::vec3 pos;
+        glm::vec3 color;
+        glm::vec3 normal;
+    };
+
+    int voxelIndex(int x, int y, int z) { return x + y * CHUNK_SIZE_X + z * CHUNK_SIZE_X * WORLD_Y; }
+    int64_t chunkKey(int chunkX, int chunkZ) { return (static_cast<int64_t>(chunkX) << 32) ^ static_cast<uint32_t>(chunkZ); }
+
+    class World
+    {
+    public:
+        World()
+        {
+            for (int cz = 0; cz < GRID; ++cz)
+                for (int cx = 0; cx < GRID; ++cx)
+                    generate(m_chunks[chunkKey(cx, cz)], cx, cz);
+        }
+
+        const std::unordered_map<int64_t, Chunk> &chunks() const { return m_chunks; }
+        int width() const { return GRID * CHUNK_SIZE_X; }
+        int depth() const { return GRID * CHUNK_SIZE_Z; }
+
+        const Chunk *find(int chunkX, int chunkZ) const
+        {
+            auto it = m_chunks.find(chunkKey(chunkX, chunkZ));
+            return it == m_chunks.end() ? nullptr : &it->second;
+        }
+
+        // 与 VoxelScene::rawVoxelAt 相同：越界检查 + 区块换算 + 哈希查找
+        unsigned char rawVoxelAt(int x, int y, int z) const
+        {
+            if (x < 0 || x >= width() || y < 0 || y >= WORLD_Y || z < 0 || z >= depth())
+                return 0;
+            const int chunkX = x / CHUNK_SIZE_X;
+            const int chunkZ = z / CHUNK_SIZE_Z;
+            const Chunk *chunk = find(chunkX, chunkZ);
+            if (!chunk)
+                return 0;
+            return chunk->voxels[static_cast<size_t>(voxelIndex(x - chunkX * CHUNK_SIZE_X, y, z - chunkZ * CHUNK_SIZE_Z))];
+        }
+
+    private:
+        static void generate(Chunk &chunk, int chunkX, int chunkZ)
+        {
+            chunk.chunkX = chunkX;
+            chunk.chunkZ = chunkZ;
+            chunk.voxels.assign(CHUNK_SIZE_X * WORLD_Y * CHUNK_SIZE_Z, 0);
+            for (int localZ = 0; localZ < CHUNK_SIZE_Z; ++localZ)
+            {
+                for (int localX = 0; localX < CHUNK_SIZE_X; ++localX)
+                {
+                    const float wx = static_cast<float>(chunkX * CHUNK_SIZE_X + localX);
+                    const float wz = static_cast<float>(chunkZ * CHUNK_SIZE_Z + localZ);
+                    const float macroWave = std::sin(wx * 0.021f) * 5.8f + std::cos(wz * 0.018f) * 4.9f
+                                          + std::sin((wx + wz) * 0.010f) * 2.8f;
+                    const float ridgeWave = std::sin(wx * 0.006f + wz * 0.004f) * 7.0f;
+                    const int height = std::clamp(8 + static_cast<int>((macroWave + ridgeWave) * 0.45f), 4, WORLD_Y - 3);
+                    for (int y = 0; y <= height; ++y)
+                    {
+                        unsigned char block = 3;
+                        if (y == height)
+                            block = 1;
+                        else if (y >= height - 2)
+                            block = 2;
+                        chunk.voxels[static_cast<size_t>(voxelIndex(localX, y, localZ))] = block;
+                    }
+                }
+            }
+        }
+
+        std::unordered_map<int64_t, Chunk> m_chunks;
+    };
+
+    glm::vec3 blockColor(unsigned char type)
+    {
+        switch (type)
+        {
+        case 1: return {0.30f, 0.72f, 0.28f};
+        case 2: return {0.46f, 0.31f, 0.18f};
+        case 3: return {0.55f, 0.57f, 0.62f};
+        default: return glm::vec3(0.7f);
+        }
+    }
+
+    // ── 旧版：逐体素、逐面、6 个不共享顶点，邻居经 rawVoxelAt 查询 ──
+    void legacyBuild(const World &world, const Chunk &chunk, std::vector<LegacyVertex> &vertices)
+    {
+        static const glm::vec3 faceNormals[6] = {{0, 0, 1}, {0, 0, -1}, {-1, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, -1, 0}};
+        static const glm::ivec3 faceNeighbors[6] = {{0, 0, 1}, {0, 0, -1}, {-1, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, -1, 0}};
+        static const glm::vec3 faceQuads[6][4] = {
+            {{0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1}},
+            {{1, 0, 0}, {0, 0, 0}, {0, 1, 0}, {1, 1, 0}},
+            {{0, 0, 0}, {0, 0, 1}, {0, 1, 1}, {0, 1, 0}},
+            {{1, 0, 1}, {1, 0, 0}, {1, 1, 0}, {1, 1, 1}},
+            {{0, 1, 1}, {1, 1, 1}, {1, 1, 0}, {0, 1, 0}},
+            {{0, 0, 0}, {1, 0, 0}, {1, 0, 1}, {0, 0, 1}},
+        };
+        static const float faceBrightness[6] = {0.82f, 0.82f, 0.72f, 0.72f, 1.0f, 0.55f};
+
+        vertices.clear();
+        vertices.reserve(CHUNK_SIZE_X * WORLD_Y * CHUNK_SIZE_Z * 12);
+        const int startX = chunk.chunkX * CHUNK_SIZE_X;
+        const int startZ = chunk.chunkZ * CHUNK_SIZE_Z;
+        for (int localZ = 0; localZ < CHUNK_SIZE_Z; ++localZ)
+        {
+            for (int y = 0; y < WORLD_Y; ++y)
+            {
+                for (int localX = 0; localX < CHUNK_SIZE_X; ++localX)
+                {
+                    const int wx = startX + localX;
+                    const int wz = startZ + localZ;
+                    const unsigned char mat = world.rawVoxelAt(wx, y, wz);
+                    if (mat == 0)
+                        continue;
+                    const glm::vec3 baseColor = blockColor(mat);
+                    const glm::vec3 origin(static_cast<float>(wx), static_cast<float>(y), static_cast<float>(wz));
+                    for (int f = 0; f < 6; ++f)
+                    {
+                        const glm::ivec3 &nb = faceNeighbors[f];
+                        if (world.rawVoxelAt(wx + nb.x, y + nb.y, wz + nb.z) != 0)
+                            continue;
+                        const glm::vec3 col = baseColor * faceBrightness[f];
+                        glm::vec3 q[4];
+                        for (int i = 0; i < 4; ++i)
+                            q[i] = origin + faceQuads[f][i];
+                        vertices.push_back({q[0], col, faceNormals[f]});
+                        vertices.push_back({q[1], col, faceNormals[f]});
+                        vertices.push_back({q[2], col, faceNormals[f]});
+                        vertices.push_back({q[0], col, faceNormals[f]});
+                        vertices.push_back({q[2], col, faceNormals[f]});
+                        vertices.push_back({q[3], col, faceNormals[f]});
+                    }
+                }
+            }
+        }
+    }
+
+    // ── 新版：与 VoxelScene::fillPaddedChunk 相同的边界拷贝 ──
+    void fillPadded(const World &world, const Chunk &chunk, VoxelPaddedChunk &out)
+    {
+        out.reset(CHUNK_SIZE_X, WORLD_Y, CHUNK_SIZE_Z);
+        for (int z = 0; z < CHUNK_SIZE_Z; ++z)
+            for (int y = 0; y < WORLD_Y; ++y)
+                std::copy_n(&chunk.voxels[static_cast<size_t>(voxelIndex(0, y, z))], CHUNK_SIZE_X,
+                            &out.cells[static_cast<size_t>(out.index(0, y, z))]);
+
+        auto copyBorder = [&](int nx, int nz, int srcX, int srcZ, int dstX, int dstZ, bool alongX) {
+            const Chunk *nb = world.find(nx, nz);
+            if (!nb)
+                return;
+            const int count = alongX ? CHUNK_SIZE_X : CHUNK_SIZE_Z;
+            for (int y = 0; y < WORLD_Y; ++y)
+                for (int i = 0; i < count; ++i)
+                    out.set(alongX ? i : dstX, y, alongX ? dstZ : i,
+                            nb->voxels[static_cast<size_t>(voxelIndex(alongX ? i : srcX, y, alongX ? srcZ : i))]);
+        };
+        copyBorder(chunk.chunkX - 1, chunk.chunkZ, CHUNK_SIZE_X - 1, 0, -1, 0, false);
+        copyBorder(chunk.chunkX + 1, chunk.chunkZ, 0, 0, CHUNK_SIZE_X, 0, false);
+        copyBorder(chunk.chunkX, chunk.chunkZ - 1, 0, CHUNK_SIZE_Z - 1, 0, -1, true);
+        copyBorder(chunk.chunkX, chunk.chunkZ + 1, 0, 0, 0, CHUNK_SIZE_Z, true);
+    }
+
+    using Clock = std::chrono::steady_clock;
+    double msSince(Clock::time_point start) { return std::chrono::duration<double, std::milli>(Clock::now() - start).count(); }
+}
+
+int main(int argc, char **argv)
+{
+    const int repeat = argc > 1 ? std::max(1, std::atoi(argv[1])) : 20;
+    const World world;
+    const size_t chunkCount = world.chunks().size();
+
+    // 旧版
+    std::vector<LegacyVertex> legacyVerts;
+    size_t legacyVertexTotal = 0;
+    auto start = Clock::now();
+    for (int r = 0; r < repeat; ++r)
+    {
+        legacyVertexTotal = 0;
+        for (const auto &[key, chunk] : world.chunks())
+        {
+            legacyBuild(world, chunk, legacyVerts);
+            legacyVertexTotal += legacyVerts.size();
+        }
+    }
+    const double legacyMs = msSince(start) / static_cast<double>(repeat * chunkCount);
+
+    // 新版：拆分边界拷贝（主线程）与贪婪构建（工作线程）
+    VoxelPaddedChunk padded;
+    std::vector<VoxelPackedVertex> packed;
+    size_t greedyVertexTotal = 0;
+    double padMs = 0.0;
+    double greedyMs = 0.0;
+    for (int r = 0; r < repeat; ++r)
+    {
+        greedyVertexTotal = 0;
+        for (const auto &[key, chunk] : world.chunks())
+        {
+            start = Clock::now();
+            fillPadded(world, chunk, padded);
+            padMs += msSince(start);
+            start = Clock::now();
+            VoxelMesher::build(padded, packed);
+            greedyMs += msSince(start);
+            greedyVertexTotal += packed.size();
+        }
+    }
+    padMs /= static_cast<double>(repeat * chunkCount);
+    greedyMs /= static_cast<double>(repeat * chunkCount);
+
+    const double legacyKB = static_cast<double>(legacyVertexTotal * sizeof(LegacyVertex)) / 1024.0;
+    const double greedyKB = static_cast<double>(greedyVertexTotal * sizeof(VoxelPackedVertex)) / 1024.0;
+    std::printf("voxel meshing @ LOAD_CHUNK_RADIUS=%d (%zu chunks of %dx%dx%d, avg of %d runs)\n",
+                LOAD_CHUNK_RADIUS, chunkCount, CHUNK_SIZE_X, WORLD_Y, CHUNK_SIZE_Z, repeat);
+    std::printf("  legacy  %6.3f ms/chunk (main thread)              verts %8zu  %2zu B/vert  VRAM %8.1f KB\n",
+                legacyMs, legacyVertexTotal, sizeof(LegacyVertex), legacyKB);
+    std::printf("  greedy  %6.3f ms/chunk (pad %.3f main + mesh %.3f worker)  verts %8zu  %2zu B/vert  VRAM %8.1f KB\n",
+                padMs + greedyMs, padMs, greedyMs, greedyVertexTotal, sizeof(VoxelPackedVertex), greedyKB);
+    std::printf("  ratio   time x%.1f, verts x%.1f, VRAM x%.1f\n",
+                legacyMs / std::max(padMs + greedyMs, 1e-9),
+                static_cast<double>(legacyVertexTotal) / static_cast<double>(std::max<size_t>(greedyVertexTotal, 1)),
+                legacyKB / std::max(greedyKB, 1e-9));
+    return 0;
+}
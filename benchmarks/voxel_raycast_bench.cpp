@@ -0,0 +1,235 @@
+// voxel_raycast_bench.cpp
+// 体素射线检测基准：旧版 t += 0.08 定步长采样 + 哈希密度查询 vs DDA 遍历 + 区块实心位图
+//
+// 世界按 VoxelScene 的区块布局生成（16x24x16 区块存于 unordered_map，地表起伏 + 洞穴 + 柱子，
+// 部分格子的密度落在阈值附近），射线从地表上方随机出发：
+//   - pick：准星选块，最远 8 格（raycastBlock）
+//   - los ：AI 视线 / 投射物线段，最远 32 格，走批量接口
+// 核对：DDA + 位图 与 DDA + 哈希密度 的命中格 / 法线 / 距离必须完全一致（位图与密度同步）；
+// 旧版定步长可能跨过方块棱角，只报告与 DDA 命中同一格的比例。
+// 用法：voxel_raycast_bench [rays] [chunksPerSide]   默认 200000 条，8x8 区块
+#include "../src/game/scene/voxel_raycast.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    using game::scene::VoxelOccupancy;
+    using game::scene::VoxelOccupancyCursor;
+    using game::scene::VoxelRay;
+    using game::scene::VoxelRayHit;
+
+    constexpr int kSizeX = VoxelOccupancy::SIZE_X;
+    constexpr int kSizeY = VoxelOccupancy::SIZE_Y;
+    constexpr int kSizeZ = VoxelOccupancy::SIZE_Z;
+    constexpr float kSolidDensity = 0.08f;
+
+    struct Rng
+    {
+        uint32_t state;
+        float next()
+        {
+            state = state * 1664525u + 1013904223u;
+            return static_cast<float>(state >> 8) / 16777216.0f;
+        }
+    };
+
+    struct Chunk
+    {
+        std::vector<unsigned char> voxels;
+        std::vector<float> densities;
+        VoxelOccupancy occupancy;
+    };
+
+    int64_t chunkKey(int chunkX, int chunkZ) { return (static_cast<int64_t>(chunkX) << 32) ^ static_cast<uint32_t>(chunkZ); }
+    int voxelIndex(int x, int y, int z) { return x + y * kSizeX + z * kSizeX * kSizeY; }
+
+    struct World
+    {
+        int width = 0;
+        int depth = 0;
+        std::unordered_map<int64_t, Chunk> chunks;
+
+        const Chunk *findChunk(int chunkX, int chunkZ) const
+        {
+            auto it = chunks.find(chunkKey(chunkX, chunkZ));
+            return it == chunks.end() ? nullptr : &it->second;
+        }
+
+        // 旧版 VoxelScene::densityAt：每次查询都走一次哈希表
+        float densityAt(int x, int y, int z) const
+        {
+            if (x < 0 || x >= width || y < 0 || y >= kSizeY || z < 0 || z >= depth)
+                return 0.0f;
+            const int chunkX = x / kSizeX;
+            const int chunkZ = z / kSizeZ;
+            const Chunk *chunk = findChunk(chunkX, chunkZ);
+            if (!chunk)
+                return 0.0f;
+            return chunk->densities[voxelIndex(x - chunkX * kSizeX, y, z - chunkZ * kSizeZ)];
+        }
+
+        bool isSolid(int x, int y, int z) const { return densityAt(x, y, z) > kSolidDensity; }
+    };
+
+    World makeWorld(int chunksPerSide)
+    {
+        World world;
+        world.width = chunksPerSide * kSizeX;
+        world.depth = chunksPerSide * kSizeZ;
+        Rng rng{0x5EEDu};
+        for (int cz = 0; cz < chunksPerSide; ++cz)
+            for (int cx = 0; cx < chunksPerSide; ++cx)
+            {
+                Chunk &chunk = world.chunks[chunkKey(cx, cz)];
+                chunk.voxels.assign(kSizeX * kSizeY * kSizeZ, 0);
+                chunk.densities.assign(kSizeX * kSizeY * kSizeZ, 0.0f);
+                for (int z = 0; z < kSizeZ; ++z)
+                    for (int x = 0; x < kSizeX; ++x)
+                    {
+                        const float wx = static_cast<float>(cx * kSizeX + x);
+                        const float wz = static_cast<float>(cz * kSizeZ + z);
+                        const int height = 8 + static_cast<int>(3.0f * std::sin(wx * 0.21f) + 3.0f * std::cos(wz * 0.17f));
+                        const bool pillar = rng.next() < 0.02f;
+                        const int top = pillar ? std::min(kSizeY - 2, height + 5) : height;
+                        for (int y = 0; y <= top; ++y)
+                        {
+                            const float cave = std::sin(wx * 0.13f) + std::cos(wz * 0.11f) + std::sin(y * 0.75f);
+                            if (y > 4 && y < height - 1 && cave > 2.0f)
+                                continue;
+                            const int index = voxelIndex(x, y, z);
+                            chunk.voxels[index] = 1;
+                            // 地表一层模拟笔刷留下的部分密度，覆盖阈值两侧
+                            chunk.densities[index] = y == top ? 0.04f + rng.next() * 0.96f : 1.0f;
+                        }
+                    }
+                for (int z = 0; z < kSizeZ; ++z)
+                    for (int y = 0; y < kSizeY; ++y)
+                        for (int x = 0; x < kSizeX; ++x)
+                            chunk.occupancy.assign(x, y, z, chunk.densities[voxelIndex(x, y, z)] > kSolidDensity);
+            }
+        return world;
+    }
+
+    std::vector<VoxelRay> makeRays(const World &world, int count, float maxDistance, uint32_t seed)
+    {
+        Rng rng{seed};
+        std::vector<VoxelRay> rays(count);
+        for (VoxelRay &ray : rays)
+        {
+            ray.origin = {rng.next() * world.width, 12.0f + rng.next() * 8.0f, rng.next() * world.depth};
+            const float yaw = rng.next() * 6.2831853f;
+            const float pitch = -1.1f + rng.next() * 1.3f;
+            ray.dir = {std::cos(yaw) * std::cos(pitch), std::sin(pitch), std::sin(yaw) * std::cos(pitch)};
+            ray.maxDistance = maxDistance;
+        }
+        return rays;
+    }
+
+    // ── 旧版：逐行复刻 VoxelScene::raycastBlock 的定步长采样 ──
+    struct LegacyHit
+    {
+        bool hit = false;
+        glm::ivec3 block{0};
+    };
+
+    LegacyHit legacyRaycast(const World &world, const VoxelRay &ray)
+    {
+        LegacyHit result;
+        for (float t = 0.0f; t < ray.maxDistance; t += 0.08f)
+        {
+            glm::vec3 sample = ray.origin + ray.dir * t;
+            glm::ivec3 block = glm::ivec3(glm::floor(sample));
+            if (world.isSolid(block.x, block.y, block.z))
+            {
+                result.hit = true;
+                result.block = block;
+                return result;
+            }
+        }
+        return result;
+    }
+
+    struct OccupancyLookup
+    {
+        const World *world = nullptr;
+        const VoxelOccupancy *operator()(int chunkX, int chunkZ) const
+        {
+            const Chunk *chunk = world->findChunk(chunkX, chunkZ);
+            return chunk ? &chunk->occupancy : nullptr;
+        }
+    };
+
+    template <typename Fn>
+    double measureSeconds(Fn &&fn)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    bool sameHit(const VoxelRayHit &a, const VoxelRayHit &b)
+    {
+        return a.hit == b.hit && (!a.hit || (a.cell == b.cell && a.normal == b.normal && a.distance == b.distance));
+    }
+
+    bool runCase(const char *name, const World &world, const std::vector<VoxelRay> &rays)
+    {
+        const size_t count = rays.size();
+        std::vector<LegacyHit> legacy(count);
+        std::vector<VoxelRayHit> viaDensity(count);
+        std::vector<VoxelRayHit> viaBitset(count);
+
+        const double legacySec = measureSeconds([&] {
+            for (size_t i = 0; i < count; ++i)
+                legacy[i] = legacyRaycast(world, rays[i]);
+        });
+        const double densitySec = measureSeconds([&] {
+            auto solid = [&](const glm::ivec3 &c) { return world.isSolid(c.x, c.y, c.z); };
+            for (size_t i = 0; i < count; ++i)
+                viaDensity[i] = game::scene::traceVoxelRay(rays[i], solid);
+        });
+        const double bitsetSec = measureSeconds([&] {
+            VoxelOccupancyCursor<OccupancyLookup> cursor(OccupancyLookup{&world}, world.width, world.depth);
+            game::scene::traceVoxelRays(rays.data(), count, viaBitset.data(), cursor);
+        });
+
+        size_t mismatches = 0, agree = 0, hits = 0;
+        long long visited = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (!sameHit(viaDensity[i], viaBitset[i]))
+                ++mismatches;
+            if (legacy[i].hit == viaBitset[i].hit && (!legacy[i].hit || legacy[i].block == viaBitset[i].cell))
+                ++agree;
+            hits += viaBitset[i].hit ? 1 : 0;
+            visited += viaBitset[i].visited;
+        }
+
+        const double n = static_cast<double>(count);
+        std::printf("  %-5s %12.2f %12.2f %12.2f %8.1fx %7.1f%% %7.1f%% %7.1f%s\n", name, n / legacySec * 1e-6,
+                    n / densitySec * 1e-6, n / bitsetSec * 1e-6, legacySec / bitsetSec, 100.0 * hits / n,
+                    100.0 * agree / n, static_cast<double>(visited) / n, mismatches == 0 ? "" : "  MISMATCH");
+        return mismatches == 0;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const int rayCount = argc > 1 ? std::max(1, std::atoi(argv[1])) : 200000;
+    const int chunksPerSide = argc > 2 ? std::max(1, std::atoi(argv[2])) : 8;
+    const World world = makeWorld(chunksPerSide);
+
+    std::printf("voxel raycast, %d rays, %dx%d chunks (Mrays/s)\n", rayCount, chunksPerSide, chunksPerSide);
+    std::printf("  %-5s %12s %12s %12s %9s %8s %8s %7s\n", "case", "step+hash", "dda+hash", "dda+bitset", "speedup",
+                "hit", "legacy=", "cells");
+    bool ok = runCase("pick", world, makeRays(world, rayCount, 8.0f, 0xA11CEu));
+    ok = runCase("los", world, makeRays(world, rayCount, 32.0f, 0xB0B0u)) && ok;
+    return ok ? 0 : 1;
+}
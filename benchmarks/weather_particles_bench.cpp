@@ -0,0 +1,464 @@
+// weather_particles_bench.cpp
+// 天气粒子基准：旧版 AoS 逐粒子更新 + ImGui 式抗锯齿线三角化 vs SoA + SIMD 积分 + 实例打包
+//
+// 模拟 WeatherSystem 雷雨天每帧的 CPU 负载（相机左右摇摆，地面走廊内持续产生水花）：
+//   - update：雨丝积分、落地水花（随机数）、越界重生、水花老化
+//   - submit：旧版每条雨线按 ImGui AddLine（非整数线宽、抗锯齿）生成 8 顶点 / 18 索引，
+//             新版每条雨线打包一个 24 字节实例，三角化交给 GPU
+// 两种实现用同一随机数种子，核对粒子位置逐位一致、随机数状态与水花数量一致。
+// 用法：weather_particles_bench [frames] [particleCounts...]   默认 240 帧，500 / 5000 / 50000 / 200000
+#include "../src/game/weather/weather_particles.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+    using namespace game::weather;
+
+    constexpr float kDisplayW = 1920.0f;
+    constexpr float kDisplayH = 1080.0f;
+    constexpr float kWindDx = -0.22f;
+    constexpr float kSpeed = 980.0f;   // 雷雨
+    constexpr float kLength = 25.0f;
+    constexpr float kAlpha = 0.85f;
+    constexpr float kIntensity = 1.0f;
+    constexpr float kDt = 1.0f / 60.0f;
+    constexpr size_t kMaxSplashes = 256;
+
+    struct Rng
+    {
+        uint64_t state = 0xDEADBEEF12345678ULL;
+        uint64_t next()
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return state;
+        }
+        float nextFloat() { return static_cast<float>(next() & 0xFFFFFF) / static_cast<float>(0x1000000); }
+    };
+
+    float cameraDriftX(int frame) { return std::sin(frame * 0.05f) * 6.0f; }
+    float cameraDriftY(int frame) { return std::cos(frame * 0.03f) * 1.5f; }
+
+    struct FrameGround
+    {
+        float gMin = kDisplayH * 0.33f;
+        float gMax = kDisplayH * 0.88f;
+    };
+
+    // ImDrawVert 布局
+    struct ImGuiVertex
+    {
+        float x, y, u, v;
+        uint32_t col;
+    };
+
+    struct Geometry
+    {
+        std::vector<ImGuiVertex> vertices;
+        std::vector<uint16_t> indices;
+        void clear() { vertices.clear(); indices.clear(); }
+    };
+
+    // ImGui AddPolyline 两点、抗锯齿、非整数线宽路径：每点 4 个顶点（两条羽化边 + 实心核心）
+    void tessellateLine(Geometry &g, float x0, float y0, float x1, float y1, uint32_t col, float thickness)
+    {
+        float dx = x1 - x0, dy = y1 - y0;
+        const float lenSq = dx * dx + dy * dy;
+        if (lenSq > 0.0f)
+        {
+            const float inv = 1.0f / std::sqrt(lenSq);
+            dx *= inv;
+            dy *= inv;
+        }
+        const float nx = dy, ny = -dx;
+        const float core = std::max(thickness - 1.0f, 0.0f) * 0.5f;
+        const float fringe = core + 1.0f;
+        const uint32_t transparent = col & 0x00FFFFFFu;
+        const auto base = static_cast<uint16_t>(g.vertices.size());
+        const float px[2] = {x0, x1}, py[2] = {y0, y1};
+        for (int p = 0; p < 2; ++p)
+        {
+            g.vertices.push_back({px[p] + nx * fringe, py[p] + ny * fringe, 0.0f, 0.0f, transparent});
+            g.vertices.push_back({px[p] + nx * core, py[p] + ny * core, 0.0f, 0.0f, col});
+            g.vertices.push_back({px[p] - nx * core, py[p] - ny * core, 0.0f, 0.0f, col});
+            g.vertices.push_back({px[p] - nx * fringe, py[p] - ny * fringe, 0.0f, 0.0f, transparent});
+        }
+        static constexpr uint16_t kIdx[18] = {1, 2, 6, 6, 5, 1, 0, 1, 5, 5, 4, 0, 2, 3, 7, 7, 6, 2};
+        for (uint16_t i : kIdx)
+            g.indices.push_back(static_cast<uint16_t>(base + i));
+    }
+
+    // ImGui AddEllipse：按段数取点，闭合细线（线宽 ≤ 1）抗锯齿描边每点 3 个顶点、每段 12 个索引
+    void tessellateEllipse(Geometry &g, float cx, float cy, float rx, float ry, int segments, uint32_t col)
+    {
+        const uint32_t transparent = col & 0x00FFFFFFu;
+        const auto base = static_cast<uint16_t>(g.vertices.size());
+        for (int i = 0; i < segments; ++i)
+        {
+            const float a = 6.2831853f * i / segments;
+            const float c = std::cos(a), s = std::sin(a);
+            const float px = cx + c * rx, py = cy + s * ry;
+            g.vertices.push_back({px + c, py + s, 0.0f, 0.0f, transparent});
+            g.vertices.push_back({px, py, 0.0f, 0.0f, col});
+            g.vertices.push_back({px - c, py - s, 0.0f, 0.0f, transparent});
+        }
+        for (int i = 0; i < segments; ++i)
+        {
+            const auto i0 = static_cast<uint16_t>(base + i * 3);
+            const auto i1 = static_cast<uint16_t>(base + ((i + 1) % segments) * 3);
+            const uint16_t idx[12] = {static_cast<uint16_t>(i1 + 0), static_cast<uint16_t>(i0 + 0), static_cast<uint16_t>(i0 + 1),
+                                      static_cast<uint16_t>(i0 + 1), static_cast<uint16_t>(i1 + 1), static_cast<uint16_t>(i1 + 0),
+                                      static_cast<uint16_t>(i1 + 1), static_cast<uint16_t>(i0 + 1), static_cast<uint16_t>(i0 + 2),
+                                      static_cast<uint16_t>(i0 + 2), static_cast<uint16_t>(i1 + 2), static_cast<uint16_t>(i1 + 1)};
+            g.indices.insert(g.indices.end(), idx, idx + 12);
+        }
+    }
+
+    // ── 旧版：逐行复刻 WeatherSystem 的 AoS 更新与 ImGui 绘制 ──
+    struct LegacyRain
+    {
+        float x, y, speed, length, alpha, depth;
+    };
+
+    struct LegacySplash
+    {
+        float x, y, radius, maxRadius, age, maxAge, alpha;
+        bool active = false;
+    };
+
+    struct LegacyWorld
+    {
+        Rng rng;
+        std::vector<LegacyRain> rain;
+        std::vector<LegacySplash> splashes;
+
+        void respawn(LegacyRain &p)
+        {
+            p.depth = rng.nextFloat();
+            p.x = rng.nextFloat() * (kDisplayW + 120.0f) - 60.0f;
+            const float depthScale = 0.55f + p.depth * 0.85f;
+            p.speed = kSpeed * depthScale * (0.78f + rng.nextFloat() * 0.36f);
+            p.length = kLength * (0.60f + p.depth * 0.95f) * (0.72f + rng.nextFloat() * 0.50f);
+            p.y = -p.length - rng.nextFloat() * 30.0f;
+            p.alpha = kAlpha * (0.32f + p.depth * 0.68f) * (0.45f + rng.nextFloat() * 0.45f) * kIntensity;
+        }
+
+        void resetSplash(LegacySplash &s, float x, float y)
+        {
+            s.x = x;
+            s.y = y;
+            s.radius = 0.0f;
+            s.maxRadius = 4.0f + rng.nextFloat() * 9.0f;
+            s.age = 0.0f;
+            s.maxAge = 0.22f + rng.nextFloat() * 0.20f;
+            s.alpha = 0.55f + rng.nextFloat() * 0.35f;
+            s.active = true;
+        }
+
+        void emitSplash(float x, float y)
+        {
+            for (auto &s : splashes)
+                if (!s.active)
+                {
+                    resetSplash(s, x, y);
+                    return;
+                }
+            if (splashes.size() < kMaxSplashes)
+            {
+                splashes.emplace_back();
+                resetSplash(splashes.back(), x, y);
+                return;
+            }
+            auto it = std::max_element(splashes.begin(), splashes.end(), [](const LegacySplash &a, const LegacySplash &b) {
+                float ar = a.maxAge > 0.0001f ? (a.age / a.maxAge) : a.age;
+                float br = b.maxAge > 0.0001f ? (b.age / b.maxAge) : b.age;
+                return ar < br;
+            });
+            resetSplash(*it, x, y);
+        }
+
+        void update(int frame, const FrameGround &ground)
+        {
+            const float driftX = cameraDriftX(frame);
+            const float driftY = cameraDriftY(frame);
+            for (auto &p : rain)
+            {
+                const float parallax = 0.68f + p.depth * 0.52f;
+                p.x -= driftX * parallax;
+                p.y -= driftY * parallax;
+                p.y += p.speed * kDt;
+                p.x += kWindDx * p.speed * kDt;
+
+                if (p.y >= ground.gMin && p.y <= ground.gMax + kDisplayH * 0.03f)
+                {
+                    const float spawnProb = kAlpha * kIntensity;
+                    if ((rng.next() & 0x7F) < static_cast<uint32_t>(spawnProb * 24))
+                    {
+                        const float sx = p.x + (static_cast<float>(rng.next() & 0x7) - 3.5f);
+                        const float sy = p.y + (static_cast<float>(rng.next() & 0x7) - 3.5f) * 0.4f;
+                        emitSplash(sx, sy);
+                    }
+                }
+                if (p.y > ground.gMax + 5.0f || p.x < -100.0f || p.x > kDisplayW + 100.0f)
+                    respawn(p);
+            }
+            for (auto &s : splashes)
+                if (s.active)
+                {
+                    s.x -= driftX;
+                    s.y -= driftY;
+                }
+            for (auto &s : splashes)
+            {
+                if (!s.active)
+                    continue;
+                s.age += kDt;
+                const float t = s.age / s.maxAge;
+                s.radius = s.maxRadius * t;
+                s.alpha = (1.0f - t * t) * 0.85f;
+                if (s.age >= s.maxAge)
+                    s.active = false;
+            }
+        }
+
+        void draw(Geometry &g) const
+        {
+            g.clear();
+            for (const auto &p : rain)
+            {
+                const float alpha = p.alpha * kIntensity;
+                if (alpha <= 0.01f)
+                    continue;
+                const uint8_t a = static_cast<uint8_t>(std::min(alpha * 255.0f, 255.0f));
+                const float dx = kWindDx * p.length;
+                const float dy = p.length;
+                tessellateLine(g, p.x, p.y, p.x + dx, p.y + dy,
+                               packColor(165 + static_cast<int>(p.depth * 20.0f), 205 + static_cast<int>(p.depth * 15.0f), 255, a),
+                               0.75f + p.depth * 0.95f);
+                if (alpha > 0.32f && p.depth > 0.35f)
+                    tessellateLine(g, p.x - 0.6f, p.y, p.x + dx - 0.6f, p.y + dy,
+                                   packColor(220, 240, 255, static_cast<int>(a * (0.18f + p.depth * 0.22f))),
+                                   0.5f + p.depth * 0.25f);
+            }
+            for (const auto &s : splashes)
+            {
+                if (!s.active)
+                    continue;
+                const float effAlpha = s.alpha * kIntensity;
+                if (effAlpha <= 0.01f)
+                    continue;
+                const uint8_t a = static_cast<uint8_t>(std::min(effAlpha * 210.0f, 210.0f));
+                tessellateEllipse(g, s.x, s.y, s.radius * 2.2f, s.radius * 0.75f, 22, packColor(160, 215, 255, a));
+                if (s.radius > 1.5f)
+                    tessellateEllipse(g, s.x, s.y, s.radius * 0.9f, s.radius * 0.32f, 16,
+                                      packColor(200, 235, 255, static_cast<int>(a * 0.6f)));
+            }
+        }
+    };
+
+    // ── 新版：SoA + weather_particles 内核，与 WeatherSystem::update 的调用方式相同 ──
+    struct SoaWorld
+    {
+        Rng rng;
+        RainStreaks rain;
+        RainSplashes splashes;
+        std::vector<uint32_t> flagged;
+
+        void respawn(size_t i)
+        {
+            const float depth = rng.nextFloat();
+            rain.depth[i] = depth;
+            rain.x[i] = rng.nextFloat() * (kDisplayW + 120.0f) - 60.0f;
+            const float depthScale = 0.55f + depth * 0.85f;
+            rain.speed[i] = kSpeed * depthScale * (0.78f + rng.nextFloat() * 0.36f);
+            rain.length[i] = kLength * (0.60f + depth * 0.95f) * (0.72f + rng.nextFloat() * 0.50f);
+            rain.y[i] = -rain.length[i] - rng.nextFloat() * 30.0f;
+            rain.alpha[i] = kAlpha * (0.32f + depth * 0.68f) * (0.45f + rng.nextFloat() * 0.45f) * kIntensity;
+        }
+
+        void resetSplash(size_t i, float x, float y)
+        {
+            splashes.x[i] = x;
+            splashes.y[i] = y;
+            splashes.radius[i] = 0.0f;
+            splashes.maxRadius[i] = 4.0f + rng.nextFloat() * 9.0f;
+            splashes.age[i] = 0.0f;
+            splashes.maxAge[i] = 0.22f + rng.nextFloat() * 0.20f;
+            splashes.alpha[i] = 0.55f + rng.nextFloat() * 0.35f;
+        }
+
+        void emitSplash(float x, float y)
+        {
+            const size_t count = particleCount(splashes);
+            if (count < kMaxSplashes)
+            {
+                resizeParticles(splashes, count + 1);
+                resetSplash(count, x, y);
+                return;
+            }
+            size_t oldest = 0;
+            float oldestRatio = -1.0f;
+            for (size_t i = 0; i < count; ++i)
+            {
+                const float maxAge = splashes.maxAge[i];
+                const float ratio = maxAge > 0.0001f ? (splashes.age[i] / maxAge) : splashes.age[i];
+                if (ratio > oldestRatio)
+                {
+                    oldestRatio = ratio;
+                    oldest = i;
+                }
+            }
+            resetSplash(oldest, x, y);
+        }
+
+        void update(int frame, const FrameGround &ground)
+        {
+            RainStepParams step;
+            step.dt = kDt;
+            step.driftX = cameraDriftX(frame);
+            step.driftY = cameraDriftY(frame);
+            step.windDx = kWindDx;
+            step.splashBand = true;
+            step.bandMinY = ground.gMin;
+            step.bandMaxY = ground.gMax + kDisplayH * 0.03f;
+            step.respawnY = ground.gMax + 5.0f;
+            step.minX = -100.0f;
+            step.maxX = kDisplayW + 100.0f;
+            integrateRain(rain, step, flagged);
+
+            const float spawnProb = kAlpha * kIntensity;
+            for (uint32_t i : flagged)
+            {
+                const float px = rain.x[i];
+                const float py = rain.y[i];
+                if (py >= step.bandMinY && py <= step.bandMaxY)
+                {
+                    if ((rng.next() & 0x7F) < static_cast<uint32_t>(spawnProb * 24))
+                    {
+                        const float sx = px + (static_cast<float>(rng.next() & 0x7) - 3.5f);
+                        const float sy = py + (static_cast<float>(rng.next() & 0x7) - 3.5f) * 0.4f;
+                        emitSplash(sx, sy);
+                    }
+                }
+                if (py > step.respawnY || px < step.minX || px > step.maxX)
+                    respawn(i);
+            }
+            ageSplashes(splashes, kDt, step.driftX, step.driftY);
+        }
+
+        void draw(std::vector<ParticleInstance> &lines, std::vector<ParticleInstance> &ellipses) const
+        {
+            lines.clear();
+            ellipses.clear();
+            packRain(rain, kIntensity, kWindDx, lines);
+            packSplashes(splashes, kIntensity, ellipses);
+        }
+    };
+
+    struct Result
+    {
+        double updateMs = 0.0;
+        double submitMs = 0.0;
+        size_t submitBytes = 0; // 最后一帧交给 GPU 的数据量
+    };
+
+    using Clock = std::chrono::steady_clock;
+    double msSince(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    // 初始粒子由同一随机数序列生成，两边起点完全一致
+    template <typename AddFn>
+    void seedRain(Rng &rng, int count, AddFn &&add)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            const float depth = rng.nextFloat();
+            const float x = rng.nextFloat() * (kDisplayW + 120.0f) - 60.0f;
+            const float y = rng.nextFloat() * -kDisplayH;
+            const float depthScale = 0.55f + depth * 0.85f;
+            const float speed = kSpeed * depthScale * (0.78f + rng.nextFloat() * 0.36f);
+            const float length = kLength * (0.60f + depth * 0.95f) * (0.72f + rng.nextFloat() * 0.50f);
+            const float alpha = kAlpha * (0.32f + depth * 0.68f) * (0.45f + rng.nextFloat() * 0.45f) * kIntensity;
+            add(LegacyRain{x, y, speed, length, alpha, depth});
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const int frames = argc > 1 ? std::max(1, std::atoi(argv[1])) : 240;
+    std::vector<int> counts;
+    for (int i = 2; i < argc; ++i)
+        counts.push_back(std::max(1, std::atoi(argv[i])));
+    if (counts.empty())
+        counts = {500, 5000, 50000, 200000};
+
+    bool ok = true;
+    std::printf("weather particles, %d frames, kernel %s (thunderstorm, swaying camera)\n", frames, particleKernelName());
+    std::printf("  %9s | %12s %12s %7s | %12s %12s %7s | %10s %10s\n", "particles", "aos upd p/ms", "soa upd p/ms",
+                "speedup", "imgui p/ms", "inst p/ms", "speedup", "imgui KB/f", "inst KB/f");
+    for (int count : counts)
+    {
+        LegacyWorld legacy;
+        SoaWorld soa;
+        seedRain(legacy.rng, count, [&](const LegacyRain &p) { legacy.rain.push_back(p); });
+        seedRain(soa.rng, count, [&](const LegacyRain &p) {
+            const size_t i = particleCount(soa.rain);
+            resizeParticles(soa.rain, i + 1);
+            soa.rain.x[i] = p.x;
+            soa.rain.y[i] = p.y;
+            soa.rain.speed[i] = p.speed;
+            soa.rain.length[i] = p.length;
+            soa.rain.alpha[i] = p.alpha;
+            soa.rain.depth[i] = p.depth;
+        });
+
+        const FrameGround ground;
+        Geometry geometry;
+        std::vector<ParticleInstance> lines, ellipses;
+        Result a, b;
+        for (int f = 0; f < frames; ++f)
+        {
+            auto t0 = Clock::now();
+            legacy.update(f, ground);
+            a.updateMs += msSince(t0);
+            t0 = Clock::now();
+            legacy.draw(geometry);
+            a.submitMs += msSince(t0);
+
+            t0 = Clock::now();
+            soa.update(f, ground);
+            b.updateMs += msSince(t0);
+            t0 = Clock::now();
+            soa.draw(lines, ellipses);
+            b.submitMs += msSince(t0);
+        }
+        a.submitBytes = geometry.vertices.size() * sizeof(ImGuiVertex) + geometry.indices.size() * sizeof(uint16_t);
+        b.submitBytes = (lines.size() + ellipses.size()) * sizeof(ParticleInstance);
+
+        // 核对：雨丝逐位一致，随机数状态一致，存活水花数一致
+        bool same = legacy.rng.state == soa.rng.state;
+        for (int i = 0; same && i < count; ++i)
+            same = legacy.rain[i].x == soa.rain.x[i] && legacy.rain[i].y == soa.rain.y[i];
+        const size_t legacyAlive = static_cast<size_t>(std::count_if(legacy.splashes.begin(), legacy.splashes.end(),
+                                                                     [](const LegacySplash &s) { return s.active; }));
+        same = same && legacyAlive == particleCount(soa.splashes);
+        ok = ok && same;
+
+        const double particles = static_cast<double>(count) * frames;
+        std::printf("  %9d | %12.0f %12.0f %6.1fx | %12.0f %12.0f %6.1fx | %10.1f %10.1f%s\n", count,
+                    particles / a.updateMs, particles / b.updateMs, a.updateMs / b.updateMs,
+                    particles / a.submitMs, particles / b.submitMs, a.submitMs / b.submitMs,
+                    a.submitBytes / 1024.0, b.submitBytes / 1024.0, same ? "" : "  MISMATCH");
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,89 @@
+#include "sound_bank.h"
+#include <SDL3_mixer/SDL_mixer.h>
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <filesystem>
+#include <spdlog/spdlog.h>
+
+namespace engine::audio
+{
+    SoundBank::SoundBank(MIX_Mixer *mixer)
+        : _mixer(mixer) {}
+
+    SoundBank::~SoundBank()
+    {
+        clear();
+    }
+
+    SoundId SoundBank::load(const std::string &name, const std::string &path, const SoundDesc &desc)
+    {
+        if (auto it = _ids.find(name); it != _ids.end())
+            return it->second;
+        if (!_mixer || _entries.size() >= INVALID_SOUND)
+            return INVALID_SOUND;
+
+        // predecode = true：整段解码成 PCM，之后混音只做拷贝与增益
+        MIX_Audio *audio = MIX_LoadAudio(_mixer, path.c_str(), true);
+        if (!audio)
+        {
+            spdlog::error("SoundBank: 加载音效失败 '{}' {}", path, SDL_GetError());
+            return INVALID_SOUND;
+        }
+
+        const auto id = static_cast<SoundId>(_entries.size());
+        _entries.push_back({name, path, audio, desc});
+        _ids.emplace(name, id);
+        spdlog::debug("SoundBank: 已解码音效 '{}' -> {}", path, id);
+        return id;
+    }
+
+    int SoundBank::loadDirectory(const std::string &dir, const SoundDesc &desc)
+    {
+        namespace fs = std::filesystem;
+        std::error_code ec;
+        if (!fs::is_directory(dir, ec))
+            return 0;
+
+        std::vector<fs::path> files;
+        for (const auto &entry : fs::directory_iterator(dir, ec))
+        {
+            if (!entry.is_regular_file())
+                continue;
+            std::string ext = entry.path().extension().string();
+            std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            if (ext == ".wav" || ext == ".ogg" || ext == ".mp3")
+                files.push_back(entry.path());
+        }
+        std::sort(files.begin(), files.end());
+
+        const auto start = std::chrono::steady_clock::now();
+        int loaded = 0;
+        for (const fs::path &file : files)
+        {
+            const size_t before = _entries.size();
+            if (load(file.stem().string(), file.generic_string(), desc) != INVALID_SOUND && _entries.size() > before)
+                ++loaded;
+        }
+        _load_ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+        spdlog::info("SoundBank: {} 解码 {} 个音效，耗时 {:.1f} ms", dir, loaded, _load_ms);
+        return loaded;
+    }
+
+    SoundId SoundBank::find(const std::string &name) const
+    {
+        auto it = _ids.find(name);
+        return it != _ids.end() ? it->second : INVALID_SOUND;
+    }
+
+    void SoundBank::clear()
+    {
+        for (SoundEntry &entry : _entries)
+        {
+            if (entry.audio)
+                MIX_DestroyAudio(entry.audio);
+        }
+        _entries.clear();
+        _ids.clear();
+    }
+} // namespace engine::audio
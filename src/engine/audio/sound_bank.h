@@ -0,0 +1,72 @@
+// 音效库
+// sound_bank.h
+//   - 加载期把音效整段解码为 PCM（MIX_LoadAudio predecode），播放时不再在任何线程上解码
+//   - 每个音效有稳定的 SoundId（注册顺序下标）与播放参数（音量、优先级、并发上限、衰减距离）
+//   - 只在主线程注册 / 查询；VoicePool 的播放指令自带所需参数，工作线程不读音效库
+#pragma once
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct MIX_Mixer;
+struct MIX_Audio;
+
+namespace engine::audio
+{
+    using SoundId = uint16_t;
+    constexpr SoundId INVALID_SOUND = 0xFFFF;
+
+    /**
+     * @brief 音效的播放参数
+     */
+    struct SoundDesc
+    {
+        float gain = 1.0f;
+        uint8_t priority = 128;    // 语音池满时，高优先级可抢占低优先级
+        uint8_t maxInstances = 4;  // 同一音效同时发声的上限，超出时顶替最早的实例
+        float minIntervalMs = 30.0f; // 同一音效两次起播的最小间隔，更密的触发合并为一次
+        float minDistance = 96.0f;   // 以内不衰减（像素）
+        float maxDistance = 1200.0f; // 以外直接剔除（像素）
+    };
+
+    struct SoundEntry
+    {
+        std::string name;
+        std::string path;
+        MIX_Audio *audio = nullptr; // 已解码的 PCM
+        SoundDesc desc;
+    };
+
+    class SoundBank
+    {
+    public:
+        explicit SoundBank(MIX_Mixer *mixer);
+        ~SoundBank();
+
+        SoundBank(const SoundBank &) = delete;
+        SoundBank &operator=(const SoundBank &) = delete;
+
+        /**
+         * @brief 加载并解码一个音效；同名音效已存在时直接返回原 id
+         * @return 失败返回 INVALID_SOUND
+         */
+        SoundId load(const std::string &name, const std::string &path, const SoundDesc &desc = {});
+        /** @brief 加载目录下所有 .wav / .ogg / .mp3（按文件名去扩展名注册），返回新加载的数量 */
+        int loadDirectory(const std::string &dir, const SoundDesc &desc = {});
+
+        SoundId find(const std::string &name) const;
+        const SoundEntry *entry(SoundId id) const { return id < _entries.size() ? &_entries[id] : nullptr; }
+        size_t size() const { return _entries.size(); }
+        float lastLoadMs() const { return _load_ms; }
+
+        // 释放全部音效；调用前须确保没有语音在播放（见 VoicePool::flush）
+        void clear();
+
+    private:
+        MIX_Mixer *_mixer = nullptr;
+        std::vector<SoundEntry> _entries;
+        std::unordered_map<std::string, SoundId> _ids;
+        float _load_ms = 0.0f; // 最近一次 loadDirectory 的解码耗时
+    };
+} // namespace engine::audio
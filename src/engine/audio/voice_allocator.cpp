@@ -0,0 +1,127 @@
+#include "voice_allocator.h"
+#include <algorithm>
+#include <limits>
+
+namespace engine::audio
+{
+    VoiceAllocator::VoiceAllocator(int voiceCount)
+        : _slots(static_cast<size_t>(std::max(voiceCount, 0)))
+    {
+    }
+
+    VoiceChoice VoiceAllocator::choose(const VoiceRequest &request, double nowMs) const
+    {
+        if (request.sound == INVALID_SOUND || request.gain < AUDIBLE_GAIN)
+            return {VoiceDecision::Culled, -1};
+
+        // 没有任何语音（如混音器未能创建音轨）：一律丢弃
+        if (_slots.empty())
+            return {VoiceDecision::Rejected, -1};
+
+        if (request.sound < _last_start_ms.size() && request.minIntervalMs > 0.0f &&
+            nowMs - _last_start_ms[request.sound] < request.minIntervalMs)
+            return {VoiceDecision::Coalesced, -1};
+
+        int instances = 0;
+        int oldestSame = -1;
+        int freeSlot = -1;
+        int victim = -1;
+        for (int i = 0; i < static_cast<int>(_slots.size()); ++i)
+        {
+            const VoiceSlot &voice = _slots[static_cast<size_t>(i)];
+            if (!voice.active)
+            {
+                if (freeSlot < 0)
+                    freeSlot = i;
+                continue;
+            }
+            if (voice.sound == request.sound)
+            {
+                ++instances;
+                if (oldestSame < 0 || voice.startMs < _slots[static_cast<size_t>(oldestSame)].startMs)
+                    oldestSame = i;
+            }
+            // 最不重要：优先级最低，其次音量最小，再次最早起播
+            if (victim < 0)
+            {
+                victim = i;
+                continue;
+            }
+            const VoiceSlot &worst = _slots[static_cast<size_t>(victim)];
+            if (voice.priority != worst.priority ? voice.priority < worst.priority
+                : voice.gain != worst.gain      ? voice.gain < worst.gain
+                                                : voice.startMs < worst.startMs)
+                victim = i;
+        }
+
+        if (instances >= std::max<int>(request.maxInstances, 1))
+            return {VoiceDecision::Replace, oldestSame};
+        if (freeSlot >= 0)
+            return {VoiceDecision::Start, freeSlot};
+
+        const VoiceSlot &worst = _slots[static_cast<size_t>(victim)];
+        const bool moreImportant = request.priority != worst.priority ? request.priority > worst.priority
+                                                                      : request.gain > worst.gain;
+        return moreImportant ? VoiceChoice{VoiceDecision::Steal, victim} : VoiceChoice{VoiceDecision::Rejected, -1};
+    }
+
+    void VoiceAllocator::start(int slot, const VoiceRequest &request, PlayId playId, double nowMs)
+    {
+        VoiceSlot &voice = _slots[static_cast<size_t>(slot)];
+        if (!voice.active)
+            ++_active_count;
+        voice.active = true;
+        voice.sound = request.sound;
+        voice.playId = playId;
+        voice.priority = request.priority;
+        voice.gain = request.gain;
+        voice.startMs = nowMs;
+
+        if (request.sound >= _last_start_ms.size())
+            _last_start_ms.resize(request.sound + 1u, -std::numeric_limits<double>::infinity());
+        _last_start_ms[request.sound] = nowMs;
+    }
+
+    void VoiceAllocator::release(int slot)
+    {
+        VoiceSlot &voice = _slots[static_cast<size_t>(slot)];
+        if (voice.active)
+            --_active_count;
+        voice = VoiceSlot{};
+    }
+
+    void VoiceAllocator::demote(int slot)
+    {
+        VoiceSlot &voice = _slots[static_cast<size_t>(slot)];
+        voice.playId = 0;
+        voice.priority = 0;
+        voice.gain = 0.0f;
+    }
+
+    void VoiceAllocator::releaseAll()
+    {
+        for (VoiceSlot &voice : _slots)
+            voice = VoiceSlot{};
+        _active_count = 0;
+    }
+
+    int VoiceAllocator::findPlay(PlayId playId) const
+    {
+        for (int i = 0; i < static_cast<int>(_slots.size()); ++i)
+        {
+            if (_slots[static_cast<size_t>(i)].active && _slots[static_cast<size_t>(i)].playId == playId)
+                return i;
+        }
+        return -1;
+    }
+
+    float VoiceAllocator::attenuation(float distance, float minDistance, float maxDistance)
+    {
+        if (distance <= minDistance)
+            return 1.0f;
+        if (distance >= maxDistance || maxDistance <= minDistance)
+            return 0.0f;
+        const float t = 1.0f - (distance - minDistance) / (maxDistance - minDistance);
+        return t * t;
+    }
+} // namespace engine::audio
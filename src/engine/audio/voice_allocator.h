@@ -0,0 +1,83 @@
+// 语音分配策略
+// voice_allocator.h
+//   纯逻辑，不依赖 SDL_mixer：VoicePool 在音频线程上用它决定每条播放指令落在哪个语音上
+//   1. 距离剔除：超出 maxDistance、或衰减后听不见的请求直接丢弃
+//   2. 合并：同一音效在 minIntervalMs 内的重复触发只播一次
+//   3. 并发上限：同一音效达到 maxInstances 时顶替该音效最早的实例
+//   4. 空闲语音：直接使用
+//   5. 抢占：池满时与最不重要的语音比较（优先级，其次有效音量），更重要才抢占，否则丢弃
+#pragma once
+#include "sound_bank.h"
+#include <cstdint>
+#include <vector>
+
+namespace engine::audio
+{
+    using PlayId = uint32_t; // 0 = 无效
+
+    struct VoiceRequest
+    {
+        SoundId sound = INVALID_SOUND;
+        uint8_t priority = 128;
+        uint8_t maxInstances = 4;
+        float gain = 1.0f;          // 已乘上距离衰减的有效音量
+        float minIntervalMs = 0.0f;
+    };
+
+    struct VoiceSlot
+    {
+        bool active = false;
+        SoundId sound = INVALID_SOUND;
+        PlayId playId = 0;
+        uint8_t priority = 0;
+        float gain = 0.0f;
+        double startMs = 0.0;
+    };
+
+    enum class VoiceDecision : uint8_t
+    {
+        Start = 0,   // 使用空闲语音
+        Replace,     // 顶替同一音效最早的实例
+        Steal,       // 抢占其他音效的语音
+        Coalesced,   // 与刚起播的同一音效合并
+        Culled,      // 距离剔除 / 听不见
+        Rejected,    // 池满且优先级不够
+    };
+
+    struct VoiceChoice
+    {
+        VoiceDecision decision = VoiceDecision::Rejected;
+        int slot = -1;
+    };
+
+    class VoiceAllocator
+    {
+    public:
+        static constexpr float AUDIBLE_GAIN = 0.01f;
+
+        // voiceCount 可以为 0：此时所有请求都被 Rejected
+        explicit VoiceAllocator(int voiceCount);
+
+        /** @brief 只做决策不修改状态；decision 为 Start / Replace / Steal 时 slot 有效 */
+        VoiceChoice choose(const VoiceRequest &request, double nowMs) const;
+        /** @brief 在 slot 上登记新语音（并记录该音效的起播时间，用于合并） */
+        void start(int slot, const VoiceRequest &request, PlayId playId, double nowMs);
+        void release(int slot);
+        // 正在淡出的语音：不再响应 stop，并成为最先被抢占的对象，直到真正停下后由 release 回收
+        void demote(int slot);
+        void releaseAll();
+
+        int findPlay(PlayId playId) const;
+        int activeCount() const { return _active_count; }
+        int voiceCount() const { return static_cast<int>(_slots.size()); }
+        const VoiceSlot &slot(int index) const { return _slots[static_cast<size_t>(index)]; }
+
+        /** @brief 距离衰减：minDistance 以内为 1，maxDistance 处降到 0（平方曲线） */
+        static float attenuation(float distance, float minDistance, float maxDistance);
+
+    private:
+        std::vector<VoiceSlot> _slots;
+        std::vector<double> _last_start_ms; // 按 SoundId 下标
+        int _active_count = 0;
+    };
+} // namespace engine::audio
@@ -0,0 +1,315 @@
+#include "voice_pool.h"
+#include "../core/profiler.h"
+#include <SDL3_mixer/SDL_mixer.h>
+#include <algorithm>
+#include <chrono>
+#include <spdlog/spdlog.h>
+
+namespace engine::audio
+{
+    VoicePool::VoicePool(MIX_Mixer *mixer, int voiceCount)
+        : _mixer(mixer), _allocator(voiceCount)
+    {
+        _tracks.reserve(static_cast<size_t>(_allocator.voiceCount()));
+        for (int i = 0; i < _allocator.voiceCount(); ++i)
+        {
+            MIX_Track *track = _mixer ? MIX_CreateTrack(_mixer) : nullptr;
+            if (!track)
+            {
+                spdlog::error("VoicePool: 创建第 {} 个语音失败: {}", i, SDL_GetError());
+                break;
+            }
+            _tracks.push_back(track);
+        }
+        // 创建失败时按实际数量收缩，分配器只管理真实存在的语音
+        if (static_cast<int>(_tracks.size()) != _allocator.voiceCount())
+            _allocator = VoiceAllocator(static_cast<int>(_tracks.size()));
+
+        _worker = std::thread([this] { workerLoop(); });
+        spdlog::debug("VoicePool: {} 个语音，命令队列 {}", _tracks.size(), COMMAND_CAPACITY);
+    }
+
+    VoicePool::~VoicePool()
+    {
+        _stopping.store(true, std::memory_order_release);
+        _wake.fetch_add(1, std::memory_order_release);
+        _wake.notify_one();
+        if (_worker.joinable())
+            _worker.join();
+
+        for (MIX_Track *track : _tracks)
+        {
+            MIX_StopTrack(track, 0);
+            MIX_DestroyTrack(track);
+        }
+        _tracks.clear();
+    }
+
+    // --- 游戏线程接口 ---
+
+    bool VoicePool::enqueue(const AudioCommand &command)
+    {
+        if (!_commands.push(command))
+        {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        _wake.fetch_add(1, std::memory_order_release);
+        _wake.notify_one();
+        return true;
+    }
+
+    PlayId VoicePool::submitPlay(const SoundBank &bank, SoundId sound, bool positional, glm::vec2 position, float gain)
+    {
+        const SoundEntry *entry = bank.entry(sound);
+        if (!entry || !entry->audio)
+            return 0;
+
+        AudioCommand command;
+        command.type = AudioCommand::Type::Play;
+        command.positional = positional;
+        command.priority = entry->desc.priority;
+        command.maxInstances = entry->desc.maxInstances;
+        command.sound = sound;
+        command.playId = _next_play_id.fetch_add(1, std::memory_order_relaxed);
+        command.audio = entry->audio;
+        command.gain = entry->desc.gain * gain;
+        command.minIntervalMs = entry->desc.minIntervalMs;
+        command.minDistance = entry->desc.minDistance;
+        command.maxDistance = entry->desc.maxDistance;
+        command.position = position;
+        return enqueue(command) ? command.playId : 0;
+    }
+
+    PlayId VoicePool::play(const SoundBank &bank, SoundId sound, glm::vec2 position, float gain)
+    {
+        return submitPlay(bank, sound, true, position, gain);
+    }
+
+    PlayId VoicePool::play2D(const SoundBank &bank, SoundId sound, float gain)
+    {
+        return submitPlay(bank, sound, false, {0.0f, 0.0f}, gain);
+    }
+
+    void VoicePool::stop(PlayId playId, int fadeMs)
+    {
+        if (playId == 0)
+            return;
+        AudioCommand command;
+        command.type = AudioCommand::Type::Stop;
+        command.playId = playId;
+        command.fadeMs = fadeMs;
+        enqueue(command);
+    }
+
+    void VoicePool::stopAll()
+    {
+        AudioCommand command;
+        command.type = AudioCommand::Type::StopAll;
+        enqueue(command);
+    }
+
+    void VoicePool::setListener(glm::vec2 position)
+    {
+        if (_listener_sent_valid && position == _listener_sent)
+            return;
+        AudioCommand command;
+        command.type = AudioCommand::Type::SetListener;
+        command.position = position;
+        if (enqueue(command))
+        {
+            _listener_sent = position;
+            _listener_sent_valid = true;
+        }
+    }
+
+    void VoicePool::flush()
+    {
+        AudioCommand command;
+        command.type = AudioCommand::Type::Sync;
+        command.playId = _sync_ticket.fetch_add(1, std::memory_order_relaxed) + 1;
+        // 同步命令不能丢：队列满时让出时间片等音频线程腾出空位
+        while (!_commands.push(command))
+            std::this_thread::yield();
+        _wake.fetch_add(1, std::memory_order_release);
+        _wake.notify_one();
+
+        for (uint32_t done = _sync_done.load(std::memory_order_acquire); done < command.playId;
+             done = _sync_done.load(std::memory_order_acquire))
+            _sync_done.wait(done, std::memory_order_acquire);
+    }
+
+    VoiceStats VoicePool::getStats() const
+    {
+        VoiceStats stats;
+        stats.voiceCount = static_cast<int>(_tracks.size());
+        stats.activeVoices = _active_voices.load(std::memory_order_relaxed);
+        stats.peakVoices = _peak_voices.load(std::memory_order_relaxed);
+        stats.started = _started.load(std::memory_order_relaxed);
+        stats.replaced = _replaced.load(std::memory_order_relaxed);
+        stats.stolen = _stolen.load(std::memory_order_relaxed);
+        stats.coalesced = _coalesced.load(std::memory_order_relaxed);
+        stats.culled = _culled.load(std::memory_order_relaxed);
+        stats.rejected = _rejected.load(std::memory_order_relaxed);
+        stats.dropped = _dropped.load(std::memory_order_relaxed);
+        const uint64_t count = _command_count.load(std::memory_order_relaxed);
+        stats.commandAvgUs = count ? static_cast<float>(static_cast<double>(_command_nanos.load(std::memory_order_relaxed)) /
+                                                        static_cast<double>(count) / 1000.0)
+                                   : 0.0f;
+        return stats;
+    }
+
+    // --- 音频线程 ---
+
+    void VoicePool::workerLoop()
+    {
+        LSL_PROFILE_THREAD("VoicePool");
+        const auto epoch = std::chrono::steady_clock::now();
+        for (;;)
+        {
+            // 先取序号再清空队列：清空之后入队的命令一定会让 wait 立即返回
+            const uint32_t seen = _wake.load(std::memory_order_acquire);
+            AudioCommand command;
+            while (_commands.pop(command))
+            {
+                LSL_PROFILE_ZONE("VoicePool::execute");
+                const auto start = std::chrono::steady_clock::now();
+                execute(command, std::chrono::duration<double, std::milli>(start - epoch).count());
+                _command_nanos.fetch_add(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                             std::chrono::steady_clock::now() - start).count()),
+                                         std::memory_order_relaxed);
+                _command_count.fetch_add(1, std::memory_order_relaxed);
+            }
+            _active_voices.store(_allocator.activeCount(), std::memory_order_relaxed);
+            if (_stopping.load(std::memory_order_acquire))
+                return;
+            _wake.wait(seen, std::memory_order_acquire);
+        }
+    }
+
+    void VoicePool::execute(const AudioCommand &command, double nowMs)
+    {
+        switch (command.type)
+        {
+        case AudioCommand::Type::Play:
+            executePlay(command, nowMs);
+            break;
+        case AudioCommand::Type::Stop:
+            if (const int slot = _allocator.findPlay(command.playId); slot >= 0)
+                stopSlot(slot, command.fadeMs);
+            break;
+        case AudioCommand::Type::StopAll:
+            for (MIX_Track *track : _tracks)
+                MIX_StopTrack(track, 0);
+            _allocator.releaseAll();
+            break;
+        case AudioCommand::Type::SetListener:
+            _listener = command.position;
+            break;
+        case AudioCommand::Type::Sync:
+            _sync_done.store(command.playId, std::memory_order_release);
+            _sync_done.notify_all();
+            break;
+        }
+    }
+
+    void VoicePool::executePlay(const AudioCommand &command, double nowMs)
+    {
+        float gain = command.gain;
+        float pan = 0.0f;
+        if (command.positional)
+        {
+            const glm::vec2 delta = command.position - _listener;
+            const float distance = glm::length(delta);
+            if (distance >= command.maxDistance)
+            {
+                _culled.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            gain *= VoiceAllocator::attenuation(distance, command.minDistance, command.maxDistance);
+            pan = std::clamp(delta.x / command.maxDistance, -1.0f, 1.0f);
+        }
+
+        VoiceRequest request;
+        request.sound = command.sound;
+        request.priority = command.priority;
+        request.maxInstances = command.maxInstances;
+        request.gain = gain;
+        request.minIntervalMs = command.minIntervalMs;
+
+        reclaimFinished();
+        const VoiceChoice choice = _allocator.choose(request, nowMs);
+        switch (choice.decision)
+        {
+        case VoiceDecision::Start:
+            _started.fetch_add(1, std::memory_order_relaxed);
+            break;
+        case VoiceDecision::Replace:
+            _replaced.fetch_add(1, std::memory_order_relaxed);
+            break;
+        case VoiceDecision::Steal:
+            _stolen.fetch_add(1, std::memory_order_relaxed);
+            break;
+        case VoiceDecision::Coalesced:
+            _coalesced.fetch_add(1, std::memory_order_relaxed);
+            return;
+        case VoiceDecision::Culled:
+            _culled.fetch_add(1, std::memory_order_relaxed);
+            return;
+        case VoiceDecision::Rejected:
+            _rejected.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        // 被顶替 / 抢占的语音直接切断；同一 MIX_Track 随即换上新音效
+        MIX_Track *track = _tracks[static_cast<size_t>(choice.slot)];
+        if (_allocator.slot(choice.slot).active)
+            MIX_StopTrack(track, 0);
+
+        MIX_SetTrackAudio(track, command.audio);
+        MIX_SetTrackGain(track, gain);
+        if (command.positional)
+        {
+            const MIX_StereoGains stereo{std::min(1.0f, 1.0f - pan), std::min(1.0f, 1.0f + pan)};
+            MIX_SetTrackStereo(track, &stereo);
+        }
+        else
+        {
+            MIX_SetTrackStereo(track, nullptr);
+        }
+        if (!MIX_PlayTrack(track, 0))
+        {
+            spdlog::debug("VoicePool: 播放失败 sound={} {}", command.sound, SDL_GetError());
+            _allocator.release(choice.slot);
+            return;
+        }
+        _allocator.start(choice.slot, request, command.playId, nowMs);
+
+        const int active = _allocator.activeCount();
+        if (active > _peak_voices.load(std::memory_order_relaxed))
+            _peak_voices.store(active, std::memory_order_relaxed);
+    }
+
+    void VoicePool::reclaimFinished()
+    {
+        for (int i = 0; i < _allocator.voiceCount(); ++i)
+        {
+            if (_allocator.slot(i).active && !MIX_TrackPlaying(_tracks[static_cast<size_t>(i)]))
+                _allocator.release(i);
+        }
+    }
+
+    void VoicePool::stopSlot(int slot, int fadeMs)
+    {
+        MIX_Track *track = _tracks[static_cast<size_t>(slot)];
+        if (fadeMs <= 0)
+        {
+            MIX_StopTrack(track, 0);
+            _allocator.release(slot);
+            return;
+        }
+        // 淡出期间语音仍占着槽位，结束后由 reclaimFinished 回收
+        MIX_StopTrack(track, MIX_TrackMSToFrames(track, fadeMs));
+        _allocator.demote(slot);
+    }
+} // namespace engine::audio
@@ -0,0 +1,139 @@
+// 语音池
+// voice_pool.h
+//   - 启动时一次性创建固定数量的 MIX_Track（语音），运行期不再创建 / 销毁
+//   - 游戏逻辑通过 play / stop / setListener 写入无锁命令队列后立即返回，从不等待混音器锁
+//   - 专用音频线程取出命令，按 VoiceAllocator 的策略分配语音并调用 SDL_mixer
+//   - 同时发声的语音数恒定不超过池大小，混音开销随之有上界；队列满时命令被丢弃并计数
+#pragma once
+#include "sound_bank.h"
+#include "voice_allocator.h"
+#include "../utils/bounded_queue.h"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <glm/glm.hpp>
+
+struct MIX_Track;
+
+namespace engine::audio
+{
+    /**
+     * @brief 音频线程命令（按值拷贝进环形队列）
+     * 播放命令在入队时就带上音效的 PCM 与参数，音频线程不访问 SoundBank
+     */
+    struct AudioCommand
+    {
+        enum class Type : uint8_t
+        {
+            Play = 0,
+            Stop,
+            StopAll,
+            SetListener,
+            Sync,
+        };
+
+        Type type = Type::Play;
+        bool positional = false;
+        uint8_t priority = 128;
+        uint8_t maxInstances = 4;
+        SoundId sound = INVALID_SOUND;
+        PlayId playId = 0; // Sync 时为序号
+        MIX_Audio *audio = nullptr;
+        float gain = 1.0f;
+        float minIntervalMs = 0.0f;
+        float minDistance = 0.0f;
+        float maxDistance = 0.0f;
+        int fadeMs = 0;
+        glm::vec2 position{0.0f, 0.0f};
+    };
+
+    /**
+     * @brief 统计（供调试面板读取），计数为自启动以来的总量
+     */
+    struct VoiceStats
+    {
+        int voiceCount = 0;
+        int activeVoices = 0;
+        int peakVoices = 0;
+        uint64_t started = 0;   // 空闲语音起播
+        uint64_t replaced = 0;  // 达到单音效并发上限，顶替最早实例
+        uint64_t stolen = 0;    // 抢占其他音效
+        uint64_t coalesced = 0; // 间隔过短被合并
+        uint64_t culled = 0;    // 距离剔除
+        uint64_t rejected = 0;  // 池满且优先级不够
+        uint64_t dropped = 0;   // 命令队列已满
+        float commandAvgUs = 0.0f; // 音频线程处理单条命令的平均耗时
+    };
+
+    class VoicePool
+    {
+    public:
+        static constexpr int DEFAULT_VOICE_COUNT = 32;
+        static constexpr size_t COMMAND_CAPACITY = 1024;
+
+        explicit VoicePool(MIX_Mixer *mixer, int voiceCount = DEFAULT_VOICE_COUNT);
+        ~VoicePool();
+
+        VoicePool(const VoicePool &) = delete;
+        VoicePool &operator=(const VoicePool &) = delete;
+
+        // --- 游戏线程接口（无锁，立即返回）---
+
+        /**
+         * @brief 在世界坐标 position 处播放音效（按与听者的距离衰减、左右声像）
+         * @return 用于 stop 的播放编号；音效无效或队列已满返回 0（命令被丢弃不代表一定会发声）
+         */
+        PlayId play(const SoundBank &bank, SoundId sound, glm::vec2 position, float gain = 1.0f);
+        /** @brief 不参与距离衰减的界面 / 玩家自身音效 */
+        PlayId play2D(const SoundBank &bank, SoundId sound, float gain = 1.0f);
+        void stop(PlayId playId, int fadeMs = 40);
+        void stopAll();
+        // 只由主线程调用；位置未变时不发命令
+        void setListener(glm::vec2 position);
+
+        /** @brief 阻塞到音频线程处理完此前入队的全部命令（仅用于卸载音效前等语音停下） */
+        void flush();
+
+        VoiceStats getStats() const;
+
+    private:
+        bool enqueue(const AudioCommand &command);
+        PlayId submitPlay(const SoundBank &bank, SoundId sound, bool positional, glm::vec2 position, float gain);
+
+        // --- 音频线程 ---
+        void workerLoop();
+        void execute(const AudioCommand &command, double nowMs);
+        void executePlay(const AudioCommand &command, double nowMs);
+        void reclaimFinished();
+        void stopSlot(int slot, int fadeMs);
+
+        MIX_Mixer *_mixer = nullptr;
+        std::vector<MIX_Track *> _tracks;
+        VoiceAllocator _allocator; // 仅音频线程访问
+        glm::vec2 _listener{0.0f, 0.0f}; // 仅音频线程访问
+
+        glm::vec2 _listener_sent{0.0f, 0.0f}; // 仅主线程访问
+        bool _listener_sent_valid = false;
+
+        engine::utils::BoundedMpscQueue<AudioCommand, COMMAND_CAPACITY> _commands;
+        std::atomic<uint32_t> _wake{0};
+        std::atomic<uint32_t> _sync_ticket{0};
+        std::atomic<uint32_t> _sync_done{0};
+        std::atomic<bool> _stopping{false};
+        std::atomic<PlayId> _next_play_id{1};
+        std::thread _worker;
+
+        std::atomic<int> _active_voices{0};
+        std::atomic<int> _peak_voices{0};
+        std::atomic<uint64_t> _started{0};
+        std::atomic<uint64_t> _replaced{0};
+        std::atomic<uint64_t> _stolen{0};
+        std::atomic<uint64_t> _coalesced{0};
+        std::atomic<uint64_t> _culled{0};
+        std::atomic<uint64_t> _rejected{0};
+        std::atomic<uint64_t> _dropped{0};
+        std::atomic<uint64_t> _command_count{0};
+        std::atomic<uint64_t> _command_nanos{0};
+    };
+} // namespace engine::audio
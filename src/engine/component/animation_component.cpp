@@ -20,23 +20,21 @@ namespace engine::component
         if (!m_clips.count(name)) return;
 
         m_current = name;
+        m_currentClip = &m_clips.at(name);
         m_frame   = 0;
         m_timer   = 0.0f;
         applyFrame();
     }
 
-    void AnimationComponent::init()
+    void AnimationComponent::resolveSiblings()
     {
         m_sprite = _owner->getComponent<SpriteComponent>();
     }
 
     void AnimationComponent::update(float dt)
     {
-        if (m_current.empty() || !m_sprite) return;
-
-        auto it = m_clips.find(m_current);
-        if (it == m_clips.end()) return;
-        const auto& clip = it->second;
+        if (!m_currentClip || !m_sprite) return;
+        const auto& clip = *m_currentClip;
 
         const int frameCount = !clip.frames.empty()
             ? static_cast<int>(clip.frames.size())
@@ -73,6 +71,7 @@ namespace engine::component
     {
         if (!m_clips.count(name)) return;
         m_current = name;
+        m_currentClip = &m_clips.at(name);
         m_frame   = 0;
         m_timer   = 0.0f;
         applyFrame();
@@ -89,12 +88,11 @@ namespace engine::component
 
     void AnimationComponent::applyFrame()
     {
-        if (!m_sprite || m_current.empty()) return;
+        if (!m_sprite || !m_currentClip) return;
 
-        auto it = m_clips.find(m_current);
-        if (it == m_clips.end()) return;
-
-        const auto& clip = it->second;
+        const auto& clip = *m_currentClip;
+        if (clip.texture)
+            m_sprite->setTexture(clip.texture);
         if (!clip.frames.empty())
         {
             const int frameIndex = std::clamp(m_frame, 0, static_cast<int>(clip.frames.size()) - 1);
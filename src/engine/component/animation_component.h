@@ -1,6 +1,7 @@
 #pragma once
 
 #include "component.h"
+#include "../resource/resource_handle.h"
 #include "../utils/math.h"
 #include <string>
 #include <unordered_map>
@@ -35,6 +36,9 @@ namespace engine::component
 
         // 显式帧序列：当非空时，优先使用这里的 sourceRect / duration / flipX。
         std::vector<AnimationFrame> frames;
+
+        // 可选：片段所用精灵表的纹理句柄（空 = 沿用 SpriteComponent 当前纹理）
+        engine::resource::TextureHandle texture;
     };
 
     /**
@@ -53,6 +57,8 @@ namespace engine::component
     class AnimationComponent final : public Component
     {
     public:
+        static constexpr ComponentTypeId TYPE_ID = component_type::Animation;
+
         /**
          * @param frame_w  单帧像素宽度（精灵表列宽）
          * @param frame_h  单帧像素高度（精灵表行高）
@@ -91,19 +97,20 @@ namespace engine::component
         const std::unordered_map<std::string, AnimationClip>& getClips() const { return m_clips; }
         void removeClip(const std::string& name)
         {
+            if (m_current == name) { m_current.clear(); m_currentClip = nullptr; m_frame = 0; m_timer = 0.0f; }
             m_clips.erase(name);
-            if (m_current == name) { m_current.clear(); m_frame = 0; m_timer = 0.0f; }
         }
         void clearClips()
         {
             m_clips.clear();
             m_current.clear();
+            m_currentClip = nullptr;
             m_frame = 0;
             m_timer = 0.0f;
         }
 
     protected:
-        void init()   override;
+        void resolveSiblings() override;
         void update(float dt) override;
         void render() override {}
 
@@ -113,6 +120,7 @@ namespace engine::component
 
         std::unordered_map<std::string, AnimationClip> m_clips;
         std::string m_current;
+        const AnimationClip* m_currentClip = nullptr; // m_clips 中 m_current 的节点（节点地址稳定），帧内不再按名字查表
         int   m_frame = 0;
         float m_timer = 0.0f;
 
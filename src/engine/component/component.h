@@ -1,4 +1,6 @@
 #pragma once
+#include <cstdint>
+
 namespace engine::core
 {
     class Context;
@@ -11,6 +13,25 @@ namespace engine::object
 
 namespace engine::component
 {
+    // ── 组件类型编号 ──
+    // 每个组件类声明 static constexpr ComponentTypeId TYPE_ID，GameObject 以其为下标直接索引组件槽位，
+    // getComponent 不再经过 type_index 哈希。游戏层组件从 GAME_BASE 开始编号（见 game_component_types.h）。
+    using ComponentTypeId = uint8_t;
+
+    namespace component_type
+    {
+        constexpr ComponentTypeId Transform  = 0;
+        constexpr ComponentTypeId Sprite     = 1;
+        constexpr ComponentTypeId Animation  = 2;
+        constexpr ComponentTypeId Physics    = 3;
+        constexpr ComponentTypeId Controller = 4;
+        constexpr ComponentTypeId Parallax   = 5;
+        constexpr ComponentTypeId TileLayer  = 6;
+
+        constexpr ComponentTypeId GAME_BASE  = 8;
+        constexpr ComponentTypeId COUNT      = 16; // 每个 GameObject 的槽位数
+    }
+
     class Component
     {
         friend class engine::object::GameObject;
@@ -24,6 +45,7 @@ namespace engine::component
         void attach(engine::object::GameObject* owner, engine::core::Context* ctx) {
             _owner = owner;
             _context = ctx;
+            resolveSiblings(); // init 中可直接使用已缓存的兄弟组件
             init(); // 确保在拿到 context 后才初始化
         }
         Component() = default;
@@ -40,6 +62,8 @@ namespace engine::component
 
     protected:
         virtual void init() {};
+        // 获取并缓存同一对象上的兄弟组件指针；attach 时及对象增删任意组件后由 GameObject 调用
+        virtual void resolveSiblings() {};
         virtual void handleInput() {};
         virtual void update(float delta_time) = 0;
         virtual void render() = 0;
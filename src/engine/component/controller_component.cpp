@@ -105,12 +105,17 @@ namespace engine::component
         m_state = velZ > 0.0f ? MovementState::Jump : MovementState::Fall;
     }
 
+    void ControllerComponent::resolveSiblings()
+    {
+        m_physics = _owner->getComponent<PhysicsComponent>();
+    }
+
     void ControllerComponent::update(float delta_time)
     {
         if (!_owner)
             return;
 
-        auto* physics = _owner->getComponent<PhysicsComponent>();
+        auto* physics = m_physics;
         if (!physics)
             return;
 
@@ -10,6 +10,8 @@ namespace engine::component
     class ControllerComponent final : public Component
     {
     public:
+        static constexpr ComponentTypeId TYPE_ID = component_type::Controller;
+
         enum class MovementState
         {
             Idle,
@@ -138,6 +140,8 @@ namespace engine::component
         bool m_footTileOverlapped = false;
         float m_footTileHeightPx = 0.0f;
 
+        PhysicsComponent* m_physics = nullptr; // 缓存的兄弟组件，见 resolveSiblings
+
         float approach(float current, float target, float delta) const;
     public:
         bool isFlyModeActive() const { return m_flyModeActive; }
@@ -145,6 +149,7 @@ namespace engine::component
         bool isGrounded(const PhysicsComponent& physics) const;
         void updateMovementState(const glm::vec2& velocity, bool grounded, bool jetpacking, float velZ = 0.0f);
 
+        void resolveSiblings() override;
         void handleInput() override;
         void update(float delta_time) override;
         void render() override {}
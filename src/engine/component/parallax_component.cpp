@@ -67,7 +67,7 @@ namespace engine::component
         // 这在处理大量重复背景时能节省大量的哈希查找开销
         if (_dirty_flags & DIRTY_SIZE) 
         {
-            glm::vec2 size = _context->getResourceManager().getTextureSize(_sprite.getTextureId());
+            glm::vec2 size = _context->getResourceManager().getTextureSize(_sprite.getTextureHandle());
             if (size.x > 0 && size.y > 0) {
                 _sprite.setSize(size);
                 _dirty_flags &= ~DIRTY_SIZE;
@@ -95,10 +95,9 @@ namespace engine::component
             return;
         }
 
-        // 1. 绑定 Transform
-        _transform_comp = _owner->getComponent<TransformComponent>();
+        // 1. 绑定 Transform（添加后 resolveSiblings 会缓存其指针）
         if (!_transform_comp) {
-            _transform_comp = _owner->addComponent<TransformComponent>();
+            _owner->addComponent<TransformComponent>();
         }
         spdlog::debug("注册组件到 ParallaxRenderSystem 系统: {}", (void*)this); // 打印系统实例地址
         // 2. 注册到视差渲染系统
@@ -108,6 +107,11 @@ namespace engine::component
         _dirty_flags |= DIRTY_SIZE;
     }
 
+    void ParallaxComponent::resolveSiblings()
+    {
+        _transform_comp = _owner->getComponent<TransformComponent>();
+    }
+
     /**
      * @brief 每一帧的逻辑更新
      * @note 视差偏移通常依赖于 Camera 位置，该逻辑建议放在专用的 ParallaxRenderSystem 中。
@@ -28,6 +28,8 @@ namespace engine::component
             DIRTY_OFFSET = 1 << 1
         };
     public:
+        static constexpr ComponentTypeId TYPE_ID = component_type::Parallax;
+
         // --- 构造与析构 ---
         ParallaxComponent(const std::string& texture_id,
                           const glm::vec2& scroll_factor = glm::vec2(1.0f, 1.0f),
@@ -66,6 +68,7 @@ namespace engine::component
     protected:
         // --- 生命周期重写 ---
         void init() override;
+        void resolveSiblings() override;
         void update(float delta_time) override;
         void render() override {} // 视差渲染由专门的 ParallaxRenderSystem 负责
 
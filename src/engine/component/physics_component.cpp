@@ -28,6 +28,8 @@ namespace engine::component
             b2Body_SetTransform(m_bodyId,
                                 {position.x / PIXELS_PER_METER, position.y / PIXELS_PER_METER},
                                 rotation);
+            if (m_physicsManager)
+                m_physicsManager->resetInterpolation(m_bodyId);
         }
     }
 
@@ -92,16 +94,23 @@ namespace engine::component
         b2CreatePolygonShape(m_bodyId, &shapeDef, &box);
     }
 
+    void PhysicsComponent::resolveSiblings()
+    {
+        m_transform = _owner->getComponent<TransformComponent>();
+    }
+
     void PhysicsComponent::update(float /*delta_time*/)
     {
         if (!_owner || B2_IS_NULL(m_bodyId))
             return;
 
-        auto* transform = _owner->getComponent<TransformComponent>();
+        auto* transform = m_transform;
         if (transform)
         {
             constexpr float PIXELS_PER_METER = 32.0f;
-            b2Vec2 pos = b2Body_GetPosition(m_bodyId);
+            // 固定步长下写入插值位置，渲染帧率高于物理频率时保持平滑
+            b2Vec2 pos = m_physicsManager ? m_physicsManager->getInterpolatedPosition(m_bodyId)
+                                          : b2Body_GetPosition(m_bodyId);
             transform->setPosition({pos.x * PIXELS_PER_METER, pos.y * PIXELS_PER_METER});
         }
     }
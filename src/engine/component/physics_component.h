@@ -8,11 +8,18 @@ namespace engine::physics
     class PhysicsManager;
 }
 
+namespace engine::component
+{
+    class TransformComponent;
+}
+
 namespace engine::component
 {
     class PhysicsComponent final : public Component
     {
     public:
+        static constexpr ComponentTypeId TYPE_ID = component_type::Physics;
+
         PhysicsComponent(b2BodyId bodyId, ::engine::physics::PhysicsManager *physicsManager = nullptr);
         ~PhysicsComponent() override = default;
 
@@ -34,7 +41,9 @@ namespace engine::component
         b2BodyId m_bodyId;
         ::engine::physics::PhysicsManager *m_physicsManager = nullptr;
         glm::vec2 m_cachedHalfExtentsPx{0.0f, 0.0f};
+        TransformComponent *m_transform = nullptr;
 
+        void resolveSiblings() override;
         void update(float delta_time) override;
         void render() override {}
         void clean() override;
@@ -44,11 +44,10 @@ namespace engine::component
             return;
         }
 
-        // 1. 自动绑定 Transform 组件
-        _transform_comp = _owner->getComponent<TransformComponent>();
+        // 1. 自动绑定 Transform 组件（添加后 resolveSiblings 会缓存其指针）
         if (!_transform_comp)
         {
-            _transform_comp = _owner->addComponent<TransformComponent>();
+            _owner->addComponent<TransformComponent>();
         }
 
         // 2. 注册到渲染系统
@@ -58,6 +57,16 @@ namespace engine::component
         _dirty_flags |= (DIRTY_SIZE | DIRTY_OFFSET);
     }
 
+    void SpriteComponent::resolveSiblings()
+    {
+        auto *transform = _owner->getComponent<TransformComponent>();
+        if (transform != _transform_comp)
+        {
+            _transform_comp = transform;
+            _last_transform_version = 0xFFFFFFFF; // 换了 Transform，强制重算偏移
+        }
+    }
+
     void SpriteComponent::update(float delta_time)
     {
         // 极简 Update：仅做版本比对。
@@ -72,7 +81,7 @@ namespace engine::component
     void SpriteComponent::ensureResourcesReady()
     {
         // 1. 获取纹理物理尺寸
-        glm::vec2 tex_size = _context->getResourceManager().getTextureSize(_sprite.getTextureId());
+        glm::vec2 tex_size = _context->getResourceManager().getTextureSize(_sprite.getTextureHandle());
 
         // 如果纹理还没加载好（异步加载中），直接返回，不清除脏标记，等待下一帧
         if (tex_size.x <= 0)
@@ -102,7 +111,7 @@ namespace engine::component
         const glm::vec2 render_pos = _transform_comp->getPosition() + _offset;
 
         glm::vec4 uv_rect = _cached_uv;
-        const glm::vec2 tex_size = ctx.getResourceManager().getTextureSize(_sprite.getTextureId());
+        const glm::vec2 tex_size = ctx.getResourceManager().getTextureSize(_sprite.getTextureHandle());
         if (tex_size.x > 0.0f && tex_size.y > 0.0f)
         {
             const engine::utils::FRect src = _sprite.getSourceRect().value_or(
@@ -157,6 +166,14 @@ namespace engine::component
         _dirty_flags |= (DIRTY_SIZE | DIRTY_OFFSET);
     }
 
+    void SpriteComponent::setTexture(engine::resource::TextureHandle texture)
+    {
+        if (texture == _sprite.getTextureHandle())
+            return;
+        _sprite.setTexture(texture);
+        _dirty_flags |= (DIRTY_SIZE | DIRTY_UV | DIRTY_OFFSET);
+    }
+
     void SpriteComponent::setSourceRect(const std::optional<engine::utils::FRect> &source_rect_opt)
     {
         _sprite.setSourceRect(source_rect_opt);
@@ -219,7 +236,7 @@ namespace engine::component
 
     void SpriteComponent::updateSpriteSizeAndUV()
     {
-        glm::vec2 tex_size = _context->getResourceManager().getTextureSize(_sprite.getTextureId());
+        glm::vec2 tex_size = _context->getResourceManager().getTextureSize(_sprite.getTextureHandle());
         auto src_opt = _sprite.getSourceRect();
 
         // 计算逻辑尺寸
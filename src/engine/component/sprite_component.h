@@ -39,6 +39,8 @@ namespace engine::component
         };
 
     public:
+        static constexpr ComponentTypeId TYPE_ID = component_type::Sprite;
+
         // --- 构造与析构 ---
         SpriteComponent(engine::render::Sprite &&sprite);
         SpriteComponent(const std::string &texture_id,
@@ -66,6 +68,7 @@ namespace engine::component
         const glm::vec4& getCachedUV() const { return _cached_uv; }
         const engine::render::Sprite& getSprite()       const { return _sprite; }
         const std::string&            getTextureId()    const { return _sprite.getTextureId(); }
+        engine::resource::TextureHandle getTextureHandle() const { return _sprite.getTextureHandle(); }
         const glm::vec2               getSpriteSize()   const { return _sprite_size; }
         const glm::vec2               getOffset()       const { return _offset; }
         engine::utils::Alignment      getAlignment()    const { return _alignment; }
@@ -82,12 +85,15 @@ namespace engine::component
         void setSpriteById(const std::string &texture_id, 
                            std::optional<engine::utils::FRect> source_rect_opt = std::nullopt);
         
+        /** @brief 按句柄切换纹理（动画片段换精灵表时使用），源矩形保持不变 */
+        void setTexture(engine::resource::TextureHandle texture);
         void setSourceRect(const std::optional<engine::utils::FRect> &source_rect_opt);
         void setAlignment(engine::utils::Alignment anchor);
 
     protected:
         // --- Component 生命周期重写 ---
         void init() override;
+        void resolveSiblings() override;
         void update(float delta_time) override;
         void render() override {} // 已交由 SpriteRenderSystem 统一管理
 
@@ -26,6 +26,8 @@ namespace engine::component
             DIRTY_OFFSET = 1 << 1
         };
     public:
+        static constexpr ComponentTypeId TYPE_ID = component_type::TileLayer;
+
         /**
          * @brief 无参构造函数
          */
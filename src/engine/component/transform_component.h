@@ -16,6 +16,8 @@ namespace engine::component
         friend class engine::object::GameObject;
 
     public:
+        static constexpr ComponentTypeId TYPE_ID = component_type::Transform;
+
         // --- 构造与析构 ---
         TransformComponent(glm::vec2 position = {0.0f, 0.0f}, 
                            glm::vec2 scale    = {1.0f, 1.0f}, 
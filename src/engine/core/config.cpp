@@ -1,4 +1,5 @@
 #include "config.h"
+#include <algorithm>
 #include <fstream>
 #include <nlohmann/json.hpp>
 #include <spdlog/spdlog.h>
@@ -79,6 +80,8 @@ namespace engine::core
             const auto &graphics_config = json["graphics"];
             _render_type = graphics_config.value("render_type", _render_type);
             _vsync_enabled = graphics_config.value("vsync", _vsync_enabled);
+            _sprite_batching = graphics_config.value("sprite_batching", _sprite_batching);
+            _texture_upload_budget_kb = std::max(1, graphics_config.value("texture_upload_budget_kb", _texture_upload_budget_kb));
         }
         if (json.contains("performance"))
         {
@@ -122,7 +125,7 @@ namespace engine::core
     {
         return nlohmann::ordered_json{
             {"window", {{"title", _window_title}, {"width", _window_width}, {"height", _window_height}, {"logical_width", _logical_width}, {"logical_height", _logical_height}, {"camera_width", _camera_width}, {"camera_height", _camera_height}, {"resizable", _window_resizable}}},
-            {"graphics", {{"vsync", _vsync_enabled}, {"render_type", _render_type}}},
+            {"graphics", {{"vsync", _vsync_enabled}, {"render_type", _render_type}, {"sprite_batching", _sprite_batching}, {"texture_upload_budget_kb", _texture_upload_budget_kb}}},
             {"performance", {{"target_fps", _target_fps}, {"show_fps", _show_fps_overlay}}},
             {"audio", {{"music_volume", _music_volume}, {"sfx_volume", _sfx_volume}}},
             {"input_mapping", _input_mappings}};
@@ -57,6 +57,8 @@ namespace engine::core
         // 图形设置
         int _render_type = 0; // 渲染类型
         bool _vsync_enabled = true;
+        bool _sprite_batching = true; // OpenGL：精灵合批 + 运行时纹理图集
+        int _texture_upload_budget_kb = 2048; // 异步纹理每帧上传预算（KB）
         // 性能设置
         int _target_fps = 60;
         bool _show_fps_overlay = true; // 是否显示FPS覆盖层
@@ -1,5 +1,6 @@
 #include "context.h"
 #include "time.h"
+#include "job_system.h"
 #include "../input/input_manager.h"
 #include "../render/camera.h"
 #include "../render/renderer.h"
@@ -30,7 +31,9 @@ namespace engine::core
         _sprite_render_system = std::make_unique<engine::render::SpriteRenderSystem>();
         _parallax_render_system = std::make_unique<engine::render::ParallaxRenderSystem>();
         _tilelayer_render_system = std::make_unique<engine::render::TilelayerRenderSystem>();
-        spdlog::trace("Context 初始化完成。静态指针已绑定，SpriteRenderSystem, ParallaxRenderSystem 已创建。");
+        // 3. 任务系统（按硬件线程数创建后台线程）
+        _job_system = std::make_unique<engine::core::JobSystem>();
+        spdlog::trace("Context 初始化完成。静态指针已绑定，SpriteRenderSystem, ParallaxRenderSystem, JobSystem 已创建。");
     }
     Context::~Context()
     {
@@ -9,6 +9,7 @@ namespace engine::resource { class ResourceManager; }
 namespace engine::core
 {
     class Time;
+    class JobSystem;
 
     class Context final
     {
@@ -41,6 +42,9 @@ namespace engine::core
         engine::render::ParallaxRenderSystem &getParallaxRenderSystem() { return *_parallax_render_system; }
         engine::render::TilelayerRenderSystem &getTilelayerRenderSystem() { return *_tilelayer_render_system; }
 
+        // 引擎共享任务系统（物理求解等）
+        engine::core::JobSystem &getJobSystem() { return *_job_system; }
+
     private:
         engine::input::InputManager &_input_manager;
         engine::render::Renderer &_renderer;
@@ -51,5 +55,6 @@ namespace engine::core
         std::unique_ptr<engine::render::SpriteRenderSystem> _sprite_render_system;
         std::unique_ptr<engine::render::ParallaxRenderSystem> _parallax_render_system;
         std::unique_ptr<engine::render::TilelayerRenderSystem> _tilelayer_render_system;
+        std::unique_ptr<engine::core::JobSystem> _job_system;
     };
 } // namespace engine::core
\ No newline at end of file
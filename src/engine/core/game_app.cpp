@@ -3,6 +3,7 @@
 #include "time.h"
 #include "config.h"
 #include "context.h"
+#include "profiler.h"
 #include "../resource/resource_manager.h"
 #include "../scene/scene_manager.h"
 #include "../render/renderer.h"
@@ -88,11 +89,20 @@ namespace engine::core
             spdlog::error("初始化失败，无法运行。");
             return;
         }
+        LSL_PROFILE_THREAD("主线程");
         while (_is_running)
         {
-            _time->update();
+            // 帧标记放在帧率限制之前，限帧等待计入本帧
+            LSL_PROFILE_FRAME();
+            {
+                LSL_PROFILE_ZONE("Time::update");
+                _time->update();
+            }
             float delta_time = _time->getDeltaTime();
-            _input_manager->update(); // 更新输入
+            {
+                LSL_PROFILE_ZONE("InputManager::update");
+                _input_manager->update(); // 更新输入
+            }
 
             handleEvents();
             update(delta_time);
@@ -148,6 +158,7 @@ namespace engine::core
      */
     void GameApp::handleEvents()
     {
+        LSL_PROFILE_ZONE("GameApp::handleEvents");
         if (_input_manager->shouldQuit())
         {
             spdlog::trace("GameApp 收到 InputManager 退出事件，退出游戏");
@@ -172,6 +183,7 @@ namespace engine::core
      */
     void GameApp::update(float delta_time)
     {
+        LSL_PROFILE_ZONE("GameApp::update");
         if (_scene_manager)
         {
             _scene_manager->update(delta_time);
@@ -192,12 +204,22 @@ namespace engine::core
      */
     void GameApp::render()
     {
+        LSL_PROFILE_ZONE("GameApp::render");
+        // 异步纹理在场景绘制前上传，本帧即可替换占位纹理
+        if (_resource_manager)
+        {
+            LSL_PROFILE_ZONE("ResourceManager::processTextureUploads");
+            _resource_manager->processTextureUploads(static_cast<size_t>(_config->_texture_upload_budget_kb) * 1024);
+        }
         _renderer->clearScreen();
         if (_scene_manager)
         {
             _scene_manager->render();
         }
-        _renderer->present();
+        {
+            LSL_PROFILE_ZONE("Renderer::present");
+            _renderer->present();
+        }
     }
     void GameApp::close()
     {
@@ -322,6 +344,7 @@ namespace engine::core
             {
                 auto opengl_renderer = std::make_unique<engine::render::OpenGLRenderer>(_window);
                 opengl_renderer->setLogicalSize(glm::vec2(_config->_logical_width, _config->_logical_height));
+                opengl_renderer->setSpriteBatching(_config->_sprite_batching);
                 // -1 = 自适应 VSync（帧时间超标时立即呈现，不降至半刷新率）
                 SDL_GL_SetSwapInterval(_config->_vsync_enabled ? -1 : 0);
 
@@ -0,0 +1,201 @@
+#include "job_system.h"
+#include "profiler.h"
+#include <algorithm>
+#include <spdlog/spdlog.h>
+
+namespace engine::core
+{
+    namespace
+    {
+        // 后台线程在启动时写入所属任务系统与自身索引；其它线程保持为空
+        thread_local const JobSystem *t_workerSystem = nullptr;
+        thread_local uint32_t t_workerIndex = 0;
+
+        // 入睡前的自旋次数：物理求解等短任务往往紧接着到来，避免频繁进出条件变量
+        constexpr int kSpinBeforeSleep = 64;
+    }
+
+    JobSystem::JobSystem(int backgroundThreads)
+        : _owner_thread(std::this_thread::get_id())
+    {
+        if (backgroundThreads < 0)
+        {
+            const unsigned hw = std::thread::hardware_concurrency();
+            backgroundThreads = static_cast<int>(hw > 1 ? hw - 1 : 0);
+        }
+        backgroundThreads = std::clamp(backgroundThreads, 0, MAX_THREADS - 1);
+
+        _queues.reserve(static_cast<size_t>(backgroundThreads + 1));
+        for (int i = 0; i <= backgroundThreads; ++i)
+            _queues.push_back(std::make_unique<WorkerQueue>());
+
+        _threads.reserve(static_cast<size_t>(backgroundThreads));
+        for (int i = 1; i <= backgroundThreads; ++i)
+            _threads.emplace_back([this, i] { workerLoop(static_cast<uint32_t>(i)); });
+
+        spdlog::debug("[JobSystem] started {} background thread(s)", backgroundThreads);
+    }
+
+    JobSystem::~JobSystem()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_sleep_mutex);
+            _stopping = true;
+        }
+        _wake_cv.notify_all();
+        for (auto &thread : _threads)
+        {
+            if (thread.joinable())
+                thread.join();
+        }
+    }
+
+    uint32_t JobSystem::currentWorkerIndex() const
+    {
+        if (t_workerSystem == this)
+            return t_workerIndex;
+        return std::this_thread::get_id() == _owner_thread ? 0u : EXTERNAL_WORKER;
+    }
+
+    JobGroup *JobSystem::submit(TaskFn task, int itemCount, int minRange, void *context)
+    {
+        JobGroup *group = acquireGroup();
+        if (!task || itemCount <= 0)
+            return group;
+
+        // 段数：不少于 minRange 一段，且不超过线程数的 4 倍（兼顾负载均衡与调度开销）
+        minRange = std::max(minRange, 1);
+        const int threadCount = getThreadCount();
+        const int blockCount = std::clamp(itemCount / minRange, 1, threadCount * 4);
+        const int blockSize = itemCount / blockCount;
+        const int remainder = itemCount % blockCount;
+
+        group->pending.store(blockCount, std::memory_order_relaxed);
+
+        uint32_t queueIndex = _next_queue.fetch_add(1, std::memory_order_relaxed);
+        int start = 0;
+        for (int b = 0; b < blockCount; ++b)
+        {
+            const int end = start + blockSize + (b < remainder ? 1 : 0);
+            WorkerQueue &queue = *_queues[queueIndex++ % static_cast<uint32_t>(threadCount)];
+            {
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                queue.jobs.push_back({task, context, start, end, group});
+            }
+            start = end;
+        }
+
+        _queued_jobs.fetch_add(blockCount, std::memory_order_release);
+        {
+            // 持锁一次再通知，保证与 workerLoop 的等待谓词不会错过唤醒
+            std::lock_guard<std::mutex> lock(_sleep_mutex);
+        }
+        _wake_cv.notify_all();
+        return group;
+    }
+
+    void JobSystem::wait(JobGroup *group)
+    {
+        if (!group)
+            return;
+
+        const uint32_t workerIndex = currentWorkerIndex();
+        while (group->pending.load(std::memory_order_acquire) > 0)
+        {
+            // 外部线程不执行任务：任务的 workerIndex 用来索引每线程暂存（如 Box2D 的求解上下文），不能借用 0 号
+            if (workerIndex == EXTERNAL_WORKER || !tryRunOne(workerIndex))
+                std::this_thread::yield();
+        }
+        releaseGroup(group);
+    }
+
+    void JobSystem::workerLoop(uint32_t workerIndex)
+    {
+        t_workerSystem = this;
+        t_workerIndex = workerIndex;
+        LSL_PROFILE_THREAD("JobSystem");
+        for (;;)
+        {
+            if (tryRunOne(workerIndex))
+                continue;
+
+            for (int spin = 0; spin < kSpinBeforeSleep && _queued_jobs.load(std::memory_order_acquire) == 0; ++spin)
+                std::this_thread::yield();
+            if (_queued_jobs.load(std::memory_order_acquire) > 0)
+                continue;
+
+            std::unique_lock<std::mutex> lock(_sleep_mutex);
+            _wake_cv.wait(lock, [this]
+                          { return _stopping || _queued_jobs.load(std::memory_order_acquire) > 0; });
+            if (_stopping)
+                return;
+        }
+    }
+
+    bool JobSystem::tryRunOne(uint32_t workerIndex)
+    {
+        Job job;
+        if (!popLocal(workerIndex, job) && !steal(workerIndex, job))
+            return false;
+
+        _queued_jobs.fetch_sub(1, std::memory_order_relaxed);
+        execute(job, workerIndex);
+        return true;
+    }
+
+    bool JobSystem::popLocal(uint32_t workerIndex, Job &out)
+    {
+        WorkerQueue &queue = *_queues[workerIndex % _queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.jobs.empty())
+            return false;
+        out = queue.jobs.back();
+        queue.jobs.pop_back();
+        return true;
+    }
+
+    bool JobSystem::steal(uint32_t thiefIndex, Job &out)
+    {
+        const size_t count = _queues.size();
+        for (size_t offset = 1; offset < count; ++offset)
+        {
+            WorkerQueue &queue = *_queues[(thiefIndex + offset) % count];
+            std::unique_lock<std::mutex> lock(queue.mutex, std::try_to_lock);
+            if (!lock.owns_lock() || queue.jobs.empty())
+                continue;
+            out = queue.jobs.front();
+            queue.jobs.pop_front();
+            _stolen_total.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+
+    void JobSystem::execute(const Job &job, uint32_t workerIndex)
+    {
+        LSL_PROFILE_ZONE("JobSystem::execute");
+        job.task(job.start, job.end, workerIndex, job.context);
+        _executed_total.fetch_add(1, std::memory_order_relaxed);
+        job.group->pending.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    JobGroup *JobSystem::acquireGroup()
+    {
+        std::lock_guard<std::mutex> lock(_group_mutex);
+        if (_free_groups.empty())
+        {
+            _group_storage.push_back(std::make_unique<JobGroup>());
+            return _group_storage.back().get();
+        }
+        JobGroup *group = _free_groups.back();
+        _free_groups.pop_back();
+        group->pending.store(0, std::memory_order_relaxed);
+        return group;
+    }
+
+    void JobSystem::releaseGroup(JobGroup *group)
+    {
+        std::lock_guard<std::mutex> lock(_group_mutex);
+        _free_groups.push_back(group);
+    }
+} // namespace engine::core
@@ -0,0 +1,116 @@
+// 引擎任务系统
+// job_system.h
+//   - 每个线程一个双端队列：所有者从尾部取（LIFO，缓存友好），空闲线程从其它队列头部窃取（FIFO）
+//   - 创建 JobSystem 的线程（通常是主线程）在 wait() 中同样参与执行，线程索引固定为 0
+//   - 其它外部线程可以 submit / wait，但不参与执行：它们没有自己的队列与索引，不会与 0 号线程共用每线程暂存
+//   - 任务签名与 Box2D v3 的 b2TaskCallback 一致，可直接作为 b2WorldDef 的 enqueueTask/finishTask 后端
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace engine::core
+{
+    /**
+     * @brief 一次 submit 产生的任务组，wait() 返回后自动回收，调用方不得再使用
+     */
+    struct JobGroup
+    {
+        std::atomic<int> pending{0};
+    };
+
+    class JobSystem final
+    {
+    public:
+        // [start, end) 区间任务；workerIndex ∈ [0, getThreadCount())，同一时刻各线程互不相同
+        using TaskFn = void (*)(int start, int end, uint32_t workerIndex, void *context);
+
+        // 上限与 Box2D 的 B2_MAX_WORKERS 一致
+        static constexpr int MAX_THREADS = 64;
+        // 既非后台线程也非所有者线程的索引
+        static constexpr uint32_t EXTERNAL_WORKER = UINT32_MAX;
+
+        // backgroundThreads < 0 时按硬件线程数自动选择（调用线程占一个）
+        explicit JobSystem(int backgroundThreads = -1);
+        ~JobSystem();
+
+        JobSystem(const JobSystem &) = delete;
+        JobSystem &operator=(const JobSystem &) = delete;
+
+        /**
+         * @brief 把 [0, itemCount) 切分为若干段（每段不少于 minRange）并分发到各线程队列
+         * @return 任务组句柄，必须交给 wait() 回收
+         */
+        JobGroup *submit(TaskFn task, int itemCount, int minRange, void *context);
+
+        // 阻塞直到任务组完成；所有者线程等待期间参与执行（含其它任务组的任务），外部线程只等待
+        void wait(JobGroup *group);
+
+        // 便捷接口：阻塞式并行 for，fn(start, end, workerIndex)
+        template <typename Fn>
+        void parallelFor(int itemCount, int minRange, Fn &&fn)
+        {
+            auto thunk = [](int start, int end, uint32_t workerIndex, void *context)
+            {
+                (*static_cast<Fn *>(context))(start, end, workerIndex);
+            };
+            wait(submit(thunk, itemCount, minRange, &fn));
+        }
+
+        // 参与执行的线程总数（后台线程 + 调用线程）
+        int getThreadCount() const { return static_cast<int>(_queues.size()); }
+        // 当前线程在本任务系统中的索引：所有者线程为 0，后台线程为 1..N，其它线程为 EXTERNAL_WORKER
+        uint32_t currentWorkerIndex() const;
+
+        uint64_t getExecutedTotal() const { return _executed_total.load(std::memory_order_relaxed); }
+        uint64_t getStolenTotal() const { return _stolen_total.load(std::memory_order_relaxed); }
+
+    private:
+        struct Job
+        {
+            TaskFn task = nullptr;
+            void *context = nullptr;
+            int start = 0;
+            int end = 0;
+            JobGroup *group = nullptr;
+        };
+
+        // 独占缓存行，避免相邻队列互相伪共享
+        struct alignas(64) WorkerQueue
+        {
+            std::mutex mutex;
+            std::deque<Job> jobs;
+        };
+
+        void workerLoop(uint32_t workerIndex);
+        bool tryRunOne(uint32_t workerIndex);
+        bool popLocal(uint32_t workerIndex, Job &out);
+        bool steal(uint32_t thiefIndex, Job &out);
+        void execute(const Job &job, uint32_t workerIndex);
+
+        JobGroup *acquireGroup();
+        void releaseGroup(JobGroup *group);
+
+        std::vector<std::unique_ptr<WorkerQueue>> _queues; // [0] 属于所有者线程
+        std::vector<std::thread> _threads;
+        std::thread::id _owner_thread;
+
+        std::mutex _sleep_mutex;
+        std::condition_variable _wake_cv;
+        std::atomic<int> _queued_jobs{0};
+        bool _stopping = false; // 受 _sleep_mutex 保护
+
+        std::mutex _group_mutex;
+        std::vector<std::unique_ptr<JobGroup>> _group_storage;
+        std::vector<JobGroup *> _free_groups;
+
+        std::atomic<uint32_t> _next_queue{0};
+        std::atomic<uint64_t> _executed_total{0};
+        std::atomic<uint64_t> _stolen_total{0};
+    };
+} // namespace engine::core
@@ -0,0 +1,389 @@
+#include "profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <spdlog/spdlog.h>
+
+namespace engine::core
+{
+    namespace
+    {
+        /**
+         * @brief 单个轨道的环形缓冲
+         * events / depth 只由所属线程写入；written 以 release 发布，读取方 acquire 后读取并在读完后复核序号
+         */
+        struct ThreadBuffer
+        {
+            std::string name; // 受 Registry::mutex 保护
+            uint32_t id = 0;
+            std::unique_ptr<ProfileEvent[]> events{new ProfileEvent[Profiler::EVENTS_PER_THREAD]};
+            std::atomic<uint64_t> written{0};
+            std::atomic<bool> retired{false}; // 所属线程已退出，可被新线程复用
+            uint16_t depth = 0;
+        };
+
+        struct Registry
+        {
+            std::mutex mutex;
+            std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+            ThreadBuffer *gpu = nullptr;
+            uint32_t nextId = 1; // 0 留给导出时的帧轨道
+        };
+
+        // 有意泄漏：后台线程可能晚于静态对象析构才退出
+        Registry &registry()
+        {
+            static Registry *instance = new Registry();
+            return *instance;
+        }
+
+        struct FrameState
+        {
+            std::vector<ProfileFrame> history = std::vector<ProfileFrame>(Profiler::FRAME_HISTORY);
+            size_t count = 0;
+            size_t head = 0; // 下一个写入位置
+            uint64_t index = 0;
+            uint64_t startNs = 0;
+            uint64_t allocs = 0;
+            uint64_t allocBytes = 0;
+            bool open = false;
+        };
+
+        FrameState &frameState()
+        {
+            static FrameState state;
+            return state;
+        }
+
+        // 线程退出时把缓冲交还给注册表
+        struct ThreadSlot
+        {
+            ThreadBuffer *buffer = nullptr;
+            const char *name = nullptr;
+            ~ThreadSlot()
+            {
+                if (buffer)
+                    buffer->retired.store(true, std::memory_order_release);
+            }
+        };
+
+        thread_local ThreadSlot t_slot;
+
+        ThreadBuffer *acquireBuffer(const char *name)
+        {
+            Registry &reg = registry();
+            std::lock_guard<std::mutex> lock(reg.mutex);
+            ThreadBuffer *buffer = nullptr;
+            for (auto &candidate : reg.buffers)
+            {
+                if (candidate->retired.load(std::memory_order_acquire))
+                {
+                    buffer = candidate.get();
+                    break;
+                }
+            }
+            if (buffer)
+            {
+                // 持锁期间读取方不会访问该缓冲，旧线程的区段直接丢弃
+                buffer->retired.store(false, std::memory_order_relaxed);
+                buffer->written.store(0, std::memory_order_relaxed);
+                buffer->depth = 0;
+            }
+            else
+            {
+                reg.buffers.push_back(std::make_unique<ThreadBuffer>());
+                buffer = reg.buffers.back().get();
+                buffer->id = reg.nextId++;
+            }
+            buffer->name = name ? name : "线程 " + std::to_string(buffer->id);
+            return buffer;
+        }
+
+        ThreadBuffer &localBuffer()
+        {
+            if (!t_slot.buffer)
+                t_slot.buffer = acquireBuffer(t_slot.name);
+            return *t_slot.buffer;
+        }
+
+        ThreadBuffer &gpuBuffer()
+        {
+            Registry &reg = registry();
+            {
+                std::lock_guard<std::mutex> lock(reg.mutex);
+                if (reg.gpu)
+                    return *reg.gpu;
+            }
+            ThreadBuffer *buffer = acquireBuffer("GPU");
+            std::lock_guard<std::mutex> lock(reg.mutex);
+            reg.gpu = buffer;
+            return *buffer;
+        }
+
+        void push(ThreadBuffer &buffer, const ProfileEvent &event)
+        {
+            const uint64_t seq = buffer.written.load(std::memory_order_relaxed);
+            buffer.events[seq & (Profiler::EVENTS_PER_THREAD - 1)] = event;
+            buffer.written.store(seq + 1, std::memory_order_release);
+        }
+
+        /**
+         * @brief 取出与 [fromNs, toNs) 相交的区段（调用方持有 Registry::mutex）
+         * 缓冲内区段按结束时间递增，从最新一条往回扫，遇到早于 fromNs 结束的即可停止
+         */
+        void snapshot(const ThreadBuffer &buffer, uint64_t fromNs, uint64_t toNs, std::vector<ProfileEvent> &out)
+        {
+            constexpr uint64_t capacity = Profiler::EVENTS_PER_THREAD;
+            const uint64_t end = buffer.written.load(std::memory_order_acquire);
+            const uint64_t begin = end > capacity ? end - capacity : 0;
+            const size_t first = out.size();
+            uint64_t seq = end;
+            while (seq > begin)
+            {
+                const ProfileEvent &event = buffer.events[(seq - 1) & (capacity - 1)];
+                if (event.endNs <= fromNs)
+                    break;
+                --seq;
+                if (event.startNs < toNs)
+                    out.push_back(event);
+            }
+
+            // 拷贝期间所属线程可能已绕回覆盖最旧的条目，这些条目丢弃
+            const uint64_t after = buffer.written.load(std::memory_order_acquire);
+            const uint64_t valid = after > capacity ? after - capacity : 0;
+            if (valid > seq)
+            {
+                const uint64_t overwritten = std::min<uint64_t>(valid - seq, out.size() - first);
+                out.resize(out.size() - static_cast<size_t>(overwritten));
+            }
+            std::reverse(out.begin() + static_cast<std::ptrdiff_t>(first), out.end());
+        }
+
+        void writeJsonString(std::ostream &out, const char *text)
+        {
+            out << '"';
+            for (const char *c = text ? text : ""; *c; ++c)
+            {
+                const auto ch = static_cast<unsigned char>(*c);
+                if (ch == '"' || ch == '\\')
+                    out << '\\' << *c;
+                else if (ch < 0x20)
+                {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", ch);
+                    out << escaped;
+                }
+                else
+                    out << *c;
+            }
+            out << '"';
+        }
+
+        void writeMicros(std::ostream &out, uint64_t ns)
+        {
+            char buffer[32];
+            std::snprintf(buffer, sizeof(buffer), "%.3f", static_cast<double>(ns) / 1000.0);
+            out << buffer;
+        }
+    } // namespace
+
+    void Profiler::setEnabled(bool enabled)
+    {
+        _enabled.store(enabled, std::memory_order_relaxed);
+        spdlog::info("Profiler: 采集{}", enabled ? "开启" : "关闭");
+    }
+
+    uint64_t Profiler::nowNs()
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::steady_clock::now().time_since_epoch())
+                                         .count());
+    }
+
+    void Profiler::setThreadName(const char *name)
+    {
+        t_slot.name = name;
+        if (t_slot.buffer)
+        {
+            std::lock_guard<std::mutex> lock(registry().mutex);
+            t_slot.buffer->name = name;
+        }
+    }
+
+    uint16_t Profiler::beginZone()
+    {
+        return localBuffer().depth++;
+    }
+
+    void Profiler::endZone(const char *name, uint64_t startNs, uint32_t allocsAtStart, uint16_t depth)
+    {
+        ThreadBuffer &buffer = localBuffer();
+        if (buffer.depth > 0)
+            --buffer.depth;
+        push(buffer, {name, startNs, nowNs(), t_alloc_count - allocsAtStart, depth});
+    }
+
+    void Profiler::submitGpuZone(const char *name, uint64_t startNs, uint64_t endNs, uint16_t depth)
+    {
+        push(gpuBuffer(), {name, startNs, endNs, 0, depth});
+    }
+
+    void Profiler::frameMark()
+    {
+        FrameState &state = frameState();
+        if (!isEnabled())
+        {
+            state.open = false;
+            return;
+        }
+
+        const uint64_t now = nowNs();
+        const uint64_t allocs = _alloc_count.load(std::memory_order_relaxed);
+        const uint64_t allocBytes = _alloc_bytes.load(std::memory_order_relaxed);
+        if (state.open)
+        {
+            state.history[state.head] = {state.index, state.startNs, now, allocs - state.allocs, allocBytes - state.allocBytes};
+            state.head = (state.head + 1) % state.history.size();
+            state.count = std::min(state.count + 1, state.history.size());
+        }
+        state.open = true;
+        ++state.index;
+        state.startNs = now;
+        state.allocs = allocs;
+        state.allocBytes = allocBytes;
+    }
+
+    std::vector<ProfileFrame> Profiler::frames()
+    {
+        const FrameState &state = frameState();
+        std::vector<ProfileFrame> result;
+        result.reserve(state.count);
+        const size_t size = state.history.size();
+        for (size_t i = 0; i < state.count; ++i)
+            result.push_back(state.history[(state.head + size - state.count + i) % size]);
+        return result;
+    }
+
+    ProfileCapture Profiler::capture(const ProfileFrame &frame)
+    {
+        ProfileCapture result;
+        result.frame = frame;
+
+        Registry &reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        for (const auto &buffer : reg.buffers)
+        {
+            ProfileTrack track;
+            snapshot(*buffer, frame.startNs, frame.endNs, track.events);
+            if (track.events.empty())
+                continue;
+            track.name = buffer->name;
+            track.id = buffer->id;
+            result.tracks.push_back(std::move(track));
+        }
+        return result;
+    }
+
+    bool Profiler::exportChromeTrace(const std::string &path)
+    {
+        std::vector<ProfileTrack> tracks;
+        {
+            Registry &reg = registry();
+            std::lock_guard<std::mutex> lock(reg.mutex);
+            for (const auto &buffer : reg.buffers)
+            {
+                ProfileTrack track;
+                track.name = buffer->name;
+                track.id = buffer->id;
+                snapshot(*buffer, 0, UINT64_MAX, track.events);
+                tracks.push_back(std::move(track));
+            }
+        }
+        const std::vector<ProfileFrame> frameList = frames();
+
+        // 时间戳以最早的记录为零点
+        uint64_t origin = UINT64_MAX;
+        for (const auto &track : tracks)
+            for (const auto &event : track.events)
+                origin = std::min(origin, event.startNs);
+        for (const auto &frame : frameList)
+            origin = std::min(origin, frame.startNs);
+        if (origin == UINT64_MAX)
+        {
+            spdlog::warn("Profiler: 没有可导出的区段（采集未开启？）");
+            return false;
+        }
+
+        const std::filesystem::path file(path);
+        std::error_code ec;
+        if (file.has_parent_path())
+            std::filesystem::create_directories(file.parent_path(), ec);
+        std::ofstream out(file, std::ios::binary | std::ios::trunc);
+        if (!out)
+        {
+            spdlog::error("Profiler: 无法写入 {}", path);
+            return false;
+        }
+
+        size_t eventCount = 0;
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Frames\"}}";
+        for (const auto &frame : frameList)
+        {
+            out << ",\n{\"name\":\"Frame " << frame.index << "\",\"cat\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":0,\"ts\":";
+            writeMicros(out, frame.startNs - origin);
+            out << ",\"dur\":";
+            writeMicros(out, frame.endNs - frame.startNs);
+            out << ",\"args\":{\"allocs\":" << frame.allocs << ",\"allocBytes\":" << frame.allocBytes << "}}";
+        }
+        for (const auto &track : tracks)
+        {
+            out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << track.id << ",\"args\":{\"name\":";
+            writeJsonString(out, track.name.c_str());
+            out << "}}";
+            for (const auto &event : track.events)
+            {
+                out << ",\n{\"name\":";
+                writeJsonString(out, event.name);
+                out << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << track.id << ",\"ts\":";
+                writeMicros(out, event.startNs - origin);
+                out << ",\"dur\":";
+                writeMicros(out, event.endNs - event.startNs);
+                out << ",\"args\":{\"allocs\":" << event.allocs << "}}";
+            }
+            eventCount += track.events.size();
+        }
+        out << "\n]}\n";
+        out.flush();
+        if (!out)
+        {
+            spdlog::error("Profiler: 写入 {} 失败", path);
+            return false;
+        }
+        spdlog::info("Profiler: 已导出 {} 个区段、{} 帧到 {}", eventCount, frameList.size(), path);
+        return true;
+    }
+
+    ProfilerStats Profiler::getStats()
+    {
+        ProfilerStats stats;
+        stats.enabled = isEnabled();
+        stats.frames = frameState().index;
+        Registry &reg = registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        stats.tracks = static_cast<int>(reg.buffers.size());
+        for (const auto &buffer : reg.buffers)
+        {
+            const uint64_t written = buffer->written.load(std::memory_order_relaxed);
+            if (buffer.get() == reg.gpu)
+                stats.gpuEvents = written;
+            else
+                stats.events += written;
+        }
+        return stats;
+    }
+} // namespace engine::core
@@ -0,0 +1,170 @@
+// 引擎分层性能剖析器
+// profiler.h
+//   - LSL_PROFILE_ZONE("名称") 在当前作用域记录一个区段，可任意嵌套；名称只存指针，必须是字符串字面量
+//   - 每个线程一块固定容量的环形缓冲，只有所属线程写入；读取方按写入序号校验被覆盖的条目，全程无锁
+//   - GameApp::run 每帧调用 LSL_PROFILE_FRAME() 打帧标记，面板 / 导出按帧的时间范围取出各线程区段
+//   - 采集期间统计全局 operator new 的次数与字节数（整帧合计，以及每个区段内本线程的分配次数）
+//   - GPU 区段由渲染器用计时查询测得，延迟几帧后写入独立的 "GPU" 轨道
+//   - 运行期未开启时每个区段只多一次 relaxed 原子读；CMake 选项 LSL_PROFILER=OFF 时宏展开为空
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifndef LSL_PROFILER
+#define LSL_PROFILER 0
+#endif
+
+namespace engine::core
+{
+    /**
+     * @brief 一个已结束的区段（时间为进程内单调时钟的纳秒数）
+     */
+    struct ProfileEvent
+    {
+        const char *name = nullptr;
+        uint64_t startNs = 0;
+        uint64_t endNs = 0;
+        uint32_t allocs = 0; // 区段内本线程的 operator new 次数（含子区段）
+        uint16_t depth = 0;  // 0 为线程内最外层
+    };
+
+    struct ProfileFrame
+    {
+        uint64_t index = 0;
+        uint64_t startNs = 0;
+        uint64_t endNs = 0;
+        uint64_t allocs = 0;     // 整帧所有线程的分配次数
+        uint64_t allocBytes = 0;
+    };
+
+    struct ProfileTrack
+    {
+        std::string name;
+        uint32_t id = 0;
+        std::vector<ProfileEvent> events; // 按结束时间排序
+    };
+
+    /**
+     * @brief 某一帧的快照：帧信息 + 与该帧时间范围相交的各线程区段
+     */
+    struct ProfileCapture
+    {
+        ProfileFrame frame;
+        std::vector<ProfileTrack> tracks;
+    };
+
+    struct ProfilerStats
+    {
+        bool enabled = false;
+        int tracks = 0;
+        uint64_t events = 0;    // 自启动以来记录的区段总数
+        uint64_t gpuEvents = 0;
+        uint64_t frames = 0;
+    };
+
+    class Profiler final
+    {
+    public:
+        static constexpr size_t EVENTS_PER_THREAD = 1u << 16; // 约 2MB / 线程，60FPS 下可保留数秒
+        static constexpr size_t FRAME_HISTORY = 600;
+
+        // 区段与分配计数只读这个标志，开销为一次 relaxed 原子读
+        static bool isEnabled() { return _enabled.load(std::memory_order_relaxed); }
+        static void setEnabled(bool enabled);
+
+        /** @brief 进程内单调时钟（纳秒） */
+        static uint64_t nowNs();
+
+        /** @brief 为当前线程的轨道命名（线程启动时调用一次，名称须为字符串字面量；首次记录区段时才分配缓冲） */
+        static void setThreadName(const char *name);
+
+        // ── 区段（由 ProfileZone 调用）──
+        static uint16_t beginZone();
+        static void endZone(const char *name, uint64_t startNs, uint32_t allocsAtStart, uint16_t depth);
+        // 当前线程累计的分配次数（区段起止之差即区段内分配数）
+        static uint32_t threadAllocCount() { return t_alloc_count; }
+
+        /** @brief 渲染线程提交已解析的 GPU 区段（时间已换算到 CPU 时钟） */
+        static void submitGpuZone(const char *name, uint64_t startNs, uint64_t endNs, uint16_t depth);
+
+        /** @brief 帧边界：结束上一帧并开始新的一帧（只由主线程调用） */
+        static void frameMark();
+
+        /** @brief 全局 operator new 的计数钩子 */
+        static void countAllocation(size_t bytes)
+        {
+            if (!isEnabled())
+                return;
+            ++t_alloc_count;
+            _alloc_count.fetch_add(1, std::memory_order_relaxed);
+            _alloc_bytes.fetch_add(bytes, std::memory_order_relaxed);
+        }
+
+        // ── 读取（主线程：面板 / 导出）──
+        /** @brief 已结束的帧，从旧到新 */
+        static std::vector<ProfileFrame> frames();
+        /** @brief 取出指定帧的快照；该帧已被环形缓冲覆盖时 tracks 可能不完整 */
+        static ProfileCapture capture(const ProfileFrame &frame);
+        /**
+         * @brief 把各线程缓冲中仍保留的全部区段导出为 Chrome trace JSON（chrome://tracing / ui.perfetto.dev 可直接打开）
+         * @return 写入失败返回 false
+         */
+        static bool exportChromeTrace(const std::string &path);
+        static ProfilerStats getStats();
+
+    private:
+        static inline std::atomic<bool> _enabled{false};
+        static inline std::atomic<uint64_t> _alloc_count{0};
+        static inline std::atomic<uint64_t> _alloc_bytes{0};
+        static inline thread_local uint32_t t_alloc_count = 0;
+    };
+
+    /**
+     * @brief 作用域区段：构造时记录起点，析构时写入当前线程的缓冲
+     */
+    class ProfileZone
+    {
+    public:
+        explicit ProfileZone(const char *name)
+        {
+            if (!Profiler::isEnabled())
+                return;
+            _name = name;
+            _depth = Profiler::beginZone();
+            _allocs = Profiler::threadAllocCount();
+            _start = Profiler::nowNs();
+        }
+        ~ProfileZone()
+        {
+            if (_name)
+                Profiler::endZone(_name, _start, _allocs, _depth);
+        }
+
+        ProfileZone(const ProfileZone &) = delete;
+        ProfileZone &operator=(const ProfileZone &) = delete;
+
+    private:
+        const char *_name = nullptr; // 为空表示构造时未开启采集
+        uint64_t _start = 0;
+        uint32_t _allocs = 0;
+        uint16_t _depth = 0;
+    };
+} // namespace engine::core
+
+#define LSL_PROFILE_CONCAT_INNER(a, b) a##b
+#define LSL_PROFILE_CONCAT(a, b) LSL_PROFILE_CONCAT_INNER(a, b)
+
+#if LSL_PROFILER
+#define LSL_PROFILE_ZONE(name) ::engine::core::ProfileZone LSL_PROFILE_CONCAT(lsl_profile_zone_, __LINE__)(name)
+#define LSL_PROFILE_FUNCTION() LSL_PROFILE_ZONE(__func__)
+#define LSL_PROFILE_FRAME() ::engine::core::Profiler::frameMark()
+#define LSL_PROFILE_THREAD(name) ::engine::core::Profiler::setThreadName(name)
+#else
+#define LSL_PROFILE_ZONE(name) ((void)0)
+#define LSL_PROFILE_FUNCTION() ((void)0)
+#define LSL_PROFILE_FRAME() ((void)0)
+#define LSL_PROFILE_THREAD(name) ((void)0)
+#endif
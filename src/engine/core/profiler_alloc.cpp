@@ -0,0 +1,47 @@
+// 全局 operator new / delete 替换：采集开启时计数，供 Profiler 统计每帧与每个区段的分配
+// 单独成一个编译单元，避免与其它代码内联后触发 -Wmismatched-new-delete
+#include "profiler.h"
+#include <cstdlib>
+#include <new>
+
+#if LSL_PROFILER
+// 只替换普通形式的 new / delete；nothrow 与带大小的版本在标准库中转发到这里，对齐版本不计入
+void *operator new(std::size_t size)
+{
+    engine::core::Profiler::countAllocation(size);
+    for (;;)
+    {
+        if (void *ptr = std::malloc(size ? size : 1))
+            return ptr;
+        std::new_handler handler = std::get_new_handler();
+        if (!handler)
+            throw std::bad_alloc();
+        handler();
+    }
+}
+
+void *operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+#endif
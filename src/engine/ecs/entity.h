@@ -3,6 +3,18 @@
 
 namespace engine::ecs
 {
+    // 低 20 位为槽位索引，高 12 位为版本号：实体销毁后槽位复用时版本号加一，旧句柄随之失效
     using Entity = uint32_t;
     constexpr Entity NULL_ENTITY = 0;
+
+    constexpr uint32_t ENTITY_INDEX_BITS = 20;
+    constexpr uint32_t ENTITY_INDEX_MASK = (1u << ENTITY_INDEX_BITS) - 1;
+    constexpr uint32_t ENTITY_VERSION_MASK = (1u << (32 - ENTITY_INDEX_BITS)) - 1;
+
+    constexpr uint32_t entityIndex(Entity entity) { return entity & ENTITY_INDEX_MASK; }
+    constexpr uint32_t entityVersion(Entity entity) { return entity >> ENTITY_INDEX_BITS; }
+    constexpr Entity makeEntity(uint32_t index, uint32_t version)
+    {
+        return (version & ENTITY_VERSION_MASK) << ENTITY_INDEX_BITS | (index & ENTITY_INDEX_MASK);
+    }
 }
@@ -1,73 +1,330 @@
+// 实体注册表
+// registry.h
+//   - 每种组件一个 ComponentPool（稀疏集），组件按类型连续存放，get/has 为一次分页表查找
+//   - 实体带版本号（见 entity.h），销毁后旧句柄 valid() 返回 false，槽位回收复用
+//   - view<A, B...>()：以最小的池为主序遍历，其余池做 contains 过滤，不分配内存
+//   - group<A, B...>()：拥有型分组，组内实体在各池中排在同样的前缀位置，
+//     遍历时按下标直接并行访问，适合 Position + Velocity 这类总是一起读写的热点组合
+//
+// 注意：组件存放在 std::vector 中，add / remove / destroy 之后先前取得的组件引用可能失效；
+//       遍历 view / group 期间不要增删被遍历的组件或销毁实体。
 #pragma once
 #include "entity.h"
-#include <unordered_map>
-#include <vector>
+#include "sparse_set.h"
+#include <algorithm>
+#include <array>
 #include <memory>
-#include <typeindex>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 namespace engine::ecs
 {
+    // 组件类型编号：首次使用时按序分配，全程序唯一，用作注册表中池数组的下标
+    inline uint32_t nextComponentTypeId()
+    {
+        static uint32_t counter = 0;
+        return counter++;
+    }
+
+    template <typename T>
+    uint32_t componentTypeId()
+    {
+        static const uint32_t id = nextComponentTypeId();
+        return id;
+    }
+
+    // 拥有型分组的共享状态：pools 中每个池的 [0, size) 是同一批实体
+    struct GroupData
+    {
+        std::vector<uint32_t> typeIds;
+        std::vector<SparseSet *> pools;
+        size_t size = 0;
+    };
+
+    template <typename... Ts>
+    class View
+    {
+    public:
+        explicit View(ComponentPool<Ts> *...pools) : _pools(pools...)
+        {
+            _lead = std::get<0>(_pools);
+            ((_lead = pools->size() < _lead->size() ? static_cast<SparseSet *>(pools) : _lead), ...);
+        }
+
+        // f(Entity, Ts&...)
+        template <typename Func>
+        void each(Func &&f)
+        {
+            if constexpr (sizeof...(Ts) == 1)
+            {
+                // 单组件：直接顺序扫描稠密数组
+                auto *pool = std::get<0>(_pools);
+                const Entity *entities = pool->data();
+                for (size_t i = 0, n = pool->size(); i < n; ++i)
+                    f(entities[i], pool->at(static_cast<uint32_t>(i)));
+            }
+            else
+            {
+                const Entity *entities = _lead->data();
+                for (size_t i = 0, n = _lead->size(); i < n; ++i)
+                {
+                    const Entity entity = entities[i];
+                    if ((std::get<ComponentPool<Ts> *>(_pools)->contains(entity) && ...))
+                        f(entity, std::get<ComponentPool<Ts> *>(_pools)->get(entity)...);
+                }
+            }
+        }
+
+        // 遍历上界（主序池的大小），实际匹配数可能更少
+        size_t sizeHint() const { return _lead->size(); }
+
+        template <typename T>
+        T &get(Entity entity) { return std::get<ComponentPool<T> *>(_pools)->get(entity); }
+
+        // 满足全部组件的实体列表（兼容旧接口，会分配内存）
+        std::vector<Entity> entities()
+        {
+            std::vector<Entity> result;
+            result.reserve(_lead->size());
+            for (Entity entity : _lead->entities())
+            {
+                if ((std::get<ComponentPool<Ts> *>(_pools)->contains(entity) && ...))
+                    result.push_back(entity);
+            }
+            return result;
+        }
+
+    private:
+        std::tuple<ComponentPool<Ts> *...> _pools;
+        SparseSet *_lead = nullptr;
+    };
+
+    template <typename... Ts>
+    class Group
+    {
+    public:
+        Group(GroupData *data, ComponentPool<Ts> *...pools) : _data(data), _pools(pools...) {}
+
+        size_t size() const { return _data->size; }
+
+        // f(Entity, Ts&...)；各池前 size() 个槽位一一对应，无查找
+        template <typename Func>
+        void each(Func &&f)
+        {
+            const Entity *entities = std::get<0>(_pools)->data();
+            auto raws = std::make_tuple(std::get<ComponentPool<Ts> *>(_pools)->raw()...);
+            for (size_t i = 0, n = _data->size; i < n; ++i)
+                f(entities[i], std::get<Ts *>(raws)[i]...);
+        }
+
+    private:
+        GroupData *_data;
+        std::tuple<ComponentPool<Ts> *...> _pools;
+    };
+
     class Registry
     {
     private:
-        Entity _next_entity = 1;
-        std::unordered_map<std::type_index, std::unordered_map<Entity, std::shared_ptr<void>>> _components;
+        std::vector<Entity> _entities; // 按槽位索引：存活时为当前句柄，空闲时只记录下一次复用的版本号
+        std::vector<uint32_t> _free_list;
+        size_t _alive = 0;
+        std::vector<std::unique_ptr<SparseSet>> _pools; // 下标为 componentTypeId
+        std::vector<std::unique_ptr<GroupData>> _groups;
+
+        template <typename T>
+        ComponentPool<T> &assure()
+        {
+            const uint32_t id = componentTypeId<T>();
+            if (id >= _pools.size())
+                _pools.resize(id + 1);
+            if (!_pools[id])
+                _pools[id] = std::make_unique<ComponentPool<T>>();
+            return static_cast<ComponentPool<T> &>(*_pools[id]);
+        }
+
+        template <typename T>
+        ComponentPool<T> *poolFor()
+        {
+            const uint32_t id = componentTypeId<T>();
+            return id < _pools.size() ? static_cast<ComponentPool<T> *>(_pools[id].get()) : nullptr;
+        }
+
+        static bool inGroup(const GroupData &group, Entity entity)
+        {
+            return group.pools[0]->contains(entity) && group.pools[0]->indexOf(entity) < group.size;
+        }
+
+        // 实体刚获得某个被拥有的组件：若已集齐，换到各池的分组前缀末尾
+        static void enterGroup(GroupData &group, Entity entity)
+        {
+            if (inGroup(group, entity))
+                return;
+            for (SparseSet *pool : group.pools)
+            {
+                if (!pool->contains(entity))
+                    return;
+            }
+            const auto slot = static_cast<uint32_t>(group.size);
+            for (SparseSet *pool : group.pools)
+                pool->swapSlots(pool->indexOf(entity), slot);
+            ++group.size;
+        }
+
+        // 实体即将失去某个被拥有的组件：先换出分组前缀
+        static void leaveGroup(GroupData &group, Entity entity)
+        {
+            if (!inGroup(group, entity))
+                return;
+            --group.size;
+            const auto slot = static_cast<uint32_t>(group.size);
+            for (SparseSet *pool : group.pools)
+                pool->swapSlots(pool->indexOf(entity), slot);
+        }
 
     public:
+        Registry()
+        {
+            // 槽位 0 保留，保证任何有效句柄都不等于 NULL_ENTITY
+            _entities.push_back(NULL_ENTITY);
+        }
+
+        Registry(const Registry &) = delete;
+        Registry &operator=(const Registry &) = delete;
+        Registry(Registry &&) = default;
+        Registry &operator=(Registry &&) = default;
+
         Entity create()
         {
-            return _next_entity++;
+            ++_alive;
+            if (!_free_list.empty())
+            {
+                const uint32_t index = _free_list.back();
+                _free_list.pop_back();
+                _entities[index] = makeEntity(index, entityVersion(_entities[index]));
+                return _entities[index];
+            }
+            const auto index = static_cast<uint32_t>(_entities.size());
+            if (index >= ENTITY_INDEX_MASK)
+            {
+                --_alive;
+                return NULL_ENTITY; // 索引位已用尽（约 100 万个同时存活的实体）
+            }
+            const Entity entity = makeEntity(index, 0);
+            _entities.push_back(entity);
+            return entity;
+        }
+
+        bool valid(Entity entity) const
+        {
+            const uint32_t index = entityIndex(entity);
+            return entity != NULL_ENTITY && index < _entities.size() && _entities[index] == entity;
         }
 
         void destroy(Entity entity)
         {
-            for (auto& [type, storage] : _components)
+            if (!valid(entity))
+                return;
+            for (auto &pool : _pools)
             {
-                storage.erase(entity);
+                if (!pool || !pool->contains(entity))
+                    continue;
+                if (pool->owner)
+                    leaveGroup(*pool->owner, entity);
+                pool->erase(entity);
             }
+            const uint32_t index = entityIndex(entity);
+            // 空闲槽位的索引字段写成保留值，任何句柄都无法与之相等
+            _entities[index] = makeEntity(ENTITY_INDEX_MASK, entityVersion(entity) + 1);
+            _free_list.push_back(index);
+            --_alive;
         }
 
-        template<typename T, typename... Args>
-        T& add(Entity entity, Args&&... args)
+        size_t size() const { return _alive; }
+
+        // 已存在时覆盖；返回的引用在下一次结构性修改前有效
+        template <typename T, typename... Args>
+        T &add(Entity entity, Args &&...args)
         {
-            auto component = std::make_shared<T>(std::forward<Args>(args)...);
-            _components[typeid(T)][entity] = component;
-            return *component;
+            auto &pool = assure<T>();
+            pool.emplace(entity, std::forward<Args>(args)...);
+            if (pool.owner)
+                enterGroup(*pool.owner, entity);
+            return pool.get(entity);
         }
 
-        template<typename T>
-        T* get(Entity entity)
+        template <typename T>
+        void remove(Entity entity)
         {
-            auto type_it = _components.find(typeid(T));
-            if (type_it == _components.end())
-                return nullptr;
-
-            auto entity_it = type_it->second.find(entity);
-            if (entity_it == type_it->second.end())
-                return nullptr;
+            auto *pool = poolFor<T>();
+            if (!pool || !pool->contains(entity))
+                return;
+            if (pool->owner)
+                leaveGroup(*pool->owner, entity);
+            pool->erase(entity);
+        }
 
-            return static_cast<T*>(entity_it->second.get());
+        template <typename T>
+        T *get(Entity entity)
+        {
+            auto *pool = poolFor<T>();
+            return pool ? pool->tryGet(entity) : nullptr;
         }
 
-        template<typename T>
+        template <typename T>
         bool has(Entity entity)
         {
-            return get<T>(entity) != nullptr;
+            auto *pool = poolFor<T>();
+            return pool && pool->contains(entity);
         }
 
-        template<typename T>
-        std::vector<Entity> view()
+        template <typename... Ts>
+        View<Ts...> view()
         {
-            std::vector<Entity> result;
-            auto it = _components.find(typeid(T));
-            if (it != _components.end())
+            static_assert(sizeof...(Ts) > 0, "view 至少需要一个组件类型");
+            return View<Ts...>(&assure<Ts>()...);
+        }
+
+        /**
+         * @brief 获取（首次调用时建立）拥有型分组；同一组类型重复调用返回同一分组
+         * @throws std::logic_error 当其中某个组件已被另一个分组拥有时抛出
+         */
+        template <typename... Ts>
+        Group<Ts...> group()
+        {
+            static_assert(sizeof...(Ts) >= 2, "分组至少需要两个组件类型");
+            const std::array<uint32_t, sizeof...(Ts)> ids{componentTypeId<Ts>()...};
+            for (auto &existing : _groups)
             {
-                for (const auto& [entity, _] : it->second)
-                {
-                    result.push_back(entity);
-                }
+                if (existing->typeIds.size() == ids.size() &&
+                    std::equal(ids.begin(), ids.end(), existing->typeIds.begin()))
+                    return Group<Ts...>(existing.get(), &assure<Ts>()...);
             }
-            return result;
+
+            auto data = std::make_unique<GroupData>();
+            data->typeIds.assign(ids.begin(), ids.end());
+            data->pools = {static_cast<SparseSet *>(&assure<Ts>())...};
+            for (SparseSet *pool : data->pools)
+            {
+                // 稠密顺序只能服从一个分组
+                if (pool->owner)
+                    throw std::logic_error("Registry::group: 组件已被其他分组拥有");
+            }
+
+            // 以最小的池为主序收集已集齐的实体
+            SparseSet *lead = data->pools[0];
+            for (SparseSet *pool : data->pools)
+                lead = pool->size() < lead->size() ? pool : lead;
+            const std::vector<Entity> candidates = lead->entities();
+            for (Entity entity : candidates)
+                enterGroup(*data, entity);
+
+            for (SparseSet *pool : data->pools)
+                pool->owner = data.get();
+            GroupData *raw = data.get();
+            _groups.push_back(std::move(data));
+            return Group<Ts...>(raw, &assure<Ts>()...);
         }
     };
 }
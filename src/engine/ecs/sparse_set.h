@@ -0,0 +1,150 @@
+// 稀疏集组件存储
+// sparse_set.h
+//   - SparseSet：实体 → 稠密下标的分页稀疏表 + 连续的实体数组，增删查均为 O(1)
+//   - ComponentPool<T>：在 SparseSet 之上并行维护连续的组件数组，删除时与末尾交换
+//   - 稠密数组中的顺序可被分组（Registry::group）重排：组内实体始终排在 [0, groupSize)
+#pragma once
+#include "entity.h"
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace engine::ecs
+{
+    struct GroupData;
+
+    class SparseSet
+    {
+    public:
+        static constexpr uint32_t PAGE_SIZE = 4096;
+        static constexpr uint32_t INVALID = 0xFFFFFFFFu;
+
+        virtual ~SparseSet() = default;
+
+        bool contains(Entity entity) const
+        {
+            const uint32_t slot = sparseAt(entityIndex(entity));
+            return slot != INVALID && _dense[slot] == entity;
+        }
+
+        // 稠密下标；调用方须先确认 contains
+        uint32_t indexOf(Entity entity) const { return sparseAt(entityIndex(entity)); }
+
+        size_t size() const { return _dense.size(); }
+        bool empty() const { return _dense.empty(); }
+        const Entity *data() const { return _dense.data(); }
+        const std::vector<Entity> &entities() const { return _dense; }
+
+        // 交换两个稠密位置（实体与组件一起移动）
+        void swapSlots(uint32_t a, uint32_t b)
+        {
+            if (a == b)
+                return;
+            std::swap(_dense[a], _dense[b]);
+            sparseRef(entityIndex(_dense[a])) = a;
+            sparseRef(entityIndex(_dense[b])) = b;
+            swapPayload(a, b);
+        }
+
+        // 类型擦除删除（实体销毁时遍历所有池）；不存在时无操作
+        void erase(Entity entity)
+        {
+            if (!contains(entity))
+                return;
+            const uint32_t slot = indexOf(entity);
+            const uint32_t last = static_cast<uint32_t>(_dense.size() - 1);
+            swapSlots(slot, last);
+            sparseRef(entityIndex(entity)) = INVALID;
+            _dense.pop_back();
+            popPayload();
+        }
+
+        // 拥有此池的分组（每个池至多属于一个分组）
+        GroupData *owner = nullptr;
+
+    protected:
+        uint32_t emplaceEntity(Entity entity)
+        {
+            const uint32_t slot = static_cast<uint32_t>(_dense.size());
+            sparseRef(entityIndex(entity)) = slot;
+            _dense.push_back(entity);
+            return slot;
+        }
+
+        virtual void swapPayload(uint32_t a, uint32_t b) = 0;
+        virtual void popPayload() = 0;
+
+    private:
+        uint32_t sparseAt(uint32_t index) const
+        {
+            const uint32_t page = index / PAGE_SIZE;
+            if (page >= _sparse.size() || !_sparse[page])
+                return INVALID;
+            return _sparse[page][index % PAGE_SIZE];
+        }
+
+        uint32_t &sparseRef(uint32_t index)
+        {
+            const uint32_t page = index / PAGE_SIZE;
+            if (page >= _sparse.size())
+                _sparse.resize(page + 1);
+            if (!_sparse[page])
+            {
+                _sparse[page] = std::make_unique<uint32_t[]>(PAGE_SIZE);
+                std::fill_n(_sparse[page].get(), PAGE_SIZE, INVALID);
+            }
+            return _sparse[page][index % PAGE_SIZE];
+        }
+
+        std::vector<std::unique_ptr<uint32_t[]>> _sparse; // 按页懒分配，实体索引稀疏时不浪费内存
+        std::vector<Entity> _dense;
+    };
+
+    template <typename T>
+    class ComponentPool final : public SparseSet
+    {
+    public:
+        template <typename... Args>
+        T &emplace(Entity entity, Args &&...args)
+        {
+            if (contains(entity))
+            {
+                T &existing = _components[indexOf(entity)];
+                existing = make(std::forward<Args>(args)...);
+                return existing;
+            }
+            emplaceEntity(entity);
+            return _components.emplace_back(make(std::forward<Args>(args)...));
+        }
+
+        T *tryGet(Entity entity) { return contains(entity) ? &_components[indexOf(entity)] : nullptr; }
+        T &get(Entity entity) { return _components[indexOf(entity)]; }
+        T &at(uint32_t slot) { return _components[slot]; }
+        T *raw() { return _components.data(); }
+
+    protected:
+        void swapPayload(uint32_t a, uint32_t b) override
+        {
+            using std::swap;
+            swap(_components[a], _components[b]);
+        }
+
+        void popPayload() override { _components.pop_back(); }
+
+    private:
+        // 聚合类型（Position 等）用花括号初始化，其余走构造函数
+        template <typename... Args>
+        static T make(Args &&...args)
+        {
+            if constexpr (std::is_constructible_v<T, Args...>)
+                return T(std::forward<Args>(args)...);
+            else
+                return T{std::forward<Args>(args)...};
+        }
+
+        std::vector<T> _components;
+    };
+}
@@ -1,6 +1,4 @@
 #include "game_object.h"
-#include "../component/transform_component.h"
-#include "../component/sprite_component.h"
 
 namespace engine::object
 {
@@ -17,35 +15,48 @@ namespace engine::object
     void GameObject::update(float delta_time)
     {
         if (!_enabled) return;
-        for (auto &pair : _components)
+        for (size_t i = 0; i < _order.size(); ++i)
         {
-            pair.second->update(delta_time);
+            _components[_order[i]]->update(delta_time);
         }
     }
 
     void GameObject::render()
     {
         if (!_visible) return;
-        for (auto &pair : _components)
+        for (auto id : _order)
         {
-            pair.second->render();
+            _components[id]->render();
         }
     }
 
     void GameObject::clean()
     {
-        for (auto &pair : _components)
+        for (auto id : _order)
         {
-            pair.second->clean();
+            _components[id]->clean();
         }
-        _components.clear();
+        for (auto &component : _components)
+        {
+            component.reset();
+        }
+        _order.clear();
     }
 
     void GameObject::handleInput()
     {
-        for (auto &pair : _components)
+        for (size_t i = 0; i < _order.size(); ++i)
+        {
+            _components[_order[i]]->handleInput();
+        }
+    }
+
+    void GameObject::notifyComponentsChanged(engine::component::ComponentTypeId changed)
+    {
+        for (auto id : _order)
         {
-            pair.second->handleInput();
+            if (id != changed)
+                _components[id]->resolveSiblings();
         }
     }
 } // namespace engine::object
\ No newline at end of file
@@ -1,8 +1,11 @@
 #pragma once
 #include "../component/component.h"
+#include <array>
+#include <memory>
 #include <string>
-#include <unordered_map>
-#include <typeindex>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
 #include <spdlog/spdlog.h>
 
 namespace engine::core
@@ -20,7 +23,20 @@ namespace engine::object
         bool _need_remove = false;
         bool _visible     = true;
         bool _enabled     = true;
-        std::unordered_map<std::type_index, std::unique_ptr<engine::component::Component>> _components;
+        // 按 TYPE_ID 直接索引的组件槽位；_order 记录添加顺序，update/render 按此顺序遍历
+        std::array<std::unique_ptr<engine::component::Component>, engine::component::component_type::COUNT> _components;
+        std::vector<engine::component::ComponentTypeId> _order;
+
+        template <typename T>
+        static constexpr engine::component::ComponentTypeId typeIdOf()
+        {
+            static_assert(std::is_base_of<engine::component::Component, T>::value, "T 必须继承 Component");
+            static_assert(T::TYPE_ID < engine::component::component_type::COUNT, "组件 TYPE_ID 超出槽位数");
+            return T::TYPE_ID;
+        }
+
+        // 增删组件后通知其余组件刷新缓存的兄弟指针
+        void notifyComponentsChanged(engine::component::ComponentTypeId changed);
 
     public:
         GameObject(engine::core::Context &context,
@@ -51,21 +67,21 @@ namespace engine::object
         template <typename T, typename... Args>
         T *addComponent(Args &&...args)
         {
-            // 检测组件是否合法
-            static_assert(std::is_base_of<engine::component::Component, T>::value, "T 必须继承 Component");
-            auto type_index = std::type_index(typeid(T));
+            constexpr auto id = typeIdOf<T>();
             // 检测组件是否已经存在，如果存在则返回组件指针
-            if (hasComponent<T>())
+            if (_components[id])
             {
                 return getComponent<T>();
             }
-            // 如果不存在则创建组件
+            // 如果不存在则创建组件；先入槽位，init 中嵌套添加的组件也能找到它
             auto new_component = std::make_unique<T>(std::forward<Args>(args)...);
             T *ptr = new_component.get();
-            // 这会自动设置 _owner, _context 并触发 ptr->init()
+            _components[id] = std::move(new_component);
+            _order.push_back(id);
+            // 这会自动设置 _owner, _context 并触发 ptr->resolveSiblings() / ptr->init()
             // 这里的 _context 是 GameObject 构造时存入的成员变量
             ptr->attach(this, this->_context);
-            _components[type_index] = std::move(new_component);
+            notifyComponentsChanged(id);
             spdlog::debug(" GameObject {} 添加组件: {}", _name, typeid(T).name());
             return ptr;
         }
@@ -73,33 +89,25 @@ namespace engine::object
         template <typename T>
         T *getComponent() const
         {
-            static_assert(std::is_base_of<engine::component::Component, T>::value, "T 必须继承 Component");
-            auto type_index = std::type_index(typeid(T));
-            if (_components.find(type_index) == _components.end())
-            {
-                return nullptr;
-            }
-            return static_cast<T *>(_components.at(type_index).get());
+            return static_cast<T *>(_components[typeIdOf<T>()].get());
         }
 
         template <typename T>
         bool hasComponent() const
         {
-            static_assert(std::is_base_of<engine::component::Component, T>::value, "T 必须继承 Component");
-            return _components.contains(std::type_index(typeid(T)));
+            return _components[typeIdOf<T>()] != nullptr;
         }
 
         template <typename T>
         void removeComponent()
         {
-            static_assert(std::is_base_of<engine::component::Component, T>::value, "T 必须继承 Component");
-            auto type_index = std::type_index(typeid(T));
-            auto it = _components.find(type_index);
-            if (it != _components.end())
-            {
-                it->second->clean();
-                _components.erase(it);
-            }
+            constexpr auto id = typeIdOf<T>();
+            if (!_components[id])
+                return;
+            _components[id]->clean();
+            _components[id].reset();
+            std::erase(_order, id);
+            notifyComponentsChanged(id);
         }
 
         void update(float delta_time);
@@ -0,0 +1,43 @@
+// PhysicsManager::debugDraw 单独成编译单元：无渲染器的工具 / 基准只链接 physics_manager.cpp 即可
+#include "physics_manager.h"
+#include "../render/renderer.h"
+#include "../render/camera.h"
+#include <glm/glm.hpp>
+
+namespace engine::physics
+{
+    void PhysicsManager::debugDraw(engine::render::Renderer &renderer, const engine::render::Camera &camera) const
+    {
+        if (!b2World_IsValid(m_worldId))
+            return;
+
+        constexpr float PIXELS_PER_METER = 32.0f;
+
+        // 复合体（整块碰撞）可能有几十个形状，按实际数量取
+        std::vector<b2ShapeId> shapes;
+        for (const auto &bodyId : m_bodies)
+        {
+            if (!b2Body_IsValid(bodyId))
+                continue;
+
+            const int shapeCount = b2Body_GetShapeCount(bodyId);
+            if (shapeCount <= 0)
+                continue;
+
+            shapes.resize(static_cast<size_t>(shapeCount));
+            const int actualCount = b2Body_GetShapes(bodyId, shapes.data(), shapeCount);
+            for (int i = 0; i < actualCount; i++)
+            {
+                if (!b2Shape_IsValid(shapes[i]))
+                    continue;
+
+                // 包围盒对轴对齐盒形即为其本身，对链形线段为其外接框
+                const b2AABB aabb = b2Shape_GetAABB(shapes[i]);
+                const float width = (aabb.upperBound.x - aabb.lowerBound.x) * PIXELS_PER_METER;
+                const float height = (aabb.upperBound.y - aabb.lowerBound.y) * PIXELS_PER_METER;
+                renderer.drawRect(camera, aabb.lowerBound.x * PIXELS_PER_METER, aabb.lowerBound.y * PIXELS_PER_METER,
+                                  width, height, glm::vec4(0.0f, 0.5f, 1.0f, 0.3f));
+            }
+        }
+    }
+}
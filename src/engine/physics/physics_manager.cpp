@@ -1,8 +1,8 @@
 #include "physics_manager.h"
-#include "../render/renderer.h"
-#include "../render/camera.h"
+#include "../core/job_system.h"
+#include "../core/profiler.h"
 #include <algorithm>
-#include <glm/glm.hpp>
+#include <cmath>
 
 namespace engine::physics
 {
@@ -20,13 +20,38 @@ namespace engine::physics
         }
     }
 
-    void PhysicsManager::init(b2Vec2 gravity)
+    void PhysicsManager::init(b2Vec2 gravity, engine::core::JobSystem *jobSystem)
     {
         b2WorldDef worldDef = b2DefaultWorldDef();
         worldDef.gravity = gravity;
+
+        // Box2D 用 workerIndex 索引每线程上下文，因此 workerCount 必须覆盖任务系统的全部线程
+        m_jobSystem = jobSystem;
+        m_solverWorkerCount = 1;
+        if (m_jobSystem && m_jobSystem->getThreadCount() > 1)
+        {
+            m_solverWorkerCount = m_jobSystem->getThreadCount();
+            worldDef.workerCount = m_solverWorkerCount;
+            worldDef.enqueueTask = &PhysicsManager::enqueueTask;
+            worldDef.finishTask = &PhysicsManager::finishTask;
+            worldDef.userTaskContext = m_jobSystem;
+        }
+
         m_worldId = b2CreateWorld(&worldDef);
     }
 
+    void *PhysicsManager::enqueueTask(b2TaskCallback *task, int itemCount, int minRange, void *taskContext, void *userContext)
+    {
+        auto *jobs = static_cast<engine::core::JobSystem *>(userContext);
+        return jobs->submit(task, itemCount, minRange, taskContext);
+    }
+
+    void PhysicsManager::finishTask(void *userTask, void *userContext)
+    {
+        auto *jobs = static_cast<engine::core::JobSystem *>(userContext);
+        jobs->wait(static_cast<engine::core::JobGroup *>(userTask));
+    }
+
     void PhysicsManager::update(float timeStep, int subStepCount)
     {
         if (b2World_IsValid(m_worldId))
@@ -35,6 +60,69 @@ namespace engine::physics
         }
     }
 
+    int PhysicsManager::advance(float frameDelta)
+    {
+        m_lastStepCount = 0;
+        if (!b2World_IsValid(m_worldId))
+            return 0;
+
+        m_accumulator += std::max(frameDelta, 0.0f);
+        while (m_accumulator >= m_fixedTimeStep && m_lastStepCount < m_maxStepsPerFrame)
+        {
+            LSL_PROFILE_ZONE("PhysicsManager::step");
+            capturePreviousPositions();
+            b2World_Step(m_worldId, m_fixedTimeStep, m_subStepCount);
+            m_accumulator -= m_fixedTimeStep;
+            ++m_lastStepCount;
+        }
+
+        // 达到步数上限：丢弃积压时间，防止后续帧持续追帧（死亡螺旋）
+        if (m_accumulator >= m_fixedTimeStep)
+        {
+            const float kept = std::fmod(m_accumulator, m_fixedTimeStep);
+            m_droppedTime += m_accumulator - kept;
+            m_accumulator = kept;
+        }
+
+        m_alpha = std::clamp(m_accumulator / m_fixedTimeStep, 0.0f, 1.0f);
+        return m_lastStepCount;
+    }
+
+    void PhysicsManager::setTickRate(float hz)
+    {
+        m_tickRate = std::clamp(hz, 1.0f, 1000.0f);
+        m_fixedTimeStep = 1.0f / m_tickRate;
+        m_accumulator = std::min(m_accumulator, m_fixedTimeStep);
+    }
+
+    void PhysicsManager::capturePreviousPositions()
+    {
+        for (auto &[index, interp] : m_interpolation)
+        {
+            if (b2Body_IsValid(interp.bodyId))
+                interp.previous = b2Body_GetPosition(interp.bodyId);
+        }
+    }
+
+    b2Vec2 PhysicsManager::getInterpolatedPosition(b2BodyId bodyId) const
+    {
+        const b2Vec2 current = b2Body_GetPosition(bodyId);
+        auto it = m_interpolation.find(bodyId.index1);
+        if (it == m_interpolation.end() || !B2_ID_EQUALS(it->second.bodyId, bodyId))
+            return current;
+
+        const b2Vec2 previous = it->second.previous;
+        return {previous.x + (current.x - previous.x) * m_alpha,
+                previous.y + (current.y - previous.y) * m_alpha};
+    }
+
+    void PhysicsManager::resetInterpolation(b2BodyId bodyId)
+    {
+        auto it = m_interpolation.find(bodyId.index1);
+        if (it != m_interpolation.end() && B2_ID_EQUALS(it->second.bodyId, bodyId) && b2Body_IsValid(bodyId))
+            it->second.previous = b2Body_GetPosition(bodyId);
+    }
+
     b2BodyId PhysicsManager::createStaticBody(b2Vec2 position, b2Vec2 halfSize, void *userData)
     {
         if (!b2World_IsValid(m_worldId))
@@ -42,9 +130,24 @@ namespace engine::physics
             return b2_nullBodyId;
         }
 
+        b2BodyId bodyId = createStaticBox({position, halfSize}, userData);
+        if (B2_IS_NULL(bodyId))
+        {
+            return b2_nullBodyId;
+        }
+
+        if (userData)
+        {
+            m_userDataToBody[userData] = bodyId;
+        }
+        return bodyId;
+    }
+
+    b2BodyId PhysicsManager::createStaticBox(const StaticBoxDesc &box, void *userData)
+    {
         b2BodyDef bodyDef = b2DefaultBodyDef();
         bodyDef.type = b2_staticBody;
-        bodyDef.position = position;
+        bodyDef.position = box.position;
         bodyDef.userData = userData;
         b2BodyId bodyId = b2CreateBody(m_worldId, &bodyDef);
 
@@ -53,18 +156,116 @@ namespace engine::physics
             return b2_nullBodyId;
         }
 
-        b2Polygon box = b2MakeBox(halfSize.x, halfSize.y);
+        b2Polygon polygon = b2MakeBox(box.halfSize.x, box.halfSize.y);
         b2ShapeDef shapeDef = b2DefaultShapeDef();
-        b2CreatePolygonShape(bodyId, &shapeDef, &box);
+        b2CreatePolygonShape(bodyId, &shapeDef, &polygon);
 
-        m_bodies.push_back(bodyId);
-        if (userData)
+        trackBody(bodyId);
+        return bodyId;
+    }
+
+    void PhysicsManager::createStaticBodies(const StaticBoxDesc *boxes, int count, b2BodyId *outIds)
+    {
+        if (!b2World_IsValid(m_worldId))
         {
-            m_userDataToBody[userData] = bodyId;
+            for (int i = 0; i < count; ++i)
+                outIds[i] = b2_nullBodyId;
+            return;
         }
+
+        if (count > 0)
+            m_bodies.reserve(m_bodies.size() + static_cast<size_t>(count));
+        for (int i = 0; i < count; ++i)
+            outIds[i] = createStaticBox(boxes[i], nullptr);
+    }
+
+    void PhysicsManager::destroyBodies(const b2BodyId *bodyIds, int count)
+    {
+        for (int i = 0; i < count; ++i)
+            destroyBody(bodyIds[i]);
+    }
+
+    b2BodyId PhysicsManager::createStaticCompoundBody(b2Vec2 origin, const StaticBoxDesc *boxes, int count)
+    {
+        if (!b2World_IsValid(m_worldId) || count <= 0)
+            return b2_nullBodyId;
+
+        b2BodyDef bodyDef = b2DefaultBodyDef();
+        bodyDef.type = b2_staticBody;
+        bodyDef.position = origin;
+        b2BodyId bodyId = b2CreateBody(m_worldId, &bodyDef);
+        if (!b2Body_IsValid(bodyId))
+            return b2_nullBodyId;
+
+        b2ShapeDef shapeDef = b2DefaultShapeDef();
+        for (int i = 0; i < count; ++i)
+        {
+            b2Polygon polygon = b2MakeOffsetBox(boxes[i].halfSize.x, boxes[i].halfSize.y, boxes[i].position, b2Rot_identity);
+            b2CreatePolygonShape(bodyId, &shapeDef, &polygon);
+        }
+
+        trackBody(bodyId);
+        return bodyId;
+    }
+
+    b2BodyId PhysicsManager::createStaticChainBody(b2Vec2 origin, const b2Vec2 *points, const int *loopSizes, int loopCount)
+    {
+        if (!b2World_IsValid(m_worldId) || loopCount <= 0)
+            return b2_nullBodyId;
+
+        b2BodyDef bodyDef = b2DefaultBodyDef();
+        bodyDef.type = b2_staticBody;
+        bodyDef.position = origin;
+        b2BodyId bodyId = b2CreateBody(m_worldId, &bodyDef);
+        if (!b2Body_IsValid(bodyId))
+            return b2_nullBodyId;
+
+        const b2Vec2 *loopPoints = points;
+        for (int i = 0; i < loopCount; ++i)
+        {
+            const int size = loopSizes[i];
+            if (size >= 4)
+            {
+                b2ChainDef chainDef = b2DefaultChainDef();
+                chainDef.points = loopPoints;
+                chainDef.count = size;
+                chainDef.isLoop = true;
+                b2CreateChain(bodyId, &chainDef);
+            }
+            loopPoints += size;
+        }
+
+        trackBody(bodyId);
         return bodyId;
     }
 
+    void PhysicsManager::trackBody(b2BodyId bodyId)
+    {
+        const size_t slot = static_cast<size_t>(bodyId.index1);
+        if (slot >= m_bodySlots.size())
+            m_bodySlots.resize(std::max(slot + 1, m_bodySlots.size() * 2), 0);
+        m_bodies.push_back(bodyId);
+        m_bodySlots[slot] = static_cast<uint32_t>(m_bodies.size());
+    }
+
+    void PhysicsManager::untrackBody(b2BodyId bodyId)
+    {
+        const size_t slot = static_cast<size_t>(bodyId.index1);
+        if (slot >= m_bodySlots.size() || m_bodySlots[slot] == 0)
+            return;
+
+        const size_t dense = m_bodySlots[slot] - 1;
+        if (!B2_ID_EQUALS(m_bodies[dense], bodyId))
+            return; // 槽位已被新物理体复用
+
+        // 与末尾交换后弹出，O(1)
+        const b2BodyId last = m_bodies.back();
+        m_bodies[dense] = last;
+        m_bodySlots[static_cast<size_t>(last.index1)] = static_cast<uint32_t>(dense + 1);
+        m_bodies.pop_back();
+        m_bodySlots[slot] = 0;
+    }
+
     b2BodyId PhysicsManager::createDynamicBody(b2Vec2 position, b2Vec2 halfSize, void *userData)
     {
         if (!b2World_IsValid(m_worldId))
@@ -92,11 +293,12 @@ namespace engine::physics
         shapeDef.density = 1.0f;
         b2CreatePolygonShape(bodyId, &shapeDef, &box);
 
-        m_bodies.push_back(bodyId);
+        trackBody(bodyId);
         if (userData)
         {
             m_userDataToBody[userData] = bodyId;
         }
+        m_interpolation[bodyId.index1] = {bodyId, position};
 
         return bodyId;
     }
@@ -111,16 +313,18 @@ namespace engine::physics
         void *userData = b2Body_GetUserData(bodyId);
         if (userData)
         {
-            m_userDataToBody.erase(userData);
+            auto userIt = m_userDataToBody.find(userData);
+            if (userIt != m_userDataToBody.end() && B2_ID_EQUALS(userIt->second, bodyId))
+                m_userDataToBody.erase(userIt);
+        }
+        if (!m_interpolation.empty())
+        {
+            auto interpIt = m_interpolation.find(bodyId.index1);
+            if (interpIt != m_interpolation.end() && B2_ID_EQUALS(interpIt->second.bodyId, bodyId))
+                m_interpolation.erase(interpIt);
         }
 
-        m_bodies.erase(std::remove_if(m_bodies.begin(),
-                                      m_bodies.end(),
-                                      [bodyId](const b2BodyId &trackedBody)
-                                      {
-                                          return B2_ID_EQUALS(trackedBody, bodyId);
-                                      }),
-                       m_bodies.end());
+        untrackBody(bodyId);
         b2DestroyBody(bodyId);
     }
 
@@ -143,41 +347,8 @@ namespace engine::physics
             }
         }
         m_bodies.clear();
+        m_bodySlots.clear();
         m_userDataToBody.clear();
-    }
-
-    void PhysicsManager::debugDraw(engine::render::Renderer &renderer, const engine::render::Camera &camera) const
-    {
-        if (!b2World_IsValid(m_worldId))
-            return;
-
-        constexpr float PIXELS_PER_METER = 32.0f;
-
-        for (const auto &bodyId : m_bodies)
-        {
-            if (!b2Body_IsValid(bodyId))
-                continue;
-
-            b2Vec2 pos = b2Body_GetPosition(bodyId);
-            int shapeCount = b2Body_GetShapeCount(bodyId);
-
-            if (shapeCount > 0)
-            {
-                b2ShapeId shapes[16];
-                int actualCount = b2Body_GetShapes(bodyId, shapes, 16);
-
-                for (int i = 0; i < actualCount; i++)
-                {
-                    if (b2Shape_IsValid(shapes[i]))
-                    {
-                        b2Polygon poly = b2Shape_GetPolygon(shapes[i]);
-                        float width = (poly.vertices[1].x - poly.vertices[0].x) * 2.0f * PIXELS_PER_METER;
-                        float height = (poly.vertices[2].y - poly.vertices[1].y) * 2.0f * PIXELS_PER_METER;
-
-                        renderer.drawRect(camera, pos.x * PIXELS_PER_METER - width / 2, pos.y * PIXELS_PER_METER - height / 2, width, height, glm::vec4(0.0f, 0.5f, 1.0f, 0.3f));
-                    }
-                }
-            }
-        }
+        m_interpolation.clear();
     }
 }
\ No newline at end of file
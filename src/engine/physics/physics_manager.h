@@ -1,6 +1,8 @@
 // physics_manager.h
 #pragma once
 #include <box2d/box2d.h> // 引入Box2D库
+#include <cstddef>
+#include <cstdint>
 #include <unordered_map>
 #include <vector>
 
@@ -10,43 +12,129 @@ namespace engine::render
     class Camera;
 }
 
+namespace engine::core
+{
+    class JobSystem;
+}
+
 namespace engine::physics
 {
+    /**
+     * @brief 批量创建静态碰撞盒的描述（单位：米）
+     */
+    struct StaticBoxDesc
+    {
+        b2Vec2 position = {0.0f, 0.0f};
+        b2Vec2 halfSize = {0.0f, 0.0f};
+    };
+
     class PhysicsManager
     {
     public:
         PhysicsManager();
         ~PhysicsManager();
 
-        // 初始化物理世界（重力等）
-        void init(b2Vec2 gravity = {0.0f, 10.0f});
+        // 初始化物理世界（重力等）。传入任务系统时，岛屿求解 / 接触处理按其线程数并行
+        void init(b2Vec2 gravity = {0.0f, 10.0f}, engine::core::JobSystem *jobSystem = nullptr);
 
-        // 每帧更新（固定时间步）
+        // 单步推进物理世界（timeStep 秒）
         void update(float timeStep, int subStepCount = 4);
 
+        // ── 固定时间步 ──
+        // 按帧时间累积，以 1/tickRate 为步长推进若干步，返回本帧实际步数。
+        // 单帧最多 maxStepsPerFrame 步，超出部分丢弃（低帧率时减速而非步长变大）。
+        int advance(float frameDelta);
+
+        void setTickRate(float hz);
+        void setMaxStepsPerFrame(int steps) { m_maxStepsPerFrame = steps > 0 ? steps : 1; }
+        void setSubStepCount(int subSteps) { m_subStepCount = subSteps > 0 ? subSteps : 1; }
+
+        float getTickRate() const { return m_tickRate; }
+        float getFixedTimeStep() const { return m_fixedTimeStep; }
+        int getMaxStepsPerFrame() const { return m_maxStepsPerFrame; }
+        // 插值系数：累积器剩余时间 / 步长，范围 [0, 1)
+        float getInterpolationAlpha() const { return m_alpha; }
+        int getLastStepCount() const { return m_lastStepCount; }
+        // 因步数上限被丢弃的累计时间（秒）
+        float getDroppedTime() const { return m_droppedTime; }
+
+        // 动态体的渲染插值位置（米）：上一步与当前步之间按 alpha 插值；未跟踪的物理体返回当前位置
+        b2Vec2 getInterpolatedPosition(b2BodyId bodyId) const;
+        // 传送 / 强制设位置后调用，使上一步位置等于当前位置，避免插值拖影
+        void resetInterpolation(b2BodyId bodyId);
+
         // 创建静态物理体（用于瓦片）
         b2BodyId createStaticBody(b2Vec2 position, b2Vec2 halfSize, void *userData);
         b2BodyId createDynamicBody(b2Vec2 position, b2Vec2 halfSize, void *userData);
 
-        // 销毁物理体
+        // 销毁物理体（O(1)）
         void destroyBody(b2BodyId bodyId);
-        
+
+        // ── 批量接口（区块碰撞体） ──
+        // 一次创建 count 个无 userData 的静态盒体，outIds 至少 count 个，失败项写入 b2_nullBodyId
+        void createStaticBodies(const StaticBoxDesc *boxes, int count, b2BodyId *outIds);
+        // 一次销毁多个物理体（跳过无效 / 空 ID）
+        void destroyBodies(const b2BodyId *bodyIds, int count);
+
+        // ── 复合静态体（整块一个物理体，坐标均相对 origin，单位：米） ──
+        // 一个静态体承载 count 个盒形；count 为 0 时不创建并返回 b2_nullBodyId
+        b2BodyId createStaticCompoundBody(b2Vec2 origin, const StaticBoxDesc *boxes, int count);
+        // 一个静态体承载 loopCount 条闭合链形，第 i 条取 points 中接下来的 loopSizes[i] 个点（每条至少 4 点）
+        b2BodyId createStaticChainBody(b2Vec2 origin, const b2Vec2 *points, const int *loopSizes, int loopCount);
+
+        size_t getBodyCount() const { return m_bodies.size(); }
+
         // 通过用户数据查找物理体（可选）
         b2BodyId findBodyByUserData(void *userData) const;
 
         // 获取物理世界ID
         b2WorldId getWorldId() const { return m_worldId; }
+        // Box2D 求解使用的线程数（未接入任务系统时为 1）
+        int getSolverWorkerCount() const { return m_solverWorkerCount; }
 
         // 清理所有物理体
         void clearBodies();
 
-        // 调试绘制所有碰撞箱
+        // 调试绘制所有碰撞形状的包围盒（实现位于 physics_debug_draw.cpp，无渲染器的工具可不链接）
         void debugDraw(class engine::render::Renderer &renderer, const class engine::render::Camera &camera) const;
 
     private:
+        // 动态体插值状态：每个固定步之前记录位置
+        struct BodyInterpolation
+        {
+            b2BodyId bodyId = b2_nullBodyId;
+            b2Vec2 previous = {0.0f, 0.0f};
+        };
+
+        void capturePreviousPositions();
+
+        // ── 物理体登记（槽位表） ──
+        // m_bodies 为紧凑数组，m_bodySlots 以 Box2D 的 index1 为下标记录其在 m_bodies 中的位置 + 1（0 = 未登记）。
+        // Box2D 内部会复用已释放的 index1，因此槽位表大小只随同时存活的物理体峰值增长。
+        void trackBody(b2BodyId bodyId);
+        void untrackBody(b2BodyId bodyId);
+        b2BodyId createStaticBox(const StaticBoxDesc &box, void *userData);
+
+        // Box2D 任务回调 → JobSystem
+        static void *enqueueTask(b2TaskCallback *task, int itemCount, int minRange, void *taskContext, void *userContext);
+        static void finishTask(void *userTask, void *userContext);
+
         b2WorldId m_worldId = b2_nullWorldId;
+        engine::core::JobSystem *m_jobSystem = nullptr; // 非拥有
+        int m_solverWorkerCount = 1;
         std::vector<b2BodyId> m_bodies;
+        std::vector<uint32_t> m_bodySlots;
         std::unordered_map<void *, b2BodyId> m_userDataToBody; // 用于快速查找
+        std::unordered_map<int32_t, BodyInterpolation> m_interpolation; // key = b2BodyId::index1
+
+        float m_tickRate = 60.0f;
+        float m_fixedTimeStep = 1.0f / 60.0f;
+        int m_maxStepsPerFrame = 4;
+        int m_subStepCount = 4;
+        float m_accumulator = 0.0f;
+        float m_alpha = 0.0f;
+        int m_lastStepCount = 0;
+        float m_droppedTime = 0.0f;
     };
 
 } // namespace engine::physics
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include "physics_stress.h"
+#include "physics_manager.h"
+#include "../core/job_system.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <spdlog/spdlog.h>
+
+namespace engine::physics
+{
+    namespace
+    {
+        struct StressResult
+        {
+            int workers = 0;
+            double avgMs = 0.0;
+            double p95Ms = 0.0;
+            double maxMs = 0.0;
+            int awakeBodies = 0;
+        };
+
+        StressResult runOnce(const PhysicsStressOptions &options, int workers)
+        {
+            // 调用线程占一个索引，因此后台线程数 = workers - 1
+            engine::core::JobSystem jobs(workers - 1);
+            PhysicsManager physics;
+            physics.init({0.0f, 10.0f}, workers > 1 ? &jobs : nullptr);
+            // 关闭休眠，保证测量期间所有物体都参与求解
+            b2World_EnableSleeping(physics.getWorldId(), false);
+            buildStressScene(physics, options.bodyCount);
+
+            for (int i = 0; i < options.warmupSteps; ++i)
+                physics.update(options.timeStep, options.subStepCount);
+
+            std::vector<double> samples;
+            samples.reserve(static_cast<size_t>(options.measureSteps));
+            for (int i = 0; i < options.measureSteps; ++i)
+            {
+                const auto start = std::chrono::steady_clock::now();
+                physics.update(options.timeStep, options.subStepCount);
+                samples.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+            }
+
+            StressResult result;
+            result.workers = physics.getSolverWorkerCount();
+            if (!samples.empty())
+            {
+                double sum = 0.0;
+                for (double ms : samples)
+                    sum += ms;
+                result.avgMs = sum / static_cast<double>(samples.size());
+                std::sort(samples.begin(), samples.end());
+                result.p95Ms = samples[std::min(samples.size() - 1, samples.size() * 95 / 100)];
+                result.maxMs = samples.back();
+            }
+            result.awakeBodies = b2World_GetAwakeBodyCount(physics.getWorldId());
+            return result;
+        }
+    }
+
+    // 容器：地面 + 两侧墙；动态体以网格排布在上方，落下后堆叠
+    void buildStressScene(PhysicsManager &physics, int bodyCount)
+    {
+        constexpr float kHalf = 0.25f;
+        constexpr float kSpacing = 0.55f;
+        const int columns = std::max(1, static_cast<int>(std::sqrt(static_cast<float>(bodyCount)) * 2.0f));
+        const float width = static_cast<float>(columns) * kSpacing;
+        const float groundY = 2.0f;
+
+        physics.createStaticBody({width * 0.5f, groundY}, {width * 0.5f + 1.0f, 0.5f}, nullptr);
+        physics.createStaticBody({-1.0f, groundY - 50.0f}, {0.5f, 50.0f}, nullptr);
+        physics.createStaticBody({width + 1.0f, groundY - 50.0f}, {0.5f, 50.0f}, nullptr);
+
+        for (int i = 0; i < bodyCount; ++i)
+        {
+            const int col = i % columns;
+            const int row = i / columns;
+            // 奇数行错开半格，避免整齐叠放导致接触过少
+            const float x = (static_cast<float>(col) + (row & 1 ? 0.5f : 0.0f)) * kSpacing + kSpacing * 0.5f;
+            const float y = groundY - 1.0f - static_cast<float>(row) * kSpacing;
+            physics.createDynamicBody({x, y}, {kHalf, kHalf}, nullptr);
+        }
+    }
+
+    int runPhysicsStress(const PhysicsStressOptions &options)
+    {
+        if (options.bodyCount <= 0 || options.measureSteps <= 0)
+        {
+            spdlog::error("[PhysicsStress] bodyCount / measureSteps 必须为正数");
+            return 1;
+        }
+
+        spdlog::info("[PhysicsStress] {} 动态体, 预热 {} 步, 测量 {} 步, dt={:.4f}s, 子步 {}",
+                     options.bodyCount, options.warmupSteps, options.measureSteps,
+                     options.timeStep, options.subStepCount);
+
+        double baselineMs = 0.0;
+        for (int workers : options.workerCounts)
+        {
+            workers = std::clamp(workers, 1, engine::core::JobSystem::MAX_THREADS);
+            const StressResult result = runOnce(options, workers);
+            if (baselineMs <= 0.0)
+                baselineMs = result.avgMs;
+            const double speedup = result.avgMs > 0.0 ? baselineMs / result.avgMs : 0.0;
+            spdlog::info("[PhysicsStress] workers={:2d}  avg {:7.3f} ms  p95 {:7.3f} ms  max {:7.3f} ms  x{:.2f}  (awake {})",
+                         result.workers, result.avgMs, result.p95Ms, result.maxMs, speedup, result.awakeBodies);
+        }
+        return 0;
+    }
+} // namespace engine::physics
@@ -0,0 +1,29 @@
+// physics_stress.h
+// 无窗口物理压力测试：大量动态体堆叠在封闭容器中，分别以 1/2/4/8 个求解线程测量单步耗时。
+// 启动方式：<可执行文件> --physics-stress [bodyCount] [measureSteps]
+#pragma once
+#include <vector>
+
+namespace engine::physics
+{
+    struct PhysicsStressOptions
+    {
+        int bodyCount = 4000;
+        int warmupSteps = 120;  // 先让物体落地堆叠，产生稳定的接触图
+        int measureSteps = 300;
+        float timeStep = 1.0f / 60.0f;
+        int subStepCount = 4;
+        std::vector<int> workerCounts{1, 2, 4, 8};
+    };
+
+    class PhysicsManager;
+
+    /**
+     * @brief 搭建压力测试场景：地面 + 两侧墙组成的容器，bodyCount 个动态方块以错开的网格排布在上方
+     * 与 runPhysicsStress 相同的场景，供 headless 基准复用
+     */
+    void buildStressScene(PhysicsManager &physics, int bodyCount);
+
+    // 返回进程退出码（0 = 成功）
+    int runPhysicsStress(const PhysicsStressOptions &options);
+} // namespace engine::physics
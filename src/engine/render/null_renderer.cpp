@@ -0,0 +1,94 @@
+#include "null_renderer.h"
+#include "sprite.h"
+#include "../resource/resource_manager.h"
+#include "../world/chunk.h"
+
+namespace engine::render
+{
+    void NullRenderer::clearScreen()
+    {
+        _frame_stats = RenderStats{};
+        _last_texture = 0;
+    }
+
+    void NullRenderer::present()
+    {
+        _last_frame_stats = _frame_stats;
+        ++_frame_count;
+    }
+
+    void NullRenderer::drawSprite(const Camera &, const Sprite &sprite, const glm::vec2 &,
+                                  const glm::vec2 &, double, const glm::vec4 &)
+    {
+        // 与 OpenGL 后端一致：按句柄取纹理，未就绪（ID 为 0）的精灵不计入
+        const unsigned int texture = _res_mgr ? _res_mgr->getGLTexture(sprite.getTextureHandle()) : 0;
+        if (!texture)
+            return;
+        if (texture != _last_texture)
+        {
+            if (_last_texture != 0)
+                ++_frame_stats.textureBreaks;
+            ++_frame_stats.batches;
+            ++_frame_stats.drawCalls;
+            _last_texture = texture;
+        }
+        ++_frame_stats.quads;
+    }
+
+    void NullRenderer::drawParallax(const Camera &camera, const Sprite &sprite, const glm::vec2 &position,
+                                    const glm::vec2 &, const glm::bvec2 &, const glm::vec2 &scale, double angle)
+    {
+        drawSprite(camera, sprite, position, scale, angle);
+    }
+
+    void NullRenderer::drawChunkVertices(const Camera &,
+                                         const std::unordered_map<SDL_GPUTexture *, std::vector<GPUVertex>> &verticesPerTexture,
+                                         const glm::vec2 &)
+    {
+        _frame_stats.drawCalls += static_cast<int>(verticesPerTexture.size());
+    }
+
+    void NullRenderer::drawChunkBatches(const Camera &,
+                                        const std::unordered_map<SDL_GPUTexture *, engine::world::TextureBatch> &batches,
+                                        const glm::vec2 &)
+    {
+        _frame_stats.drawCalls += static_cast<int>(batches.size());
+    }
+
+    void NullRenderer::drawChunkGL(const Camera &, unsigned int vao, unsigned int, int vertexCount,
+                                   unsigned int glTex, const glm::vec2 &)
+    {
+        if (vao == 0 || vertexCount <= 0 || glTex == 0)
+            return;
+        ++_frame_stats.drawCalls;
+        _last_texture = 0;
+    }
+
+    bool NullRenderer::buildChunkMeshGL(unsigned int &vao, unsigned int &vbo, int &vertexCount,
+                                        const std::vector<float> &vertices)
+    {
+        if (vertices.empty())
+        {
+            vertexCount = 0;
+            return true;
+        }
+        if (vao == 0)
+            vao = ++_next_object_id;
+        if (vbo == 0)
+            vbo = ++_next_object_id;
+        vertexCount = static_cast<int>(vertices.size() / 8);
+        _uploaded_bytes += vertices.size() * sizeof(float);
+        return true;
+    }
+
+    void NullRenderer::drawTexture(SDL_GPUTexture *texture, float, float, float, float)
+    {
+        if (texture)
+            ++_frame_stats.drawCalls;
+    }
+
+    void NullRenderer::drawRect(const Camera &, float, float, float, float, const glm::vec4 &)
+    {
+        ++_frame_stats.quads;
+    }
+} // namespace engine::render
@@ -0,0 +1,57 @@
+// 空渲染器
+// null_renderer.h
+//   - 不创建窗口与图形设备，所有绘制只计数；用于 headless 基准与无显示环境下的自动化运行
+//   - 精灵按 OpenGL 后端的方式取纹理 ID，纹理流送与资源查找路径保持不变
+//   - buildChunkMeshGL 分配占位 VAO / VBO 并按 8 float / 顶点记录顶点数，区块流送的集成阶段照常执行
+#pragma once
+#include "renderer.h"
+#include <cstdint>
+
+namespace engine::render
+{
+    class NullRenderer final : public Renderer
+    {
+    public:
+        NullRenderer() = default;
+
+        glm::vec2 windowToLogical(float window_x, float window_y) const override { return {window_x, window_y}; }
+
+        void drawSprite(const Camera &camera, const Sprite &sprite, const glm::vec2 &position,
+                        const glm::vec2 &scale = {1.0f, 1.0f}, double angle = 0.0f,
+                        const glm::vec4 &uv_rect = {0.0f, 0.0f, 1.0f, 1.0f}) override;
+        void clearScreen() override;
+        void present() override;
+        void setDrawColor(uint8_t, uint8_t, uint8_t, uint8_t) override {}
+        void drawParallax(const Camera &camera, const Sprite &sprite, const glm::vec2 &position,
+                          const glm::vec2 &scroll_factor, const glm::bvec2 &repeat,
+                          const glm::vec2 &scale, double angle) override;
+        void drawChunkVertices(const Camera &camera,
+                               const std::unordered_map<SDL_GPUTexture *, std::vector<GPUVertex>> &verticesPerTexture,
+                               const glm::vec2 &worldOffset) override;
+        void drawChunkBatches(const Camera &camera,
+                              const std::unordered_map<SDL_GPUTexture *, engine::world::TextureBatch> &batches,
+                              const glm::vec2 &worldOffset) override;
+        void drawChunkGL(const Camera &camera, unsigned int vao, unsigned int vbo, int vertexCount,
+                         unsigned int glTex, const glm::vec2 &worldOffset) override;
+        bool buildChunkMeshGL(unsigned int &vao, unsigned int &vbo, int &vertexCount,
+                              const std::vector<float> &vertices) override;
+        void drawTexture(SDL_GPUTexture *texture, float x, float y, float w, float h) override;
+        void drawRect(const Camera &camera, float x, float y, float w, float h, const glm::vec4 &color) override;
+        void clean() override {}
+
+        RenderStats getRenderStats() const override { return _last_frame_stats; }
+
+        /** @brief 累计上传的区块顶点字节数（buildChunkMeshGL） */
+        uint64_t getUploadedBytes() const { return _uploaded_bytes; }
+        /** @brief 已完成的帧数（present 次数） */
+        uint64_t getFrameCount() const { return _frame_count; }
+
+    private:
+        RenderStats _frame_stats;
+        RenderStats _last_frame_stats;
+        unsigned int _last_texture = 0;
+        unsigned int _next_object_id = 0;
+        uint64_t _uploaded_bytes = 0;
+        uint64_t _frame_count = 0;
+    };
+} // namespace engine::render
@@ -5,7 +5,10 @@
 #include <spdlog/spdlog.h>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <type_traits>
 #define IMGUI_IMPL_OPENGL_LOADER_CUSTOM
 #include <imgui_impl_opengl3_loader.h>
 #ifndef GL_STATIC_DRAW
@@ -17,9 +20,89 @@
 #ifndef GL_RGBA8
 #define GL_RGBA8 0x8058
 #endif
+#ifndef GL_STREAM_DRAW
+#define GL_STREAM_DRAW 0x88E0
+#endif
+#ifndef GL_ELEMENT_ARRAY_BUFFER
+#define GL_ELEMENT_ARRAY_BUFFER 0x8893
+#endif
+#ifndef GL_UNSIGNED_SHORT
+#define GL_UNSIGNED_SHORT 0x1403
+#endif
+#ifndef GL_MAP_WRITE_BIT
+#define GL_MAP_WRITE_BIT 0x0002
+#endif
+#ifndef GL_MAP_PERSISTENT_BIT
+#define GL_MAP_PERSISTENT_BIT 0x0040
+#endif
+#ifndef GL_MAP_COHERENT_BIT
+#define GL_MAP_COHERENT_BIT 0x0080
+#endif
+#ifndef GL_SYNC_GPU_COMMANDS_COMPLETE
+#define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#endif
+#ifndef GL_SYNC_FLUSH_COMMANDS_BIT
+#define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+#endif
+#ifndef GL_TIMEOUT_EXPIRED
+#define GL_TIMEOUT_EXPIRED 0x911B
+#endif
+#ifndef GL_READ_FRAMEBUFFER
+#define GL_READ_FRAMEBUFFER 0x8CA8
+#endif
+#ifndef GL_READ_FRAMEBUFFER_BINDING
+#define GL_READ_FRAMEBUFFER_BINDING 0x8CAA
+#endif
+#ifndef GL_COLOR_ATTACHMENT0
+#define GL_COLOR_ATTACHMENT0 0x8CE0
+#endif
+#ifndef GL_FRAMEBUFFER_COMPLETE
+#define GL_FRAMEBUFFER_COMPLETE 0x8CD5
+#endif
+#ifndef GL_TRIANGLE_STRIP
+#define GL_TRIANGLE_STRIP 0x0005
+#endif
+#ifndef GL_TIMESTAMP
+#define GL_TIMESTAMP 0x8E28
+#endif
+#ifndef GL_QUERY_RESULT
+#define GL_QUERY_RESULT 0x8866
+#endif
+#ifndef GL_QUERY_RESULT_AVAILABLE
+#define GL_QUERY_RESULT_AVAILABLE 0x8867
+#endif
 
 namespace engine::render
 {
+    namespace
+    {
+        GLuint compileShader(GLenum type, const char *src)
+        {
+            GLuint s = glCreateShader(type);
+            glShaderSource(s, 1, &src, nullptr);
+            glCompileShader(s);
+            GLint ok; glGetShaderiv(s, GL_COMPILE_STATUS, &ok);
+            if (!ok) {
+                char buf[512]; glGetShaderInfoLog(s, 512, nullptr, buf);
+                spdlog::error("Shader compile error: {}", buf);
+            }
+            return s;
+        }
+
+        GLuint linkProgram(const char *vert, const char *frag)
+        {
+            GLuint vs = compileShader(GL_VERTEX_SHADER, vert);
+            GLuint fs = compileShader(GL_FRAGMENT_SHADER, frag);
+            GLuint program = glCreateProgram();
+            glAttachShader(program, vs);
+            glAttachShader(program, fs);
+            glLinkProgram(program);
+            glDeleteShader(vs);
+            glDeleteShader(fs);
+            return program;
+        }
+    }
+
     OpenGLRenderer::OpenGLRenderer(SDL_Window *window) : _window(window)
     {
         SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
@@ -48,6 +131,9 @@ namespace engine::render
         glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
 
         initTileShader();
+        initSpriteBatch();
+        initParticleShader();
+        initGpuTimer();
 
         spdlog::info("OpenGL Renderer initialized");
     }
@@ -66,6 +152,9 @@ namespace engine::render
         _boundShader  = 0;
         _boundVAO     = 0;
         _boundTexture = 0;
+        glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+        beginBatchFrame();
+        beginGpuFrame();
 
         glClearColor(0.1f, 0.1f, 0.2f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT);
@@ -73,6 +162,9 @@ namespace engine::render
 
     void OpenGLRenderer::present()
     {
+        flush();
+        endBatchFrame();
+        endGpuFrame();
         SDL_GL_SwapWindow(_window);
     }
 
@@ -86,6 +178,12 @@ namespace engine::render
         if (!_tileShader || !_whiteTex || w <= 0.0f || h <= 0.0f)
             return;
 
+        if (_batchEnabled)
+        {
+            submitRect(camera.getProjectionMatrix() * camera.getViewMatrix(), x, y, w, h, color);
+            return;
+        }
+
         glm::mat4 proj = camera.getProjectionMatrix();
         glm::mat4 view = camera.getViewMatrix();
         glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(x, y, 0.0f));
@@ -99,6 +197,17 @@ namespace engine::render
         if (!_tileShader || !_whiteTex || rects.empty())
             return;
 
+        if (_batchEnabled)
+        {
+            const glm::mat4 viewProj = camera.getProjectionMatrix() * camera.getViewMatrix();
+            for (const auto &rect : rects)
+            {
+                if (rect.w > 0.0f && rect.h > 0.0f && rect.color.a > 0.0f)
+                    submitRect(viewProj, rect.x, rect.y, rect.w, rect.h, rect.color);
+            }
+            return;
+        }
+
         std::vector<float> vertices;
         vertices.reserve(rects.size() * 6 * 8);
 
@@ -157,6 +266,7 @@ namespace engine::render
         glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(vertices.size() * sizeof(float)), vertices.data());
         if (_glDrawArrays)
             _glDrawArrays(GL_TRIANGLES, 0, static_cast<int>(vertices.size() / 8));
+        ++_frameStats.drawCalls;
     }
 
     void OpenGLRenderer::drawTexture(SDL_GPUTexture*, float, float, float, float)
@@ -167,6 +277,9 @@ namespace engine::render
     {
         if (imgl3wProcs.gl.DeleteProgram)
         {
+            releaseSpriteBatch();
+            releaseParticleShader();
+            releaseGpuTimer();
             if (_tileShader) { glDeleteProgram(_tileShader); _tileShader = 0; }
             if (_quadVAO)    { glDeleteVertexArrays(1, &_quadVAO); _quadVAO = 0; }
             if (_quadVBO)    { glDeleteBuffers(1, &_quadVBO); _quadVBO = 0; }
@@ -201,25 +314,7 @@ void main() {
     FragColor = texture(uTex, vUV) * vColor * uColor;
 }
 )";
-        auto compile = [](GLenum type, const char *src) -> GLuint {
-            GLuint s = glCreateShader(type);
-            glShaderSource(s, 1, &src, nullptr);
-            glCompileShader(s);
-            GLint ok; glGetShaderiv(s, GL_COMPILE_STATUS, &ok);
-            if (!ok) {
-                char buf[512]; glGetShaderInfoLog(s, 512, nullptr, buf);
-                spdlog::error("Shader compile error: {}", buf);
-            }
-            return s;
-        };
-        GLuint vs = compile(GL_VERTEX_SHADER, vert);
-        GLuint fs = compile(GL_FRAGMENT_SHADER, frag);
-        _tileShader = glCreateProgram();
-        glAttachShader(_tileShader, vs);
-        glAttachShader(_tileShader, fs);
-        glLinkProgram(_tileShader);
-        glDeleteShader(vs);
-        glDeleteShader(fs);
+        _tileShader = linkProgram(vert, frag);
         _tileUniformMVP = glGetUniformLocation(_tileShader, "uMVP");
         _tileUniformColor = glGetUniformLocation(_tileShader, "uColor");
         glUseProgram(_tileShader);
@@ -297,6 +392,9 @@ void main() {
         if (!_tileShader || !vao || !vbo || !glTex || vertexCount == 0)
             return;
 
+        // 区块网格不进批处理；先提交已排队的精灵以保持绘制顺序
+        flush();
+
         glm::mat4 proj = camera.getProjectionMatrix();
         glm::mat4 view = camera.getViewMatrix();
         glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(worldOffset, 0.0f));
@@ -324,21 +422,191 @@ void main() {
             _boundVAO = vao;
         }
         if (_glDrawArrays) _glDrawArrays(GL_TRIANGLES, 0, (GLsizei)vertexCount);
+        ++_frameStats.drawCalls;
         // 不解绑 — 留给下一个 draw call 覆盖，省去无意义的 driver 刷新
     }
 
+    void OpenGLRenderer::initParticleShader()
+    {
+        // 每个实例是一个形状；顶点着色器把单位四边形（三角带）展开成包围盒并外扩 1 像素给抗锯齿，
+        // 片元着色器按形状的距离场算覆盖率。uShape 在一次绘制内不变，分支没有发散
+        const char *vert = R"(
+#version 330 core
+layout(location = 0) in vec4 aGeom;   // LINE: p0, p1 | ELLIPSE: 圆心, 半径 | RECT: 左上, 右下
+layout(location = 1) in float aWidth;
+layout(location = 2) in vec4 aColor;
+uniform mat4 uProj;
+uniform int uShape;
+out vec2 vLocal;
+flat out vec4 vParams;
+out vec4 vColor;
+void main() {
+    vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));
+    vec2 pos;
+    if (uShape == 0) {
+        vec2 axis = aGeom.zw - aGeom.xy;
+        float len = length(axis);
+        vec2 dir = len > 1e-4 ? axis / len : vec2(1.0, 0.0);
+        float hw = aWidth * 0.5 + 1.0;
+        vLocal = vec2(mix(-1.0, len + 1.0, corner.x), mix(-hw, hw, corner.y));
+        pos = aGeom.xy + dir * vLocal.x + vec2(-dir.y, dir.x) * vLocal.y;
+        vParams = vec4(len, aWidth * 0.5, 0.0, 0.0);
+    } else if (uShape == 1) {
+        vec2 ext = aGeom.zw + aWidth * 0.5 + 1.0;
+        vLocal = mix(-ext, ext, corner);
+        pos = aGeom.xy + vLocal;
+        vParams = vec4(aGeom.zw, aWidth, 0.0);
+    } else {
+        vec2 halfExt = abs(aGeom.zw - aGeom.xy) * 0.5;
+        vec2 ext = halfExt + 1.0;
+        vLocal = mix(-ext, ext, corner);
+        pos = (aGeom.xy + aGeom.zw) * 0.5 + vLocal;
+        vParams = vec4(halfExt, min(aWidth, min(halfExt.x, halfExt.y)), 0.0);
+    }
+    gl_Position = uProj * vec4(pos, 0.0, 1.0);
+    vColor = aColor;
+}
+)";
+        const char *frag = R"(
+#version 330 core
+in vec2 vLocal;
+flat in vec4 vParams;
+in vec4 vColor;
+uniform int uShape;
+out vec4 FragColor;
+void main() {
+    float cover;
+    if (uShape == 0) {
+        cover = clamp(vParams.y + 0.5 - abs(vLocal.y), 0.0, 1.0)
+              * clamp(min(vLocal.x, vParams.x - vLocal.x) + 0.5, 0.0, 1.0);
+    } else if (uShape == 1) {
+        vec2 r = max(vParams.xy, vec2(1e-3));
+        float k0 = length(vLocal / r);
+        float k1 = length(vLocal / (r * r));
+        float d = k1 > 0.0 ? k0 * (k0 - 1.0) / k1 : -min(r.x, r.y);
+        cover = vParams.z > 0.0 ? clamp(vParams.z * 0.5 + 0.5 - abs(d), 0.0, 1.0)
+                                : clamp(0.5 - d, 0.0, 1.0);
+    } else {
+        vec2 q = abs(vLocal) - vParams.xy + vParams.z;
+        float d = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - vParams.z;
+        cover = clamp(0.5 - d, 0.0, 1.0);
+    }
+    if (cover <= 0.0)
+        discard;
+    FragColor = vec4(vColor.rgb, vColor.a * cover);
+}
+)";
+        _glDrawArraysInstanced = reinterpret_cast<PFNGLDRAWARRAYSINSTANCEDPROC>(SDL_GL_GetProcAddress("glDrawArraysInstanced"));
+        _glVertexAttribDivisor = reinterpret_cast<PFNGLVERTEXATTRIBDIVISORPROC>(SDL_GL_GetProcAddress("glVertexAttribDivisor"));
+        if (!_glDrawArraysInstanced || !_glVertexAttribDivisor)
+        {
+            spdlog::error("OpenGLRenderer: failed to load instancing functions, particles fall back to ImGui");
+            return;
+        }
+
+        _particleShader = linkProgram(vert, frag);
+        _particleUniformProj = glGetUniformLocation(_particleShader, "uProj");
+        _particleUniformShape = glGetUniformLocation(_particleShader, "uShape");
+
+        glGenVertexArrays(1, &_particleVAO);
+        glGenBuffers(1, &_particleVBO);
+        glBindVertexArray(_particleVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, _particleVBO);
+        constexpr int stride = sizeof(ParticleInstance);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(ParticleInstance, x0));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 1, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(ParticleInstance, width));
+        glEnableVertexAttribArray(2);
+        glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, (void*)offsetof(ParticleInstance, color));
+        for (unsigned int attr = 0; attr < 3; ++attr)
+            _glVertexAttribDivisor(attr, 1);
+        glBindVertexArray(0);
+        _boundVAO = 0;
+
+        spdlog::info("OpenGLRenderer: particle shader compiled");
+    }
+
+    void OpenGLRenderer::releaseParticleShader()
+    {
+        if (_particleShader) { glDeleteProgram(_particleShader); _particleShader = 0; }
+        if (_particleVAO)    { glDeleteVertexArrays(1, &_particleVAO); _particleVAO = 0; }
+        if (_particleVBO)    { glDeleteBuffers(1, &_particleVBO); _particleVBO = 0; }
+    }
+
+    bool OpenGLRenderer::drawParticleInstances(ParticleShape shape, const ParticleInstance *instances, size_t count,
+                                               const glm::vec2 &viewSize)
+    {
+        if (!_particleShader)
+            return false;
+        if (!instances || count == 0 || viewSize.x <= 0.0f || viewSize.y <= 0.0f)
+            return true;
+
+        // 与 drawChunkGL 相同：先提交已排队的精灵以保持绘制顺序
+        flush();
+        glEnable(GL_BLEND);
+
+        if (_boundShader != _particleShader)
+        {
+            glUseProgram(_particleShader);
+            _boundShader = _particleShader;
+        }
+        const glm::mat4 proj = glm::ortho(0.0f, viewSize.x, viewSize.y, 0.0f, -1.0f, 1.0f);
+        glUniformMatrix4fv(_particleUniformProj, 1, GL_FALSE, glm::value_ptr(proj));
+        glUniform1i(_particleUniformShape, static_cast<int>(shape));
+
+        if (_boundVAO != _particleVAO)
+        {
+            glBindVertexArray(_particleVAO);
+            _boundVAO = _particleVAO;
+        }
+        // 每次绘制 orphan 一次：驱动换一块新存储，不等待上一批实例被 GPU 读完
+        glBindBuffer(GL_ARRAY_BUFFER, _particleVBO);
+        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(count * sizeof(ParticleInstance)), instances,
+                     GL_STREAM_DRAW);
+        _glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<int>(count));
+        ++_frameStats.drawCalls;
+        _frameStats.particleInstances += static_cast<int>(count);
+        return true;
+    }
+
     void OpenGLRenderer::drawSprite(const Camera &camera, const Sprite &sprite,
                                      const glm::vec2 &position, const glm::vec2 &scale,
                                      double angle, const glm::vec4 &uv_rect)
     {
         if (!_res_mgr || !_tileShader) return;
 
-        unsigned int glTex = _res_mgr->getGLTexture(sprite.getTextureId());
+        unsigned int glTex = _res_mgr->getGLTexture(sprite.getTextureHandle());
         if (!glTex) return;
 
         glm::vec2 size = sprite.getSize();
         if (size.x <= 0 || size.y <= 0) return;
 
+        if (_batchEnabled)
+        {
+            // 与逐个绘制的 model = T * S * R 相同，直接在 CPU 上算出世界坐标四角
+            const AtlasEntry &entry = atlasEntryFor(sprite.getTextureHandle(), glTex);
+            const float rad = static_cast<float>(glm::radians(angle));
+            const float c = angle != 0.0 ? std::cos(rad) : 1.0f;
+            const float s = angle != 0.0 ? std::sin(rad) : 0.0f;
+            auto corner = [&](float lx, float ly) {
+                return glm::vec2(position.x + scale.x * (c * lx - s * ly),
+                                 position.y + scale.y * (s * lx + c * ly));
+            };
+            const glm::vec2 corners[4] = {corner(0.0f, 0.0f), corner(size.x, 0.0f),
+                                          corner(0.0f, size.y), corner(size.x, size.y)};
+
+            float u0 = entry.uvRect.x + uv_rect.x * entry.uvRect.z;
+            float u1 = u0 + uv_rect.z * entry.uvRect.z;
+            const float v0 = entry.uvRect.y + uv_rect.y * entry.uvRect.w;
+            const float v1 = v0 + uv_rect.w * entry.uvRect.w;
+            if (sprite.isFlipped()) std::swap(u0, u1);
+
+            submitQuad(entry.pageTex, camera.getProjectionMatrix() * camera.getViewMatrix(), corners,
+                       {u0, v0, u1, v1}, glm::vec4(1.0f));
+            return;
+        }
+
         glm::mat4 proj = camera.getProjectionMatrix();
         glm::mat4 view = camera.getViewMatrix();
         glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(position, 0.0f));
@@ -392,6 +660,7 @@ void main() {
         ensureQuadBufferCapacity(sizeof(verts));
         glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(verts), verts);
         if (_glDrawArrays) _glDrawArrays(GL_TRIANGLES, 0, 6);
+        ++_frameStats.drawCalls;
         // 不解绑 — 留给下一个 draw call 覆盖
     }
 
@@ -410,7 +679,7 @@ void main() {
     {
         if (!_res_mgr || !_tileShader) return;
 
-        unsigned int glTex = _res_mgr->getGLTexture(sprite.getTextureId());
+        unsigned int glTex = _res_mgr->getGLTexture(sprite.getTextureHandle());
         if (!glTex) return;
 
         glm::vec2 size = sprite.getSize();
@@ -454,6 +723,28 @@ void main() {
         glm::mat4 proj = glm::ortho(0.0f, viewport.x, viewport.y, 0.0f, 0.0f, 1.0f);
         glm::vec4 uvRect{0.0f, 0.0f, 1.0f, 1.0f};
 
+        if (_batchEnabled)
+        {
+            // 屏幕空间投影在一帧内不变，整层平铺合成一批
+            const AtlasEntry &entry = atlasEntryFor(sprite.getTextureHandle(), glTex);
+            float u0 = entry.uvRect.x;
+            float u1 = entry.uvRect.x + entry.uvRect.z;
+            const float v0 = entry.uvRect.y;
+            const float v1 = entry.uvRect.y + entry.uvRect.w;
+            if (sprite.isFlipped()) std::swap(u0, u1);
+
+            for (float x = start.x; x < stop.x; x += screenSize.x)
+            {
+                for (float y = start.y; y < stop.y; y += screenSize.y)
+                {
+                    const glm::vec2 corners[4] = {{x, y}, {x + screenSize.x, y},
+                                                  {x, y + screenSize.y}, {x + screenSize.x, y + screenSize.y}};
+                    submitQuad(entry.pageTex, proj, corners, {u0, v0, u1, v1}, glm::vec4(1.0f));
+                }
+            }
+            return;
+        }
+
         for (float x = start.x; x < stop.x; x += screenSize.x)
         {
             for (float y = start.y; y < stop.y; y += screenSize.y)
@@ -465,4 +756,582 @@ void main() {
             }
         }
     }
+
+    // ── 精灵批处理 ──
+
+    void OpenGLRenderer::setSpriteBatching(bool enabled)
+    {
+        if (enabled && !_batchVAO)
+        {
+            spdlog::warn("OpenGLRenderer: 精灵批处理不可用，保持逐个绘制");
+            enabled = false;
+        }
+        if (_batchEnabled && !enabled)
+            flush();
+        _batchEnabled = enabled;
+    }
+
+    void OpenGLRenderer::initSpriteBatch()
+    {
+        auto load = [](auto &fn, const char *name) {
+            fn = reinterpret_cast<std::remove_reference_t<decltype(fn)>>(SDL_GL_GetProcAddress(name));
+        };
+        load(_glDrawElementsBaseVertex, "glDrawElementsBaseVertex");
+        load(_glBufferStorage, "glBufferStorage");
+        load(_glMapBufferRange, "glMapBufferRange");
+        load(_glUnmapBuffer, "glUnmapBuffer");
+        load(_glFenceSync, "glFenceSync");
+        load(_glClientWaitSync, "glClientWaitSync");
+        load(_glDeleteSync, "glDeleteSync");
+        load(_glGenFramebuffers, "glGenFramebuffers");
+        load(_glDeleteFramebuffers, "glDeleteFramebuffers");
+        load(_glBindFramebuffer, "glBindFramebuffer");
+        load(_glFramebufferTexture2D, "glFramebufferTexture2D");
+        load(_glCheckFramebufferStatus, "glCheckFramebufferStatus");
+        load(_glCopyTexSubImage2D, "glCopyTexSubImage2D");
+        load(_glGetTexParameteriv, "glGetTexParameteriv");
+
+        if (!_tileShader || !_glDrawElementsBaseVertex)
+        {
+            spdlog::error("OpenGLRenderer: failed to load glDrawElementsBaseVertex, sprite batching disabled");
+            return;
+        }
+
+        glGenVertexArrays(1, &_batchVAO);
+        glBindVertexArray(_batchVAO);
+
+        // 静态索引：每个四边形 (0,1,2)(1,3,2)，与逐个绘制的三角形顺序一致
+        std::vector<uint16_t> indices(static_cast<size_t>(MAX_BATCH_QUADS) * 6);
+        for (int q = 0; q < MAX_BATCH_QUADS; ++q)
+        {
+            const auto base = static_cast<uint16_t>(q * 4);
+            uint16_t *idx = indices.data() + static_cast<size_t>(q) * 6;
+            idx[0] = base;
+            idx[1] = static_cast<uint16_t>(base + 1);
+            idx[2] = static_cast<uint16_t>(base + 2);
+            idx[3] = static_cast<uint16_t>(base + 1);
+            idx[4] = static_cast<uint16_t>(base + 3);
+            idx[5] = static_cast<uint16_t>(base + 2);
+        }
+        glGenBuffers(1, &_batchIBO);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _batchIBO);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indices.size() * sizeof(uint16_t)),
+                     indices.data(), GL_STATIC_DRAW);
+
+        createStreamBuffer();
+        glBindVertexArray(0);
+        _boundVAO = 0;
+
+        // 白色像素放进图集第一页，矩形与精灵可合进同一批
+        _whiteEntry = {_whiteTex, _whiteTex, {0.0f, 0.0f, 1.0f, 1.0f}};
+        AtlasRegion region;
+        if (_atlasPacker.insert(1, 1, region) && copyIntoAtlas(_whiteTex, region))
+        {
+            const float inv = 1.0f / ATLAS_PAGE_SIZE;
+            _whiteEntry.pageTex = _atlasPages[region.page];
+            _whiteEntry.uvRect = {(region.x + 0.5f) * inv, (region.y + 0.5f) * inv, 0.0f, 0.0f};
+        }
+
+        spdlog::info("OpenGLRenderer: sprite batch ready ({} quads/frame, {})", _streamFrameQuads,
+                     _streamMapped ? "persistent mapped" : "orphaned buffer");
+    }
+
+    void OpenGLRenderer::releaseSpriteBatch()
+    {
+        _batchEnabled = false;
+        destroyStreamBuffer();
+        if (_batchIBO) { glDeleteBuffers(1, &_batchIBO); _batchIBO = 0; }
+        if (_batchVAO) { glDeleteVertexArrays(1, &_batchVAO); _batchVAO = 0; }
+        if (_copyFBO && _glDeleteFramebuffers) { _glDeleteFramebuffers(1, &_copyFBO); _copyFBO = 0; }
+        for (unsigned int page : _atlasPages)
+            glDeleteTextures(1, &page);
+        _atlasPages.clear();
+        _atlasEntries.clear();
+        _atlasPacker.clear();
+        _atlasTextureCount = 0;
+    }
+
+    void OpenGLRenderer::createStreamBuffer()
+    {
+        const size_t frameBytes = static_cast<size_t>(_streamFrameQuads) * 4 * sizeof(GPUVertex);
+
+        glBindVertexArray(_batchVAO);
+        glGenBuffers(1, &_batchVBO);
+        glBindBuffer(GL_ARRAY_BUFFER, _batchVBO);
+
+        // GL 4.4 / ARB_buffer_storage：三段持久映射，顶点直接写进驱动内存，用 fence 防止覆盖 GPU 未读完的段。
+        // macOS（GL 4.1）等不支持时退回单段缓冲：每帧 orphan 一次，批次用 glBufferSubData 追加
+        const bool canPersist = _glBufferStorage && _glMapBufferRange && _glUnmapBuffer && _glFenceSync &&
+                                _glClientWaitSync && _glDeleteSync && SDL_GL_ExtensionSupported("GL_ARB_buffer_storage");
+        if (canPersist)
+        {
+            const unsigned int flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            const auto totalBytes = static_cast<std::ptrdiff_t>(frameBytes * STREAM_FRAMES);
+            _glBufferStorage(GL_ARRAY_BUFFER, totalBytes, nullptr, flags);
+            _streamMapped = static_cast<GPUVertex *>(_glMapBufferRange(GL_ARRAY_BUFFER, 0, totalBytes, flags));
+            if (!_streamMapped)
+            {
+                // 不可变存储无法改回 glBufferData，换一个缓冲对象
+                spdlog::warn("OpenGLRenderer: persistent mapping failed, falling back to buffer orphaning");
+                glDeleteBuffers(1, &_batchVBO);
+                glGenBuffers(1, &_batchVBO);
+                glBindBuffer(GL_ARRAY_BUFFER, _batchVBO);
+            }
+        }
+        if (!_streamMapped)
+        {
+            glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(frameBytes), nullptr, GL_STREAM_DRAW);
+            _streamStaging.assign(static_cast<size_t>(_streamFrameQuads) * 4, GPUVertex{});
+        }
+
+        const auto stride = static_cast<GLsizei>(sizeof(GPUVertex));
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(GPUVertex, pos));
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(GPUVertex, color));
+        glEnableVertexAttribArray(2);
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride, (void*)offsetof(GPUVertex, uv));
+        glBindVertexArray(0);
+        _boundVAO = 0;
+    }
+
+    void OpenGLRenderer::destroyStreamBuffer()
+    {
+        for (int i = 0; i < STREAM_FRAMES; ++i)
+        {
+            if (_streamFences[i])
+            {
+                _glDeleteSync(_streamFences[i]);
+                _streamFences[i] = nullptr;
+            }
+        }
+        if (_streamMapped)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, _batchVBO);
+            _glUnmapBuffer(GL_ARRAY_BUFFER);
+            _streamMapped = nullptr;
+        }
+        if (_batchVBO) { glDeleteBuffers(1, &_batchVBO); _batchVBO = 0; }
+        _streamStaging.clear();
+        _streamStaging.shrink_to_fit();
+    }
+
+    void OpenGLRenderer::waitStreamFence(int frame)
+    {
+        void *&fence = _streamFences[frame];
+        if (!fence)
+            return;
+
+        unsigned int result = _glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+        if (result == GL_TIMEOUT_EXPIRED)
+        {
+            ++_frameStats.streamStalls;
+            do
+            {
+                result = _glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000); // 1ms
+            } while (result == GL_TIMEOUT_EXPIRED);
+        }
+        _glDeleteSync(fence);
+        fence = nullptr;
+    }
+
+    void OpenGLRenderer::beginBatchFrame()
+    {
+        _frameStats = {};
+        if (!_batchVAO)
+            return;
+
+        if (_streamGrowPending)
+        {
+            for (int i = 0; i < STREAM_FRAMES; ++i)
+                waitStreamFence(i);
+            destroyStreamBuffer();
+            _streamFrameQuads = std::min(_streamFrameQuads * 2, MAX_STREAM_QUADS);
+            createStreamBuffer();
+            _streamGrowPending = false;
+            spdlog::info("OpenGLRenderer: sprite stream buffer grown to {} quads/frame", _streamFrameQuads);
+        }
+
+        if (_streamMapped)
+        {
+            _streamFrame = (_streamFrame + 1) % STREAM_FRAMES;
+            waitStreamFence(_streamFrame);
+        }
+        else
+        {
+            _streamOrphanPending = true;
+        }
+        _frameQuadCursor = 0;
+        _batchFirstQuad = 0;
+        _batch = {};
+    }
+
+    void OpenGLRenderer::endBatchFrame()
+    {
+        if (_streamMapped && _frameQuadCursor > 0)
+            _streamFences[_streamFrame] = _glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+        _frameStats.batching = _batchEnabled;
+        _frameStats.persistentMapped = _streamMapped != nullptr;
+        _frameStats.atlasPages = static_cast<int>(_atlasPages.size());
+        _frameStats.atlasTextures = _atlasTextureCount;
+        _lastFrameStats = _frameStats;
+    }
+
+    GPUVertex *OpenGLRenderer::streamFrameBase()
+    {
+        if (_streamMapped)
+            return _streamMapped + static_cast<size_t>(_streamFrame) * _streamFrameQuads * 4;
+        return _streamStaging.data();
+    }
+
+    void OpenGLRenderer::submitQuad(unsigned int texture, const glm::mat4 &viewProj, const glm::vec2 corners[4],
+                                    const glm::vec4 &uv, const glm::vec4 &color)
+    {
+        if (_frameQuadCursor > _batchFirstQuad)
+        {
+            if (texture != _batch.texture)
+            {
+                ++_frameStats.textureBreaks;
+                flush();
+            }
+            else if (_tileShader != _batch.shader || viewProj != _batch.viewProj)
+            {
+                ++_frameStats.stateBreaks;
+                flush();
+            }
+            else if (_frameQuadCursor - _batchFirstQuad >= MAX_BATCH_QUADS)
+            {
+                flush();
+            }
+        }
+
+        if (_frameQuadCursor >= _streamFrameQuads)
+        {
+            // 本帧段写满：提交后从段首复用（持久映射需等 GPU 读完本段），下一帧起容量翻倍
+            flush();
+            if (_streamMapped)
+            {
+                _streamFences[_streamFrame] = _glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+                waitStreamFence(_streamFrame);
+            }
+            else
+            {
+                _streamOrphanPending = true;
+            }
+            _frameQuadCursor = 0;
+            _batchFirstQuad = 0;
+            _streamGrowPending = _streamFrameQuads < MAX_STREAM_QUADS;
+        }
+
+        if (_frameQuadCursor == _batchFirstQuad)
+            _batch = {texture, _tileShader, viewProj};
+
+        GPUVertex *v = streamFrameBase() + static_cast<size_t>(_frameQuadCursor) * 4;
+        v[0] = {corners[0], color, {uv.x, uv.y}};
+        v[1] = {corners[1], color, {uv.z, uv.y}};
+        v[2] = {corners[2], color, {uv.x, uv.w}};
+        v[3] = {corners[3], color, {uv.z, uv.w}};
+        ++_frameQuadCursor;
+        ++_frameStats.quads;
+    }
+
+    void OpenGLRenderer::submitRect(const glm::mat4 &viewProj, float x, float y, float w, float h, const glm::vec4 &color)
+    {
+        const glm::vec2 corners[4] = {{x, y}, {x + w, y}, {x, y + h}, {x + w, y + h}};
+        const glm::vec4 &r = _whiteEntry.uvRect;
+        submitQuad(_whiteEntry.pageTex, viewProj, corners, {r.x, r.y, r.x + r.z, r.y + r.w}, color);
+    }
+
+    void OpenGLRenderer::flush()
+    {
+        const int quads = _frameQuadCursor - _batchFirstQuad;
+        if (quads <= 0 || !_batchVAO)
+            return;
+
+        if (_boundShader != _batch.shader)
+        {
+            glUseProgram(_batch.shader);
+            _boundShader = _batch.shader;
+        }
+        glUniformMatrix4fv(_tileUniformMVP, 1, GL_FALSE, glm::value_ptr(_batch.viewProj));
+        if (_glUniform4f)
+            _glUniform4f(_tileUniformColor, 1.0f, 1.0f, 1.0f, 1.0f); // 颜色已写进顶点
+        if (_boundTexture != _batch.texture)
+        {
+            glBindTexture(GL_TEXTURE_2D, _batch.texture);
+            _boundTexture = _batch.texture;
+        }
+        if (_boundVAO != _batchVAO)
+        {
+            glBindVertexArray(_batchVAO);
+            _boundVAO = _batchVAO;
+        }
+
+        int baseVertex = _batchFirstQuad * 4;
+        if (_streamMapped)
+        {
+            baseVertex += _streamFrame * _streamFrameQuads * 4;
+        }
+        else
+        {
+            const size_t quadBytes = 4 * sizeof(GPUVertex);
+            glBindBuffer(GL_ARRAY_BUFFER, _batchVBO);
+            if (_streamOrphanPending)
+            {
+                glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(_streamFrameQuads * quadBytes), nullptr, GL_STREAM_DRAW);
+                _streamOrphanPending = false;
+            }
+            glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLintptr>(_batchFirstQuad * quadBytes),
+                            static_cast<GLsizeiptr>(quads * quadBytes), _streamStaging.data() + static_cast<size_t>(_batchFirstQuad) * 4);
+        }
+
+        _glDrawElementsBaseVertex(GL_TRIANGLES, quads * 6, GL_UNSIGNED_SHORT, nullptr, baseVertex);
+        ++_frameStats.drawCalls;
+        ++_frameStats.batches;
+        _batchFirstQuad = _frameQuadCursor;
+    }
+
+    const OpenGLRenderer::AtlasEntry &OpenGLRenderer::atlasEntryFor(engine::resource::TextureHandle texture, unsigned int glTex)
+    {
+        const uint32_t index = texture.index();
+        if (index >= _atlasEntries.size())
+            _atlasEntries.resize(index + 1);
+        AtlasEntry &cached = _atlasEntries[index];
+        if (cached.sourceTex == glTex)
+            return cached;
+
+        // 首次出现（或纹理被重新加载）：小纹理拷进图集页，大纹理 / 图集已满时直接用原纹理
+        AtlasEntry entry{glTex, glTex, {0.0f, 0.0f, 1.0f, 1.0f}};
+        const glm::vec2 size = _res_mgr ? _res_mgr->getTextureSize(texture) : glm::vec2(0.0f);
+        const int w = static_cast<int>(size.x);
+        const int h = static_cast<int>(size.y);
+        AtlasRegion region;
+        if (w > 0 && h > 0 && w <= ATLAS_MAX_SOURCE_SIZE && h <= ATLAS_MAX_SOURCE_SIZE && isNearestFiltered(glTex) &&
+            _atlasPacker.insert(w, h, region) && copyIntoAtlas(glTex, region))
+        {
+            const float inv = 1.0f / ATLAS_PAGE_SIZE;
+            entry.pageTex = _atlasPages[region.page];
+            entry.uvRect = {region.x * inv, region.y * inv, w * inv, h * inv};
+            ++_atlasTextureCount;
+        }
+        cached = entry;
+        return cached;
+    }
+
+    bool OpenGLRenderer::isNearestFiltered(unsigned int glTex)
+    {
+        if (!_glGetTexParameteriv)
+            return false;
+        GLint minFilter = 0;
+        GLint magFilter = 0;
+        glBindTexture(GL_TEXTURE_2D, glTex);
+        _glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, &minFilter);
+        _glGetTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, &magFilter);
+        _boundTexture = glTex;
+        return minFilter == GL_NEAREST && magFilter == GL_NEAREST;
+    }
+
+    bool OpenGLRenderer::copyIntoAtlas(unsigned int srcTex, const AtlasRegion &region)
+    {
+        if (!_glGenFramebuffers || !_glBindFramebuffer || !_glFramebufferTexture2D ||
+            !_glCheckFramebufferStatus || !_glCopyTexSubImage2D)
+            return false;
+
+        while (static_cast<int>(_atlasPages.size()) <= region.page)
+        {
+            unsigned int page = 0;
+            glGenTextures(1, &page);
+            glBindTexture(GL_TEXTURE_2D, page);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+            _atlasPages.push_back(page);
+            spdlog::info("OpenGLRenderer: atlas page {} created ({}x{})", _atlasPages.size(), ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE);
+        }
+
+        // 源纹理挂到读帧缓冲上，用 glCopyTexSubImage2D 在显存内拷贝，无需回读像素
+        if (!_copyFBO)
+            _glGenFramebuffers(1, &_copyFBO);
+        GLint prevRead = 0;
+        glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &prevRead);
+        _glBindFramebuffer(GL_READ_FRAMEBUFFER, _copyFBO);
+        _glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, srcTex, 0);
+
+        const bool complete = _glCheckFramebufferStatus(GL_READ_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+        if (complete)
+        {
+            glBindTexture(GL_TEXTURE_2D, _atlasPages[region.page]);
+            const int x = region.x;
+            const int y = region.y;
+            const int w = region.w;
+            const int h = region.h;
+            _glCopyTexSubImage2D(GL_TEXTURE_2D, 0, x, y, 0, 0, w, h);
+            if (_atlasPacker.getPadding() > 0)
+            {
+                // 边缘像素向 padding 外扩一圈，UV 舍入落到边界外时采到的仍是自身颜色
+                _glCopyTexSubImage2D(GL_TEXTURE_2D, 0, x - 1, y, 0, 0, 1, h);
+                _glCopyTexSubImage2D(GL_TEXTURE_2D, 0, x + w, y, w - 1, 0, 1, h);
+                _glCopyTexSubImage2D(GL_TEXTURE_2D, 0, x, y - 1, 0, 0, w, 1);
+                _glCopyTexSubImage2D(GL_TEXTURE_2D, 0, x, y + h, 0, h - 1, w, 1);
+                _glCopyTexSubImage2D(GL_TEXTURE_2D, 0, x - 1, y - 1, 0, 0, 1, 1);
+                _glCopyTexSubImage2D(GL_TEXTURE_2D, 0, x + w, y - 1, w - 1, 0, 1, 1);
+                _glCopyTexSubImage2D(GL_TEXTURE_2D, 0, x - 1, y + h, 0, h - 1, 1, 1);
+                _glCopyTexSubImage2D(GL_TEXTURE_2D, 0, x + w, y + h, w - 1, h - 1, 1, 1);
+            }
+        }
+        else
+        {
+            spdlog::warn("OpenGLRenderer: texture {} cannot be attached for atlas copy, drawn standalone", srcTex);
+        }
+
+        _glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+        _glBindFramebuffer(GL_READ_FRAMEBUFFER, static_cast<unsigned int>(prevRead));
+        _boundTexture = 0; // 绑定已被改动，下一次绘制重新绑定
+        return complete;
+    }
+
+    // ── GPU 计时 ──
+
+    void OpenGLRenderer::initGpuTimer()
+    {
+        auto load = [](auto &fn, const char *name) {
+            fn = reinterpret_cast<std::remove_reference_t<decltype(fn)>>(SDL_GL_GetProcAddress(name));
+        };
+        load(_glGenQueries, "glGenQueries");
+        load(_glDeleteQueries, "glDeleteQueries");
+        load(_glQueryCounter, "glQueryCounter");
+        load(_glGetQueryObjectiv, "glGetQueryObjectiv");
+        load(_glGetQueryObjectui64v, "glGetQueryObjectui64v");
+        if (!_glGenQueries || !_glDeleteQueries || !_glQueryCounter || !_glGetQueryObjectiv || !_glGetQueryObjectui64v)
+        {
+            spdlog::warn("OpenGLRenderer: 计时查询不可用，GPU 区段不记录");
+            _glQueryCounter = nullptr;
+            return;
+        }
+        for (GpuTimerFrame &frame : _gpuFrames)
+            _glGenQueries(MAX_GPU_ZONES * 2, frame.queries);
+        _gpuZoneStack.reserve(16);
+        _gpuResolved.reserve(MAX_GPU_ZONES);
+    }
+
+    void OpenGLRenderer::releaseGpuTimer()
+    {
+        if (!_glQueryCounter)
+            return;
+        for (GpuTimerFrame &frame : _gpuFrames)
+        {
+            _glDeleteQueries(MAX_GPU_ZONES * 2, frame.queries);
+            frame = {};
+        }
+        _glQueryCounter = nullptr;
+        _gpuFrameActive = false;
+    }
+
+    void OpenGLRenderer::beginGpuFrame()
+    {
+        if (!_glQueryCounter)
+            return;
+
+        // 复用本槽位前先取回 GPU_TIMER_FRAMES 帧前的结果
+        GpuTimerFrame &frame = _gpuFrames[_gpuFrameIndex];
+        if (frame.pending)
+            resolveGpuFrame(frame);
+
+        _gpuFrameActive = engine::core::Profiler::isEnabled();
+        if (!_gpuFrameActive)
+            return;
+        frame.zoneCount = 0;
+        frame.cpuStartNs = engine::core::Profiler::nowNs();
+        _gpuZoneStack.clear();
+        beginGpuZone("GPU Frame");
+    }
+
+    void OpenGLRenderer::endGpuFrame()
+    {
+        if (!_gpuFrameActive)
+            return;
+        // 关闭整帧区段以及未配对的区段
+        while (!_gpuZoneStack.empty())
+            endGpuZone();
+
+        GpuTimerFrame &frame = _gpuFrames[_gpuFrameIndex];
+        frame.pending = frame.zoneCount > 0;
+        _gpuFrameActive = false;
+        _gpuFrameIndex = (_gpuFrameIndex + 1) % GPU_TIMER_FRAMES;
+    }
+
+    void OpenGLRenderer::beginGpuZone(const char *name)
+    {
+        if (!_gpuFrameActive)
+            return;
+        flush();
+
+        GpuTimerFrame &frame = _gpuFrames[_gpuFrameIndex];
+        if (frame.zoneCount >= MAX_GPU_ZONES)
+        {
+            _gpuZoneStack.push_back(-1);
+            return;
+        }
+        const int index = frame.zoneCount++;
+        frame.zones[index] = {name, static_cast<uint16_t>(_gpuZoneStack.size()), false};
+        _glQueryCounter(frame.queries[index * 2], GL_TIMESTAMP);
+        _gpuZoneStack.push_back(index);
+    }
+
+    void OpenGLRenderer::endGpuZone()
+    {
+        if (!_gpuFrameActive || _gpuZoneStack.empty())
+            return;
+        flush();
+
+        const int index = _gpuZoneStack.back();
+        _gpuZoneStack.pop_back();
+        if (index < 0)
+            return;
+        GpuTimerFrame &frame = _gpuFrames[_gpuFrameIndex];
+        _glQueryCounter(frame.queries[index * 2 + 1], GL_TIMESTAMP);
+        frame.zones[index].closed = true;
+    }
+
+    void OpenGLRenderer::resolveGpuFrame(GpuTimerFrame &frame)
+    {
+        frame.pending = false;
+
+        // 整帧区段的结束查询最后发出，它可用时本帧其余查询也都已完成；GPU 落后太多时直接丢弃这一帧
+        GLint available = 0;
+        _glGetQueryObjectiv(frame.queries[1], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available)
+            return;
+
+        uint64_t frameBegin = 0;
+        _glGetQueryObjectui64v(frame.queries[0], GL_QUERY_RESULT, &frameBegin);
+        _gpuResolved.clear();
+        for (int i = 0; i < frame.zoneCount; ++i)
+        {
+            const GpuZoneRecord &zone = frame.zones[i];
+            if (!zone.closed)
+                continue;
+            uint64_t begin = 0;
+            uint64_t end = 0;
+            _glGetQueryObjectui64v(frame.queries[i * 2], GL_QUERY_RESULT, &begin);
+            _glGetQueryObjectui64v(frame.queries[i * 2 + 1], GL_QUERY_RESULT, &end);
+            begin = std::max(begin, frameBegin);
+            end = std::max(end, begin);
+            engine::core::ProfileEvent event;
+            event.name = zone.name;
+            event.startNs = frame.cpuStartNs + (begin - frameBegin);
+            event.endNs = frame.cpuStartNs + (end - frameBegin);
+            event.depth = zone.depth;
+            _gpuResolved.push_back(event);
+        }
+
+        // 轨道要求按结束时间递增
+        std::sort(_gpuResolved.begin(), _gpuResolved.end(),
+                  [](const engine::core::ProfileEvent &a, const engine::core::ProfileEvent &b) { return a.endNs < b.endNs; });
+        for (const auto &event : _gpuResolved)
+            engine::core::Profiler::submitGpuZone(event.name, event.startNs, event.endNs, event.depth);
+    }
 }
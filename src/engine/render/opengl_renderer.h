@@ -1,6 +1,12 @@
 #pragma once
+#include "../resource/resource_handle.h"
 #include "renderer.h"
+#include "texture_atlas.h"
 #include <SDL3/SDL.h>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace engine::render
 {
@@ -36,6 +42,21 @@ namespace engine::render
                          unsigned int glTex, const glm::vec2 &worldOffset) override;
         bool buildChunkMeshGL(unsigned int &vao, unsigned int &vbo, int &vertexCount,
                               const std::vector<float> &vertices) override;
+        bool drawParticleInstances(ParticleShape shape, const ParticleInstance *instances, size_t count,
+                                   const glm::vec2 &viewSize) override;
+
+        // ── 精灵批处理 ──
+        // 开启后精灵 / 矩形 / 视差平铺写入流式顶点缓冲，只在纹理页、shader 或变换切换时提交；
+        // 最近邻采样的小纹理在首次绘制时拷进图集页，不同精灵表因此可以合进同一批
+        void setSpriteBatching(bool enabled) override;
+        bool isSpriteBatching() const override { return _batchEnabled; }
+        void flush() override;
+        RenderStats getRenderStats() const override { return _lastFrameStats; }
+
+        // ── GPU 计时 ──
+        // 区段边界会先提交排队中的批次，保证批次归属正确；因此只在采集开启时增加批次数
+        void beginGpuZone(const char *name) override;
+        void endGpuZone() override;
 
     private:
         SDL_Window *_window = nullptr;
@@ -52,6 +73,13 @@ namespace engine::render
         unsigned int _whiteTex = 0;
         size_t _quadVBOCapacityBytes = 0;
 
+        // Particle shader — 单位四边形由 gl_VertexID 生成，每个粒子只上传一个实例
+        unsigned int _particleShader = 0;
+        int _particleUniformProj = -1;
+        int _particleUniformShape = -1;
+        unsigned int _particleVAO = 0;
+        unsigned int _particleVBO = 0;
+
         // GL 状态缓存 — 避免帧内重复绑定同一 shader
         unsigned int _boundShader   = 0;
         unsigned int _boundVAO      = 0;
@@ -63,9 +91,158 @@ namespace engine::render
         PFNGLDRAWARRAYSPROC _glDrawArrays = nullptr;
         PFNGLUNIFORM4FPROC _glUniform4f = nullptr;
 
+        // ── 批处理状态 ──
+        static constexpr int MAX_BATCH_QUADS = 16384;    // 单次提交上限（16 位索引，4 顶点 / 四边形）
+        static constexpr int STREAM_FRAMES = 3;           // 流式缓冲分三段轮转，CPU 写当前帧时 GPU 仍可读前两帧
+        static constexpr int MAX_STREAM_QUADS = 262144;   // 每帧段容量上限（写满时翻倍到此为止）
+        static constexpr int ATLAS_PAGE_SIZE = 2048;
+        static constexpr int ATLAS_MAX_PAGES = 8;
+        static constexpr int ATLAS_MAX_SOURCE_SIZE = 512; // 超过此尺寸的纹理（如视差背景）不进图集
+        // 图集页固定最近邻采样、无 mipmap；其他过滤方式的源纹理保持独立绑定，采样结果与逐个绘制一致
+
+        // 纹理在批处理中的实际绑定：图集页 + 页内 UV，或原纹理本身
+        struct AtlasEntry
+        {
+            unsigned int sourceTex = 0;     // 用于检测纹理被重新加载
+            unsigned int pageTex = 0;
+            glm::vec4 uvRect{0.0f, 0.0f, 1.0f, 1.0f}; // 页内 (u, v, w, h)
+        };
+
+        struct BatchState
+        {
+            unsigned int texture = 0;
+            unsigned int shader = 0;
+            glm::mat4 viewProj{1.0f};
+        };
+
+        bool _batchEnabled = false;
+        BatchState _batch;
+
+        unsigned int _batchVAO = 0;
+        unsigned int _batchVBO = 0;
+        unsigned int _batchIBO = 0;
+        int _streamFrameQuads = MAX_BATCH_QUADS;   // 每帧段容量（四边形）
+        GPUVertex *_streamMapped = nullptr;          // 持久映射基址；回退路径为 nullptr
+        std::vector<GPUVertex> _streamStaging;       // 回退路径的 CPU 暂存
+        void *_streamFences[STREAM_FRAMES] = {};
+        int _streamFrame = 0;
+        int _frameQuadCursor = 0;  // 本帧段内已写入的四边形数
+        int _batchFirstQuad = 0;   // 未提交批次的起点
+        bool _streamOrphanPending = false;
+        bool _streamGrowPending = false;
+
+        TextureAtlasPacker _atlasPacker{ATLAS_PAGE_SIZE, ATLAS_MAX_PAGES, 1};
+        std::vector<unsigned int> _atlasPages;
+        std::vector<AtlasEntry> _atlasEntries; // 按纹理句柄槽位下标寻址
+        AtlasEntry _whiteEntry;
+        unsigned int _copyFBO = 0;
+        int _atlasTextureCount = 0;
+
+        RenderStats _frameStats;
+        RenderStats _lastFrameStats;
+
+        // 批处理用到、ImGui 加载器未提供的 GL 函数（经 SDL 加载）
+        using PFNGLDRAWELEMENTSBASEVERTEXPROC = void (*)(unsigned int, int, unsigned int, const void *, int);
+        using PFNGLBUFFERSTORAGEPROC = void (*)(unsigned int, std::ptrdiff_t, const void *, unsigned int);
+        using PFNGLMAPBUFFERRANGEPROC = void *(*)(unsigned int, std::ptrdiff_t, std::ptrdiff_t, unsigned int);
+        using PFNGLUNMAPBUFFERPROC = unsigned char (*)(unsigned int);
+        using PFNGLFENCESYNCPROC = void *(*)(unsigned int, unsigned int);
+        using PFNGLCLIENTWAITSYNCPROC = unsigned int (*)(void *, unsigned int, uint64_t);
+        using PFNGLDELETESYNCPROC = void (*)(void *);
+        using PFNGLGENFRAMEBUFFERSPROC = void (*)(int, unsigned int *);
+        using PFNGLDELETEFRAMEBUFFERSPROC = void (*)(int, const unsigned int *);
+        using PFNGLBINDFRAMEBUFFERPROC = void (*)(unsigned int, unsigned int);
+        using PFNGLFRAMEBUFFERTEXTURE2DPROC = void (*)(unsigned int, unsigned int, unsigned int, unsigned int, int);
+        using PFNGLCHECKFRAMEBUFFERSTATUSPROC = unsigned int (*)(unsigned int);
+        using PFNGLCOPYTEXSUBIMAGE2DPROC = void (*)(unsigned int, int, int, int, int, int, int, int);
+        using PFNGLGETTEXPARAMETERIVPROC = void (*)(unsigned int, unsigned int, int *);
+        PFNGLDRAWELEMENTSBASEVERTEXPROC _glDrawElementsBaseVertex = nullptr;
+        PFNGLBUFFERSTORAGEPROC _glBufferStorage = nullptr;
+        PFNGLMAPBUFFERRANGEPROC _glMapBufferRange = nullptr;
+        PFNGLUNMAPBUFFERPROC _glUnmapBuffer = nullptr;
+        PFNGLFENCESYNCPROC _glFenceSync = nullptr;
+        PFNGLCLIENTWAITSYNCPROC _glClientWaitSync = nullptr;
+        PFNGLDELETESYNCPROC _glDeleteSync = nullptr;
+        PFNGLGENFRAMEBUFFERSPROC _glGenFramebuffers = nullptr;
+        PFNGLDELETEFRAMEBUFFERSPROC _glDeleteFramebuffers = nullptr;
+        PFNGLBINDFRAMEBUFFERPROC _glBindFramebuffer = nullptr;
+        PFNGLFRAMEBUFFERTEXTURE2DPROC _glFramebufferTexture2D = nullptr;
+        PFNGLCHECKFRAMEBUFFERSTATUSPROC _glCheckFramebufferStatus = nullptr;
+        PFNGLCOPYTEXSUBIMAGE2DPROC _glCopyTexSubImage2D = nullptr;
+        PFNGLGETTEXPARAMETERIVPROC _glGetTexParameteriv = nullptr;
+
+        // ── GPU 计时：GL_TIMESTAMP 查询，结果延迟 GPU_TIMER_FRAMES 帧读取，不等待 GPU ──
+        static constexpr int GPU_TIMER_FRAMES = 4;
+        static constexpr int MAX_GPU_ZONES = 64; // 每帧上限，超出的区段忽略
+
+        struct GpuZoneRecord
+        {
+            const char *name = nullptr;
+            uint16_t depth = 0;
+            bool closed = false;
+        };
+
+        struct GpuTimerFrame
+        {
+            unsigned int queries[MAX_GPU_ZONES * 2] = {}; // 每个区段一对（起、止）
+            GpuZoneRecord zones[MAX_GPU_ZONES];
+            int zoneCount = 0;
+            uint64_t cpuStartNs = 0; // 整帧区段发出时的 CPU 时间，GPU 时间戳以此对齐
+            bool pending = false;
+        };
+
+        GpuTimerFrame _gpuFrames[GPU_TIMER_FRAMES];
+        int _gpuFrameIndex = 0;
+        bool _gpuFrameActive = false;
+        std::vector<int> _gpuZoneStack; // 进行中的区段下标；-1 表示超出上限被忽略
+        std::vector<engine::core::ProfileEvent> _gpuResolved;
+
+        using PFNGLGENQUERIESPROC = void (*)(int, unsigned int *);
+        using PFNGLDELETEQUERIESPROC = void (*)(int, const unsigned int *);
+        using PFNGLQUERYCOUNTERPROC = void (*)(unsigned int, unsigned int);
+        using PFNGLGETQUERYOBJECTIVPROC = void (*)(unsigned int, unsigned int, int *);
+        using PFNGLGETQUERYOBJECTUI64VPROC = void (*)(unsigned int, unsigned int, uint64_t *);
+        PFNGLGENQUERIESPROC _glGenQueries = nullptr;
+        PFNGLDELETEQUERIESPROC _glDeleteQueries = nullptr;
+        PFNGLQUERYCOUNTERPROC _glQueryCounter = nullptr;
+        PFNGLGETQUERYOBJECTIVPROC _glGetQueryObjectiv = nullptr;
+        PFNGLGETQUERYOBJECTUI64VPROC _glGetQueryObjectui64v = nullptr;
+
+        // 实例化粒子用到的 GL 3.3 函数（ImGui 加载器未提供）
+        using PFNGLDRAWARRAYSINSTANCEDPROC = void (*)(unsigned int, int, int, int);
+        using PFNGLVERTEXATTRIBDIVISORPROC = void (*)(unsigned int, unsigned int);
+        PFNGLDRAWARRAYSINSTANCEDPROC _glDrawArraysInstanced = nullptr;
+        PFNGLVERTEXATTRIBDIVISORPROC _glVertexAttribDivisor = nullptr;
+
         void initTileShader();
+        void initParticleShader();
+        void releaseParticleShader();
         void drawQuad(unsigned int glTex, const glm::mat4 &mvp, const glm::vec4 &uvRect, float w, float h, bool flipped,
                       const glm::vec4 &color);
         void ensureQuadBufferCapacity(size_t requiredBytes);
+
+        // ── 批处理内部 ──
+        void initSpriteBatch();
+        void releaseSpriteBatch();
+        void createStreamBuffer();
+        void destroyStreamBuffer();
+        void waitStreamFence(int frame);
+        void beginBatchFrame();
+        void endBatchFrame();
+        GPUVertex *streamFrameBase();
+        // corners 依次为左上、右上、左下、右下；uv 为 (u0, v0, u1, v1)
+        void submitQuad(unsigned int texture, const glm::mat4 &viewProj, const glm::vec2 corners[4],
+                        const glm::vec4 &uv, const glm::vec4 &color);
+        void submitRect(const glm::mat4 &viewProj, float x, float y, float w, float h, const glm::vec4 &color);
+        const AtlasEntry &atlasEntryFor(engine::resource::TextureHandle texture, unsigned int glTex);
+        bool isNearestFiltered(unsigned int glTex);
+        bool copyIntoAtlas(unsigned int srcTex, const AtlasRegion &region);
+
+        // ── GPU 计时内部 ──
+        void initGpuTimer();
+        void releaseGpuTimer();
+        void beginGpuFrame();
+        void endGpuFrame();
+        void resolveGpuFrame(GpuTimerFrame &frame);
     };
 }
@@ -1,5 +1,6 @@
 #pragma once
 #include <glm/glm.hpp>
+#include <cstdint>
 
 namespace engine::render
 {
@@ -40,4 +41,24 @@ namespace engine::render
         NEAREST, // 像素风
         LINEAR   // 平滑
     };
+    /**
+     * @brief 屏幕空间粒子形状（渲染器按形状一次实例化绘制，抗锯齿边缘在片元里算）
+     */
+    enum class ParticleShape : uint8_t
+    {
+        LINE,    // 线段：p0 → p1，width 为线宽
+        ELLIPSE, // 椭圆：p0 为圆心，p1 为 (rx, ry)；width 为描边宽，0 = 实心
+        RECT     // 矩形：p0 为左上，p1 为右下；width 为圆角半径
+    };
+    /**
+     * @brief 单个粒子实例（24 字节，原样上传为实例属性）
+     * color 为 RGBA8，R 在最低字节（与 IM_COL32 相同）
+     */
+    struct ParticleInstance
+    {
+        float x0, y0;
+        float x1, y1;
+        float width;
+        uint32_t color;
+    };
 } // namespace engine::render
\ No newline at end of file
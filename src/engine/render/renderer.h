@@ -1,5 +1,6 @@
 #pragma once
 #include "render_types.h"
+#include "../core/profiler.h"
 #include <glm/glm.hpp>
 #include <SDL3/SDL.h>
 #include <cstdint>
@@ -26,6 +27,24 @@ namespace engine::render
         glm::vec4 color{1.0f};
     };
 
+    /**
+     * @brief 单帧渲染统计（上一完整帧），供性能面板显示
+     */
+    struct RenderStats
+    {
+        int drawCalls = 0;        // 本帧 draw call 总数（含区块网格等非批处理绘制）
+        int batches = 0;          // 精灵批次提交数
+        int quads = 0;            // 进入批处理的四边形数
+        int textureBreaks = 0;    // 因纹理页切换而提交的批次
+        int stateBreaks = 0;      // 因 shader / 变换切换而提交的批次
+        int streamStalls = 0;     // 流式顶点缓冲写满后等待 GPU 的次数
+        int particleInstances = 0; // 实例化粒子数（drawParticleInstances）
+        int atlasPages = 0;
+        int atlasTextures = 0;    // 已合入图集的纹理数
+        bool batching = false;
+        bool persistentMapped = false; // 顶点缓冲是否为持久映射（否则为 orphan + glBufferSubData）
+    };
+
     class Renderer
     {
     protected:
@@ -103,6 +122,15 @@ namespace engine::render
                                       const std::vector<float> &vertices) { return false; }
 
         virtual void drawTexture(SDL_GPUTexture* texture, float x, float y, float w, float h) = 0;
+        // 逻辑坐标（屏幕空间）下的三角形列表，每个纹理一次绘制；用于文字等 UI 批量绘制
+        virtual void drawScreenVertices(const std::unordered_map<SDL_GPUTexture *, std::vector<GPUVertex>> &verticesPerTexture) {}
+        /**
+         * @brief 屏幕空间实例化粒子，一次绘制一种形状
+         * 坐标范围为 [0, viewSize]，左上为原点（与 ImGui 显示坐标一致）
+         * @return false 表示后端不支持，调用方自行回退（如 ImGui DrawList）
+         */
+        virtual bool drawParticleInstances(ParticleShape shape, const ParticleInstance *instances, size_t count,
+                                           const glm::vec2 &viewSize) { return false; }
         virtual void drawRect(const Camera &camera, float x, float y, float w, float h, const glm::vec4 &color) = 0;
         virtual void drawRectBatch(const Camera &camera, const std::vector<ColoredRect> &rects)
         {
@@ -110,5 +138,41 @@ namespace engine::render
                 drawRect(camera, rect.x, rect.y, rect.w, rect.h, rect.color);
         }
         virtual void clean() = 0;
+
+        // --- 批处理 ---
+        // 不支持批处理的后端保持逐个绘制，这些接口为空实现
+        virtual void setSpriteBatching(bool enabled) {}
+        virtual bool isSpriteBatching() const { return false; }
+        // 提交尚未绘制的批次；在直接调用图形 API（如 ImGui）之前必须调用
+        virtual void flush() {}
+        virtual RenderStats getRenderStats() const { return {}; }
+
+        // --- GPU 计时 ---
+        // 仅在 Profiler 采集开启时生效；结果延迟几帧后写入 Profiler 的 "GPU" 轨道。不支持的后端为空实现
+        virtual void beginGpuZone(const char *name) {}
+        virtual void endGpuZone() {}
     };
-}
\ No newline at end of file
+
+    /**
+     * @brief 作用域 GPU 区段（名称须为字符串字面量）
+     */
+    class GpuZoneScope
+    {
+    public:
+        GpuZoneScope(Renderer &renderer, const char *name) : _renderer(renderer) { _renderer.beginGpuZone(name); }
+        ~GpuZoneScope() { _renderer.endGpuZone(); }
+
+        GpuZoneScope(const GpuZoneScope &) = delete;
+        GpuZoneScope &operator=(const GpuZoneScope &) = delete;
+
+    private:
+        Renderer &_renderer;
+    };
+}
+
+#if LSL_PROFILER
+#define LSL_PROFILE_GPU_ZONE(renderer, name) \
+    ::engine::render::GpuZoneScope LSL_PROFILE_CONCAT(lsl_profile_gpu_zone_, __LINE__)((renderer), (name))
+#else
+#define LSL_PROFILE_GPU_ZONE(renderer, name) ((void)0)
+#endif
\ No newline at end of file
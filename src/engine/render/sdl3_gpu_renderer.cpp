@@ -198,12 +198,12 @@ namespace engine::render
         if (!_active_pass || !_sprite_pipeline || !_res_mgr)
             return;
 
-        SDL_GPUTexture *gpu_tex = _res_mgr->getGPUTexture(sprite.getTextureId());
+        SDL_GPUTexture *gpu_tex = _res_mgr->getGPUTexture(sprite.getTextureHandle());
         SDL_GPUSampler *sampler = _res_mgr->getDefaultSampler();
         if (!gpu_tex || !sampler)
             return;
 
-        glm::vec2 tex_total_size = _res_mgr->getTextureSize(sprite.getTextureId());
+        glm::vec2 tex_total_size = _res_mgr->getTextureSize(sprite.getTextureHandle());
         if (tex_total_size.x <= 0.0f)
             return;
 
@@ -270,12 +270,12 @@ namespace engine::render
         if (!_active_pass || !_sprite_pipeline || !_res_mgr)
             return;
 
-        SDL_GPUTexture *gpu_tex = _res_mgr->getGPUTexture(sprite.getTextureId());
+        SDL_GPUTexture *gpu_tex = _res_mgr->getGPUTexture(sprite.getTextureHandle());
         SDL_GPUSampler *sampler = _res_mgr->getDefaultSampler();
         if (!gpu_tex || !sampler)
             return;
 
-        glm::vec2 tex_pixel_size = _res_mgr->getTextureSize(sprite.getTextureId());
+        glm::vec2 tex_pixel_size = _res_mgr->getTextureSize(sprite.getTextureHandle());
         if (tex_pixel_size.x <= 0.0f || tex_pixel_size.y <= 0.0f)
             return;
 
@@ -328,6 +328,19 @@ namespace engine::render
     }
 
     void SDL3GPURenderer::drawChunkVertices(const Camera &camera, const std::unordered_map<SDL_GPUTexture *, std::vector<GPUVertex>> &verticesPerTexture, const glm::vec2 &worldOffset)
+    {
+        glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(worldOffset.x, worldOffset.y, 0.0f));
+        drawVertexGroups(verticesPerTexture, camera.getProjectionMatrix() * camera.getViewMatrix() * model);
+    }
+
+    void SDL3GPURenderer::drawScreenVertices(const std::unordered_map<SDL_GPUTexture *, std::vector<GPUVertex>> &verticesPerTexture)
+    {
+        const glm::vec2 &logical_size = getLogicalSize();
+        drawVertexGroups(verticesPerTexture, glm::ortho(0.0f, logical_size.x, logical_size.y, 0.0f));
+    }
+
+    void SDL3GPURenderer::drawVertexGroups(const std::unordered_map<SDL_GPUTexture *, std::vector<GPUVertex>> &verticesPerTexture,
+                                           const glm::mat4 &mvp)
     {
         if (!_active_pass || !_sprite_pipeline || verticesPerTexture.empty())
             return;
@@ -378,11 +391,8 @@ namespace engine::render
             SDL_GPUBufferBinding vertexBinding{vertexBuffer, 0};
             SDL_BindGPUVertexBuffers(_active_pass, 0, &vertexBinding, 1);
 
-            // 计算 MVP 矩阵
-            glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(worldOffset.x, worldOffset.y, 0.0f));
-
             SpritePushConstants constants;
-            constants.mvp = camera.getProjectionMatrix() * camera.getViewMatrix() * model;
+            constants.mvp = mvp;
             constants.color = glm::vec4(1.0f);
             constants.uv_rect = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
 
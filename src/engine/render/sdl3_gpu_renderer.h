@@ -37,6 +37,7 @@ namespace engine::render
         void drawChunkVertices(const Camera &camera,
                                const std::unordered_map<SDL_GPUTexture *, std::vector<GPUVertex>> &verticesPerTexture,
                                const glm::vec2 &worldOffset) override;
+        void drawScreenVertices(const std::unordered_map<SDL_GPUTexture *, std::vector<GPUVertex>> &verticesPerTexture) override;
         void drawChunkBatches(const Camera &camera,
                               const std::unordered_map<SDL_GPUTexture *, engine::world::TextureBatch> &batches,
                               const glm::vec2 &worldOffset) override;
@@ -64,5 +65,8 @@ namespace engine::render
 
         void initGPU();
         void createPipeline();
+        // 每组纹理一次绘制：顶点经临时缓冲上传，mvp 对所有组相同
+        void drawVertexGroups(const std::unordered_map<SDL_GPUTexture *, std::vector<GPUVertex>> &verticesPerTexture,
+                              const glm::mat4 &mvp);
     };
 }
\ No newline at end of file
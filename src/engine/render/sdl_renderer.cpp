@@ -56,7 +56,7 @@ namespace engine::render
     {
         if (!_res_mgr)
             return;
-        auto texture = _res_mgr->getTexture(sprite.getTextureId());
+        auto texture = _res_mgr->getTexture(sprite.getTextureHandle());
         if (!texture)
             return;
 
@@ -90,7 +90,7 @@ namespace engine::render
         if (!engine::core::Context::Current)
             return;
 
-        auto texture = _res_mgr->getTexture(sprite.getTextureId());
+        auto texture = _res_mgr->getTexture(sprite.getTextureHandle());
         if (!texture)
         {
             spdlog::error("无法为ID：{}的纹理获取纹理", sprite.getTextureId());
@@ -195,7 +195,7 @@ namespace engine::render
      */
     void SDLRenderer::drawUISprite(const Sprite &sprite, const glm::vec2 &position, const std::optional<glm::vec2> &size)
     {
-        auto texture = _res_mgr->getTexture(sprite.getTextureId());
+        auto texture = _res_mgr->getTexture(sprite.getTextureHandle());
         if (!texture)
             return;
 
@@ -338,7 +338,7 @@ namespace engine::render
         if (!_res_mgr)
             return std::nullopt;
 
-        SDL_Texture *texture = _res_mgr->getTexture(sprite.getTextureId());
+        SDL_Texture *texture = _res_mgr->getTexture(sprite.getTextureHandle());
         if (!texture)
         {
             spdlog::error("无法为ID：{}的纹理获取纹理", sprite.getTextureId());
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../resource/resource_handle.h"
 #include "../utils/math.h"
 #include <string>
 #include <optional>
@@ -9,6 +10,8 @@ namespace engine::render
     {
     private:
         std::string _texture_id;
+        // 纹理句柄：设置路径时驻留一次，绘制时按句柄查询，不再哈希路径
+        engine::resource::TextureHandle _texture_handle;
         // 需要截取的纹理区域
         std::optional<engine::utils::FRect> _source_rect;
         // 全图大小
@@ -25,6 +28,7 @@ namespace engine::render
          */
         Sprite(const std::string &texture_id, const std::optional<engine::utils::FRect> &source_rect = std::nullopt, bool is_flipped = false)
             : _texture_id(texture_id),
+              _texture_handle(engine::resource::TextureRegistry::shared().acquire(texture_id)),
               _source_rect(source_rect),
               _is_flipped(is_flipped),
               _size(0, 0)
@@ -33,6 +37,7 @@ namespace engine::render
 
         // GETTER
         const std::string &getTextureId() const { return _texture_id; }
+        engine::resource::TextureHandle getTextureHandle() const { return _texture_handle; }
         const std::optional<engine::utils::FRect> &getSourceRect() const { return _source_rect; }
         glm::vec2 getSize() const
         {
@@ -42,7 +47,17 @@ namespace engine::render
         };
         bool isFlipped() const { return _is_flipped; }
         // SETTER
-        void setTextureId(const std::string &texture_id) { _texture_id = texture_id; }
+        void setTextureId(const std::string &texture_id)
+        {
+            _texture_id = texture_id;
+            _texture_handle = engine::resource::TextureRegistry::shared().acquire(texture_id);
+        }
+        // 已持有句柄时直接切换（路径从驻留表取回，不再哈希）
+        void setTexture(engine::resource::TextureHandle handle)
+        {
+            _texture_id = engine::resource::TextureRegistry::shared().path(handle);
+            _texture_handle = handle;
+        }
         void setSourceRect(const std::optional<engine::utils::FRect> &source_rect) { _source_rect = source_rect; }
         void setFlipped(bool is_flipped) { _is_flipped = is_flipped; }
         void setSize(const glm::vec2 &size)
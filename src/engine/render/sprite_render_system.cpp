@@ -21,6 +21,7 @@ namespace engine::render
      * @note 该方法会跳过隐藏的精灵组件和没有变换组件的精灵
      * @note 渲染时考虑了精灵的偏移、缩放和旋转变换
      * @note 通过抽象渲染接口实现跨平台渲染（SDL/Vulkan等）
+     * @note OpenGL 后端开启精灵批处理时 draw() 只写入顶点，draw call 在纹理页 / 状态切换或帧末统一提交
      */
     void SpriteRenderSystem::renderAll(engine::core::Context &ctx)
     {
@@ -1,8 +1,71 @@
 #include "text_renderer.h"
 #include <spdlog/spdlog.h>
+#include <cstring>
+#include <functional>
 
 namespace engine::render
 {
+    // ── ShapedRunCache ──
+
+    ShapedRun* ShapedRunCache::find(uint64_t fontId, unsigned int fontSize, const std::string& text)
+    {
+        const Key key{fontId, fontSize, std::hash<std::string>{}(text)};
+        auto it = m_index.find(key);
+        if (it == m_index.end() || it->second->run.text != text)
+        {
+            ++m_misses;
+            return nullptr;
+        }
+        m_lru.splice(m_lru.begin(), m_lru, it->second);
+        ++m_hits;
+        return &it->second->run;
+    }
+
+    ShapedRun& ShapedRunCache::insert(uint64_t fontId, unsigned int fontSize, ShapedRun run)
+    {
+        const Key key{fontId, fontSize, std::hash<std::string>{}(run.text)};
+        if (auto it = m_index.find(key); it != m_index.end())
+        {
+            // 哈希冲突或重复插入：覆盖旧条目
+            it->second->run = std::move(run);
+            m_lru.splice(m_lru.begin(), m_lru, it->second);
+            return it->second->run;
+        }
+
+        if (m_lru.size() >= m_capacity)
+        {
+            m_index.erase(m_lru.back().key);
+            m_lru.pop_back();
+        }
+        m_lru.push_front({key, std::move(run)});
+        m_index[key] = m_lru.begin();
+        return m_lru.front().run;
+    }
+
+    void ShapedRunCache::eraseFont(uint64_t fontId)
+    {
+        for (auto it = m_lru.begin(); it != m_lru.end();)
+        {
+            if (it->key.fontId == fontId)
+            {
+                m_index.erase(it->key);
+                it = m_lru.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    void ShapedRunCache::clear()
+    {
+        m_index.clear();
+        m_lru.clear();
+    }
+
+    // ── TextRenderer ──
+
     TextRenderer::TextRenderer()
     {
     }
@@ -12,9 +75,21 @@ namespace engine::render
         cleanup();
     }
 
-    bool TextRenderer::init(SDL_GPUDevice* device, const std::string& fontPath, unsigned int fontSize)
+    bool TextRenderer::init(SDL_GPUDevice* device, const std::string& fontPath, unsigned int fontSize,
+                            ShapedRunCache* runCache)
     {
         m_device = device;
+        m_fontId = std::hash<std::string>{}(fontPath);
+        m_fontSize = fontSize;
+        if (runCache)
+        {
+            m_runCache = runCache;
+        }
+        else
+        {
+            m_ownedRunCache = std::make_unique<ShapedRunCache>();
+            m_runCache = m_ownedRunCache.get();
+        }
 
         if (FT_Init_FreeType(&m_ftLibrary))
         {
@@ -55,6 +130,42 @@ namespace engine::render
         m_sampler = SDL_CreateGPUSampler(m_device, &samplerInfo);
     }
 
+    SDL_GPUTexture* TextRenderer::atlasPage(int page)
+    {
+        while (static_cast<int>(m_atlasPages.size()) <= page)
+        {
+            SDL_GPUTextureCreateInfo texInfo = {};
+            texInfo.type = SDL_GPU_TEXTURETYPE_2D;
+            texInfo.format = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
+            texInfo.width = ATLAS_PAGE_SIZE;
+            texInfo.height = ATLAS_PAGE_SIZE;
+            texInfo.layer_count_or_depth = 1;
+            texInfo.num_levels = 1;
+            texInfo.usage = SDL_GPU_TEXTUREUSAGE_SAMPLER;
+
+            SDL_GPUTexture* texture = SDL_CreateGPUTexture(m_device, &texInfo);
+            if (!texture)
+            {
+                spdlog::error("TextRenderer: 无法创建字形图集页: {}", SDL_GetError());
+                return nullptr;
+            }
+            m_atlasPages.push_back(texture);
+        }
+        return m_atlasPages[page];
+    }
+
+    void TextRenderer::resetAtlas()
+    {
+        // 图集写满：丢弃全部字形重新装箱（页纹理复用），已缓存的整形结果按 generation 重新解析
+        spdlog::info("TextRenderer: 字形图集已满（{} 个字形），重建", m_glyphs.size());
+        m_atlasPacker.clear();
+        m_glyphs.clear();
+        m_pendingUploads.clear();
+        m_pendingPixels.clear();
+        ++m_atlasGeneration;
+        ++m_atlasResets;
+    }
+
     bool TextRenderer::loadGlyph(uint32_t glyphIndex)
     {
         if (m_glyphs.find(glyphIndex) != m_glyphs.end())
@@ -68,81 +179,127 @@ namespace engine::render
 
         FT_GlyphSlot g = m_ftFace->glyph;
 
-        SDL_GPUTexture* texture = nullptr;
+        Glyph glyph;
+        glyph.size = {g->bitmap.width, g->bitmap.rows};
+        glyph.bearing = {g->bitmap_left, g->bitmap_top};
+        glyph.advance = g->advance.x >> 6;
 
-        if (g->bitmap.width > 0 && g->bitmap.rows > 0)
+        const int w = static_cast<int>(g->bitmap.width);
+        const int h = static_cast<int>(g->bitmap.rows);
+        if (w > 0 && h > 0 && g->bitmap.buffer)
         {
-            SDL_GPUTextureCreateInfo texInfo = {};
-            texInfo.type = SDL_GPU_TEXTURETYPE_2D;
-            texInfo.format = SDL_GPU_TEXTUREFORMAT_R8_UNORM;
-            texInfo.width = g->bitmap.width;
-            texInfo.height = g->bitmap.rows;
-            texInfo.layer_count_or_depth = 1;
-            texInfo.num_levels = 1;
-            texInfo.usage = SDL_GPU_TEXTUREUSAGE_SAMPLER;
+            AtlasRegion region;
+            if (!m_atlasPacker.insert(w, h, region))
+            {
+                resetAtlas();
+                if (!m_atlasPacker.insert(w, h, region))
+                {
+                    spdlog::warn("TextRenderer: 字形 {} ({}x{}) 超出图集页尺寸", glyphIndex, w, h);
+                    m_glyphs[glyphIndex] = glyph;
+                    return true;
+                }
+            }
 
-            texture = SDL_CreateGPUTexture(m_device, &texInfo);
-            if (!texture)
+            SDL_GPUTexture* page = atlasPage(region.page);
+            if (!page)
                 return false;
 
-            if (g->bitmap.buffer)
+            // 连同 1 像素透明边框一起上传，线性采样不会混入相邻字形
+            PendingUpload upload;
+            upload.page = page;
+            upload.x = region.x - 1;
+            upload.y = region.y - 1;
+            upload.w = w + 2;
+            upload.h = h + 2;
+            upload.offset = m_pendingPixels.size();
+            m_pendingPixels.resize(upload.offset + static_cast<size_t>(upload.w) * upload.h * 4, 0);
+
+            const bool mono = g->bitmap.pixel_mode == FT_PIXEL_MODE_MONO;
+            for (int row = 0; row < h; ++row)
             {
-                SDL_GPUTransferBufferCreateInfo transferInfo = {};
-                transferInfo.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
-                transferInfo.size = g->bitmap.width * g->bitmap.rows;
-
-                SDL_GPUTransferBuffer* transferBuffer = SDL_CreateGPUTransferBuffer(m_device, &transferInfo);
-                if (transferBuffer)
+                const unsigned char* src = g->bitmap.buffer + static_cast<ptrdiff_t>(row) * g->bitmap.pitch;
+                uint8_t* dst = m_pendingPixels.data() + upload.offset + ((static_cast<size_t>(row) + 1) * upload.w + 1) * 4;
+                for (int col = 0; col < w; ++col, dst += 4)
                 {
-                    void* data = SDL_MapGPUTransferBuffer(m_device, transferBuffer, false);
-                    if (data)
-                    {
-                        memcpy(data, g->bitmap.buffer, g->bitmap.width * g->bitmap.rows);
-                        SDL_UnmapGPUTransferBuffer(m_device, transferBuffer);
-
-                        SDL_GPUCommandBuffer* uploadCmd = SDL_AcquireGPUCommandBuffer(m_device);
-                        SDL_GPUCopyPass* copyPass = SDL_BeginGPUCopyPass(uploadCmd);
-
-                        SDL_GPUTextureTransferInfo texTransferInfo = {};
-                        texTransferInfo.transfer_buffer = transferBuffer;
-                        texTransferInfo.offset = 0;
-
-                        SDL_GPUTextureRegion region = {};
-                        region.texture = texture;
-                        region.w = g->bitmap.width;
-                        region.h = g->bitmap.rows;
-                        region.d = 1;
-
-                        SDL_UploadToGPUTexture(copyPass, &texTransferInfo, &region, false);
-
-                        SDL_EndGPUCopyPass(copyPass);
-                        SDL_SubmitGPUCommandBuffer(uploadCmd);
-                        SDL_WaitForGPUIdle(m_device);
-                        SDL_ReleaseGPUTransferBuffer(m_device, transferBuffer);
-                    }
+                    const uint8_t coverage = mono ? ((src[col >> 3] >> (7 - (col & 7))) & 1 ? 255 : 0) : src[col];
+                    dst[0] = 255;
+                    dst[1] = 255;
+                    dst[2] = 255;
+                    dst[3] = coverage;
                 }
             }
-        }
+            m_pendingUploads.push_back(upload);
 
-        Glyph glyph;
-        glyph.texture = texture;
-        glyph.size = {g->bitmap.width, g->bitmap.rows};
-        glyph.bearing = {g->bitmap_left, g->bitmap_top};
-        glyph.advance = g->advance.x >> 6;
+            const float inv = 1.0f / ATLAS_PAGE_SIZE;
+            glyph.texture = page;
+            glyph.uvRect = {region.x * inv, region.y * inv, w * inv, h * inv};
+        }
 
         m_glyphs[glyphIndex] = glyph;
         return true;
     }
 
-    std::vector<GlyphRenderInfo> TextRenderer::prepareText(const std::string& text, float x, float y)
+    void TextRenderer::flushUploads()
     {
-        std::vector<GlyphRenderInfo> result;
+        if (m_pendingUploads.empty() || !m_device)
+            return;
+
+        SDL_GPUTransferBufferCreateInfo transferInfo = {};
+        transferInfo.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+        transferInfo.size = static_cast<Uint32>(m_pendingPixels.size());
+        SDL_GPUTransferBuffer* transferBuffer = SDL_CreateGPUTransferBuffer(m_device, &transferInfo);
+        if (!transferBuffer)
+        {
+            spdlog::error("TextRenderer: 无法创建字形传输缓冲: {}", SDL_GetError());
+            return;
+        }
+
+        void* data = SDL_MapGPUTransferBuffer(m_device, transferBuffer, false);
+        if (!data)
+        {
+            SDL_ReleaseGPUTransferBuffer(m_device, transferBuffer);
+            return;
+        }
+        std::memcpy(data, m_pendingPixels.data(), m_pendingPixels.size());
+        SDL_UnmapGPUTransferBuffer(m_device, transferBuffer);
+
+        // 本批所有字形共用一个命令缓冲；之后提交的帧命令缓冲按提交顺序在其后执行，无需等待 GPU 空闲
+        SDL_GPUCommandBuffer* uploadCmd = SDL_AcquireGPUCommandBuffer(m_device);
+        SDL_GPUCopyPass* copyPass = SDL_BeginGPUCopyPass(uploadCmd);
+        for (const auto& upload : m_pendingUploads)
+        {
+            SDL_GPUTextureTransferInfo texTransferInfo = {};
+            texTransferInfo.transfer_buffer = transferBuffer;
+            texTransferInfo.offset = static_cast<Uint32>(upload.offset);
+            texTransferInfo.pixels_per_row = static_cast<Uint32>(upload.w);
+            texTransferInfo.rows_per_layer = static_cast<Uint32>(upload.h);
+
+            SDL_GPUTextureRegion region = {};
+            region.texture = upload.page;
+            region.x = static_cast<Uint32>(upload.x);
+            region.y = static_cast<Uint32>(upload.y);
+            region.w = static_cast<Uint32>(upload.w);
+            region.h = static_cast<Uint32>(upload.h);
+            region.d = 1;
+
+            SDL_UploadToGPUTexture(copyPass, &texTransferInfo, &region, false);
+        }
+        SDL_EndGPUCopyPass(copyPass);
+        SDL_SubmitGPUCommandBuffer(uploadCmd);
+        // SDL 会在 GPU 用完后才真正释放
+        SDL_ReleaseGPUTransferBuffer(m_device, transferBuffer);
+
+        m_pendingUploads.clear();
+        m_pendingPixels.clear();
+        ++m_uploadBatches;
+    }
 
+    void TextRenderer::shapeInto(const std::string& text, ShapedRun& run)
+    {
         hb_buffer_clear_contents(m_hbBuffer);
         hb_buffer_add_utf8(m_hbBuffer, text.c_str(), -1, 0, -1);
-        hb_buffer_set_direction(m_hbBuffer, HB_DIRECTION_LTR);
-        hb_buffer_set_script(m_hbBuffer, HB_SCRIPT_LATIN);
-        hb_buffer_set_language(m_hbBuffer, hb_language_from_string("en", -1));
+        // 按内容推断文字方向 / 书写系统 / 语言，中日韩文本不再按拉丁文整形
+        hb_buffer_guess_segment_properties(m_hbBuffer);
 
         hb_shape(m_hbFont, m_hbBuffer, nullptr, 0);
 
@@ -150,47 +307,129 @@ namespace engine::render
         hb_glyph_info_t* glyphInfo = hb_buffer_get_glyph_infos(m_hbBuffer, &glyphCount);
         hb_glyph_position_t* glyphPos = hb_buffer_get_glyph_positions(m_hbBuffer, &glyphCount);
 
-        float penX = x;
-        float penY = y;
+        run.text = text;
+        run.glyphs.clear();
+        run.glyphs.reserve(glyphCount);
+        run.quads.clear();
+        run.atlasGeneration = 0;
 
+        float penX = 0.0f;
+        float penY = 0.0f;
         for (unsigned int i = 0; i < glyphCount; i++)
         {
-            uint32_t codepoint = glyphInfo[i].codepoint;
-            loadGlyph(codepoint);
+            run.glyphs.push_back({glyphInfo[i].codepoint,
+                                  penX + glyphPos[i].x_offset / 64.0f,
+                                  penY + glyphPos[i].y_offset / 64.0f});
+            penX += glyphPos[i].x_advance / 64.0f;
+            penY += glyphPos[i].y_advance / 64.0f;
+        }
+    }
 
-            auto it = m_glyphs.find(codepoint);
-            if (it == m_glyphs.end())
-                continue;
+    void TextRenderer::resolveRun(ShapedRun& run)
+    {
+        if (run.atlasGeneration == m_atlasGeneration)
+            return;
 
-            Glyph& glyph = it->second;
-            if (!glyph.texture || glyph.size.x == 0 || glyph.size.y == 0)
+        // 解析途中图集若被重建，前面解析的字形已失效，整段重来一次
+        for (int attempt = 0; attempt < 2; ++attempt)
+        {
+            const uint32_t generation = m_atlasGeneration;
+            run.quads.clear();
+            for (const auto& shaped : run.glyphs)
             {
-                penX += glyphPos[i].x_advance / 64.0f;
-                continue;
+                if (!loadGlyph(shaped.glyphIndex))
+                    continue;
+                const Glyph& glyph = m_glyphs[shaped.glyphIndex];
+                if (!glyph.texture)
+                    continue;
+
+                run.quads.push_back({glyph.texture,
+                                     shaped.x + glyph.bearing.x,
+                                     shaped.y - glyph.bearing.y,
+                                     static_cast<float>(glyph.size.x),
+                                     static_cast<float>(glyph.size.y),
+                                     {glyph.uvRect.x, glyph.uvRect.y,
+                                      glyph.uvRect.x + glyph.uvRect.z, glyph.uvRect.y + glyph.uvRect.w}});
             }
+            if (generation == m_atlasGeneration)
+                break;
+        }
+        run.atlasGeneration = m_atlasGeneration;
+        flushUploads();
+    }
 
-            float xpos = penX + glyph.bearing.x + (glyphPos[i].x_offset / 64.0f);
-            float ypos = penY - glyph.bearing.y + (glyphPos[i].y_offset / 64.0f);
+    const ShapedRun& TextRenderer::shapeText(const std::string& text)
+    {
+        ShapedRun* run = m_runCache->find(m_fontId, m_fontSize, text);
+        if (!run)
+        {
+            ShapedRun shaped;
+            shapeInto(text, shaped);
+            run = &m_runCache->insert(m_fontId, m_fontSize, std::move(shaped));
+        }
+        resolveRun(*run);
+        return *run;
+    }
 
-            result.push_back({glyph.texture, xpos, ypos,
-                            static_cast<float>(glyph.size.x),
-                            static_cast<float>(glyph.size.y)});
+    const std::vector<GlyphRenderInfo>& TextRenderer::prepareText(const std::string& text, float x, float y)
+    {
+        m_prepared.clear();
+        for (const auto& quad : shapeText(text).quads)
+            m_prepared.push_back({quad.texture, x + quad.x, y + quad.y, quad.w, quad.h, quad.uv});
+        return m_prepared;
+    }
 
-            penX += glyphPos[i].x_advance / 64.0f;
-            penY += glyphPos[i].y_advance / 64.0f;
+    void TextRenderer::appendText(const std::string& text, float x, float y, const glm::vec4& color, TextVertexBatch& batch)
+    {
+        SDL_GPUTexture* lastPage = nullptr;
+        std::vector<GPUVertex>* vertices = nullptr;
+        for (const auto& quad : shapeText(text).quads)
+        {
+            if (quad.texture != lastPage)
+            {
+                lastPage = quad.texture;
+                vertices = &batch[quad.texture];
+            }
+            const float x0 = x + quad.x;
+            const float y0 = y + quad.y;
+            const float x1 = x0 + quad.w;
+            const float y1 = y0 + quad.h;
+            const GPUVertex tl{{x0, y0}, color, {quad.uv.x, quad.uv.y}};
+            const GPUVertex tr{{x1, y0}, color, {quad.uv.z, quad.uv.y}};
+            const GPUVertex bl{{x0, y1}, color, {quad.uv.x, quad.uv.w}};
+            const GPUVertex br{{x1, y1}, color, {quad.uv.z, quad.uv.w}};
+            vertices->insert(vertices->end(), {tl, tr, bl, tr, br, bl});
         }
+    }
 
-        return result;
+    TextStats TextRenderer::getStats() const
+    {
+        TextStats stats;
+        stats.glyphs = m_glyphs.size();
+        stats.atlasPages = static_cast<int>(m_atlasPages.size());
+        stats.uploadBatches = m_uploadBatches;
+        stats.atlasResets = m_atlasResets;
+        return stats;
     }
 
     void TextRenderer::cleanup()
     {
-        for (auto& pair : m_glyphs)
+        m_glyphs.clear();
+        m_pendingUploads.clear();
+        m_pendingPixels.clear();
+        m_atlasPacker.clear();
+        for (SDL_GPUTexture* page : m_atlasPages)
+            SDL_ReleaseGPUTexture(m_device, page);
+        m_atlasPages.clear();
+        ++m_atlasGeneration;
+
+        // 共享缓存里本字体的四边形指向已释放的图集页
+        if (m_runCache)
         {
-            if (pair.second.texture)
-                SDL_ReleaseGPUTexture(m_device, pair.second.texture);
+            m_runCache->eraseFont(m_fontId);
+            m_runCache = nullptr;
         }
-        m_glyphs.clear();
+        m_ownedRunCache.reset();
 
         if (m_vertexBuffer)
         {
@@ -1,10 +1,15 @@
 #pragma once
+#include "render_types.h"
+#include "texture_atlas.h"
 #include <ft2build.h>
 #include FT_FREETYPE_H
 #include <hb.h>
 #include <hb-ft.h>
 #include <SDL3/SDL.h>
 #include <glm/glm.hpp>
+#include <cstdint>
+#include <list>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -13,7 +18,8 @@ namespace engine::render
 {
     struct Glyph
     {
-        SDL_GPUTexture* texture = nullptr;
+        SDL_GPUTexture* texture = nullptr; // 所在图集页；空白字形（空格等）为 nullptr
+        glm::vec4 uvRect{0.0f};            // 页内 (u, v, w, h)
         glm::ivec2 size;
         glm::ivec2 bearing;
         unsigned int advance;
@@ -23,6 +29,89 @@ namespace engine::render
     {
         SDL_GPUTexture* texture;
         float x, y, w, h;
+        glm::vec4 uv; // (u0, v0, u1, v1)
+    };
+
+    // 按图集页分组的屏幕空间三角形，直接交给 Renderer::drawScreenVertices
+    using TextVertexBatch = std::unordered_map<SDL_GPUTexture*, std::vector<GPUVertex>>;
+
+    // 整形结果中的一个字形（相对文本原点，像素）
+    struct ShapedGlyph
+    {
+        uint32_t glyphIndex = 0;
+        float x = 0.0f;
+        float y = 0.0f;
+    };
+
+    struct ShapedRun
+    {
+        std::string text;
+        std::vector<ShapedGlyph> glyphs;
+        // 按图集解析后的四边形（相对原点）；图集重建后按 atlasGeneration 重新解析
+        std::vector<GlyphRenderInfo> quads;
+        uint32_t atlasGeneration = 0;
+    };
+
+    /**
+     * @brief 已整形文本的 LRU 缓存，键为 (字体, 字号, 字符串哈希)
+     * FontManager 下的所有 TextRenderer 共用一份；哈希相同但文本不同视为未命中
+     */
+    class ShapedRunCache
+    {
+    public:
+        explicit ShapedRunCache(size_t capacity = 1024) : m_capacity(capacity > 0 ? capacity : 1) {}
+
+        // 命中时移到最近使用端；返回的指针在下一次 insert 前有效
+        ShapedRun* find(uint64_t fontId, unsigned int fontSize, const std::string& text);
+        ShapedRun& insert(uint64_t fontId, unsigned int fontSize, ShapedRun run);
+        void eraseFont(uint64_t fontId);
+        void clear();
+
+        size_t size() const { return m_lru.size(); }
+        uint64_t getHits() const { return m_hits; }
+        uint64_t getMisses() const { return m_misses; }
+
+    private:
+        struct Key
+        {
+            uint64_t fontId = 0;
+            unsigned int fontSize = 0;
+            uint64_t textHash = 0;
+            bool operator==(const Key& other) const
+            {
+                return fontId == other.fontId && fontSize == other.fontSize && textHash == other.textHash;
+            }
+        };
+
+        struct KeyHash
+        {
+            size_t operator()(const Key& key) const
+            {
+                uint64_t h = key.textHash ^ (key.fontId * 0x9E3779B97F4A7C15ull);
+                h ^= static_cast<uint64_t>(key.fontSize) << 32;
+                return static_cast<size_t>(h ^ (h >> 29));
+            }
+        };
+
+        struct Entry
+        {
+            Key key;
+            ShapedRun run;
+        };
+
+        size_t m_capacity;
+        std::list<Entry> m_lru; // 头部为最近使用
+        std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> m_index;
+        uint64_t m_hits = 0;
+        uint64_t m_misses = 0;
+    };
+
+    struct TextStats
+    {
+        size_t glyphs = 0;        // 已光栅化的字形数
+        int atlasPages = 0;
+        uint64_t uploadBatches = 0; // 提交的上传批次（每批一个拷贝通道）
+        uint64_t atlasResets = 0;
     };
 
     class TextRenderer
@@ -31,11 +120,36 @@ namespace engine::render
         TextRenderer();
         ~TextRenderer();
 
-        bool init(SDL_GPUDevice* device, const std::string& fontPath, unsigned int fontSize);
-        std::vector<GlyphRenderInfo> prepareText(const std::string& text, float x, float y);
+        // runCache 为空时使用私有缓存
+        bool init(SDL_GPUDevice* device, const std::string& fontPath, unsigned int fontSize,
+                  ShapedRunCache* runCache = nullptr);
+
+        // 整形（缓存命中时不重新整形）并解析到图集；返回的引用在下一次 shapeText 前有效
+        const ShapedRun& shapeText(const std::string& text);
+        // 以 (x, y) 为原点的字形四边形；返回的数组在下一次 prepareText 前有效
+        const std::vector<GlyphRenderInfo>& prepareText(const std::string& text, float x, float y);
+        // 追加到按页分组的顶点表，一屏文字通常只落在一页上 → 一次绑定一次绘制
+        void appendText(const std::string& text, float x, float y, const glm::vec4& color, TextVertexBatch& batch);
+        // 提交新光栅化的字形：一个传输缓冲 + 一个拷贝通道，不等待 GPU 空闲
+        void flushUploads();
+
+        TextStats getStats() const;
         void cleanup();
 
     private:
+        static constexpr int ATLAS_PAGE_SIZE = 1024;
+        static constexpr int ATLAS_MAX_PAGES = 4;
+
+        struct PendingUpload
+        {
+            SDL_GPUTexture* page = nullptr;
+            int x = 0; // 含 1 像素透明边框的区域
+            int y = 0;
+            int w = 0;
+            int h = 0;
+            size_t offset = 0; // m_pendingPixels 中的字节偏移
+        };
+
         FT_Library m_ftLibrary = nullptr;
         FT_Face m_ftFace = nullptr;
         hb_font_t* m_hbFont = nullptr;
@@ -44,9 +158,29 @@ namespace engine::render
         SDL_GPUBuffer* m_vertexBuffer = nullptr;
         SDL_GPUSampler* m_sampler = nullptr;
 
+        uint64_t m_fontId = 0;
+        unsigned int m_fontSize = 0;
+        ShapedRunCache* m_runCache = nullptr;
+        std::unique_ptr<ShapedRunCache> m_ownedRunCache;
+
         std::unordered_map<uint32_t, Glyph> m_glyphs;
 
-        bool loadGlyph(uint32_t codepoint);
+        // ── 字形图集 ──
+        TextureAtlasPacker m_atlasPacker{ATLAS_PAGE_SIZE, ATLAS_MAX_PAGES, 1};
+        std::vector<SDL_GPUTexture*> m_atlasPages;
+        uint32_t m_atlasGeneration = 1;
+        std::vector<PendingUpload> m_pendingUploads;
+        std::vector<uint8_t> m_pendingPixels; // RGBA：白色 + 覆盖率 alpha
+        uint64_t m_uploadBatches = 0;
+        uint64_t m_atlasResets = 0;
+
+        std::vector<GlyphRenderInfo> m_prepared;
+
+        bool loadGlyph(uint32_t glyphIndex);
         void createRenderResources();
+        SDL_GPUTexture* atlasPage(int page);
+        void resetAtlas();
+        void shapeInto(const std::string& text, ShapedRun& run);
+        void resolveRun(ShapedRun& run);
     };
 }
@@ -0,0 +1,129 @@
+#include "texture_atlas.h"
+#include <algorithm>
+#include <limits>
+
+namespace engine::render
+{
+    TextureAtlasPacker::TextureAtlasPacker(int pageSize, int maxPages, int padding)
+        : _page_size(std::max(1, pageSize)), _max_pages(std::max(1, maxPages)), _padding(std::max(0, padding))
+    {
+    }
+
+    void TextureAtlasPacker::clear()
+    {
+        _pages.clear();
+    }
+
+    float TextureAtlasPacker::getOccupancy(int page) const
+    {
+        if (page < 0 || page >= getPageCount())
+            return 0.0f;
+        return static_cast<float>(_pages[page].usedArea) / (static_cast<float>(_page_size) * _page_size);
+    }
+
+    bool TextureAtlasPacker::insert(int w, int h, AtlasRegion &out)
+    {
+        const int paddedW = w + _padding * 2;
+        const int paddedH = h + _padding * 2;
+        if (w <= 0 || h <= 0 || paddedW > _page_size || paddedH > _page_size)
+            return false;
+
+        int x = 0;
+        int y = 0;
+        for (size_t i = 0; i < _pages.size(); ++i)
+        {
+            if (insertIntoPage(_pages[i], paddedW, paddedH, x, y))
+            {
+                out = {static_cast<int>(i), x + _padding, y + _padding, w, h};
+                return true;
+            }
+        }
+
+        if (getPageCount() >= _max_pages)
+            return false;
+
+        Page &page = _pages.emplace_back();
+        page.skyline.push_back({0, 0, _page_size});
+        if (!insertIntoPage(page, paddedW, paddedH, x, y))
+            return false;
+        out = {getPageCount() - 1, x + _padding, y + _padding, w, h};
+        return true;
+    }
+
+    int TextureAtlasPacker::fit(const Page &page, size_t index, int w, int h) const
+    {
+        const int x = page.skyline[index].x;
+        if (x + w > _page_size)
+            return -1;
+
+        int y = page.skyline[index].y;
+        int widthLeft = w;
+        for (size_t i = index; widthLeft > 0; ++i)
+        {
+            if (i >= page.skyline.size())
+                return -1;
+            y = std::max(y, page.skyline[i].y);
+            if (y + h > _page_size)
+                return -1;
+            widthLeft -= page.skyline[i].w;
+        }
+        return y;
+    }
+
+    bool TextureAtlasPacker::insertIntoPage(Page &page, int w, int h, int &outX, int &outY)
+    {
+        // ── 选位置：顶边最低优先，其次占用段最窄 ──
+        int bestTop = std::numeric_limits<int>::max();
+        int bestWidth = std::numeric_limits<int>::max();
+        size_t bestIndex = page.skyline.size();
+        for (size_t i = 0; i < page.skyline.size(); ++i)
+        {
+            const int y = fit(page, i, w, h);
+            if (y < 0)
+                continue;
+            const int top = y + h;
+            if (top < bestTop || (top == bestTop && page.skyline[i].w < bestWidth))
+            {
+                bestTop = top;
+                bestWidth = page.skyline[i].w;
+                bestIndex = i;
+            }
+        }
+        if (bestIndex == page.skyline.size())
+            return false;
+
+        outX = page.skyline[bestIndex].x;
+        outY = bestTop - h;
+
+        // ── 更新轮廓：插入新段，裁掉被覆盖的后续段，合并等高邻段 ──
+        auto &sky = page.skyline;
+        sky.insert(sky.begin() + static_cast<std::ptrdiff_t>(bestIndex), SkylineNode{outX, bestTop, w});
+        for (size_t i = bestIndex + 1; i < sky.size();)
+        {
+            const int prevRight = sky[i - 1].x + sky[i - 1].w;
+            if (sky[i].x >= prevRight)
+                break;
+            const int shrink = prevRight - sky[i].x;
+            sky[i].x += shrink;
+            sky[i].w -= shrink;
+            if (sky[i].w > 0)
+                break;
+            sky.erase(sky.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+        for (size_t i = 0; i + 1 < sky.size();)
+        {
+            if (sky[i].y == sky[i + 1].y)
+            {
+                sky[i].w += sky[i + 1].w;
+                sky.erase(sky.begin() + static_cast<std::ptrdiff_t>(i + 1));
+            }
+            else
+            {
+                ++i;
+            }
+        }
+
+        page.usedArea += static_cast<long long>(w) * h;
+        return true;
+    }
+} // namespace engine::render
@@ -0,0 +1,63 @@
+// 运行时纹理图集装箱
+// texture_atlas.h
+//   - Skyline（天际线）装箱：每页维护一条高度轮廓，新矩形放在使顶边最低的位置
+//   - 多页：当前各页都放不下时开新页，达到页数上限后拒绝（调用方退回独立纹理）
+//   - 只负责分配矩形，不碰 GPU；纹理拷贝由具体渲染后端完成
+#pragma once
+#include <cstddef>
+#include <vector>
+
+namespace engine::render
+{
+    /**
+     * @brief 图集中的一块区域（像素坐标，不含四周的 padding）
+     */
+    struct AtlasRegion
+    {
+        int page = -1;
+        int x = 0;
+        int y = 0;
+        int w = 0;
+        int h = 0;
+    };
+
+    class TextureAtlasPacker
+    {
+    public:
+        // padding：每个矩形四周额外保留的像素，用于边缘外扩，防止采样串色
+        explicit TextureAtlasPacker(int pageSize = 2048, int maxPages = 8, int padding = 1);
+
+        // 分配 w x h 区域；所有页（含可新开的页）都放不下时返回 false
+        bool insert(int w, int h, AtlasRegion &out);
+        void clear();
+
+        int getPageSize() const { return _page_size; }
+        int getPadding() const { return _padding; }
+        int getPageCount() const { return static_cast<int>(_pages.size()); }
+        // 已分配面积 / 页面积（含 padding）
+        float getOccupancy(int page) const;
+
+    private:
+        struct SkylineNode
+        {
+            int x = 0;
+            int y = 0; // 该段已占用到的高度
+            int w = 0;
+        };
+
+        struct Page
+        {
+            std::vector<SkylineNode> skyline;
+            long long usedArea = 0;
+        };
+
+        // 矩形左边对齐 skyline[index] 时的放置高度；放不下返回 -1
+        int fit(const Page &page, std::size_t index, int w, int h) const;
+        bool insertIntoPage(Page &page, int w, int h, int &outX, int &outY);
+
+        int _page_size;
+        int _max_pages;
+        int _padding;
+        std::vector<Page> _pages;
+    };
+} // namespace engine::render
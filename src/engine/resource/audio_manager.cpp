@@ -15,11 +15,18 @@ namespace engine::resource
         {
             spdlog::error("AudioManager: 创建默认混音器失败: {}", SDL_GetError());
         }
+        else
+        {
+            _sound_bank = std::make_unique<engine::audio::SoundBank>(_mixer);
+            _voice_pool = std::make_unique<engine::audio::VoicePool>(_mixer);
+        }
         spdlog::trace("TextureManager 构造成功");
     }
 
     AudioManager::~AudioManager()
     {
+        _voice_pool.reset();
+        _sound_bank.reset();
         clearAudios();
         if (_mixer)
         {
@@ -83,6 +90,14 @@ namespace engine::resource
 
     void AudioManager::clearAudios()
     {
+        // 先让语音全部停下，再释放它们引用的 PCM
+        if (_voice_pool)
+        {
+            _voice_pool->stopAll();
+            _voice_pool->flush();
+        }
+        if (_sound_bank)
+            _sound_bank->clear();
         if (!_audios.empty())
         {
             spdlog::debug("正在清除 {} 个缓存的音频", _audios.size());
@@ -3,6 +3,8 @@
 #include <string>
 #include <unordered_map>
 #include <SDL3_mixer/SDL_mixer.h>
+#include "../audio/sound_bank.h"
+#include "../audio/voice_pool.h"
 
 namespace engine::resource
 {
@@ -33,6 +35,9 @@ namespace engine::resource
         std::unordered_map<std::string, std::unique_ptr<MIX_Track, SDLMixTrackDeleter>> _tracks;
         std::unordered_map<std::string, std::unique_ptr<MIX_Audio, SDLMixAudioDeleter>> _audios;
         MIX_Mixer *_mixer = nullptr;
+        // 预解码音效与语音池（混音器创建成功时才有）；析构顺序：语音池 → 音效库 → 混音器
+        std::unique_ptr<engine::audio::SoundBank> _sound_bank;
+        std::unique_ptr<engine::audio::VoicePool> _voice_pool;
 
     public:
         AudioManager();
@@ -43,6 +48,8 @@ namespace engine::resource
         AudioManager &operator=(AudioManager &&) = delete;
 
         MIX_Mixer *getMixer() const { return _mixer; }
+        engine::audio::SoundBank *getSoundBank() const { return _sound_bank.get(); }
+        engine::audio::VoicePool *getVoicePool() const { return _voice_pool.get(); }
 
     private:
         MIX_Audio *loadAudio(const std::string &path);
@@ -36,7 +36,7 @@ namespace engine::resource
 
         spdlog::debug("加载字体 '{}' 大小 {}px", file, fontSize);
         auto renderer = std::make_unique<render::TextRenderer>();
-        if (!renderer->init(_device, file, fontSize))
+        if (!renderer->init(_device, file, fontSize, &_run_cache))
         {
             spdlog::error("无法加载字体 '{}'", file);
             return nullptr;
@@ -65,5 +65,6 @@ namespace engine::resource
             spdlog::debug("正在清理所有 {} 个字体", _renderers.size());
             _renderers.clear();
         }
+        _run_cache.clear();
     }
 }
@@ -12,6 +12,8 @@ namespace engine::resource
         friend class ResourceManager;
 
     private:
+        // 所有字体共用的整形缓存；须先于 _renderers 构造、晚于其析构
+        render::ShapedRunCache _run_cache;
         std::unordered_map<std::string, std::unique_ptr<render::TextRenderer>> _renderers;
         SDL_GPUDevice* _device = nullptr;
 
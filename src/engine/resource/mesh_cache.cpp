@@ -0,0 +1,369 @@
+#include "mesh_cache.h"
+#include "../utils/mapped_file.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <spdlog/spdlog.h>
+
+namespace engine::resource
+{
+    namespace
+    {
+        constexpr char kMagic[4] = {'L', 'S', 'L', 'M'};
+        constexpr uint16_t kFlagIndex32 = 1 << 0;
+        constexpr uint16_t kFlagImage = 1 << 1;
+
+        struct MeshFileHeader
+        {
+            char magic[4];
+            uint16_t version;
+            uint16_t flags;
+            uint32_t vertexCount;
+            uint32_t indexCount;
+            uint64_t sourceSize;
+            int64_t sourceTime;
+            float boundsMin[3];
+            float boundsMax[3];
+            float uvMin[2];
+            float uvMax[2];
+            uint32_t imageWidth;
+            uint32_t imageHeight;
+            uint32_t pathLength;
+            uint32_t reserved;
+        };
+        static_assert(sizeof(MeshFileHeader) == 88, "网格缓存文件头应为 88 字节");
+
+        struct PackedVertex
+        {
+            uint16_t pos[3];    // unorm16，按包围盒归一化
+            int16_t normal[2];  // 八面体编码 snorm16
+            uint16_t uv[2];     // unorm16，按 UV 包围盒归一化
+            uint16_t pad;
+        };
+        static_assert(sizeof(PackedVertex) == 16, "PackedVertex 应为 16 字节");
+
+        size_t align4(size_t size) { return (size + 3) & ~size_t{3}; }
+
+        uint16_t quantizeUnorm(float value, float lo, float extent)
+        {
+            const float t = extent > 0.0f ? (value - lo) / extent : 0.0f;
+            return static_cast<uint16_t>(std::lround(std::clamp(t, 0.0f, 1.0f) * 65535.0f));
+        }
+
+        float dequantizeUnorm(uint16_t value, float lo, float extent)
+        {
+            return lo + static_cast<float>(value) * (1.0f / 65535.0f) * extent;
+        }
+
+        int16_t quantizeSnorm(float value)
+        {
+            return static_cast<int16_t>(std::lround(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+        }
+
+        float signNotZero(float v) { return v >= 0.0f ? 1.0f : -1.0f; }
+
+        glm::vec2 octEncode(glm::vec3 n)
+        {
+            const float len = std::abs(n.x) + std::abs(n.y) + std::abs(n.z);
+            if (len <= 0.0f)
+                return {0.0f, 1.0f};
+            n /= len;
+            if (n.z >= 0.0f)
+                return {n.x, n.y};
+            return {(1.0f - std::abs(n.y)) * signNotZero(n.x), (1.0f - std::abs(n.x)) * signNotZero(n.y)};
+        }
+
+        glm::vec3 octDecode(float x, float y)
+        {
+            glm::vec3 n{x, y, 1.0f - std::abs(x) - std::abs(y)};
+            if (n.z < 0.0f)
+            {
+                const float ox = n.x;
+                n.x = (1.0f - std::abs(n.y)) * signNotZero(ox);
+                n.y = (1.0f - std::abs(ox)) * signNotZero(n.y);
+            }
+            return glm::normalize(n);
+        }
+
+        uint64_t hashPath(const std::string &path)
+        {
+            uint64_t h = 1469598103934665603ull;
+            for (unsigned char c : path)
+                h = (h ^ c) * 1099511628211ull;
+            return h;
+        }
+    }
+
+    MeshCache::MeshCache(std::string directory) : _directory(std::move(directory))
+    {
+    }
+
+    std::string MeshCache::cachePathFor(const std::string &sourcePath) const
+    {
+        // 文件名 = 源文件名（便于人工排查）+ 完整路径哈希（区分同名文件）
+        const std::string stem = std::filesystem::path(sourcePath).stem().string();
+        char hash[17];
+        std::snprintf(hash, sizeof(hash), "%016llx", static_cast<unsigned long long>(hashPath(sourcePath)));
+        return (std::filesystem::path(_directory) / (stem + "." + hash + ".lslm")).string();
+    }
+
+    bool MeshCache::sourceStamp(const std::string &sourcePath, uint64_t &size, int64_t &time)
+    {
+        std::error_code ec;
+        const auto fileSize = std::filesystem::file_size(sourcePath, ec);
+        if (ec)
+            return false;
+        const auto writeTime = std::filesystem::last_write_time(sourcePath, ec);
+        if (ec)
+            return false;
+        size = static_cast<uint64_t>(fileSize);
+        time = static_cast<int64_t>(writeTime.time_since_epoch().count());
+        return true;
+    }
+
+    bool MeshCache::writeFile(const std::string &cachePath, const std::string &sourcePath,
+                              uint64_t sourceSize, int64_t sourceTime, const MeshData &mesh)
+    {
+        if (mesh.vertices.empty() || mesh.indices.empty())
+            return false;
+
+        MeshFileHeader header{};
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.version = FORMAT_VERSION;
+        header.vertexCount = static_cast<uint32_t>(mesh.vertices.size());
+        header.indexCount = static_cast<uint32_t>(mesh.indices.size());
+        header.sourceSize = sourceSize;
+        header.sourceTime = sourceTime;
+        header.pathLength = static_cast<uint32_t>(sourcePath.size());
+        const bool index32 = mesh.vertices.size() > 0xFFFF;
+        const bool hasImage = !mesh.baseColor.empty();
+        header.flags = static_cast<uint16_t>((index32 ? kFlagIndex32 : 0) | (hasImage ? kFlagImage : 0));
+
+        glm::vec2 uvMin = mesh.vertices.front().uv;
+        glm::vec2 uvMax = uvMin;
+        for (const MeshVertex &vertex : mesh.vertices)
+        {
+            uvMin = glm::min(uvMin, vertex.uv);
+            uvMax = glm::max(uvMax, vertex.uv);
+        }
+        const glm::vec3 posExtent = mesh.boundsMax - mesh.boundsMin;
+        const glm::vec2 uvExtent = uvMax - uvMin;
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            header.boundsMin[axis] = mesh.boundsMin[axis];
+            header.boundsMax[axis] = mesh.boundsMax[axis];
+        }
+        header.uvMin[0] = uvMin.x;
+        header.uvMin[1] = uvMin.y;
+        header.uvMax[0] = uvMax.x;
+        header.uvMax[1] = uvMax.y;
+        if (hasImage)
+        {
+            header.imageWidth = static_cast<uint32_t>(mesh.baseColor.width);
+            header.imageHeight = static_cast<uint32_t>(mesh.baseColor.height);
+        }
+
+        std::vector<PackedVertex> packed(mesh.vertices.size());
+        for (size_t i = 0; i < mesh.vertices.size(); ++i)
+        {
+            const MeshVertex &vertex = mesh.vertices[i];
+            PackedVertex &out = packed[i];
+            for (int axis = 0; axis < 3; ++axis)
+                out.pos[axis] = quantizeUnorm(vertex.pos[axis], mesh.boundsMin[axis], posExtent[axis]);
+            const glm::vec2 oct = octEncode(vertex.normal);
+            out.normal[0] = quantizeSnorm(oct.x);
+            out.normal[1] = quantizeSnorm(oct.y);
+            out.uv[0] = quantizeUnorm(vertex.uv.x, uvMin.x, uvExtent.x);
+            out.uv[1] = quantizeUnorm(vertex.uv.y, uvMin.y, uvExtent.y);
+            out.pad = 0;
+        }
+
+        // 先写临时文件再改名，中途失败不会留下半截缓存
+        std::error_code ec;
+        std::filesystem::create_directories(std::filesystem::path(cachePath).parent_path(), ec);
+        const std::string tempPath = cachePath + ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+            if (!file)
+                return false;
+            const char zeros[4] = {};
+            file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+            file.write(sourcePath.data(), static_cast<std::streamsize>(sourcePath.size()));
+            file.write(zeros, static_cast<std::streamsize>(align4(sourcePath.size()) - sourcePath.size()));
+            file.write(reinterpret_cast<const char *>(packed.data()), static_cast<std::streamsize>(packed.size() * sizeof(PackedVertex)));
+            if (index32)
+            {
+                file.write(reinterpret_cast<const char *>(mesh.indices.data()),
+                           static_cast<std::streamsize>(mesh.indices.size() * sizeof(uint32_t)));
+            }
+            else
+            {
+                std::vector<uint16_t> narrow(mesh.indices.begin(), mesh.indices.end());
+                file.write(reinterpret_cast<const char *>(narrow.data()), static_cast<std::streamsize>(narrow.size() * sizeof(uint16_t)));
+                file.write(zeros, static_cast<std::streamsize>(align4(narrow.size() * sizeof(uint16_t)) - narrow.size() * sizeof(uint16_t)));
+            }
+            if (hasImage)
+                file.write(reinterpret_cast<const char *>(mesh.baseColor.rgba.data()),
+                           static_cast<std::streamsize>(mesh.baseColor.rgba.size()));
+            if (!file)
+                return false;
+        }
+        std::filesystem::rename(tempPath, cachePath, ec);
+        if (ec)
+        {
+            std::filesystem::remove(tempPath, ec);
+            return false;
+        }
+        return true;
+    }
+
+    bool MeshCache::readFile(const std::string &cachePath, const std::string &sourcePath,
+                             uint64_t sourceSize, int64_t sourceTime, MeshData &out)
+    {
+        utils::MappedFile file;
+        if (!file.open(cachePath) || file.size() < sizeof(MeshFileHeader))
+            return false;
+
+        MeshFileHeader header;
+        std::memcpy(&header, file.data(), sizeof(header));
+        if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.version != FORMAT_VERSION ||
+            header.sourceSize != sourceSize || header.sourceTime != sourceTime || header.pathLength != sourcePath.size())
+            return false;
+
+        const bool index32 = (header.flags & kFlagIndex32) != 0;
+        const bool hasImage = (header.flags & kFlagImage) != 0;
+        const size_t pathOffset = sizeof(MeshFileHeader);
+        const size_t vertexOffset = pathOffset + align4(header.pathLength);
+        const size_t indexOffset = vertexOffset + size_t{header.vertexCount} * sizeof(PackedVertex);
+        const size_t indexBytes = size_t{header.indexCount} * (index32 ? sizeof(uint32_t) : sizeof(uint16_t));
+        const size_t imageOffset = indexOffset + align4(indexBytes);
+        const size_t imageBytes = hasImage ? size_t{header.imageWidth} * header.imageHeight * 4 : 0;
+        if (file.size() < imageOffset + imageBytes ||
+            std::memcmp(file.data() + pathOffset, sourcePath.data(), sourcePath.size()) != 0)
+            return false;
+
+        const glm::vec3 boundsMin{header.boundsMin[0], header.boundsMin[1], header.boundsMin[2]};
+        const glm::vec3 boundsMax{header.boundsMax[0], header.boundsMax[1], header.boundsMax[2]};
+        const glm::vec3 posExtent = boundsMax - boundsMin;
+        const glm::vec2 uvMin{header.uvMin[0], header.uvMin[1]};
+        const glm::vec2 uvExtent = glm::vec2(header.uvMax[0], header.uvMax[1]) - uvMin;
+
+        out = MeshData{};
+        out.boundsMin = boundsMin;
+        out.boundsMax = boundsMax;
+        out.vertices.resize(header.vertexCount);
+        const auto *packed = reinterpret_cast<const PackedVertex *>(file.data() + vertexOffset);
+        for (size_t i = 0; i < out.vertices.size(); ++i)
+        {
+            const PackedVertex &src = packed[i];
+            MeshVertex &vertex = out.vertices[i];
+            for (int axis = 0; axis < 3; ++axis)
+                vertex.pos[axis] = dequantizeUnorm(src.pos[axis], boundsMin[axis], posExtent[axis]);
+            vertex.normal = octDecode(std::max(src.normal[0] / 32767.0f, -1.0f), std::max(src.normal[1] / 32767.0f, -1.0f));
+            vertex.uv = {dequantizeUnorm(src.uv[0], uvMin.x, uvExtent.x), dequantizeUnorm(src.uv[1], uvMin.y, uvExtent.y)};
+        }
+
+        out.indices.resize(header.indexCount);
+        if (index32)
+        {
+            std::memcpy(out.indices.data(), file.data() + indexOffset, indexBytes);
+        }
+        else
+        {
+            const auto *narrow = reinterpret_cast<const uint16_t *>(file.data() + indexOffset);
+            std::copy(narrow, narrow + header.indexCount, out.indices.begin());
+        }
+        for (uint32_t index : out.indices)
+            if (index >= header.vertexCount)
+                return false;
+
+        if (hasImage)
+        {
+            out.baseColor.width = static_cast<int>(header.imageWidth);
+            out.baseColor.height = static_cast<int>(header.imageHeight);
+            out.baseColor.rgba.assign(file.data() + imageOffset, file.data() + imageOffset + imageBytes);
+        }
+        return true;
+    }
+
+    bool MeshCache::importAndStore(const std::string &sourcePath, uint64_t size, int64_t time, MeshData &out)
+    {
+        if (!importMesh(sourcePath, out))
+        {
+            ++_failures;
+            spdlog::warn("MeshCache: 导入失败 {}", sourcePath);
+            return false;
+        }
+        ++_imports;
+        if (!writeFile(cachePathFor(sourcePath), sourcePath, size, time, out))
+            spdlog::warn("MeshCache: 写入缓存失败 {}", sourcePath);
+        return true;
+    }
+
+    bool MeshCache::load(const std::string &sourcePath, MeshData &out)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        auto finish = [&](bool ok) {
+            _loadMicros += static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+            return ok;
+        };
+
+        uint64_t size = 0;
+        int64_t time = 0;
+        if (!sourceStamp(sourcePath, size, time))
+        {
+            ++_failures;
+            return finish(false);
+        }
+        if (readFile(cachePathFor(sourcePath), sourcePath, size, time, out))
+        {
+            ++_hits;
+            return finish(true);
+        }
+        return finish(importAndStore(sourcePath, size, time, out));
+    }
+
+    bool MeshCache::cook(const std::string &sourcePath, bool force)
+    {
+        if (!force && isFresh(sourcePath))
+            return true;
+        uint64_t size = 0;
+        int64_t time = 0;
+        if (!sourceStamp(sourcePath, size, time))
+            return false;
+        MeshData mesh;
+        return importAndStore(sourcePath, size, time, mesh);
+    }
+
+    bool MeshCache::isFresh(const std::string &sourcePath) const
+    {
+        uint64_t size = 0;
+        int64_t time = 0;
+        if (!sourceStamp(sourcePath, size, time))
+            return false;
+
+        // 只比对文件头，不解码
+        utils::MappedFile file;
+        if (!file.open(cachePathFor(sourcePath)) || file.size() < sizeof(MeshFileHeader))
+            return false;
+        MeshFileHeader header;
+        std::memcpy(&header, file.data(), sizeof(header));
+        return std::memcmp(header.magic, kMagic, sizeof(kMagic)) == 0 && header.version == FORMAT_VERSION &&
+               header.sourceSize == size && header.sourceTime == time;
+    }
+
+    MeshCacheStats MeshCache::getStats() const
+    {
+        MeshCacheStats stats;
+        stats.hits = _hits.load();
+        stats.imports = _imports.load();
+        stats.failures = _failures.load();
+        stats.loadMs = static_cast<double>(_loadMicros.load()) / 1000.0;
+        return stats;
+    }
+} // namespace engine::resource
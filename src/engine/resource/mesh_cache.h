@@ -0,0 +1,105 @@
+// 静态网格导入与二进制缓存
+// mesh_cache.h
+//   - 导入：OBJ（指针扫描解析，角点焊接为索引网格）、GLB（tinygltf，首个网格的首个图元 + 基础色贴图）
+//   - 缓存：每个源文件一个 .lslm，按源路径哈希命名，头部记录源文件大小与修改时间，任一不符即重新导入
+//   - 命中时内存映射缓存文件，直接解码量化顶点 / 拷贝索引与贴图，不再解析文本或 glTF
+//
+// 文件布局（小端，各段 4 字节对齐）：
+//   MeshFileHeader | 源路径 | PackedVertex[vertexCount] | 索引（u16 / u32）| RGBA8 贴图
+// 量化：位置按包围盒归一化为 unorm16，法线八面体编码为 snorm16 x2，UV 按 UV 包围盒归一化为 unorm16。
+#pragma once
+#include <glm/glm.hpp>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace engine::resource
+{
+    struct MeshVertex
+    {
+        glm::vec3 pos{0.0f};
+        glm::vec3 normal{0.0f, 1.0f, 0.0f};
+        glm::vec2 uv{0.0f};
+    };
+
+    /** 导入时附带的基础色贴图（RGBA8，行优先，首行在上） */
+    struct MeshImage
+    {
+        int width = 0;
+        int height = 0;
+        std::vector<uint8_t> rgba;
+
+        bool empty() const { return rgba.empty(); }
+    };
+
+    struct MeshData
+    {
+        std::vector<MeshVertex> vertices;
+        std::vector<uint32_t> indices; // 三角形列表
+        glm::vec3 boundsMin{0.0f};
+        glm::vec3 boundsMax{0.0f};
+        MeshImage baseColor;
+    };
+
+    // ── 导入 ──
+
+    /** 合并完全相同的顶点，输出索引网格 */
+    void weldMeshVertices(const std::vector<MeshVertex> &corners, MeshData &out);
+    /** 由顶点重新计算包围盒 */
+    void computeMeshBounds(MeshData &mesh);
+
+    bool importObjMesh(const std::string &path, MeshData &out);
+    bool importGlbMesh(const std::string &path, MeshData &out);
+    /** 按扩展名分派（.obj / .glb），不支持的格式返回 false */
+    bool importMesh(const std::string &path, MeshData &out);
+    bool isImportableMesh(const std::string &path);
+
+    // ── 缓存 ──
+
+    struct MeshCacheStats
+    {
+        uint64_t hits = 0;     // 直接映射缓存
+        uint64_t imports = 0;  // 缓存缺失 / 过期，重新导入
+        uint64_t failures = 0; // 导入失败
+        double loadMs = 0.0;   // 全部 load() 的累计耗时
+    };
+
+    class MeshCache
+    {
+    public:
+        static constexpr uint16_t FORMAT_VERSION = 1;
+
+        // directory 不存在时在首次写入时创建
+        explicit MeshCache(std::string directory);
+
+        /** 读取网格：缓存有效则映射解码，否则导入源文件并写回缓存 */
+        bool load(const std::string &sourcePath, MeshData &out);
+        /** 离线烘焙：缓存已有效且 !force 时直接返回 true */
+        bool cook(const std::string &sourcePath, bool force = false);
+        /** 缓存是否与源文件一致 */
+        bool isFresh(const std::string &sourcePath) const;
+
+        std::string cachePathFor(const std::string &sourcePath) const;
+        const std::string &getDirectory() const { return _directory; }
+        MeshCacheStats getStats() const;
+
+        // 文件读写（纯函数，工具 / 基准可直接使用）
+        static bool writeFile(const std::string &cachePath, const std::string &sourcePath,
+                              uint64_t sourceSize, int64_t sourceTime, const MeshData &mesh);
+        /** 校验魔数 / 版本 / 源文件信息后解码；任一不符返回 false */
+        static bool readFile(const std::string &cachePath, const std::string &sourcePath,
+                             uint64_t sourceSize, int64_t sourceTime, MeshData &out);
+        /** 源文件大小与修改时间；文件不存在返回 false */
+        static bool sourceStamp(const std::string &sourcePath, uint64_t &size, int64_t &time);
+
+    private:
+        bool importAndStore(const std::string &sourcePath, uint64_t size, int64_t time, MeshData &out);
+
+        std::string _directory;
+        std::atomic<uint64_t> _hits{0};
+        std::atomic<uint64_t> _imports{0};
+        std::atomic<uint64_t> _failures{0};
+        std::atomic<uint64_t> _loadMicros{0};
+    };
+} // namespace engine::resource
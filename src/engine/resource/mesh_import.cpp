@@ -0,0 +1,392 @@
+#include "mesh_cache.h"
+#include "../utils/mapped_file.h"
+#define TINYGLTF_IMPLEMENTATION
+#define STB_IMAGE_IMPLEMENTATION
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <tiny_gltf.h>
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <unordered_map>
+
+namespace engine::resource
+{
+    namespace
+    {
+        std::string lowerExtension(const std::string &path)
+        {
+            const size_t dot = path.find_last_of('.');
+            if (dot == std::string::npos)
+                return {};
+            std::string ext = path.substr(dot);
+            std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            return ext;
+        }
+
+        // ── OBJ 行扫描 ──
+
+        bool isBlank(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+        const char *skipBlank(const char *p, const char *end)
+        {
+            while (p < end && isBlank(*p))
+                ++p;
+            return p;
+        }
+
+        // strtof 需要以非数字字符结尾；行内 token 后总有空白或换行，映射区末尾由调用方保证
+        float parseFloat(const char *&p, const char *end)
+        {
+            p = skipBlank(p, end);
+            char *next = nullptr;
+            const float value = std::strtof(p, &next);
+            p = next > p ? next : p;
+            return value;
+        }
+
+        int parseInt(const char *&p, const char *end)
+        {
+            bool negative = false;
+            if (p < end && (*p == '-' || *p == '+'))
+                negative = *p++ == '-';
+            int value = 0;
+            while (p < end && *p >= '0' && *p <= '9')
+                value = value * 10 + (*p++ - '0');
+            return negative ? -value : value;
+        }
+
+        struct ObjIndex
+        {
+            int position = 0; // 1 起，0 = 缺省；负数在解析时已换算为绝对下标
+            int uv = 0;
+            int normal = 0;
+        };
+
+        // v / v/vt / v//vn / v/vt/vn
+        bool parseFaceIndex(const char *&p, const char *end, size_t positions, size_t uvs, size_t normals, ObjIndex &out)
+        {
+            p = skipBlank(p, end);
+            if (p >= end || *p == '\n' || *p == '#')
+                return false;
+            auto resolve = [](int index, size_t count) { return index < 0 ? static_cast<int>(count) + index + 1 : index; };
+            out = {};
+            out.position = resolve(parseInt(p, end), positions);
+            if (p < end && *p == '/')
+            {
+                ++p;
+                if (p < end && *p != '/')
+                    out.uv = resolve(parseInt(p, end), uvs);
+                if (p < end && *p == '/')
+                {
+                    ++p;
+                    out.normal = resolve(parseInt(p, end), normals);
+                }
+            }
+            while (p < end && !isBlank(*p) && *p != '\n')
+                ++p;
+            return true;
+        }
+    }
+
+    void weldMeshVertices(const std::vector<MeshVertex> &corners, MeshData &out)
+    {
+        using Key = std::array<uint32_t, 8>;
+        static_assert(sizeof(MeshVertex) == sizeof(Key), "MeshVertex 应为 8 个 float");
+        struct KeyHash
+        {
+            size_t operator()(const Key &key) const
+            {
+                uint64_t h = 1469598103934665603ull;
+                for (uint32_t word : key)
+                    h = (h ^ word) * 1099511628211ull;
+                return static_cast<size_t>(h);
+            }
+        };
+
+        std::unordered_map<Key, uint32_t, KeyHash> lookup;
+        lookup.reserve(corners.size());
+        out.vertices.clear();
+        out.indices.clear();
+        out.indices.reserve(corners.size());
+        for (const MeshVertex &corner : corners)
+        {
+            Key key;
+            std::memcpy(key.data(), &corner, sizeof(Key));
+            auto [it, inserted] = lookup.try_emplace(key, static_cast<uint32_t>(out.vertices.size()));
+            if (inserted)
+                out.vertices.push_back(corner);
+            out.indices.push_back(it->second);
+        }
+    }
+
+    void computeMeshBounds(MeshData &mesh)
+    {
+        if (mesh.vertices.empty())
+        {
+            mesh.boundsMin = mesh.boundsMax = glm::vec3(0.0f);
+            return;
+        }
+        mesh.boundsMin = mesh.boundsMax = mesh.vertices.front().pos;
+        for (const MeshVertex &vertex : mesh.vertices)
+        {
+            mesh.boundsMin = glm::min(mesh.boundsMin, vertex.pos);
+            mesh.boundsMax = glm::max(mesh.boundsMax, vertex.pos);
+        }
+    }
+
+    bool importObjMesh(const std::string &path, MeshData &out)
+    {
+        utils::MappedFile file;
+        if (!file.open(path) || file.size() == 0)
+            return false;
+
+        // strtof 可能越过映射区末尾继续读，末行没有换行时拷贝一份补上
+        std::string tail;
+        const char *begin = reinterpret_cast<const char *>(file.data());
+        const char *end = begin + file.size();
+        if (end[-1] != '\n')
+        {
+            tail.assign(begin, end);
+            tail.push_back('\n');
+            begin = tail.data();
+            end = begin + tail.size();
+        }
+
+        std::vector<glm::vec3> positions;
+        std::vector<glm::vec3> normals;
+        std::vector<glm::vec2> uvs;
+        std::vector<MeshVertex> corners; // 按三角形展开的角点，最后焊接
+        std::vector<ObjIndex> face;
+
+        for (const char *p = begin; p < end;)
+        {
+            p = skipBlank(p, end);
+            const char *lineEnd = static_cast<const char *>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+            if (!lineEnd)
+                lineEnd = end;
+
+            if (p + 1 < lineEnd && p[0] == 'v' && isBlank(p[1]))
+            {
+                const char *q = p + 2;
+                glm::vec3 position;
+                position.x = parseFloat(q, lineEnd);
+                position.y = parseFloat(q, lineEnd);
+                position.z = parseFloat(q, lineEnd);
+                positions.push_back(position);
+            }
+            else if (p + 2 < lineEnd && p[0] == 'v' && p[1] == 'n' && isBlank(p[2]))
+            {
+                const char *q = p + 3;
+                glm::vec3 normal;
+                normal.x = parseFloat(q, lineEnd);
+                normal.y = parseFloat(q, lineEnd);
+                normal.z = parseFloat(q, lineEnd);
+                normals.push_back(glm::normalize(normal));
+            }
+            else if (p + 2 < lineEnd && p[0] == 'v' && p[1] == 't' && isBlank(p[2]))
+            {
+                const char *q = p + 3;
+                glm::vec2 uv;
+                uv.x = parseFloat(q, lineEnd);
+                uv.y = parseFloat(q, lineEnd);
+                uvs.push_back({uv.x, 1.0f - uv.y});
+            }
+            else if (p + 1 < lineEnd && p[0] == 'f' && isBlank(p[1]))
+            {
+                const char *q = p + 2;
+                face.clear();
+                ObjIndex index;
+                while (parseFaceIndex(q, lineEnd, positions.size(), uvs.size(), normals.size(), index))
+                    face.push_back(index);
+
+                // 扇形三角化；缺法线时用面法线
+                for (size_t i = 1; i + 1 < face.size(); ++i)
+                {
+                    const ObjIndex tri[3] = {face[0], face[i], face[i + 1]};
+                    auto validPosition = [&](const ObjIndex &idx) {
+                        return idx.position > 0 && static_cast<size_t>(idx.position) <= positions.size();
+                    };
+                    glm::vec3 fallbackNormal{0.0f, 1.0f, 0.0f};
+                    if (validPosition(tri[0]) && validPosition(tri[1]) && validPosition(tri[2]))
+                    {
+                        const glm::vec3 &a = positions[static_cast<size_t>(tri[0].position - 1)];
+                        const glm::vec3 &b = positions[static_cast<size_t>(tri[1].position - 1)];
+                        const glm::vec3 &c = positions[static_cast<size_t>(tri[2].position - 1)];
+                        const glm::vec3 n = glm::cross(b - a, c - a);
+                        if (glm::length(n) > 0.0001f)
+                            fallbackNormal = glm::normalize(n);
+                    }
+
+                    for (const ObjIndex &idx : tri)
+                    {
+                        MeshVertex vertex{};
+                        if (validPosition(idx))
+                            vertex.pos = positions[static_cast<size_t>(idx.position - 1)];
+                        vertex.normal = idx.normal > 0 && static_cast<size_t>(idx.normal) <= normals.size()
+                                            ? normals[static_cast<size_t>(idx.normal - 1)]
+                                            : fallbackNormal;
+                        vertex.uv = idx.uv > 0 && static_cast<size_t>(idx.uv) <= uvs.size()
+                                        ? uvs[static_cast<size_t>(idx.uv - 1)]
+                                        : glm::vec2(0.0f);
+                        corners.push_back(vertex);
+                    }
+                }
+            }
+            p = lineEnd + 1;
+        }
+
+        if (corners.empty())
+            return false;
+        out = MeshData{};
+        weldMeshVertices(corners, out);
+        computeMeshBounds(out);
+        return true;
+    }
+
+    bool importGlbMesh(const std::string &path, MeshData &out)
+    {
+        tinygltf::Model model;
+        tinygltf::TinyGLTF loader;
+        std::string warn;
+        std::string err;
+        if (!loader.LoadBinaryFromFile(&model, &err, &warn, path))
+            return false;
+
+        if (model.meshes.empty() || model.meshes.front().primitives.empty())
+            return false;
+        const tinygltf::Primitive &primitive = model.meshes.front().primitives.front();
+        auto posIt = primitive.attributes.find("POSITION");
+        if (posIt == primitive.attributes.end())
+            return false;
+
+        auto readFloats = [&](int accessorIndex, int components, auto &&store)
+        {
+            const auto &accessor = model.accessors[static_cast<size_t>(accessorIndex)];
+            const auto &view = model.bufferViews[static_cast<size_t>(accessor.bufferView)];
+            const auto &buffer = model.buffers[static_cast<size_t>(view.buffer)];
+            const unsigned char *data = buffer.data.data() + view.byteOffset + accessor.byteOffset;
+            const int byteStride = accessor.ByteStride(view);
+            const size_t stride = byteStride > 0 ? static_cast<size_t>(byteStride) : sizeof(float) * static_cast<size_t>(components);
+            for (size_t i = 0; i < accessor.count; ++i)
+                store(i, reinterpret_cast<const float *>(data + i * stride));
+        };
+
+        out = MeshData{};
+        const auto &positionAccessor = model.accessors[static_cast<size_t>(posIt->second)];
+        out.vertices.resize(positionAccessor.count);
+        readFloats(posIt->second, 3, [&](size_t i, const float *src) { out.vertices[i].pos = {src[0], src[1], src[2]}; });
+        if (auto normalIt = primitive.attributes.find("NORMAL"); normalIt != primitive.attributes.end())
+            readFloats(normalIt->second, 3, [&](size_t i, const float *src) {
+                if (i < out.vertices.size())
+                    out.vertices[i].normal = {src[0], src[1], src[2]};
+            });
+        if (auto uvIt = primitive.attributes.find("TEXCOORD_0"); uvIt != primitive.attributes.end())
+            readFloats(uvIt->second, 2, [&](size_t i, const float *src) {
+                if (i < out.vertices.size())
+                    out.vertices[i].uv = {src[0], 1.0f - src[1]};
+            });
+
+        std::vector<uint32_t> &indices = out.indices;
+        if (primitive.indices >= 0)
+        {
+            const auto &accessor = model.accessors[static_cast<size_t>(primitive.indices)];
+            const auto &view = model.bufferViews[static_cast<size_t>(accessor.bufferView)];
+            const auto &buffer = model.buffers[static_cast<size_t>(view.buffer)];
+            const unsigned char *data = buffer.data.data() + view.byteOffset + accessor.byteOffset;
+            indices.resize(accessor.count);
+            for (size_t i = 0; i < accessor.count; ++i)
+            {
+                switch (accessor.componentType)
+                {
+                case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+                    indices[i] = reinterpret_cast<const uint16_t *>(data)[i];
+                    break;
+                case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT:
+                    indices[i] = reinterpret_cast<const uint32_t *>(data)[i];
+                    break;
+                case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+                    indices[i] = reinterpret_cast<const uint8_t *>(data)[i];
+                    break;
+                default:
+                    indices[i] = 0;
+                    break;
+                }
+            }
+        }
+        else
+        {
+            indices.resize(out.vertices.size());
+            for (size_t i = 0; i < indices.size(); ++i)
+                indices[i] = static_cast<uint32_t>(i);
+        }
+
+        // 引用越界顶点的三角形整个丢弃
+        const size_t vertexCount = out.vertices.size();
+        size_t kept = 0;
+        for (size_t i = 0; i + 2 < indices.size(); i += 3)
+        {
+            if (indices[i] >= vertexCount || indices[i + 1] >= vertexCount || indices[i + 2] >= vertexCount)
+                continue;
+            indices[kept++] = indices[i];
+            indices[kept++] = indices[i + 1];
+            indices[kept++] = indices[i + 2];
+        }
+        indices.resize(kept);
+        if (indices.empty())
+            return false;
+
+        // 基础色贴图统一转为 RGBA8
+        if (primitive.material >= 0)
+        {
+            const auto &material = model.materials[static_cast<size_t>(primitive.material)];
+            const int textureIndex = material.pbrMetallicRoughness.baseColorTexture.index;
+            if (textureIndex >= 0 && textureIndex < static_cast<int>(model.textures.size()))
+            {
+                const int imageIndex = model.textures[static_cast<size_t>(textureIndex)].source;
+                if (imageIndex >= 0 && imageIndex < static_cast<int>(model.images.size()))
+                {
+                    const auto &image = model.images[static_cast<size_t>(imageIndex)];
+                    const int channels = image.component;
+                    if (!image.image.empty() && image.width > 0 && image.height > 0 && image.bits == 8 &&
+                        channels >= 1 && channels <= 4)
+                    {
+                        const size_t pixels = static_cast<size_t>(image.width) * static_cast<size_t>(image.height);
+                        out.baseColor.width = image.width;
+                        out.baseColor.height = image.height;
+                        out.baseColor.rgba.resize(pixels * 4);
+                        for (size_t i = 0; i < pixels; ++i)
+                        {
+                            const unsigned char *src = image.image.data() + i * static_cast<size_t>(channels);
+                            uint8_t *dst = out.baseColor.rgba.data() + i * 4;
+                            dst[0] = src[0];
+                            dst[1] = channels >= 3 ? src[1] : src[0];
+                            dst[2] = channels >= 3 ? src[2] : src[0];
+                            dst[3] = channels == 4 ? src[3] : (channels == 2 ? src[1] : 255);
+                        }
+                    }
+                }
+            }
+        }
+
+        computeMeshBounds(out);
+        return true;
+    }
+
+    bool isImportableMesh(const std::string &path)
+    {
+        const std::string ext = lowerExtension(path);
+        return ext == ".obj" || ext == ".glb";
+    }
+
+    bool importMesh(const std::string &path, MeshData &out)
+    {
+        const std::string ext = lowerExtension(path);
+        if (ext == ".obj")
+            return importObjMesh(path, out);
+        if (ext == ".glb")
+            return importGlbMesh(path, out);
+        return false;
+    }
+} // namespace engine::resource
@@ -0,0 +1,109 @@
+// 资源句柄
+// resource_handle.h
+//   - ResourceHandle<Tag>：32 位句柄，低 20 位为槽位索引，高 12 位为代数（与 ecs::Entity 同样的划分），0 为空句柄
+//   - ResourceHandleRegistry<Tag>：路径驻留表，同一路径始终得到同一槽位；管理器卸载资源时 retire 使旧句柄失效
+//   - 管理器按槽位索引直接寻址数组，帧内查询不再哈希字符串；Debug 构建下使用过期句柄会被检测出来
+//
+// 注意：驻留表不加锁，acquire / retire 只应在主线程调用
+#pragma once
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace engine::resource
+{
+    template <typename Tag>
+    struct ResourceHandle
+    {
+        static constexpr uint32_t INDEX_BITS = 20;
+        static constexpr uint32_t INDEX_MASK = (1u << INDEX_BITS) - 1;
+        static constexpr uint32_t GENERATION_MASK = (1u << (32 - INDEX_BITS)) - 1;
+
+        uint32_t value = 0;
+
+        static constexpr ResourceHandle make(uint32_t index, uint32_t generation)
+        {
+            return {(generation & GENERATION_MASK) << INDEX_BITS | (index & INDEX_MASK)};
+        }
+
+        constexpr uint32_t index() const { return value & INDEX_MASK; }
+        constexpr uint32_t generation() const { return value >> INDEX_BITS; }
+        constexpr bool isValid() const { return value != 0; }
+        constexpr explicit operator bool() const { return isValid(); }
+        constexpr bool operator==(const ResourceHandle &) const = default;
+    };
+
+    /**
+     * @brief 路径 → 槽位的驻留表（每种资源一张，进程内唯一）
+     * 代数从 1 开始，句柄值因此永远不为 0；槽位与路径一旦分配就不回收，retire 只递增代数。
+     */
+    template <typename Tag>
+    class ResourceHandleRegistry
+    {
+    public:
+        using Handle = ResourceHandle<Tag>;
+
+        static ResourceHandleRegistry &shared()
+        {
+            static ResourceHandleRegistry registry;
+            return registry;
+        }
+
+        // 取得路径的当前句柄，首次出现时分配槽位；空路径返回空句柄
+        Handle acquire(const std::string &path)
+        {
+            if (path.empty())
+                return {};
+            auto [it, inserted] = _indices.try_emplace(path, static_cast<uint32_t>(_paths.size()));
+            if (inserted)
+            {
+                _paths.push_back(path);
+                _generations.push_back(1);
+            }
+            return Handle::make(it->second, _generations[it->second]);
+        }
+
+        // 只查不分配；路径从未出现过时返回空句柄
+        Handle find(const std::string &path) const
+        {
+            auto it = _indices.find(path);
+            return it == _indices.end() ? Handle{} : Handle::make(it->second, _generations[it->second]);
+        }
+
+        bool isCurrent(Handle handle) const
+        {
+            const uint32_t index = handle.index();
+            return handle.isValid() && index < _generations.size() && _generations[index] == handle.generation();
+        }
+
+        // 槽位对应的路径（与代数无关，过期句柄也能取到，便于报错）
+        const std::string &path(Handle handle) const
+        {
+            static const std::string empty;
+            return handle.index() < _paths.size() ? _paths[handle.index()] : empty;
+        }
+
+        // 资源被卸载：代数加一（跳过 0），此前发出的句柄全部过期
+        void retire(uint32_t index)
+        {
+            if (index >= _generations.size())
+                return;
+            uint16_t &generation = _generations[index];
+            generation = static_cast<uint16_t>(generation % Handle::GENERATION_MASK + 1);
+        }
+
+        size_t size() const { return _paths.size(); }
+
+    private:
+        ResourceHandleRegistry() = default;
+
+        std::unordered_map<std::string, uint32_t> _indices;
+        std::vector<std::string> _paths;
+        std::vector<uint16_t> _generations;
+    };
+
+    struct TextureTag;
+    using TextureHandle = ResourceHandle<TextureTag>;
+    using TextureRegistry = ResourceHandleRegistry<TextureTag>;
+} // namespace engine::resource
@@ -46,6 +46,18 @@ namespace engine::resource
         spdlog::info("ResourceManager init 完成。后端: {}", _gpu_device ? "SDL_GPU" : "SDL_Renderer");
     }
 
+    void ResourceManager::initHeadless()
+    {
+        _renderer = nullptr;
+        _gpu_device = nullptr;
+        if (_texture_manager)
+        {
+            _texture_manager->setDevice(nullptr, nullptr);
+            _texture_manager->setHeadless(true);
+        }
+        spdlog::info("ResourceManager: 无图形后端模式");
+    }
+
     ResourceManager::ResourceManager(SDL_Renderer *renderer, SDL_GPUDevice *device)
         : _renderer(renderer), _gpu_device(device)
     {
@@ -111,6 +123,52 @@ namespace engine::resource
         return {0.0f, 0.0f};
     }
 
+    TextureHandle ResourceManager::getTextureHandle(const std::string &path)
+    {
+        return TextureManager::getHandle(path);
+    }
+
+    SDL_Texture *ResourceManager::getTexture(TextureHandle handle)
+    {
+        return _texture_manager->getLegacyTexture(handle);
+    }
+
+    SDL_GPUTexture *ResourceManager::getGPUTexture(TextureHandle handle)
+    {
+        return _texture_manager->getGPUTexture(handle);
+    }
+
+    unsigned int ResourceManager::getGLTexture(TextureHandle handle)
+    {
+        return _texture_manager->getGLTexture(handle);
+    }
+
+    TextureResource *ResourceManager::getTextureResource(TextureHandle handle)
+    {
+        return _texture_manager->getTextureResource(handle);
+    }
+
+    glm::vec2 ResourceManager::getTextureSize(TextureHandle handle)
+    {
+        return _texture_manager ? _texture_manager->getTextureSize(handle) : glm::vec2{0.0f, 0.0f};
+    }
+
+    TextureResource *ResourceManager::requestTexture(const std::string &path, int priority)
+    {
+        return _texture_manager ? _texture_manager->requestTexture(path, priority) : nullptr;
+    }
+
+    bool ResourceManager::cancelTexture(const std::string &path)
+    {
+        return _texture_manager && _texture_manager->cancelTexture(path);
+    }
+
+    void ResourceManager::processTextureUploads(size_t byteBudget)
+    {
+        if (_texture_manager)
+            _texture_manager->processUploads(byteBudget);
+    }
+
     MIX_Audio *ResourceManager::getAudio(const std::string &path)
     {
         return _audio_manager->getAudio(path);
@@ -126,6 +184,16 @@ namespace engine::resource
         _audio_manager->unloadAudio(path);
     }
 
+    engine::audio::SoundBank *ResourceManager::getSoundBank()
+    {
+        return _audio_manager ? _audio_manager->getSoundBank() : nullptr;
+    }
+
+    engine::audio::VoicePool *ResourceManager::getVoicePool()
+    {
+        return _audio_manager ? _audio_manager->getVoicePool() : nullptr;
+    }
+
     SDL_GPUShader *ResourceManager::loadShader(
         const std::string &name,
         const std::string &path,
@@ -156,11 +224,24 @@ namespace engine::resource
         stats.hasGPUDevice = _gpu_device != nullptr;
         stats.hasDefaultSampler = _default_sampler != nullptr;
         if (_texture_manager)
-            stats.textureCount = _texture_manager->_cache.size();
+        {
+            stats.textureCount = _texture_manager->_live_count;
+            stats.textureHandleCount = TextureRegistry::shared().size();
+            stats.pendingTextureCount = _texture_manager->_pending.size();
+            stats.textureUploadBytesLastFrame = _texture_manager->_upload_bytes_last_frame;
+        }
         if (_audio_manager)
         {
             stats.audioCount = _audio_manager->_audios.size();
             stats.musicCount = _audio_manager->_tracks.size();
+            if (_audio_manager->_sound_bank)
+                stats.soundCount = _audio_manager->_sound_bank->size();
+            if (_audio_manager->_voice_pool)
+            {
+                const auto voices = _audio_manager->_voice_pool->getStats();
+                stats.activeVoices = voices.activeVoices;
+                stats.voiceCount = voices.voiceCount;
+            }
         }
         if (_font_manager)
             stats.fontCount = _font_manager->_renderers.size();
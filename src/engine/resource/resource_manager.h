@@ -4,6 +4,7 @@
 #include <string>
 #include <glm/glm.hpp>
 #include <SDL3/SDL_gpu.h>
+#include "resource_handle.h"
 
 // --- 前向声明 ---
 // SDL 相关
@@ -18,6 +19,12 @@ typedef struct _Mix_Music Mix_Music;
 struct MIX_Audio;
 struct MIX_Mixer;
 
+namespace engine::audio
+{
+    class SoundBank;
+    class VoicePool;
+}
+
 namespace engine::resource
 {
     // 子管理器前向声明
@@ -53,13 +60,24 @@ namespace engine::resource
             bool hasGPUDevice = false;
             bool hasDefaultSampler = false;
             size_t textureCount = 0;
+            size_t textureHandleCount = 0; // 已驻留的纹理路径数
+            size_t pendingTextureCount = 0; // 异步请求中（排队 / 解码 / 待上传）
+            size_t textureUploadBytesLastFrame = 0;
             size_t audioCount = 0;
             size_t musicCount = 0;
+            size_t soundCount = 0;  // 音效库中已预解码的音效
+            int activeVoices = 0;
+            int voiceCount = 0;
             size_t fontCount = 0;
             size_t shaderCount = 0;
         };
 
         void init(SDL_Renderer *renderer, SDL_GPUDevice *device);
+        /**
+         * @brief 无图形后端模式（headless 基准 / 工具）：纹理只解码取尺寸并分配占位 ID，不创建任何 GPU 对象
+         * 区块网格、精灵等依赖纹理尺寸的 CPU 路径照常运行；配合 NullRenderer 使用
+         */
+        void initHeadless();
         /**
          * @brief 构造函数
          * @param renderer 旧版渲染器指针（若不使用则传 nullptr）
@@ -88,6 +106,22 @@ namespace engine::resource
         TextureResource *getTextureResource(const std::string &path);
         glm::vec2 getTextureSize(const std::string &path);
 
+        /** @brief 驻留纹理路径得到句柄（不加载）；在加载期取一次，帧内用句柄查询 */
+        TextureHandle getTextureHandle(const std::string &path);
+        // 句柄版本：O(1) 数组寻址，不哈希字符串
+        SDL_Texture *getTexture(TextureHandle handle);
+        SDL_GPUTexture *getGPUTexture(TextureHandle handle);
+        unsigned int getGLTexture(TextureHandle handle);
+        TextureResource *getTextureResource(TextureHandle handle);
+        glm::vec2 getTextureSize(TextureHandle handle);
+
+        /** @brief 异步请求纹理：立即返回（上传完成前为占位纹理），priority 越大越先加载；无渲染后端时返回 nullptr */
+        TextureResource *requestTexture(const std::string &path, int priority = 0);
+        /** @brief 取消尚未完成的异步请求 */
+        bool cancelTexture(const std::string &path);
+        /** @brief 渲染线程每帧调用：在字节预算内上传已解码的纹理 */
+        void processTextureUploads(size_t byteBudget);
+
         SDL_GPUDevice* getGPUDevice() const { return _gpu_device; }
 
         // --- 音频资源接口 ---
@@ -102,6 +136,10 @@ namespace engine::resource
         MIX_Audio *loadAudio(const std::string &path);
         void unloadAudio(const std::string &path);
 
+        /** @brief 预解码音效库与语音池；没有混音器时为 nullptr。游戏音效应走这里而不是 getAudio + MIX_PlayAudio */
+        engine::audio::SoundBank *getSoundBank();
+        engine::audio::VoicePool *getVoicePool();
+
         // --- 字体资源接口 ---
         FontManager& getFontManager() { return *_font_manager; }
 
@@ -1,10 +1,19 @@
 #pragma once
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_gpu.h>
+#include <cstdint>
 #include <string>
 
 namespace engine::resource
 {
+    // 纹理加载状态（异步请求在上传完成前为 Pending，期间各句柄指向共享的占位纹理）
+    enum class TextureState : uint8_t
+    {
+        Ready = 0,
+        Pending,
+        Failed,
+    };
+
     // 纹理资源包
     struct TextureResource
     {
@@ -12,6 +21,9 @@ namespace engine::resource
         SDL_GPUTexture *gpu_tex = nullptr; // 对应之前的 gpu
         unsigned int gl_tex = 0;           // OpenGL 纹理 ID
         glm::vec2 size = {0.0f, 0.0f};     // 统一使用 glm::vec2 方便计算
+        TextureState state = TextureState::Ready;
+
+        bool isReady() const { return state == TextureState::Ready; }
 
         void release(SDL_Renderer *ren, SDL_GPUDevice *dev);
     };
@@ -32,12 +32,21 @@
 #ifndef GL_TEXTURE_WRAP_T
 #define GL_TEXTURE_WRAP_T 0x2803
 #endif
+#include <algorithm>
 #include <spdlog/spdlog.h>
 
 namespace engine::resource
 {
     void TextureResource::release(SDL_Renderer *ren, SDL_GPUDevice *dev)
     {
+        if (state != TextureState::Ready)
+        {
+            // Pending 条目借用占位纹理，Failed 条目没有纹理，都不归本条目释放
+            sdl_tex = nullptr;
+            gpu_tex = nullptr;
+            gl_tex = 0;
+            return;
+        }
         if (sdl_tex)
         {
             SDL_DestroyTexture(sdl_tex);
@@ -65,72 +74,159 @@ namespace engine::resource
     TextureManager::~TextureManager()
     {
         clearTextures();
+        for (TextureLoadJob *job : _decoded)
+            TextureStreamer::destroyJob(job);
+        _decoded.clear();
+        _streamer.reset();
+        _placeholder.release(_renderer, _gpu_device);
     }
 
     // --- 实现头文件中声明的所有公开接口 ---
 
     SDL_Texture *TextureManager::getLegacyTexture(const std::string &path)
     {
-        return getInternal(path).sdl_tex; // 注意这里是 sdl_tex
+        return getLegacyTexture(getHandle(path));
     }
 
     SDL_GPUTexture *TextureManager::getGPUTexture(const std::string &path)
     {
-        return getInternal(path).gpu_tex; // 注意这里是 gpu_tex
+        return getGPUTexture(getHandle(path));
     }
 
     unsigned int TextureManager::getGLTexture(const std::string &path)
     {
-        return getInternal(path).gl_tex;
+        return getGLTexture(getHandle(path));
     }
 
     TextureResource *TextureManager::getTextureResource(const std::string &path)
     {
-        return &getInternal(path); // 注意这里是整个 TextureResource 对象
+        return getTextureResource(getHandle(path));
     }
 
     glm::vec2 TextureManager::getTextureSize(const std::string &path)
     {
-        auto &res = getInternal(path);
-        return res.size;
+        return getTextureSize(getHandle(path));
+    }
+
+    SDL_Texture *TextureManager::getLegacyTexture(TextureHandle handle)
+    {
+        return getInternal(handle).sdl_tex; // 注意这里是 sdl_tex
+    }
+
+    SDL_GPUTexture *TextureManager::getGPUTexture(TextureHandle handle)
+    {
+        return getInternal(handle).gpu_tex; // 注意这里是 gpu_tex
+    }
+
+    unsigned int TextureManager::getGLTexture(TextureHandle handle)
+    {
+        return getInternal(handle).gl_tex;
+    }
+
+    TextureResource *TextureManager::getTextureResource(TextureHandle handle)
+    {
+        return &getInternal(handle); // 注意这里是整个 TextureResource 对象
+    }
+
+    glm::vec2 TextureManager::getTextureSize(TextureHandle handle)
+    {
+        return getInternal(handle).size;
     }
 
     void TextureManager::unloadTexture(const std::string &path)
     {
-        if (auto it = _cache.find(path); it != _cache.end())
+        const TextureHandle handle = TextureRegistry::shared().find(path);
+        if (handle.isValid())
+            unloadSlot(handle.index());
+    }
+
+    void TextureManager::clearTextures()
+    {
+        for (uint32_t index = 0; index < _slot_live.size(); ++index)
         {
-            it->second.release(_renderer, _gpu_device);
-            _cache.erase(it);
+            if (_slot_live[index])
+                unloadSlot(index);
         }
     }
 
-    void TextureManager::clearTextures()
+    void TextureManager::unloadSlot(uint32_t index)
     {
-        for (auto &[path, res] : _cache)
+        if (index >= _slot_live.size() || !_slot_live[index])
+            return;
+        if (auto pending = _pending.find(index); pending != _pending.end())
         {
-            res.release(_renderer, _gpu_device);
+            TextureStreamer::cancel(pending->second);
+            _pending.erase(pending);
         }
-        _cache.clear();
+        _slots[index].release(_renderer, _gpu_device);
+        _slots[index] = TextureResource{};
+        _slot_live[index] = 0;
+        --_live_count;
+        TextureRegistry::shared().retire(index);
     }
 
     // --- 核心逻辑 ---
 
-    TextureResource &TextureManager::getInternal(const std::string &path)
+    TextureResource &TextureManager::slot(uint32_t index)
     {
-        auto it = _cache.find(path);
-        if (it == _cache.end())
+        if (index >= _slots.size())
         {
-            if ((!_renderer && !_gpu_device && !_use_opengl) || !forceLoad(path))
-            {
-                static TextureResource empty; // 失败时返回一个空对象，防止崩溃
+            const size_t count = std::max<size_t>(index + 1, TextureRegistry::shared().size());
+            _slots.resize(count);
+            _slot_live.resize(count, 0);
+        }
+        return _slots[index];
+    }
+
+    TextureResource &TextureManager::getInternal(TextureHandle handle)
+    {
+        static TextureResource empty; // 失败时返回一个空对象，防止崩溃
+        if (!handle.isValid())
+            return empty;
+
+        const TextureRegistry &registry = TextureRegistry::shared();
+#ifndef NDEBUG
+        // 过期句柄：纹理被卸载后仍在使用旧句柄，Release 下按路径透明重载，Debug 下报错并返回空纹理
+        if (!registry.isCurrent(handle))
+        {
+            spdlog::error("TextureManager: 过期的纹理句柄 {:#010x}（{}）", handle.value, registry.path(handle));
+            return empty;
+        }
+#endif
+        const uint32_t index = handle.index();
+        TextureResource &res = slot(index);
+        if (!_slot_live[index])
+        {
+            if (!_renderer && !_gpu_device && !_use_opengl && !_headless)
                 return empty;
+            // 失败也记为 Failed 条目，之后的每帧查询不再重复读盘
+            if (!forceLoad(registry.path(handle), res))
+            {
+                res = TextureResource{};
+                res.state = TextureState::Failed;
             }
-            return _cache[path];
+            _slot_live[index] = 1;
+            ++_live_count;
+            return res;
         }
-        return it->second;
+        if (res.state == TextureState::Pending)
+        {
+            // 同步接口不返回占位纹理：放弃在途的异步任务，当场加载（原地写回，异步句柄仍然有效）
+            if (auto pending = _pending.find(index); pending != _pending.end())
+            {
+                TextureStreamer::cancel(pending->second);
+                _pending.erase(pending);
+            }
+            if (!forceLoad(registry.path(handle), res))
+            {
+                res = TextureResource{};
+                res.state = TextureState::Failed;
+            }
+        }
+        return res;
     }
 
-    bool TextureManager::forceLoad(const std::string &path)
+    bool TextureManager::forceLoad(const std::string &path, TextureResource &res)
     {
         spdlog::info("TextureManager实例地址: {} | 成功加载: {}", (void*)this, path);
         SDL_Surface *surf = IMG_Load(path.c_str());
@@ -143,7 +239,14 @@ namespace engine::resource
         if (!converted)
             return false;
 
-        TextureResource res;
+        res = TextureResource{};
+        createTextures(converted, res);
+        SDL_DestroySurface(converted);
+        return true;
+    }
+
+    void TextureManager::createTextures(SDL_Surface *converted, TextureResource &res)
+    {
         res.size = glm::vec2(converted->w, converted->h);
 
         if (_renderer)
@@ -167,10 +270,10 @@ namespace engine::resource
         {
             res.gl_tex = uploadToGL(converted);
         }
-
-        SDL_DestroySurface(converted);
-        _cache[path] = res;
-        return true;
+        else if (_headless)
+        {
+            res.gl_tex = ++_headless_next_id;
+        }
     }
 
     SDL_GPUTexture *TextureManager::uploadToGPU(SDL_Surface *surface)
@@ -229,4 +332,155 @@ namespace engine::resource
         glBindTexture(GL_TEXTURE_2D, 0);
         return texId;
     }
-}
\ No newline at end of file
+
+    // --- 异步流送 ---
+
+    TextureResource *TextureManager::requestTexture(const std::string &path, int priority)
+    {
+        const TextureHandle handle = getHandle(path);
+        if (!handle.isValid())
+            return nullptr;
+        const uint32_t index = handle.index();
+        TextureResource &res = slot(index);
+        if (_slot_live[index])
+        {
+            if (auto pending = _pending.find(index); pending != _pending.end() && priority > pending->second->priority)
+                _streamer->setPriority(pending->second, priority);
+            return &res;
+        }
+        if (!_renderer && !_gpu_device && !_use_opengl && !_headless)
+            return nullptr;
+
+        if (!_streamer)
+            _streamer = std::make_unique<TextureStreamer>();
+
+        const TextureResource &fallback = placeholder();
+        res.sdl_tex = fallback.sdl_tex;
+        res.gpu_tex = fallback.gpu_tex;
+        res.gl_tex = fallback.gl_tex;
+        res.size = fallback.size;
+        res.state = TextureState::Pending;
+        _slot_live[index] = 1;
+        ++_live_count;
+
+        TextureLoadJob *job = _streamer->submit(path, priority);
+        job->slot = index;
+        _pending[index] = job;
+        return &res;
+    }
+
+    bool TextureManager::cancelTexture(const std::string &path)
+    {
+        const TextureHandle handle = TextureRegistry::shared().find(path);
+        if (!handle.isValid() || _pending.find(handle.index()) == _pending.end())
+            return false;
+        unloadSlot(handle.index());
+        return true;
+    }
+
+    void TextureManager::processUploads(size_t byteBudget)
+    {
+        _upload_bytes_last_frame = 0;
+        _uploads_last_frame = 0;
+        if (!_streamer)
+            return;
+
+        while (TextureLoadJob *job = _streamer->popCompleted())
+            _decoded.push_back(job);
+        if (_decoded.empty())
+            return;
+
+        std::sort(_decoded.begin(), _decoded.end(), [](const TextureLoadJob *a, const TextureLoadJob *b)
+                  { return a->priority != b->priority ? a->priority > b->priority : a->order < b->order; });
+
+        size_t consumed = 0;
+        size_t processed = 0;
+        for (; processed < _decoded.size(); ++processed)
+        {
+            TextureLoadJob *job = _decoded[processed];
+            if (job->cancelled.load(std::memory_order_relaxed))
+            {
+                ++_cancelled_total;
+                TextureStreamer::destroyJob(job);
+                continue;
+            }
+
+            const size_t bytes = job->surface ? static_cast<size_t>(job->surface->w) * static_cast<size_t>(job->surface->h) * 4 : 0;
+            if (_uploads_last_frame > 0 && consumed + bytes > byteBudget)
+                break;
+            consumed += bytes;
+            finishLoad(job);
+        }
+        _decoded.erase(_decoded.begin(), _decoded.begin() + static_cast<std::ptrdiff_t>(processed));
+        _upload_bytes_last_frame = consumed;
+    }
+
+    void TextureManager::finishLoad(TextureLoadJob *job)
+    {
+        auto pending = _pending.find(job->slot);
+        if (pending == _pending.end() || pending->second != job)
+        {
+            TextureStreamer::destroyJob(job);
+            return;
+        }
+        _pending.erase(pending);
+
+        // 原地替换，之前 requestTexture 返回的指针随之看到真实纹理
+        TextureResource &res = _slots[job->slot];
+        res = TextureResource{};
+        if (job->surface)
+        {
+            createTextures(job->surface, res);
+            ++_uploaded_total;
+            ++_uploads_last_frame;
+        }
+        else
+        {
+            res.state = TextureState::Failed;
+            ++_failed_total;
+            spdlog::warn("TextureManager: 异步加载失败 {}", job->path);
+        }
+        TextureStreamer::destroyJob(job);
+    }
+
+    const TextureResource &TextureManager::placeholder()
+    {
+        if (_placeholder_created)
+            return _placeholder;
+        _placeholder_created = true;
+
+        // 8x8 灰色棋盘格
+        constexpr int kSize = 8;
+        SDL_Surface *surface = SDL_CreateSurface(kSize, kSize, SDL_PIXELFORMAT_RGBA32);
+        if (!surface)
+            return _placeholder;
+        for (int y = 0; y < kSize; ++y)
+        {
+            auto *row = static_cast<uint8_t *>(surface->pixels) + y * surface->pitch;
+            for (int x = 0; x < kSize; ++x)
+            {
+                const uint8_t shade = ((x / 4 + y / 4) & 1) ? 0x90 : 0x60;
+                row[x * 4 + 0] = shade;
+                row[x * 4 + 1] = shade;
+                row[x * 4 + 2] = shade;
+                row[x * 4 + 3] = 0xFF;
+            }
+        }
+        createTextures(surface, _placeholder);
+        SDL_DestroySurface(surface);
+        return _placeholder;
+    }
+
+    TextureStreamStats TextureManager::getStreamStats() const
+    {
+        TextureStreamStats stats;
+        if (_streamer)
+            stats = _streamer->getStats();
+        stats.uploadedTotal = _uploaded_total;
+        stats.cancelledTotal = _cancelled_total;
+        stats.failedTotal = _failed_total;
+        stats.uploadBytesLastFrame = _upload_bytes_last_frame;
+        stats.uploadsLastFrame = _uploads_last_frame;
+        return stats;
+    }
+}
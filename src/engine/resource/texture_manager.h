@@ -1,14 +1,18 @@
 #pragma once
 
+#include <deque>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_gpu.h>
 #include <glm/glm.hpp>
 
 // ⚡️ 引入你存放结构体的头文件
+#include "resource_handle.h"
 #include "resource_types.h"
+#include "texture_streamer.h"
 
 namespace engine::resource
 {
@@ -24,12 +28,24 @@ namespace engine::resource
         TextureManager(const TextureManager &) = delete;
         TextureManager &operator=(const TextureManager &) = delete;
 
-        // 公开接口
+        // 公开接口（字符串版本：先驻留路径得到句柄，再走句柄版本）
         SDL_Texture *getLegacyTexture(const std::string &path);
         SDL_GPUTexture *getGPUTexture(const std::string &path);
         unsigned int getGLTexture(const std::string &path);
         TextureResource *getTextureResource(const std::string &path);
         glm::vec2 getTextureSize(const std::string &path);
+
+        // --- 句柄接口（帧内使用）---
+
+        /** @brief 驻留路径并返回句柄，不触发加载；在加载期调用一次，结果保存在 Sprite 等组件里 */
+        static TextureHandle getHandle(const std::string &path) { return TextureRegistry::shared().acquire(path); }
+
+        // 按槽位下标直接寻址，不哈希字符串；首次访问时按驻留的路径同步加载
+        SDL_Texture *getLegacyTexture(TextureHandle handle);
+        SDL_GPUTexture *getGPUTexture(TextureHandle handle);
+        unsigned int getGLTexture(TextureHandle handle);
+        TextureResource *getTextureResource(TextureHandle handle);
+        glm::vec2 getTextureSize(TextureHandle handle);
         void unloadTexture(const std::string &path);
         void clearTextures();
         void setDevice(SDL_Renderer *renderer, SDL_GPUDevice *device)
@@ -38,25 +54,72 @@ namespace engine::resource
             _gpu_device = device;
         }
         void setUseOpenGL(bool use) { _use_opengl = use; }
+        // 无图形后端：只记录尺寸，gl_tex 填占位 ID（不对应任何 GL 对象，释放时因无 GL 上下文而跳过）
+        void setHeadless(bool headless) { _headless = headless; }
+
+        // --- 异步流送 ---
+
+        /**
+         * @brief 异步请求纹理，立即返回资源指针（与 getTextureResource 同一对象，unload 前保持有效）
+         * 上传完成前各句柄指向共享的占位纹理、state 为 Pending；完成后原地替换为真实纹理。
+         * 已缓存则直接返回；重复请求只会提高排队中任务的优先级。
+         * @param priority 越大越先解码与上传
+         */
+        TextureResource *requestTexture(const std::string &path, int priority = 0);
+        /** @brief 取消尚未上传的请求并移除占位条目（等同于对 Pending 纹理 unload）；已就绪返回 false */
+        bool cancelTexture(const std::string &path);
+        /**
+         * @brief 渲染线程每帧调用：按优先级上传已解码的纹理，累计字节超过 byteBudget 即停止
+         * 每帧至少上传一张，超出预算的大图也能前进
+         */
+        void processUploads(size_t byteBudget);
+        TextureStreamStats getStreamStats() const;
 
     private:
         // 核心逻辑：获取内部包装资源
-        TextureResource &getInternal(const std::string &path);
+        TextureResource &getInternal(TextureHandle handle);
 
-        // 强制从磁盘加载
-        bool forceLoad(const std::string &path);
+        // 强制从磁盘加载，结果写入 res
+        bool forceLoad(const std::string &path, TextureResource &res);
+
+        // 槽位数组按驻留表的大小扩容，返回 index 对应的槽位
+        TextureResource &slot(uint32_t index);
+        // 释放槽位上的纹理、取消在途任务，并使该路径此前发出的句柄过期
+        void unloadSlot(uint32_t index);
+
+        // 为已转成 RGBA32 的表面创建各后端纹理
+        void createTextures(SDL_Surface *converted, TextureResource &res);
 
         // GPU 上传辅助逻辑
         SDL_GPUTexture *uploadToGPU(SDL_Surface *surface);
 
+        // 占位纹理（首次异步请求时创建，所有 Pending 条目共享）
+        const TextureResource &placeholder();
+        void finishLoad(TextureLoadJob *job);
+
         // 保持简洁，不要重复定义成员变量
         SDL_Renderer *_renderer = nullptr;
         SDL_GPUDevice *_gpu_device = nullptr;
         bool _use_opengl = false;
+        bool _headless = false;
+        unsigned int _headless_next_id = 0;
 
-        // 使用 resource_types.h 中定义的 TextureResource
-        std::unordered_map<std::string, TextureResource> _cache;
+        // 按句柄槽位下标存放（deque 扩容不移动元素，requestTexture 返回的指针保持有效）
+        std::deque<TextureResource> _slots;
+        std::vector<uint8_t> _slot_live; // 槽位上是否有条目（Ready / Pending / Failed）
+        size_t _live_count = 0;
 
         unsigned int uploadToGL(SDL_Surface *surface);
+
+        std::unique_ptr<TextureStreamer> _streamer;              // 首次异步请求时启动
+        std::unordered_map<uint32_t, TextureLoadJob *> _pending;    // 槽位 → 已提交、尚未上传的任务（渲染线程独占）
+        std::vector<TextureLoadJob *> _decoded;                    // 已解码、等待预算上传
+        TextureResource _placeholder;
+        bool _placeholder_created = false;
+        uint64_t _uploaded_total = 0;
+        uint64_t _cancelled_total = 0;
+        uint64_t _failed_total = 0;
+        size_t _upload_bytes_last_frame = 0;
+        int _uploads_last_frame = 0;
     };
 } // namespace engine::resource
\ No newline at end of file
@@ -0,0 +1,148 @@
+#include "texture_streamer.h"
+#include "../core/profiler.h"
+#include <SDL3_image/SDL_image.h>
+#include <SDL3/SDL.h>
+#include <algorithm>
+#include <chrono>
+#include <spdlog/spdlog.h>
+
+namespace engine::resource
+{
+    TextureStreamer::TextureStreamer(int workerCount)
+    {
+        if (workerCount <= 0)
+        {
+            const unsigned hw = std::thread::hardware_concurrency();
+            workerCount = std::clamp(static_cast<int>(hw) - 2, 1, 2);
+        }
+
+        _workers.reserve(static_cast<size_t>(workerCount));
+        for (int i = 0; i < workerCount; ++i)
+            _workers.emplace_back([this] { workerLoop(); });
+
+        spdlog::debug("[TextureStreamer] started {} worker(s)", workerCount);
+    }
+
+    TextureStreamer::~TextureStreamer()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopping = true;
+            for (TextureLoadJob *job : _queue)
+                destroyJob(job);
+            _queue.clear();
+            _queued_count.store(0, std::memory_order_relaxed);
+        }
+        _wake_cv.notify_all();
+        for (auto &worker : _workers)
+        {
+            if (worker.joinable())
+                worker.join();
+        }
+
+        while (TextureLoadJob *job = _completed.pop())
+            destroyJob(job);
+    }
+
+    TextureLoadJob *TextureStreamer::submit(const std::string &path, int priority)
+    {
+        auto *job = new TextureLoadJob();
+        job->path = path;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            job->priority = priority;
+            job->order = _next_order++;
+            _queue.push_back(job);
+            std::push_heap(_queue.begin(), _queue.end(), lowerPriority);
+            _queued_count.fetch_add(1, std::memory_order_relaxed);
+        }
+        _wake_cv.notify_one();
+        return job;
+    }
+
+    void TextureStreamer::setPriority(TextureLoadJob *job, int priority)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (job->priority == priority)
+            return;
+        // 只有仍在堆里的任务需要重排；已出队的任务只记录新值，供上传排序使用
+        job->priority = priority;
+        if (std::find(_queue.begin(), _queue.end(), job) != _queue.end())
+            std::make_heap(_queue.begin(), _queue.end(), lowerPriority);
+    }
+
+    TextureLoadJob *TextureStreamer::popCompleted()
+    {
+        TextureLoadJob *job = _completed.pop();
+        if (job)
+            _completed_count.fetch_sub(1, std::memory_order_relaxed);
+        return job;
+    }
+
+    void TextureStreamer::destroyJob(TextureLoadJob *job)
+    {
+        if (!job)
+            return;
+        if (job->surface)
+            SDL_DestroySurface(job->surface);
+        delete job;
+    }
+
+    TextureStreamStats TextureStreamer::getStats() const
+    {
+        TextureStreamStats stats;
+        stats.queuedJobs = _queued_count.load(std::memory_order_relaxed);
+        stats.activeJobs = _active_count.load(std::memory_order_relaxed);
+        stats.completedJobs = _completed_count.load(std::memory_order_relaxed);
+        const uint64_t count = _decode_count.load(std::memory_order_relaxed);
+        stats.decodeAvgMs = count ? static_cast<float>(static_cast<double>(_decode_micros.load(std::memory_order_relaxed)) /
+                                                       static_cast<double>(count) / 1000.0)
+                                  : 0.0f;
+        return stats;
+    }
+
+    void TextureStreamer::workerLoop()
+    {
+        LSL_PROFILE_THREAD("TextureStreamer");
+        for (;;)
+        {
+            TextureLoadJob *job = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _wake_cv.wait(lock, [this] { return _stopping || !_queue.empty(); });
+                if (_stopping)
+                    return;
+                std::pop_heap(_queue.begin(), _queue.end(), lowerPriority);
+                job = _queue.back();
+                _queue.pop_back();
+                _queued_count.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            _active_count.fetch_add(1, std::memory_order_relaxed);
+            decode(*job);
+            _active_count.fetch_sub(1, std::memory_order_relaxed);
+
+            _completed_count.fetch_add(1, std::memory_order_relaxed);
+            _completed.push(job);
+        }
+    }
+
+    void TextureStreamer::decode(TextureLoadJob &job)
+    {
+        LSL_PROFILE_ZONE("TextureStreamer::decode");
+        if (job.cancelled.load(std::memory_order_relaxed))
+            return;
+
+        const auto start = std::chrono::steady_clock::now();
+        SDL_Surface *surface = IMG_Load(job.path.c_str());
+        if (surface && !job.cancelled.load(std::memory_order_relaxed))
+            job.surface = SDL_ConvertSurface(surface, SDL_PIXELFORMAT_RGBA32);
+        if (surface)
+            SDL_DestroySurface(surface);
+
+        const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        job.decodeMs = static_cast<float>(micros) / 1000.0f;
+        _decode_micros.fetch_add(static_cast<uint64_t>(micros), std::memory_order_relaxed);
+        _decode_count.fetch_add(1, std::memory_order_relaxed);
+    }
+} // namespace engine::resource
@@ -0,0 +1,111 @@
+// 纹理异步流送
+// texture_streamer.h
+//   阶段 1（工作线程）：IMG_Load 读盘解码 + SDL_ConvertSurface 转 RGBA32，按优先级出队
+//   阶段 2（无锁完成队列）：工作线程把解码好的表面推入 MPSC 队列
+//   阶段 3（渲染线程）：TextureManager::processUploads 取出结果，在每帧字节预算内创建 GPU 纹理
+#pragma once
+#include "../utils/mpsc_queue.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct SDL_Surface;
+
+namespace engine::resource
+{
+    /**
+     * @brief 单张纹理的解码任务
+     * 生命周期：submit 创建 → 工作线程解码 → 完成队列 → 渲染线程 popCompleted 取回、上传并释放。
+     * 被取消的任务同样会经过完成队列回到渲染线程，只是表面被丢弃。
+     */
+    struct TextureLoadJob
+    {
+        std::string path;
+        uint32_t slot = 0;  // TextureManager 的句柄槽位，解码线程不读取
+        int priority = 0;   // 越大越先解码 / 上传；受流送器互斥锁保护
+        uint64_t order = 0; // 同优先级按提交顺序
+        std::atomic<bool> cancelled{false};
+
+        SDL_Surface *surface = nullptr; // RGBA32；解码失败为 nullptr
+        float decodeMs = 0.0f;
+
+        std::atomic<TextureLoadJob *> next{nullptr}; // MpscQueue 侵入式链接
+    };
+
+    /**
+     * @brief 流送统计（供调试面板读取），计数为自启动以来的总量
+     */
+    struct TextureStreamStats
+    {
+        size_t queuedJobs = 0;    // 等待解码
+        size_t activeJobs = 0;    // 工作线程解码中
+        size_t completedJobs = 0; // 已解码、等待渲染线程上传
+        uint64_t uploadedTotal = 0;
+        uint64_t cancelledTotal = 0;
+        uint64_t failedTotal = 0;
+        float decodeAvgMs = 0.0f;
+        size_t uploadBytesLastFrame = 0;
+        int uploadsLastFrame = 0;
+    };
+
+    class TextureStreamer
+    {
+    public:
+        // workerCount <= 0 时按硬件线程数自动选择（最多 2 个，读盘解码不需要更多）
+        explicit TextureStreamer(int workerCount = 0);
+        ~TextureStreamer();
+
+        TextureStreamer(const TextureStreamer &) = delete;
+        TextureStreamer &operator=(const TextureStreamer &) = delete;
+
+        // 提交解码任务，返回的指针用于 cancel / setPriority；所有权在 popCompleted 时交还调用方
+        TextureLoadJob *submit(const std::string &path, int priority);
+
+        // 调整仍在排队的任务的优先级；已开始解码的任务不受影响
+        void setPriority(TextureLoadJob *job, int priority);
+
+        // 标记取消（线程安全）。排队中的任务不再解码，解码中的任务结果被丢弃
+        static void cancel(TextureLoadJob *job)
+        {
+            if (job)
+                job->cancelled.store(true, std::memory_order_relaxed);
+        }
+
+        // 渲染线程：取出一个已完成（或已取消）的任务，调用方负责 destroyJob
+        TextureLoadJob *popCompleted();
+        // 释放任务及其表面
+        static void destroyJob(TextureLoadJob *job);
+
+        TextureStreamStats getStats() const;
+        int workerCount() const { return static_cast<int>(_workers.size()); }
+
+    private:
+        void workerLoop();
+        void decode(TextureLoadJob &job);
+
+        // 堆顶为优先级最高、提交最早的任务
+        static bool lowerPriority(const TextureLoadJob *a, const TextureLoadJob *b)
+        {
+            return a->priority != b->priority ? a->priority < b->priority : a->order > b->order;
+        }
+
+        std::vector<std::thread> _workers;
+        std::mutex _mutex;
+        std::condition_variable _wake_cv;
+        std::vector<TextureLoadJob *> _queue; // 二叉堆，受 _mutex 保护
+        uint64_t _next_order = 0;            // 受 _mutex 保护
+        bool _stopping = false;
+
+        engine::utils::MpscQueue<TextureLoadJob> _completed;
+
+        std::atomic<size_t> _queued_count{0};
+        std::atomic<size_t> _active_count{0};
+        std::atomic<size_t> _completed_count{0};
+        std::atomic<uint64_t> _decode_micros{0};
+        std::atomic<uint64_t> _decode_count{0};
+    };
+} // namespace engine::resource
@@ -3,7 +3,7 @@
 
 namespace engine::statemachine {
 
-void InputBuffer::push(const std::string& action, float currentTime)
+void InputBuffer::push(TriggerId action, float currentTime)
 {
     // 避免同一帧重复推入同一指令
     if (!m_buffer.empty())
@@ -29,7 +29,7 @@ void InputBuffer::update(float currentTime)
     }
 }
 
-bool InputBuffer::consume(const std::string& action, float currentTime)
+bool InputBuffer::consume(TriggerId action, float currentTime)
 {
     float cutoff = currentTime - windowSeconds;
     for (auto& e : m_buffer)
@@ -43,7 +43,7 @@ bool InputBuffer::consume(const std::string& action, float currentTime)
     return false;
 }
 
-bool InputBuffer::has(const std::string& action, float currentTime) const
+bool InputBuffer::has(TriggerId action, float currentTime) const
 {
     float cutoff = currentTime - windowSeconds;
     for (const auto& e : m_buffer)
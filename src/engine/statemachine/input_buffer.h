@@ -4,10 +4,12 @@
  * 存储过去 windowSeconds（默认 0.2s）内的按键输入。
  * 当动作进入连招/可取消区间时，优先消耗缓冲池中的指令，
  * 实现"提前按键也能触发连招"的手感。
+ *
+ * 指令以编译后的触发器 ID 存储（见 sm_compiled.h），由 StateController 负责名称解析。
  */
 #pragma once
 
-#include <string>
+#include "sm_compiled.h"
 #include <deque>
 
 namespace engine::statemachine {
@@ -17,16 +19,16 @@ public:
     float windowSeconds = 0.20f;  // 指令缓冲窗口（秒）
 
     /** 注册一次按键输入（通常在按键按下时调用）*/
-    void push(const std::string& action, float currentTime);
+    void push(TriggerId action, float currentTime);
 
     /** 每帧调用，清除过期条目 */
     void update(float currentTime);
 
     /** 检查并消耗缓冲池中最早一条匹配指令，成功返回 true。*/
-    bool consume(const std::string& action, float currentTime);
+    bool consume(TriggerId action, float currentTime);
 
     /** 仅检查缓冲池中是否有匹配指令（不消耗）*/
-    bool has(const std::string& action, float currentTime) const;
+    bool has(TriggerId action, float currentTime) const;
 
     /** 清空所有缓冲 */
     void clear();
@@ -35,7 +37,7 @@ public:
 
 private:
     struct Entry {
-        std::string action;
+        TriggerId   action    = INVALID_SYMBOL;
         float       timestamp = 0.0f;
         bool        consumed  = false;
     };
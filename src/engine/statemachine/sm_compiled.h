@@ -0,0 +1,150 @@
+/**
+ * sm_compiled.h  —  数据驱动状态机：编译后的运行时数据
+ *
+ * StateMachineData 以字符串为键，便于编辑器增删改；运行时每帧按字符串比较、
+ * 分配 std::string 的开销在几十个怪物同时跑 .sm.json 时不可忽视。
+ * SmLoader::compile() 把它转换成这里的紧凑形式：
+ *   - 状态 / 触发器 / 帧事件名全部驻留为稠密整数 ID（SymbolTable）
+ *   - 所有状态的转换、帧区间、帧事件、根位移各自拼成一个平坦数组，状态只记偏移和数量
+ *   - 转换在编译期按优先级降序排好，运行时不再排序
+ *   - 每帧激活的触发器用位集（TriggerMask）表示；帧事件写入控制器按本机上限预留的缓冲，不分配内存
+ *
+ * 编译结果只读，可被任意多个 StateController 通过 shared_ptr 共享。
+ */
+#pragma once
+
+#include "sm_types.h"
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace engine::statemachine {
+
+using SymbolId = uint16_t;
+using StateId   = SymbolId;
+using TriggerId = SymbolId;
+using EventId   = SymbolId;
+constexpr SymbolId INVALID_SYMBOL = 0xFFFF;
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  名称 ⇄ 稠密 ID（仅加载 / 绑定时查表，每帧只用 ID）
+// ─────────────────────────────────────────────────────────────────────────────
+class SymbolTable {
+public:
+    SymbolId intern(const std::string& name)
+    {
+        auto it = m_ids.find(name);
+        if (it != m_ids.end()) return it->second;
+        const auto id = static_cast<SymbolId>(m_names.size());
+        m_names.push_back(name);
+        m_ids.emplace(name, id);
+        return id;
+    }
+
+    SymbolId find(const std::string& name) const
+    {
+        auto it = m_ids.find(name);
+        return it != m_ids.end() ? it->second : INVALID_SYMBOL;
+    }
+
+    /** 无效 ID 返回空字符串 */
+    const std::string& name(SymbolId id) const
+    {
+        static const std::string kEmpty;
+        return id < m_names.size() ? m_names[id] : kEmpty;
+    }
+
+    size_t size() const { return m_names.size(); }
+
+private:
+    std::vector<std::string>                  m_names;
+    std::unordered_map<std::string, SymbolId> m_ids;
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  本帧激活的触发器集合（位集）
+// ─────────────────────────────────────────────────────────────────────────────
+struct TriggerMask {
+    static constexpr size_t kMaxTriggers = 256;
+
+    std::array<uint64_t, kMaxTriggers / 64> bits{};
+
+    void set(TriggerId id)
+    {
+        if (id < kMaxTriggers) bits[id >> 6] |= uint64_t(1) << (id & 63);
+    }
+    bool test(TriggerId id) const
+    {
+        return id < kMaxTriggers && (bits[id >> 6] >> (id & 63)) & 1u;
+    }
+    void clear() { bits.fill(0); }
+};
+
+struct CompiledTransition {
+    TriggerId trigger      = INVALID_SYMBOL;
+    StateId   target       = INVALID_SYMBOL;  // 目标不存在时为 INVALID_SYMBOL（消耗输入但不跳转，与旧逻辑一致）
+    int8_t    windowType   = -1;              // -1 = 不要求区间
+};
+
+struct CompiledFrameEvent {
+    int     frame = 0;
+    EventId event = INVALID_SYMBOL;
+};
+
+/** 一段平坦数组的 [begin, begin + count) */
+struct SliceRange {
+    uint32_t begin = 0;
+    uint32_t count = 0;
+};
+
+struct CompiledState {
+    bool       loop        = true;
+    int        totalFrames = 8;
+    SliceRange transitions;   // 已按优先级降序排列
+    SliceRange windows;
+    SliceRange frameEvents;
+    SliceRange rootMotion;
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  完整的编译结果（对应一个 .sm.json）
+// ─────────────────────────────────────────────────────────────────────────────
+struct CompiledStateMachine {
+    std::string characterId;
+    StateId     initialState = INVALID_SYMBOL;
+
+    SymbolTable stateNames;    // StateId  → 状态名
+    SymbolTable triggerNames;  // TriggerId → 触发器名（只收录被转换引用的触发器）
+    SymbolTable eventNames;    // EventId  → 帧事件名
+
+    std::vector<CompiledState>      states;        // 下标 = StateId
+    std::vector<std::string>        animationIds;  // 下标 = StateId
+    std::vector<CompiledTransition> transitions;
+    std::vector<FrameWindow>        windows;
+    std::vector<CompiledFrameEvent> frameEvents;
+    std::vector<RootMotionFrame>    rootMotion;
+
+    // 单次 tick 最多触发的帧事件数：每次 tick 只扫描当前状态的帧事件且每个至多触发一次，即各状态帧事件数的最大值
+    uint32_t               maxEventsPerTick = 0;
+
+    TriggerId              animEndTrigger = INVALID_SYMBOL;  // "ANIM_END"（未被引用时无效）
+    std::vector<TriggerId> bufferedTriggers;                 // 连招 / 可取消窗口内从缓冲池补入的按键
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  StateController::tick 的每帧输出（无堆分配）
+// ─────────────────────────────────────────────────────────────────────────────
+struct TickResult {
+    StateId                  currentState   = INVALID_SYMBOL;
+    bool                     stateChanged   = false;
+    float                    rootMotionDx   = 0.0f;
+    float                    rootMotionDy   = 0.0f;
+    std::span<const EventId> firedEvents;   // EventId；名称见 CompiledStateMachine::eventNames，指向控制器缓冲，下次 tick 前有效
+    int                      currentFrame   = 0;
+    float                    stateTimeRatio = 0.0f;
+};
+
+} // namespace engine::statemachine
@@ -1,5 +1,6 @@
 #include "sm_loader.h"
 #include <nlohmann/json.hpp>
+#include <algorithm>
 #include <fstream>
 #include <spdlog/spdlog.h>
 
@@ -174,4 +175,89 @@ bool SmLoader::load(const std::string& path, StateMachineData& outData)
     return true;
 }
 
+// ─────────────────────────────────────────────────────────────────────────────
+//  编译：字符串 → 稠密 ID
+// ─────────────────────────────────────────────────────────────────────────────
+bool SmLoader::compile(const StateMachineData& data, CompiledStateMachine& outCompiled)
+{
+    CompiledStateMachine out;
+    out.characterId = data.characterId;
+
+    // 1. 状态名先全部驻留，转换目标才能解析（std::map 有序 → ID 稳定）
+    for (const auto& [stateName, node] : data.states)
+        out.stateNames.intern(stateName);
+    out.initialState = out.stateNames.find(data.initialState);
+
+    out.states.resize(data.states.size());
+    out.animationIds.resize(data.states.size());
+
+    std::vector<std::pair<int, CompiledTransition>> sorted;
+    for (const auto& [stateName, node] : data.states)
+    {
+        const StateId id = out.stateNames.find(stateName);
+        CompiledState& cs = out.states[id];
+        cs.loop        = node.loop;
+        cs.totalFrames = node.totalFrames;
+        out.animationIds[id] = node.animationId;
+
+        // 2. 转换：按优先级降序稳定排序后平铺
+        sorted.clear();
+        for (const auto& t : node.transitions)
+        {
+            CompiledTransition ct;
+            ct.trigger    = out.triggerNames.intern(t.trigger);
+            ct.target     = out.stateNames.find(t.targetState);
+            ct.windowType = t.requireWindow ? static_cast<int8_t>(t.windowType) : int8_t(-1);
+            sorted.emplace_back(t.priority, ct);
+        }
+        std::stable_sort(sorted.begin(), sorted.end(),
+            [](const auto& a, const auto& b) { return a.first > b.first; });
+        cs.transitions = { static_cast<uint32_t>(out.transitions.size()), static_cast<uint32_t>(sorted.size()) };
+        for (const auto& [priority, ct] : sorted)
+            out.transitions.push_back(ct);
+
+        cs.windows = { static_cast<uint32_t>(out.windows.size()), static_cast<uint32_t>(node.windows.size()) };
+        out.windows.insert(out.windows.end(), node.windows.begin(), node.windows.end());
+
+        cs.frameEvents = { static_cast<uint32_t>(out.frameEvents.size()), static_cast<uint32_t>(node.frameEvents.size()) };
+        for (const auto& fe : node.frameEvents)
+            out.frameEvents.push_back({ fe.frame, out.eventNames.intern(fe.event) });
+        out.maxEventsPerTick = std::max(out.maxEventsPerTick, cs.frameEvents.count);
+
+        cs.rootMotion = { static_cast<uint32_t>(out.rootMotion.size()), static_cast<uint32_t>(node.rootMotion.size()) };
+        out.rootMotion.insert(out.rootMotion.end(), node.rootMotion.begin(), node.rootMotion.end());
+    }
+
+    if (out.triggerNames.size() > TriggerMask::kMaxTriggers)
+    {
+        s_lastError = "触发器数量超出上限: " + std::to_string(out.triggerNames.size());
+        spdlog::error("[SmLoader] 编译失败 ({}): {}", data.characterId, s_lastError);
+        return false;
+    }
+
+    // 3. 特殊触发器：未被任何转换引用的无需处理
+    out.animEndTrigger = out.triggerNames.find("ANIM_END");
+    for (const char* preset : { "KEY_ATTACK", "KEY_JUMP", "KEY_DASH",
+                                "KEY_SKILL_1", "KEY_SKILL_2", "KEY_SKILL_3" })
+    {
+        const TriggerId id = out.triggerNames.find(preset);
+        if (id != INVALID_SYMBOL)
+            out.bufferedTriggers.push_back(id);
+    }
+
+    outCompiled = std::move(out);
+    return true;
+}
+
+std::shared_ptr<const CompiledStateMachine> SmLoader::loadCompiled(const std::string& path)
+{
+    StateMachineData data;
+    if (!load(path, data))
+        return nullptr;
+    auto compiled = std::make_shared<CompiledStateMachine>();
+    if (!compile(data, *compiled))
+        return nullptr;
+    return compiled;
+}
+
 } // namespace engine::statemachine
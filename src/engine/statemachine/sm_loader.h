@@ -7,6 +7,8 @@
 #pragma once
 
 #include "sm_types.h"
+#include "sm_compiled.h"
+#include <memory>
 #include <string>
 
 namespace engine::statemachine {
@@ -19,6 +21,15 @@ public:
     /** 从 JSON 文件加载 StateMachineData，返回 true 表示成功 */
     static bool load(const std::string& path, StateMachineData& outData);
 
+    /**
+     * 把字符串形式的状态机编译为运行时 ID 形式（见 sm_compiled.h）。
+     * 失败（触发器数超出 TriggerMask 容量等）时返回 false，lastError() 给出原因。
+     */
+    static bool compile(const StateMachineData& data, CompiledStateMachine& outCompiled);
+
+    /** load + compile；失败返回 nullptr。结果可被多个 StateController 共享 */
+    static std::shared_ptr<const CompiledStateMachine> loadCompiled(const std::string& path);
+
     /** 检查当前是否有错误消息 */
     static const std::string& lastError() { return s_lastError; }
 
@@ -1,56 +1,102 @@
 #include "state_controller.h"
+#include "sm_loader.h"
 #include <algorithm>
 #include <cmath>
+#include <spdlog/spdlog.h>
 
 namespace engine::statemachine {
 
 // ─────────────────────────────────────────────────────────────────────────────
 void StateController::init(const StateMachineData* data, const std::string& initialState)
 {
-    m_data = data;
+    std::shared_ptr<CompiledStateMachine> compiled;
+    if (data)
+    {
+        compiled = std::make_shared<CompiledStateMachine>();
+        if (!SmLoader::compile(*data, *compiled))
+        {
+            spdlog::warn("[StateController] 状态机编译失败: {}", SmLoader::lastError());
+            compiled.reset();
+        }
+    }
+    init(std::shared_ptr<const CompiledStateMachine>(std::move(compiled)), initialState);
+}
+
+void StateController::init(std::shared_ptr<const CompiledStateMachine> machine, const std::string& initialState)
+{
+    m_machine = std::move(machine);
     m_inputBuffer.clear();
-    std::string startState = initialState.empty()
-        ? (data ? data->initialState : "") : initialState;
-    m_currentStateName.clear();
-    m_currentState  = nullptr;
-    m_stateTime     = 0.0f;
-    m_currentFrame  = 0;
+    m_currentState   = nullptr;
+    m_currentStateId = INVALID_SYMBOL;
+    m_stateTime      = 0.0f;
+    m_currentFrame   = 0;
     m_lastEventFrame = -1;
-    if (data && !startState.empty())
-        forceTransition(startState);
+    bindConditions();
+    m_firedEvents.clear();
+    m_result = TickResult{};
+    if (!m_machine)
+        return;
+
+    const StateId start = initialState.empty() ? m_machine->initialState : stateId(initialState);
+    if (start != INVALID_SYMBOL)
+        forceTransition(start);
 }
 
 void StateController::reset()
 {
-    if (m_data)
-        init(m_data, m_data->initialState);
+    if (m_machine)
+        init(m_machine, "");
 }
 
 // ─────────────────────────────────────────────────────────────────────────────
 UpdateResult StateController::update(float dt,
     const std::vector<std::string>& activeInputs, float time)
 {
-    UpdateResult result;
-    if (!m_data || !m_currentState)
+    // 兼容接口：名称 → ID，结果 ID → 名称
+    TriggerMask mask;
+    if (m_machine)
     {
-        result.currentState = m_currentStateName;
-        return result;
+        for (const auto& input : activeInputs)
+            mask.set(m_machine->triggerNames.find(input));
     }
 
+    const TickResult& tr = tick(dt, mask, time);
+
+    UpdateResult result;
+    result.currentState   = stateName(tr.currentState);
+    result.stateChanged   = tr.stateChanged;
+    result.rootMotionDx   = tr.rootMotionDx;
+    result.rootMotionDy   = tr.rootMotionDy;
+    result.currentFrame   = tr.currentFrame;
+    result.stateTimeRatio = tr.stateTimeRatio;
+    result.firedEvents.reserve(tr.firedEvents.size());
+    for (EventId id : tr.firedEvents)
+        result.firedEvents.push_back(eventName(id));
+    return result;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+const TickResult& StateController::tick(float dt, const TriggerMask& inputs, float time)
+{
+    TickResult& result = m_result;
+    result = TickResult{};
+    result.currentState = m_currentStateId;
+    if (!m_machine || !m_currentState)
+        return result;
+
     // 更新输入缓冲池（清除过期）
     m_inputBuffer.update(time);
 
-    // ── 求值自定义条件，满足则注入触发器 ───────────────────────────────
-    // 每帧对注册的条件函数求值，true → 等价于收到该触发器名称的指令
-    std::vector<std::string> injectInputs;
-    for (const auto& [name, fn] : m_conditions)
+    // 合并当前激活输入 + 自定义条件注入（只求值被转换引用的条件）
+    TriggerMask effective = inputs;
+    for (const auto& cond : m_boundConditions)
     {
-        if (fn && fn(*this))
-            injectInputs.push_back(name);
+        const bool hit = cond.fnPtr ? cond.fnPtr(*this, cond.user) : (*cond.fn && (*cond.fn)(*this));
+        if (hit)
+            effective.set(cond.trigger);
     }
 
     // 计算前后帧
-    float prevStateTime = m_stateTime;
     m_stateTime += dt;
     int totalFrames = std::max(1, m_currentState->totalFrames);
     float animDuration = totalFrames * m_frameDuration;
@@ -76,46 +122,34 @@ UpdateResult StateController::update(float dt,
     int winType = currentWindowType();  // -1 / 0(Locked) / 1(Combo) / 2(Cancelable)
     bool inComboOrCancel = (winType == 1 || winType == 2);
 
-    // ── 尝试转换 ────────────────────────────────────────────────────────
-    // 合并当前激活输入 + 缓冲池中的输入 + 自定义条件注入
-    std::vector<std::string> effectiveInputs;
-    effectiveInputs.reserve(activeInputs.size() + injectInputs.size());
-    effectiveInputs.insert(effectiveInputs.end(), activeInputs.begin(), activeInputs.end());
-    for (const auto& name : injectInputs)
-    {
-        if (std::find(effectiveInputs.begin(), effectiveInputs.end(), name) == effectiveInputs.end())
-            effectiveInputs.push_back(name);
-    }
     // 把缓冲池中未消耗的指令也加入（仅在连招/可取消窗口生效）
     if (inComboOrCancel)
     {
-        for (const auto& preset : { "KEY_ATTACK", "KEY_JUMP", "KEY_DASH",
-                                     "KEY_SKILL_1","KEY_SKILL_2","KEY_SKILL_3" })
+        for (TriggerId preset : m_machine->bufferedTriggers)
         {
             if (m_inputBuffer.has(preset, time))
-            {
-                // 只加一次，避免重复
-                if (std::find(effectiveInputs.begin(), effectiveInputs.end(), preset)
-                    == effectiveInputs.end())
-                    effectiveInputs.push_back(preset);
-            }
+                effective.set(preset);
         }
     }
 
     // ANIM_END 触发器
     if (animEnded)
-        effectiveInputs.push_back("ANIM_END");
+        effective.set(m_machine->animEndTrigger);
 
     // 收集根位移（在转换前，当前帧到新帧之间）
     collectRootMotion(prevFrame, newFrame, result);
 
-    // 收集帧事件
+    // 收集帧事件（拷贝构造的控制器不继承容量，首次 tick 时补足，之后不再分配）
+    if (m_firedEvents.capacity() < m_machine->maxEventsPerTick)
+        m_firedEvents.reserve(m_machine->maxEventsPerTick);
+    m_firedEvents.clear();
     collectFrameEvents(prevFrame, newFrame, result);
+    result.firedEvents = m_firedEvents;
 
     // 检查转换
-    tryTransitions(effectiveInputs, inComboOrCancel, time, result);
+    tryTransitions(effective, time, result);
 
-    result.currentState    = m_currentStateName;
+    result.currentState    = m_currentStateId;
     result.currentFrame    = m_currentFrame;
     result.stateTimeRatio  = (animDuration > 0.0f)
         ? std::min(1.0f, m_stateTime / animDuration) : 0.0f;
@@ -126,7 +160,47 @@ UpdateResult StateController::update(float dt,
 // ─────────────────────────────────────────────────────────────────────────────
 void StateController::pushInput(const std::string& action, float time)
 {
-    m_inputBuffer.push(action, time);
+    pushInput(triggerId(action), time);
+}
+
+void StateController::pushInput(TriggerId action, float time)
+{
+    // 未被任何转换引用的指令不会产生效果，直接丢弃
+    if (action != INVALID_SYMBOL)
+        m_inputBuffer.push(action, time);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  名称解析
+// ─────────────────────────────────────────────────────────────────────────────
+TriggerId StateController::triggerId(const std::string& name) const
+{
+    return m_machine ? m_machine->triggerNames.find(name) : INVALID_SYMBOL;
+}
+
+StateId StateController::stateId(const std::string& name) const
+{
+    return m_machine ? m_machine->stateNames.find(name) : INVALID_SYMBOL;
+}
+
+const std::string& StateController::stateName(StateId id) const
+{
+    static const std::string kEmpty;
+    return m_machine ? m_machine->stateNames.name(id) : kEmpty;
+}
+
+const std::string& StateController::eventName(EventId id) const
+{
+    static const std::string kEmpty;
+    return m_machine ? m_machine->eventNames.name(id) : kEmpty;
+}
+
+const std::string& StateController::getCurrentAnimation() const
+{
+    static const std::string kEmpty;
+    if (!m_machine || m_currentStateId >= m_machine->animationIds.size())
+        return kEmpty;
+    return m_machine->animationIds[m_currentStateId];
 }
 
 // ─────────────────────────────────────────────────────────────────────────────
@@ -134,17 +208,40 @@ void StateController::pushInput(const std::string& action, float time)
 // ─────────────────────────────────────────────────────────────────────────────
 void StateController::registerCondition(const std::string& triggerName, ConditionFn fn)
 {
-    m_conditions[triggerName] = std::move(fn);
+    m_conditions[triggerName] = ConditionEntry{ nullptr, nullptr, std::move(fn) };
+    bindConditions();
+}
+
+void StateController::registerCondition(const std::string& triggerName, ConditionFnPtr fn, void* user)
+{
+    m_conditions[triggerName] = ConditionEntry{ fn, user, {} };
+    bindConditions();
 }
 
 void StateController::unregisterCondition(const std::string& triggerName)
 {
     m_conditions.erase(triggerName);
+    bindConditions();
 }
 
 void StateController::clearConditions()
 {
     m_conditions.clear();
+    m_boundConditions.clear();
+}
+
+void StateController::bindConditions()
+{
+    m_boundConditions.clear();
+    if (!m_machine)
+        return;
+    for (const auto& [name, entry] : m_conditions)
+    {
+        const TriggerId id = m_machine->triggerNames.find(name);
+        if (id == INVALID_SYMBOL || (!entry.fnPtr && !entry.fn))
+            continue;
+        m_boundConditions.push_back({ id, entry.fnPtr, entry.user, &entry.fn });
+    }
 }
 
 void StateController::setOnStateChanged(StateChangedFn fn)
@@ -161,8 +258,10 @@ void StateController::setOnFrameEvent(FrameEventFn fn)
 int StateController::currentWindowType() const
 {
     if (!m_currentState) return -1;
-    for (const auto& w : m_currentState->windows)
+    const FrameWindow* windows = m_machine->windows.data() + m_currentState->windows.begin;
+    for (uint32_t i = 0; i < m_currentState->windows.count; ++i)
     {
+        const FrameWindow& w = windows[i];
         if (m_currentFrame >= w.startFrame && m_currentFrame <= w.endFrame)
             return static_cast<int>(w.type);
     }
@@ -172,95 +271,94 @@ int StateController::currentWindowType() const
 // ─────────────────────────────────────────────────────────────────────────────
 void StateController::forceTransition(const std::string& stateName)
 {
-    UpdateResult dummy;
-    doTransition(stateName, dummy);
+    forceTransition(stateId(stateName));
+}
+
+void StateController::forceTransition(StateId state)
+{
+    TickResult dummy;
+    doTransition(state, dummy);
 }
 
 // ─────────────────────────────────────────────────────────────────────────────
-void StateController::doTransition(const std::string& stateName, UpdateResult& result)
+void StateController::doTransition(StateId state, TickResult& result)
 {
-    if (!m_data) return;
-    auto it = m_data->states.find(stateName);
-    if (it == m_data->states.end()) return;
-
-    const std::string prevState = m_currentStateName;
-    m_currentStateName = stateName;
-    m_currentState     = &it->second;
-    m_stateTime        = 0.0f;
-    m_currentFrame     = 0;
-    m_lastEventFrame   = -1;
-    result.stateChanged  = true;
-    result.currentState  = stateName;
+    if (!m_machine || state >= m_machine->states.size()) return;
+
+    const StateId prevState = m_currentStateId;
+    m_currentStateId = state;
+    m_currentState   = &m_machine->states[state];
+    m_stateTime      = 0.0f;
+    m_currentFrame   = 0;
+    m_lastEventFrame = -1;
+    result.stateChanged = true;
+    result.currentState = state;
 
     // 通知状态切换回调
     if (m_onStateChanged)
-        m_onStateChanged(prevState, stateName);
+        m_onStateChanged(stateName(prevState), stateName(state));
 }
 
 // ─────────────────────────────────────────────────────────────────────────────
-bool StateController::tryTransitions(const std::vector<std::string>& activeInputs,
-    bool inComboOrCancel, float time, UpdateResult& result)
+bool StateController::tryTransitions(const TriggerMask& activeInputs, float time, TickResult& result)
 {
     if (!m_currentState) return false;
 
-    // 按优先级降序排序后检查
-    std::vector<const Transition*> sorted;
-    sorted.reserve(m_currentState->transitions.size());
-    for (const auto& t : m_currentState->transitions)
-        sorted.push_back(&t);
-    std::sort(sorted.begin(), sorted.end(),
-        [](const Transition* a, const Transition* b){ return a->priority > b->priority; });
-
-    for (const Transition* t : sorted)
+    // 编译期已按优先级降序排列
+    const CompiledTransition* transitions = m_machine->transitions.data() + m_currentState->transitions.begin;
+    const uint32_t count = m_currentState->transitions.count;
+    int windowType = -2;  // 延迟求值
+    for (uint32_t i = 0; i < count; ++i)
     {
+        const CompiledTransition& t = transitions[i];
+
         // 区间要求检查
-        if (t->requireWindow)
+        if (t.windowType >= 0)
         {
-            int wt = currentWindowType();
-            if (wt != static_cast<int>(t->windowType)) continue;
+            if (windowType == -2) windowType = currentWindowType();
+            if (windowType != t.windowType) continue;
         }
 
         // 触发器检查
-        bool triggered = false;
-        for (const auto& input : activeInputs)
-        {
-            if (input == t->trigger) { triggered = true; break; }
-        }
-        if (!triggered) continue;
+        if (!activeInputs.test(t.trigger)) continue;
 
         // 消耗缓冲池中的对应指令
-        m_inputBuffer.consume(t->trigger, time);
+        m_inputBuffer.consume(t.trigger, time);
 
-        doTransition(t->targetState, result);
+        doTransition(t.target, result);
         return true;
     }
     return false;
 }
 
 // ─────────────────────────────────────────────────────────────────────────────
-void StateController::collectFrameEvents(int prevFrame, int newFrame, UpdateResult& result)
+void StateController::collectFrameEvents(int prevFrame, int newFrame, TickResult& result)
 {
     if (!m_currentState) return;
     // 只触发 prevFrame < event.frame <= newFrame 范围内的事件（防重复）
-    for (const auto& fe : m_currentState->frameEvents)
+    const CompiledFrameEvent* events = m_machine->frameEvents.data() + m_currentState->frameEvents.begin;
+    for (uint32_t i = 0; i < m_currentState->frameEvents.count; ++i)
     {
+        const CompiledFrameEvent& fe = events[i];
         if (fe.frame > prevFrame && fe.frame <= newFrame && fe.frame > m_lastEventFrame)
         {
-            result.firedEvents.push_back(fe.event);
+            m_firedEvents.push_back(fe.event);  // 容量已按 maxEventsPerTick 预留，不会重新分配
             // 直接回调帧事件，不必外部循环 firedEvents
             if (m_onFrameEvent)
-                m_onFrameEvent(fe.event, fe.frame);
+                m_onFrameEvent(eventName(fe.event), fe.frame);
         }
     }
     if (newFrame > m_lastEventFrame) m_lastEventFrame = newFrame;
 }
 
 // ─────────────────────────────────────────────────────────────────────────────
-void StateController::collectRootMotion(int prevFrame, int newFrame, UpdateResult& result)
+void StateController::collectRootMotion(int prevFrame, int newFrame, TickResult& result)
 {
     if (!m_currentState) return;
-    for (const auto& rm : m_currentState->rootMotion)
+    const RootMotionFrame* motion = m_machine->rootMotion.data() + m_currentState->rootMotion.begin;
+    for (uint32_t i = 0; i < m_currentState->rootMotion.count; ++i)
     {
+        const RootMotionFrame& rm = motion[i];
         if (rm.frame > prevFrame && rm.frame <= newFrame)
         {
             result.rootMotionDx += rm.dx;
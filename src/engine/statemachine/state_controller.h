@@ -33,12 +33,24 @@
  *
  *   D. 强制跳转（被击、剧情等外部干预）：
  *      sm.forceTransition("HURT");
+ *
+ * 运行时形式：
+ *   init 时把 StateMachineData 编译为 CompiledStateMachine（见 sm_compiled.h），
+ *   之后每帧只处理整数 ID。大量同类角色应共享一份编译结果：
+ *      auto machine = SmLoader::loadCompiled("monster.sm.json");
+ *      sm.init(machine);
+ *      const TriggerId kGrounded = sm.triggerId("GROUNDED");   // 加载时解析一次
+ *      TriggerMask inputs; inputs.set(kGrounded);
+ *      const TickResult& r = sm.tick(dt, inputs, time);        // 无堆分配
+ *   update(dt, vector<string>, time) 保留为兼容接口，内部转换后调用 tick。
  */
 #pragma once
 
 #include "sm_types.h"
+#include "sm_compiled.h"
 #include "input_buffer.h"
 #include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -55,6 +67,12 @@ public:
      */
     using ConditionFn = std::function<bool(const StateController&)>;
 
+    /**
+     * 自定义条件的函数指针形式（无捕获开销，推荐给大量实例使用）。
+     * user 为注册时传入的上下文指针（通常是所属 GameObject / 组件）。
+     */
+    using ConditionFnPtr = bool (*)(const StateController&, void* user);
+
     /**
      * 状态切换回调。
      * 发生跳转时调用，prevState 可能为空（初始化跳转）。
@@ -72,9 +90,12 @@ public:
 
     StateController() = default;
 
-    /** 绑定状态机数据并跳到初始状态 */
+    /** 编译并绑定状态机数据，跳到初始状态（编译结果由本控制器独占）*/
     void init(const StateMachineData* data, const std::string& initialState = "");
 
+    /** 绑定已编译的状态机（可与其他控制器共享），跳到初始状态 */
+    void init(std::shared_ptr<const CompiledStateMachine> machine, const std::string& initialState = "");
+
     /** 重置到初始状态（保留已注册的条件和回调）*/
     void reset();
 
@@ -88,8 +109,24 @@ public:
      */
     UpdateResult update(float dt, const std::vector<std::string>& activeInputs, float time);
 
+    /**
+     *  主更新函数（ID 形式），每帧调用。
+     *  @param inputs 本帧激活的触发器位集（ID 来自 triggerId()）
+     *  @return 引用在下一次 tick / update 前有效
+     */
+    const TickResult& tick(float dt, const TriggerMask& inputs, float time);
+
     /** 将一次按键压入指令缓冲池（通常在 isActionPressed 时调用）*/
     void pushInput(const std::string& action, float time);
+    void pushInput(TriggerId action, float time);
+
+    // ── 名称解析（加载后调用一次并缓存结果）────────────────────────────
+    /** 未被任何转换引用的触发器返回 INVALID_SYMBOL（对其置位不会产生效果）*/
+    TriggerId triggerId(const std::string& name) const;
+    StateId   stateId(const std::string& name) const;
+    const std::string& stateName(StateId id) const;
+    const std::string& eventName(EventId id) const;
+    const CompiledStateMachine* getMachine() const { return m_machine.get(); }
 
     // ── 代码接入：自定义条件 ─────────────────────────────────────────────
     /**
@@ -105,6 +142,9 @@ public:
      */
     void registerCondition(const std::string& triggerName, ConditionFn fn);
 
+    /** 函数指针形式；与同名 std::function 条件互相覆盖 */
+    void registerCondition(const std::string& triggerName, ConditionFnPtr fn, void* user = nullptr);
+
     /** 移除指定名称的条件（不存在时无操作）*/
     void unregisterCondition(const std::string& triggerName);
 
@@ -142,10 +182,13 @@ public:
     void setOnFrameEvent(FrameEventFn fn);
 
     // ── 查询 ──────────────────────────────────────────────────────────────
-    const std::string& getCurrentState() const { return m_currentStateName; }
-    int                getCurrentFrame() const { return m_currentFrame; }
-    float              getStateTime()    const { return m_stateTime; }
-    bool               isValid()         const { return m_data != nullptr && m_currentState != nullptr; }
+    const std::string& getCurrentState()     const { return stateName(m_currentStateId); }
+    StateId            getCurrentStateId()   const { return m_currentStateId; }
+    /** 当前状态对应的动画名（无状态时为空字符串）*/
+    const std::string& getCurrentAnimation() const;
+    int                getCurrentFrame()     const { return m_currentFrame; }
+    float              getStateTime()        const { return m_stateTime; }
+    bool               isValid()             const { return m_machine != nullptr && m_currentState != nullptr; }
 
     /** 返回当前帧所在的区间类型（Locked/Combo/Cancelable），-1 = 不在任何区间 */
     int currentWindowType() const;
@@ -156,30 +199,48 @@ public:
      * @warning 绕过所有转换条件和优先级检查，请谨慎使用。
      */
     void forceTransition(const std::string& stateName);
+    void forceTransition(StateId state);
 
     /** 设置每帧时长（秒）——用于将 dt 折算成帧索引 */
     void setFrameDuration(float secondsPerFrame) { m_frameDuration = secondsPerFrame; }
 
 private:
-    const StateMachineData* m_data             = nullptr;
-    const StateNode*        m_currentState     = nullptr;
-    std::string             m_currentStateName;
+    struct ConditionEntry {
+        ConditionFnPtr fnPtr = nullptr;
+        void*          user  = nullptr;
+        ConditionFn    fn;
+    };
+
+    // 绑定到当前状态机的条件：名称已解析为触发器 ID，未被引用的条件不参与求值
+    struct BoundCondition {
+        TriggerId          trigger = INVALID_SYMBOL;
+        ConditionFnPtr     fnPtr   = nullptr;
+        void*              user    = nullptr;
+        const ConditionFn* fn      = nullptr;
+    };
+
+    std::shared_ptr<const CompiledStateMachine> m_machine;
+    const CompiledState*    m_currentState     = nullptr;
+    StateId                 m_currentStateId   = INVALID_SYMBOL;
     float                   m_stateTime        = 0.0f;  // 在当前状态已经过的秒数
     int                     m_currentFrame     = 0;
     int                     m_lastEventFrame   = -1;    // 已触发事件的最后帧（防重复）
     float                   m_frameDuration    = 0.1f;  // 100ms / 帧（可被动画组件覆盖）
     InputBuffer             m_inputBuffer;
+    TickResult              m_result;
+    std::vector<EventId>    m_firedEvents;                  // m_result.firedEvents 的存储，按 maxEventsPerTick 预留
 
     // ── 代码接入数据 ──────────────────────────────────────────────────────
-    std::unordered_map<std::string, ConditionFn> m_conditions;  // 自定义条件注册表
+    std::unordered_map<std::string, ConditionEntry> m_conditions;  // 自定义条件注册表（按名称）
+    std::vector<BoundCondition> m_boundConditions;                 // 每帧求值的条件
     StateChangedFn  m_onStateChanged;   // 状态切换回调
     FrameEventFn    m_onFrameEvent;     // 帧事件回调
 
-    void doTransition(const std::string& stateName, UpdateResult& result);
-    bool tryTransitions(const std::vector<std::string>& activeInputs,
-                        bool inComboOrCancel, float time, UpdateResult& result);
-    void collectFrameEvents(int prevFrame, int newFrame, UpdateResult& result);
-    void collectRootMotion(int prevFrame, int newFrame, UpdateResult& result);
+    void bindConditions();
+    void doTransition(StateId state, TickResult& result);
+    bool tryTransitions(const TriggerMask& activeInputs, float time, TickResult& result);
+    void collectFrameEvents(int prevFrame, int newFrame, TickResult& result);
+    void collectRootMotion(int prevFrame, int newFrame, TickResult& result);
 };
 
 } // namespace engine::statemachine
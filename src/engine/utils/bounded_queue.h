@@ -0,0 +1,87 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace engine::utils
+{
+    /**
+     * @brief 定长无锁多生产者/单消费者环形队列（Vyukov bounded queue）
+     *
+     * - 元素按值拷贝进槽位，push / pop 都不分配内存
+     * - 任意线程可 push；队列满时立即返回 false，由调用方决定丢弃或重试，不会阻塞
+     * - 仅允许一个线程 pop
+     * - 与 MpscQueue 的区别：容量固定、元素为值类型，适合高频的小命令（如音频指令）
+     */
+    template <typename T, size_t Capacity>
+    class BoundedMpscQueue
+    {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity 必须是 2 的幂");
+
+    public:
+        BoundedMpscQueue()
+        {
+            for (size_t i = 0; i < Capacity; ++i)
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        BoundedMpscQueue(const BoundedMpscQueue &) = delete;
+        BoundedMpscQueue &operator=(const BoundedMpscQueue &) = delete;
+
+        bool push(const T &value)
+        {
+            size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Cell &cell = m_cells[pos & MASK];
+                const size_t seq = cell.sequence.load(std::memory_order_acquire);
+                const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+                if (diff == 0)
+                {
+                    if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        cell.value = value;
+                        cell.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    return false; // 已满
+                }
+                else
+                {
+                    pos = m_enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        bool pop(T &out)
+        {
+            Cell &cell = m_cells[m_dequeuePos & MASK];
+            const size_t seq = cell.sequence.load(std::memory_order_acquire);
+            if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(m_dequeuePos + 1) < 0)
+                return false; // 为空，或生产者尚未写完该槽位
+            out = cell.value;
+            cell.sequence.store(m_dequeuePos + Capacity, std::memory_order_release);
+            ++m_dequeuePos;
+            return true;
+        }
+
+        static constexpr size_t capacity() { return Capacity; }
+
+    private:
+        static constexpr size_t MASK = Capacity - 1;
+
+        struct Cell
+        {
+            std::atomic<size_t> sequence{0};
+            T value{};
+        };
+
+        std::array<Cell, Capacity> m_cells;
+        alignas(64) std::atomic<size_t> m_enqueuePos{0}; // 生产者端
+        alignas(64) size_t m_dequeuePos = 0;             // 消费者端（仅消费线程访问）
+    };
+} // namespace engine::utils
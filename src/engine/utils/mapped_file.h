@@ -0,0 +1,43 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace engine::utils
+{
+    /**
+     * @brief 只读内存映射文件（POSIX mmap / Win32 MapViewOfFile）
+     *
+     * - 映射期间文件内容可被其它句柄追加写入，但已映射的长度不会随之增长：写入后需 close() 再 open()
+     * - 空文件无法映射，open 返回 true 且 size() == 0
+     * - 不可拷贝，可移动
+     */
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile() { close(); }
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+        MappedFile(MappedFile &&other) noexcept;
+        MappedFile &operator=(MappedFile &&other) noexcept;
+
+        // 映射整个文件；文件不存在或映射失败返回 false
+        bool open(const std::string &path);
+        void close();
+
+        bool isOpen() const { return m_open; }
+        const uint8_t *data() const { return m_data; }
+        size_t size() const { return m_size; }
+
+    private:
+        const uint8_t *m_data = nullptr;
+        size_t m_size = 0;
+        bool m_open = false;
+#ifdef _WIN32
+        void *m_file = nullptr;
+        void *m_mapping = nullptr;
+#endif
+    };
+} // namespace engine::utils
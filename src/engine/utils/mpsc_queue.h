@@ -0,0 +1,71 @@
+#pragma once
+#include <atomic>
+
+namespace engine::utils
+{
+    /**
+     * @brief 无锁多生产者/单消费者侵入式队列（Vyukov MPSC）
+     *
+     * - 任意线程可 push（wait-free：一次原子 exchange）
+     * - 仅允许一个线程 pop（通常为主线程）
+     * - 节点类型 T 需要提供 `std::atomic<T*> next` 成员，且可默认构造（用作哨兵）
+     * - 队列不拥有节点：push 交出指针，pop 取回指针，生命周期由调用方负责
+     */
+    template <typename T>
+    class MpscQueue
+    {
+    public:
+        MpscQueue()
+            : m_head(&m_stub), m_tail(&m_stub)
+        {
+            m_stub.next.store(nullptr, std::memory_order_relaxed);
+        }
+
+        MpscQueue(const MpscQueue &) = delete;
+        MpscQueue &operator=(const MpscQueue &) = delete;
+
+        void push(T *node)
+        {
+            node->next.store(nullptr, std::memory_order_relaxed);
+            T *prev = m_head.exchange(node, std::memory_order_acq_rel);
+            prev->next.store(node, std::memory_order_release);
+        }
+
+        // 队列为空，或生产者正处于 push 的两步之间时返回 nullptr（稍后重试即可）
+        T *pop()
+        {
+            T *tail = m_tail;
+            T *next = tail->next.load(std::memory_order_acquire);
+            if (tail == &m_stub)
+            {
+                if (!next)
+                    return nullptr;
+                m_tail = next;
+                tail = next;
+                next = next->next.load(std::memory_order_acquire);
+            }
+            if (next)
+            {
+                m_tail = next;
+                return tail;
+            }
+
+            if (tail != m_head.load(std::memory_order_acquire))
+                return nullptr;
+
+            push(&m_stub);
+            next = tail->next.load(std::memory_order_acquire);
+            if (next)
+            {
+                m_tail = next;
+                return tail;
+            }
+            return nullptr;
+        }
+
+    private:
+        std::atomic<T *> m_head; // 生产者端
+        T *m_tail;               // 消费者端（仅消费线程访问）
+        T m_stub;
+    };
+} // namespace engine::utils
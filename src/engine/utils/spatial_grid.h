@@ -0,0 +1,288 @@
+#pragma once
+#include <glm/common.hpp>
+#include <glm/vec2.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace engine::utils
+{
+    /**
+     * @brief 均匀网格空间哈希（每帧整体重建）
+     *
+     * - 用法：clear() → insert(value, pos)… → build() → queryRect / queryRadius / queryNearest
+     * - 单元格尺寸可各向异性（2.5D 场景中深度方向通常按权重放大，使网格在“感知距离”上接近正方形）
+     * - build() 为 O(n)：开放寻址哈希表记录每个非空单元格，计数后把条目按单元格连续重排，
+     *   查询时每个单元格是一段连续内存；所有缓冲区跨帧复用，稳态下不分配内存
+     * - 查询回调签名：fn(const T &value, const glm::vec2 &pos)，pos 为插入时的位置
+     */
+    template <typename T>
+    class SpatialGrid
+    {
+    public:
+        explicit SpatialGrid(glm::vec2 cellSize = {64.0f, 64.0f}) { setCellSize(cellSize); }
+
+        /** 下一次 build() 生效 */
+        void setCellSize(glm::vec2 cellSize)
+        {
+            m_cellSize = glm::max(cellSize, glm::vec2(1e-3f));
+            m_invCellSize = {1.0f / m_cellSize.x, 1.0f / m_cellSize.y};
+        }
+        glm::vec2 getCellSize() const { return m_cellSize; }
+
+        void clear() { m_pending.clear(); }
+        void insert(const T &value, const glm::vec2 &pos) { m_pending.push_back({pos, value}); }
+
+        /** 用 clear() 之后插入的条目重建网格；重建前的查询结果仍基于上一次 build() */
+        void build()
+        {
+            const size_t count = m_pending.size();
+            size_t capacity = 16;
+            while (capacity < count * 2)
+                capacity <<= 1;
+            m_mask = static_cast<uint32_t>(capacity - 1);
+            m_slots.assign(capacity, Slot{});
+            m_itemSlot.resize(count);
+            m_cellCount = 0;
+
+            // 1. 统计每个单元格的条目数
+            for (size_t i = 0; i < count; ++i)
+            {
+                const glm::ivec2 cell = cellOf(m_pending[i].pos);
+                uint32_t index = hashCell(cell);
+                while (m_slots[index].count != 0 && (m_slots[index].cx != cell.x || m_slots[index].cy != cell.y))
+                    index = (index + 1) & m_mask;
+                Slot &slot = m_slots[index];
+                if (slot.count++ == 0)
+                {
+                    slot.cx = cell.x;
+                    slot.cy = cell.y;
+                    ++m_cellCount;
+                }
+                m_itemSlot[i] = index;
+            }
+
+            // 2. 前缀和：begin 先指向单元格末尾，倒序回填后恰好落在起点（同一单元格内保持插入顺序）
+            uint32_t running = 0;
+            for (Slot &slot : m_slots)
+            {
+                running += slot.count;
+                slot.begin = running;
+            }
+            m_items.resize(count);
+            for (size_t i = count; i-- > 0;)
+                m_items[--m_slots[m_itemSlot[i]].begin] = m_pending[i];
+
+            m_bounds[0] = glm::vec2(std::numeric_limits<float>::max());
+            m_bounds[1] = glm::vec2(std::numeric_limits<float>::lowest());
+            for (const Item &item : m_items)
+            {
+                m_bounds[0] = glm::min(m_bounds[0], item.pos);
+                m_bounds[1] = glm::max(m_bounds[1], item.pos);
+            }
+            m_pending.clear();
+        }
+
+        size_t size() const { return m_items.size(); }
+        bool empty() const { return m_items.empty(); }
+        size_t cellCount() const { return m_cellCount; }
+
+        /** 轴对齐矩形 [min, max]（闭区间）内的所有条目 */
+        template <typename Fn>
+        void queryRect(const glm::vec2 &min, const glm::vec2 &max, Fn &&fn) const
+        {
+            if (m_items.empty())
+                return;
+            const glm::vec2 lo = glm::max(min, m_bounds[0]);
+            const glm::vec2 hi = glm::min(max, m_bounds[1]);
+            if (lo.x > hi.x || lo.y > hi.y)
+                return;
+
+            const glm::ivec2 c0 = cellOf(lo);
+            const glm::ivec2 c1 = cellOf(hi);
+            const uint64_t cells = uint64_t(c1.x - c0.x + 1) * uint64_t(c1.y - c0.y + 1);
+            // 矩形覆盖的单元格远多于非空单元格时，直接线性扫描更快
+            if (cells > m_cellCount * 2)
+            {
+                for (const Item &item : m_items)
+                    if (inRect(item.pos, lo, hi))
+                        fn(item.value, item.pos);
+                return;
+            }
+
+            for (int cy = c0.y; cy <= c1.y; ++cy)
+                for (int cx = c0.x; cx <= c1.x; ++cx)
+                {
+                    const Slot *slot = findSlot({cx, cy});
+                    if (!slot)
+                        continue;
+                    const Item *it = m_items.data() + slot->begin;
+                    const Item *end = it + slot->count;
+                    for (; it != end; ++it)
+                        if (inRect(it->pos, lo, hi))
+                            fn(it->value, it->pos);
+                }
+        }
+
+        /** 以 center 为圆心、radius 为半径（欧氏距离，闭区间）的所有条目 */
+        template <typename Fn>
+        void queryRadius(const glm::vec2 &center, float radius, Fn &&fn) const
+        {
+            const float radiusSq = radius * radius;
+            queryRect(center - glm::vec2(radius), center + glm::vec2(radius),
+                      [&](const T &value, const glm::vec2 &pos) {
+                          const glm::vec2 d = pos - center;
+                          if (d.x * d.x + d.y * d.y <= radiusSq)
+                              fn(value, pos);
+                      });
+        }
+
+        /**
+         * @brief 最近的 k 个条目（按距离升序写入 out，返回个数）
+         * @param depthWeight 距离度量 sqrt(dx² + (dy·depthWeight)²)，2.5D 场景传深度权重
+         * @param accept      过滤谓词 bool(const T&)，被拒绝的条目不计入 k
+         * @note 复用内部堆缓冲区，不可与其他 queryNearest 并发调用
+         */
+        template <typename Pred>
+        size_t queryNearest(const glm::vec2 &center, size_t k, float maxDistance, float depthWeight,
+                            std::vector<T> &out, Pred &&accept) const
+        {
+            out.clear();
+            if (k == 0 || m_items.empty() || maxDistance < 0.0f)
+                return 0;
+
+            // (距离², 条目) 的大顶堆，堆顶为当前第 k 近
+            std::vector<std::pair<float, const Item *>> &heap = m_nearestHeap;
+            heap.clear();
+            const float maxDistSq = maxDistance * maxDistance;
+            auto consider = [&](const Item &item) {
+                const glm::vec2 d = item.pos - center;
+                const float distSq = d.x * d.x + d.y * d.y * depthWeight * depthWeight;
+                if (distSq > maxDistSq || (heap.size() == k && distSq >= heap.front().first))
+                    return;
+                if (!accept(item.value))
+                    return;
+                if (heap.size() == k)
+                {
+                    std::pop_heap(heap.begin(), heap.end());
+                    heap.pop_back();
+                }
+                heap.emplace_back(distSq, &item);
+                std::push_heap(heap.begin(), heap.end());
+            };
+
+            // 各轴需要覆盖的单元格半径（深度权重越小，深度方向看得越远）
+            const float weight = std::max(depthWeight, 1e-6f);
+            const glm::ivec2 c0 = cellOf(center);
+            const int reachX = static_cast<int>(std::ceil(maxDistance * m_invCellSize.x)) + 1;
+            const int reachY = static_cast<int>(std::ceil(maxDistance / weight * m_invCellSize.y)) + 1;
+            const uint64_t cells = uint64_t(2 * reachX + 1) * uint64_t(2 * reachY + 1);
+            if (cells > m_cellCount * 2)
+            {
+                for (const Item &item : m_items)
+                    consider(item);
+            }
+            else
+            {
+                // 由内向外逐圈扫描；第 r 圈上任一点的距离不小于 (r-1)·min(cellX, cellY·w)
+                const float ringStep = std::min(m_cellSize.x, m_cellSize.y * weight);
+                const int rings = std::max(reachX, reachY);
+                for (int r = 0; r <= rings; ++r)
+                {
+                    const float lowerBound = std::max(0, r - 1) * ringStep;
+                    if (lowerBound * lowerBound > maxDistSq)
+                        break;
+                    if (heap.size() == k && lowerBound * lowerBound >= heap.front().first)
+                        break;
+                    for (int dy = -std::min(r, reachY); dy <= std::min(r, reachY); ++dy)
+                    {
+                        const bool edgeRow = (dy == -r || dy == r);
+                        const int stepX = edgeRow ? 1 : 2 * r;
+                        for (int dx = -r; dx <= r; dx += std::max(stepX, 1))
+                        {
+                            if (dx < -reachX || dx > reachX)
+                                continue;
+                            const Slot *slot = findSlot({c0.x + dx, c0.y + dy});
+                            if (!slot)
+                                continue;
+                            for (uint32_t i = 0; i < slot->count; ++i)
+                                consider(m_items[slot->begin + i]);
+                        }
+                    }
+                }
+            }
+
+            std::sort_heap(heap.begin(), heap.end());
+            out.reserve(heap.size());
+            for (const auto &entry : heap)
+                out.push_back(entry.second->value);
+            return out.size();
+        }
+
+        size_t queryNearest(const glm::vec2 &center, size_t k, float maxDistance, std::vector<T> &out) const
+        {
+            return queryNearest(center, k, maxDistance, 1.0f, out, [](const T &) { return true; });
+        }
+
+    private:
+        struct Item
+        {
+            glm::vec2 pos{0.0f};
+            T value{};
+        };
+
+        // 开放寻址槽位：count == 0 表示空槽
+        struct Slot
+        {
+            int32_t cx = 0;
+            int32_t cy = 0;
+            uint32_t begin = 0;
+            uint32_t count = 0;
+        };
+
+        glm::ivec2 cellOf(const glm::vec2 &pos) const
+        {
+            return {static_cast<int>(std::floor(pos.x * m_invCellSize.x)),
+                    static_cast<int>(std::floor(pos.y * m_invCellSize.y))};
+        }
+
+        uint32_t hashCell(const glm::ivec2 &cell) const
+        {
+            uint32_t h = static_cast<uint32_t>(cell.x) * 0x9E3779B1u ^ static_cast<uint32_t>(cell.y) * 0x85EBCA77u;
+            h ^= h >> 15;
+            return h & m_mask;
+        }
+
+        const Slot *findSlot(const glm::ivec2 &cell) const
+        {
+            uint32_t index = hashCell(cell);
+            while (m_slots[index].count != 0)
+            {
+                const Slot &slot = m_slots[index];
+                if (slot.cx == cell.x && slot.cy == cell.y)
+                    return &slot;
+                index = (index + 1) & m_mask;
+            }
+            return nullptr;
+        }
+
+        static bool inRect(const glm::vec2 &p, const glm::vec2 &lo, const glm::vec2 &hi)
+        {
+            return p.x >= lo.x && p.x <= hi.x && p.y >= lo.y && p.y <= hi.y;
+        }
+
+        glm::vec2 m_cellSize{64.0f};
+        glm::vec2 m_invCellSize{1.0f / 64.0f};
+        std::vector<Item> m_pending;     // insert() 暂存
+        std::vector<Item> m_items;       // build() 后按单元格连续排列
+        std::vector<Slot> m_slots{Slot{}};
+        std::vector<uint32_t> m_itemSlot; // build() 临时：条目 → 槽位
+        uint32_t m_mask = 0;
+        size_t m_cellCount = 0;
+        glm::vec2 m_bounds[2]{};
+        mutable std::vector<std::pair<float, const Item *>> m_nearestHeap;
+    };
+} // namespace engine::utils
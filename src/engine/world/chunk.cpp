@@ -1,4 +1,5 @@
 #include "chunk.h"
+#include "tile_kind_table.h"
 #include "../render/renderer.h"
 #include "../world/world_config.h"
 #include "../core/context.h"
@@ -10,6 +11,7 @@
 #include <glm/glm.hpp>
 #include <spdlog/spdlog.h>
 #include <box2d/box2d.h>
+#include <algorithm>
 
 namespace engine::world
 {
@@ -129,13 +131,76 @@ namespace engine::world
             push(p3, u1, v1);
             push(p2, u0, v1);
         }
+
+        // 按瓦片遍历并生成正面/顶面/侧面四边形；append(p0,p1,p2,p3,uvRect,color)
+        template <typename AppendFn>
+        void emitChunkQuads(const TileData *tiles,
+                            int chunkY,
+                            const glm::ivec2 &tileSize,
+                            AppendFn &&append)
+        {
+            constexpr int SIZE = Chunk::SIZE;
+            const float depthX = tileSize.x * kPseudoDepthX;
+            const float depthY = tileSize.y * kPseudoDepthY;
+            const auto &kinds = TileKindTable::shared();
+
+            for (int ly = 0; ly < SIZE; ++ly)
+            {
+                for (int lx = 0; lx < SIZE; ++lx)
+                {
+                    const auto &tile = tiles[ly * SIZE + lx];
+                    if (tile.type == TileType::Air)
+                        continue;
+                    const glm::vec4 &uvRect = kinds.uvRect(tile);
+
+                    float x0 = lx * tileSize.x;
+                    float y0 = (float)(ly * tileSize.y);
+                    float x1 = x0 + (float)tileSize.x;
+                    float y1 = y0 + (float)tileSize.y;
+
+                    glm::vec2 frontTL{x0, y0};
+                    glm::vec2 frontTR{x1, y0};
+                    glm::vec2 frontBL{x0, y1};
+                    glm::vec2 frontBR{x1, y1};
+                    glm::vec2 backTL{x0 - depthX, y0 - depthY};
+                    glm::vec2 backTR{x1 - depthX, y0 - depthY};
+                    glm::vec2 backBR{x1 - depthX, y1 - depthY};
+
+                    // GroundDecor / WallDecor（2.5D 平面瓦片）：只画平面，不加顶面/侧面
+                    if (tile.type == TileType::GroundDecor || tile.type == TileType::WallDecor)
+                    {
+                        // GroundDecor 深度渐变：wy=1（远端暗 0.60）→ wy=5（前端亮 1.08），营造草地透视走廊感
+                        float tileLight = (tile.type == TileType::GroundDecor)
+                            ? (0.60f + (float)(chunkY * SIZE + ly - 1) * 0.12f)
+                            : 1.0f;
+                        append(frontTL, frontTR, frontBL, frontBR, uvRect, faceTint(tile.type, tileLight));
+                        continue;
+                    }
+
+                    append(frontTL, frontTR, frontBL, frontBR, uvRect, faceTint(tile.type, 1.0f));
+
+                    bool topVisible = (ly == 0) || (tiles[(ly - 1) * SIZE + lx].type == TileType::Air);
+                    bool rightVisible = (lx == SIZE - 1) || (tiles[ly * SIZE + (lx + 1)].type == TileType::Air);
+
+                    if (topVisible)
+                    {
+                        // 顶面：受光面，大幅提亮，营造 DNF 光照感
+                        append(backTL, backTR, frontTL, frontTR, uvRect, faceTint(tile.type, 1.35f));
+                    }
+                    if (rightVisible)
+                    {
+                        // 侧面/阴影面：深度暗化，增强立体感
+                        append(frontTR, backTR, frontBR, backBR, uvRect, faceTint(tile.type, 0.46f));
+                    }
+                }
+            }
+        }
     }
 
     Chunk::Chunk(int chunkX, int chunkY)
         : m_chunkX(chunkX), m_chunkY(chunkY)
     {
-        for (auto &tile : m_tiles)
-            tile = TileData(TileType::Air);
+        m_tiles.fill(TileData(TileType::Air));
     }
 
     Chunk::~Chunk()
@@ -150,9 +215,43 @@ namespace engine::world
         }
     }
 
-    bool Chunk::buildMesh(const std::string &textureId,
-                          const glm::ivec2 &tileSize,
-                          engine::resource::ResourceManager *resMgr)
+    void Chunk::buildMeshData(const TileData *tiles,
+                              int chunkY,
+                              const glm::ivec2 &tileSize,
+                              const glm::vec2 &textureSize,
+                              bool glLayout,
+                              ChunkMeshData &out)
+    {
+        out.glLayout = glLayout;
+        out.gpuVertices.clear();
+        out.glVertices.clear();
+        if (textureSize.x <= 0.0f || textureSize.y <= 0.0f)
+            return;
+
+        const float inv_w = 1.0f / textureSize.x;
+        const float inv_h = 1.0f / textureSize.y;
+
+        if (glLayout)
+        {
+            out.glVertices.reserve(SIZE * SIZE * 18 * 8);
+            emitChunkQuads(tiles, chunkY, tileSize,
+                           [&](const glm::vec2 &p0, const glm::vec2 &p1, const glm::vec2 &p2, const glm::vec2 &p3,
+                               const glm::vec4 &uvRect, const glm::vec4 &color)
+                           { appendQuadGL(out.glVertices, p0, p1, p2, p3, uvRect, inv_w, inv_h, color); });
+        }
+        else
+        {
+            out.gpuVertices.reserve(SIZE * SIZE * 18);
+            emitChunkQuads(tiles, chunkY, tileSize,
+                           [&](const glm::vec2 &p0, const glm::vec2 &p1, const glm::vec2 &p2, const glm::vec2 &p3,
+                               const glm::vec4 &uvRect, const glm::vec4 &color)
+                           { appendQuad(out.gpuVertices, p0, p1, p2, p3, uvRect, inv_w, inv_h, color); });
+        }
+    }
+
+    bool Chunk::uploadMesh(const std::string &textureId,
+                           const ChunkMeshData &mesh,
+                           engine::resource::ResourceManager *resMgr)
     {
         m_textureId = textureId;
         SDL_GPUDevice *device = resMgr->getGPUDevice();
@@ -167,86 +266,19 @@ namespace engine::world
         m_batches.clear();
 
         SDL_GPUTexture *texture = resMgr->getGPUTexture(m_textureId);
-        glm::vec2 texture_size = resMgr->getTextureSize(m_textureId);
-        if (!texture || texture_size.x <= 0.0f || texture_size.y <= 0.0f)
+        if (!texture)
             return false;
 
-        std::unordered_map<SDL_GPUTexture *, std::vector<engine::render::GPUVertex>> tempVertices;
-        auto &vertices = tempVertices[texture];
-        vertices.reserve(SIZE * SIZE * 18);
-
-        float inv_w = 1.0f / texture_size.x;
-        float inv_h = 1.0f / texture_size.y;
-        float depthX = tileSize.x * kPseudoDepthX;
-        float depthY = tileSize.y * kPseudoDepthY;
-
-        for (int ly = 0; ly < SIZE; ++ly)
-        {
-            for (int lx = 0; lx < SIZE; ++lx)
-            {
-                const auto &tile = m_tiles[ly * SIZE + lx];
-                if (tile.type == TileType::Air)
-                    continue;
-
-                float x0 = lx * tileSize.x;
-                float y0 = (float)(ly * tileSize.y);
-                float x1 = x0 + (float)tileSize.x;
-                float y1 = y0 + (float)tileSize.y;
-
-                glm::vec2 frontTL{x0, y0};
-                glm::vec2 frontTR{x1, y0};
-                glm::vec2 frontBL{x0, y1};
-                glm::vec2 frontBR{x1, y1};
-                glm::vec2 backTL{x0 - depthX, y0 - depthY};
-                glm::vec2 backTR{x1 - depthX, y0 - depthY};
-                glm::vec2 backBL{x0 - depthX, y1 - depthY};
-                glm::vec2 backBR{x1 - depthX, y1 - depthY};
-
-                // GroundDecor / WallDecor（2.5D 平面瓦片）：只画平面，不加顶面/侧面
-                if (tile.type == TileType::GroundDecor || tile.type == TileType::WallDecor)
-                {
-                    // GroundDecor 深度渐变：wy=1（远端暗 0.60）→ wy=5（前端亮 1.08），营造草地透视走廊感
-                    float tileLight = (tile.type == TileType::GroundDecor)
-                        ? (0.60f + (float)(m_chunkY * SIZE + ly - 1) * 0.12f)
-                        : 1.0f;
-                    appendQuad(vertices, frontTL, frontTR, frontBL, frontBR,
-                               tile.uv_rect, inv_w, inv_h, faceTint(tile.type, tileLight));
-                    continue;
-                }
-
-                appendQuad(vertices, frontTL, frontTR, frontBL, frontBR,
-                           tile.uv_rect, inv_w, inv_h, faceTint(tile.type, 1.0f));
-
-                bool topVisible = (ly == 0) || (m_tiles[(ly - 1) * SIZE + lx].type == TileType::Air);
-                bool rightVisible = (lx == SIZE - 1) || (m_tiles[ly * SIZE + (lx + 1)].type == TileType::Air);
-
-                if (topVisible)
-                {
-                    // 顶面：受光面，大幅提亮，营造 DNF 光照感
-                    appendQuad(vertices, backTL, backTR, frontTL, frontTR,
-                               tile.uv_rect, inv_w, inv_h, faceTint(tile.type, 1.35f));
-                }
-                if (rightVisible)
-                {
-                    // 侧面/阴影面：深度暗化，增强立体感
-                    appendQuad(vertices, frontTR, backTR, frontBR, backBR,
-                               tile.uv_rect, inv_w, inv_h, faceTint(tile.type, 0.46f));
-                }
-            }
-        }
-
-        for (const auto &[batchTexture, batchVertices] : tempVertices)
+        const auto &batchVertices = mesh.gpuVertices;
+        if (!batchVertices.empty())
         {
-            if (batchVertices.empty())
-                continue;
-
             size_t dataSize = batchVertices.size() * sizeof(engine::render::GPUVertex);
             SDL_GPUBufferCreateInfo bufInfo{};
             bufInfo.usage = SDL_GPU_BUFFERUSAGE_VERTEX;
             bufInfo.size = dataSize;
             SDL_GPUBuffer *buffer = SDL_CreateGPUBuffer(device, &bufInfo);
             if (!buffer)
-                continue;
+                return false;
 
             SDL_GPUTransferBufferCreateInfo tbInfo{};
             tbInfo.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
@@ -265,88 +297,56 @@ namespace engine::world
             SDL_SubmitGPUCommandBuffer(cmd);
 
             SDL_ReleaseGPUTransferBuffer(device, staging);
-            m_batches[batchTexture] = {buffer, (Uint32)batchVertices.size()};
+            m_batches[texture] = {buffer, (Uint32)batchVertices.size()};
         }
 
         m_dirty = false;
         return true;
     }
 
-    bool Chunk::buildMeshGL(const std::string &textureId,
-                             const glm::ivec2 &tileSize,
+    bool Chunk::uploadMeshGL(const std::string &textureId,
+                             const ChunkMeshData &mesh,
                              engine::resource::ResourceManager *resMgr,
                              engine::render::Renderer &renderer)
     {
         m_textureId = textureId;
         m_gl_tex = resMgr->getGLTexture(textureId);
-        glm::vec2 texture_size = resMgr->getTextureSize(textureId);
-        if (!m_gl_tex || texture_size.x == 0 || texture_size.y == 0)
+        if (!m_gl_tex)
             return false;
 
-        std::vector<float> vertices;
-        vertices.reserve(SIZE * SIZE * 18 * 8);
-
-        float inv_w = 1.0f / texture_size.x;
-        float inv_h = 1.0f / texture_size.y;
-        float depthX = tileSize.x * kPseudoDepthX;
-        float depthY = tileSize.y * kPseudoDepthY;
+        bool ok = renderer.buildChunkMeshGL(m_gl_vao, m_gl_vbo, m_gl_vertex_count, mesh.glVertices);
+        if (ok) m_dirty = false;
+        return ok;
+    }
 
-        for (int ly = 0; ly < SIZE; ++ly)
-        {
-            for (int lx = 0; lx < SIZE; ++lx)
-            {
-                const auto &tile = m_tiles[ly * SIZE + lx];
-                if (tile.type == TileType::Air)
-                    continue;
-
-                float x0 = lx * tileSize.x;
-                float y0 = (float)(ly * tileSize.y);
-                float x1 = x0 + (float)tileSize.x;
-                float y1 = y0 + (float)tileSize.y;
-
-                glm::vec2 frontTL{x0, y0};
-                glm::vec2 frontTR{x1, y0};
-                glm::vec2 frontBL{x0, y1};
-                glm::vec2 frontBR{x1, y1};
-                glm::vec2 backTL{x0 - depthX, y0 - depthY};
-                glm::vec2 backTR{x1 - depthX, y0 - depthY};
-                glm::vec2 backBL{x0 - depthX, y1 - depthY};
-                glm::vec2 backBR{x1 - depthX, y1 - depthY};
-
-                // GroundDecor / WallDecor（2.5D 平面瓦片）：只画平面，不加顶面/侧面
-                if (tile.type == TileType::GroundDecor || tile.type == TileType::WallDecor)
-                {
-                    // GroundDecor 深度渐变：wy=1（远端暗 0.60）→ wy=5（前端亮 1.08），营造草地透视走廊感
-                    float tileLight = (tile.type == TileType::GroundDecor)
-                        ? (0.60f + (float)(m_chunkY * SIZE + ly - 1) * 0.12f)
-                        : 1.0f;
-                    appendQuadGL(vertices, frontTL, frontTR, frontBL, frontBR,
-                                 tile.uv_rect, inv_w, inv_h, faceTint(tile.type, tileLight));
-                    continue;
-                }
+    bool Chunk::buildMesh(const std::string &textureId,
+                          const glm::ivec2 &tileSize,
+                          engine::resource::ResourceManager *resMgr)
+    {
+        if (!resMgr->getGPUDevice())
+            return false;
 
-                appendQuadGL(vertices, frontTL, frontTR, frontBL, frontBR,
-                             tile.uv_rect, inv_w, inv_h, faceTint(tile.type, 1.0f));
+        glm::vec2 texture_size = resMgr->getTextureSize(textureId);
+        if (texture_size.x <= 0.0f || texture_size.y <= 0.0f)
+            return false;
 
-                bool topVisible = (ly == 0) || (m_tiles[(ly - 1) * SIZE + lx].type == TileType::Air);
-                bool rightVisible = (lx == SIZE - 1) || (m_tiles[ly * SIZE + (lx + 1)].type == TileType::Air);
+        ChunkMeshData mesh;
+        buildMeshData(m_tiles.data(), m_chunkY, tileSize, texture_size, false, mesh);
+        return uploadMesh(textureId, mesh, resMgr);
+    }
 
-                if (topVisible)
-                {
-                    appendQuadGL(vertices, backTL, backTR, frontTL, frontTR,
-                                 tile.uv_rect, inv_w, inv_h, faceTint(tile.type, 1.35f));
-                }
-                if (rightVisible)
-                {
-                    appendQuadGL(vertices, frontTR, backTR, frontBR, backBR,
-                                 tile.uv_rect, inv_w, inv_h, faceTint(tile.type, 0.46f));
-                }
-            }
-        }
+    bool Chunk::buildMeshGL(const std::string &textureId,
+                             const glm::ivec2 &tileSize,
+                             engine::resource::ResourceManager *resMgr,
+                             engine::render::Renderer &renderer)
+    {
+        glm::vec2 texture_size = resMgr->getTextureSize(textureId);
+        if (texture_size.x == 0 || texture_size.y == 0)
+            return false;
 
-        bool ok = renderer.buildChunkMeshGL(m_gl_vao, m_gl_vbo, m_gl_vertex_count, vertices);
-        if (ok) m_dirty = false;
-        return ok;
+        ChunkMeshData mesh;
+        buildMeshData(m_tiles.data(), m_chunkY, tileSize, texture_size, true, mesh);
+        return uploadMeshGL(textureId, mesh, resMgr, renderer);
     }
 
     void Chunk::render(engine::core::Context &ctx)
@@ -365,25 +365,32 @@ namespace engine::world
             ctx.getRenderer().drawChunkBatches(ctx.getCamera(), m_batches, worldOffset);
     }
 
-    void Chunk::createPhysicsBodies(engine::physics::PhysicsManager *physicsMgr, glm::vec2 tileSize, float pixelsPerMeter)
+    void Chunk::createPhysicsBodies(engine::physics::PhysicsManager *physicsMgr, glm::vec2 tileSize, float pixelsPerMeter,
+                                    ChunkColliderMode mode)
     {
         m_tileSize = tileSize;
+        m_colliderMode = mode;
         rebuildPhysicsBodies(physicsMgr, pixelsPerMeter);
     }
 
     void Chunk::destroyPhysicsBodies(engine::physics::PhysicsManager *physicsMgr)
     {
-        if (!physicsMgr)
+        if (physicsMgr)
         {
-            m_physicsBodies.clear();
-            return;
+            std::array<b2BodyId, SIZE * MAX_RUNS_PER_ROW> ids;
+            int count = 0;
+            for (const auto &row : m_physicsRows)
+            {
+                for (int i = 0; i < row.count; ++i)
+                    ids[count++] = row.bodies[i];
+            }
+            physicsMgr->destroyBodies(ids.data(), count);
+            physicsMgr->destroyBody(m_compoundBody);
         }
 
-        for (const auto &bodyId : m_physicsBodies)
-        {
-            physicsMgr->destroyBody(bodyId);
-        }
-        m_physicsBodies.clear();
+        for (auto &row : m_physicsRows)
+            row.count = 0;
+        m_compoundBody = b2_nullBodyId;
     }
 
     void Chunk::rebuildPhysicsBodies(engine::physics::PhysicsManager *physicsMgr, float pixelsPerMeter)
@@ -393,43 +400,113 @@ namespace engine::world
         if (!physicsMgr)
             return;
 
+        if (m_colliderMode != ChunkColliderMode::RowRuns)
+        {
+            buildCompoundBody(physicsMgr, pixelsPerMeter);
+            return;
+        }
+
+        // 先收集整块所有行的碰撞盒，再一次性批量创建
+        std::array<engine::physics::StaticBoxDesc, SIZE * MAX_RUNS_PER_ROW> boxes;
+        std::array<int, SIZE> rowCounts{};
+        int total = 0;
+        for (int ly = 0; ly < SIZE; ++ly)
+        {
+            rowCounts[ly] = collectRowBoxes(ly, pixelsPerMeter, boxes.data() + total);
+            total += rowCounts[ly];
+        }
+
+        std::array<b2BodyId, SIZE * MAX_RUNS_PER_ROW> ids;
+        physicsMgr->createStaticBodies(boxes.data(), total, ids.data());
+
+        int cursor = 0;
         for (int ly = 0; ly < SIZE; ++ly)
         {
-            int lx = 0;
-            while (lx < SIZE)
+            PhysicsRow &row = m_physicsRows[ly];
+            for (int i = 0; i < rowCounts[ly]; ++i)
             {
-                // 跳过无物理体的瓦片（Air、GroundDecor、WallDecor）
-                auto isPhysicsSkip = [](TileType t) {
-                    return t == TileType::Air || t == TileType::GroundDecor || t == TileType::WallDecor;
-                };
-                while (lx < SIZE && isPhysicsSkip(m_tiles[ly * SIZE + lx].type))
-                {
-                    ++lx;
-                }
+                const b2BodyId bodyId = ids[cursor++];
+                if (B2_IS_NON_NULL(bodyId))
+                    row.bodies[row.count++] = bodyId;
+            }
+        }
+    }
 
-                if (lx >= SIZE)
-                    break;
+    void Chunk::rebuildPhysicsRow(engine::physics::PhysicsManager *physicsMgr, int localY, float pixelsPerMeter)
+    {
+        if (!physicsMgr || localY < 0 || localY >= SIZE)
+            return;
 
-                int runStart = lx;
-                while (lx < SIZE && !isPhysicsSkip(m_tiles[ly * SIZE + lx].type))
-                {
-                    ++lx;
-                }
+        if (m_colliderMode != ChunkColliderMode::RowRuns)
+        {
+            // 极大矩形 / 轮廓会跨行变化，整块一个物理体，重建它即可
+            physicsMgr->destroyBody(m_compoundBody);
+            m_compoundBody = b2_nullBodyId;
+            buildCompoundBody(physicsMgr, pixelsPerMeter);
+            return;
+        }
 
-                int runLength = lx - runStart;
-                float runWidth = runLength * m_tileSize.x;
-                float worldX = (m_chunkX * SIZE + runStart) * m_tileSize.x + runWidth * 0.5f;
-                float worldY = (m_chunkY * SIZE + ly) * m_tileSize.y + m_tileSize.y * 0.5f;
-                b2Vec2 physPos = {worldX / pixelsPerMeter, worldY / pixelsPerMeter};
-                b2Vec2 halfSize = {runWidth * 0.5f / pixelsPerMeter, m_tileSize.y * 0.5f / pixelsPerMeter};
+        PhysicsRow &row = m_physicsRows[localY];
+        physicsMgr->destroyBodies(row.bodies.data(), row.count);
+        row.count = 0;
 
-                b2BodyId bodyId = physicsMgr->createStaticBody(physPos, halfSize, nullptr);
-                if (b2Body_IsValid(bodyId))
-                {
-                    m_physicsBodies.push_back(bodyId);
-                }
+        std::array<engine::physics::StaticBoxDesc, MAX_RUNS_PER_ROW> boxes;
+        const int boxCount = collectRowBoxes(localY, pixelsPerMeter, boxes.data());
+        std::array<b2BodyId, MAX_RUNS_PER_ROW> ids;
+        physicsMgr->createStaticBodies(boxes.data(), boxCount, ids.data());
+        for (int i = 0; i < boxCount; ++i)
+        {
+            if (B2_IS_NON_NULL(ids[i]))
+                row.bodies[row.count++] = ids[i];
+        }
+    }
+
+    int Chunk::collectRowBoxes(int ly, float pixelsPerMeter, engine::physics::StaticBoxDesc *out) const
+    {
+        std::array<ChunkColliderRect, MAX_RUNS_PER_ROW> runs;
+        const int count = ChunkColliderBuilder::buildRowRuns(m_tiles, ly, runs.data());
+        for (int i = 0; i < count; ++i)
+        {
+            const ChunkColliderRect &run = runs[i];
+            float runWidth = run.w * m_tileSize.x;
+            float worldX = (m_chunkX * SIZE + run.x) * m_tileSize.x + runWidth * 0.5f;
+            float worldY = (m_chunkY * SIZE + ly) * m_tileSize.y + m_tileSize.y * 0.5f;
+            out[i].position = {worldX / pixelsPerMeter, worldY / pixelsPerMeter};
+            out[i].halfSize = {runWidth * 0.5f / pixelsPerMeter, m_tileSize.y * 0.5f / pixelsPerMeter};
+        }
+        return count;
+    }
+
+    void Chunk::buildCompoundBody(engine::physics::PhysicsManager *physicsMgr, float pixelsPerMeter)
+    {
+        // 物理体原点 = 区块左上角（米），形状用区块内局部坐标
+        const glm::vec2 tileMeters = m_tileSize / pixelsPerMeter;
+        const b2Vec2 origin = {m_chunkX * SIZE * tileMeters.x, m_chunkY * SIZE * tileMeters.y};
+
+        if (m_colliderMode == ChunkColliderMode::Rectangles)
+        {
+            std::vector<ChunkColliderRect> rects;
+            std::vector<engine::physics::StaticBoxDesc> boxes;
+            rects.reserve(TILE_COUNT / 2);
+            boxes.reserve(TILE_COUNT / 2);
+            ChunkColliderBuilder::buildRectangles(m_tiles, rects);
+            for (const ChunkColliderRect &rect : rects)
+            {
+                const glm::vec2 half = glm::vec2(rect.w, rect.h) * tileMeters * 0.5f;
+                boxes.push_back({{rect.x * tileMeters.x + half.x, rect.y * tileMeters.y + half.y}, {half.x, half.y}});
             }
+            m_compoundBody = physicsMgr->createStaticCompoundBody(origin, boxes.data(), static_cast<int>(boxes.size()));
+            return;
         }
+
+        ChunkColliderOutline outline;
+        ChunkColliderBuilder::buildOutline(m_tiles, outline);
+        std::vector<b2Vec2> points;
+        points.reserve(outline.points.size());
+        for (const glm::ivec2 &p : outline.points)
+            points.push_back({p.x * tileMeters.x, p.y * tileMeters.y});
+        m_compoundBody = physicsMgr->createStaticChainBody(origin, points.data(), outline.loopSizes.data(),
+                                                           static_cast<int>(outline.loopSizes.size()));
     }
 
 } // namespace engine::world
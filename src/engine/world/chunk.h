@@ -1,5 +1,7 @@
 #pragma once
 #include "tile_info.h"
+#include "chunk_collider_builder.h"
+#include "../render/render_types.h"
 #include <glm/glm.hpp>
 #include <array>
 #include <vector>
@@ -12,7 +14,7 @@
 struct SDL_GPUTexture;
 namespace engine::core{ class Context;}
 namespace engine::resource{class ResourceManager;}
-namespace engine::physics{class PhysicsManager;}
+namespace engine::physics{class PhysicsManager; struct StaticBoxDesc;}
 namespace engine::render
 {
     class Camera;
@@ -25,11 +27,24 @@ namespace engine::world
         SDL_GPUBuffer *vertexBuffer = nullptr;
         Uint32 vertexCount = 0;
     };
+
+    /**
+     * @brief 区块的 CPU 侧网格数据（不触碰任何 GPU/GL 对象，可在工作线程构建）
+     * 两条渲染路径二选一填充：SDL GPU 用 gpuVertices，OpenGL 用 glVertices（pos2 color4 uv2）
+     */
+    struct ChunkMeshData
+    {
+        std::vector<engine::render::GPUVertex> gpuVertices;
+        std::vector<float> glVertices;
+        bool glLayout = false;
+    };
+
     class Chunk
     {
     public:
         static constexpr int SIZE = 8; // 每个块 8x8 瓦片
         static constexpr int TILE_COUNT = SIZE * SIZE;
+        static_assert(SIZE == WorldConfig::CHUNK_SIZE, "Chunk::SIZE 必须与 WorldConfig::CHUNK_SIZE 一致");
 
         Chunk(int chunkX, int chunkY);
         ~Chunk();
@@ -38,10 +53,36 @@ namespace engine::world
         engine::world::TileData &tileAt(int localX, int localY) { return m_tiles[localY * SIZE + localX]; }
         const engine::world::TileData &tileAt(int localX, int localY) const { return m_tiles[localY * SIZE + localX]; }
 
+        // 整块替换 / 读取瓦片（POD，直接 memcpy）
+        void assignTiles(const engine::world::ChunkTiles &tiles) { m_tiles = tiles; }
+        const engine::world::ChunkTiles &tiles() const { return m_tiles; }
+
         // 标记块需要重新生成网格（例如瓦片变化时）
         void setDirty() { m_dirty = true; }
         bool isDirty() const { return m_dirty; }
 
+        // 持久化标记：瓦片自上次写入区域缓存后有变化（与网格脏标记独立）
+        void markModified() { m_modified = true; }
+        void clearModified() { m_modified = false; }
+        bool isModified() const { return m_modified; }
+
+        // 纯 CPU 网格构建：线程安全，只读入参。textureSize 为图集像素尺寸
+        static void buildMeshData(const engine::world::TileData *tiles,
+                                  int chunkY,
+                                  const glm::ivec2 &tileSize,
+                                  const glm::vec2 &textureSize,
+                                  bool glLayout,
+                                  ChunkMeshData &out);
+
+        // 上传已构建的 CPU 网格（必须在主线程/渲染线程调用）
+        bool uploadMesh(const std::string &textureId,
+                        const ChunkMeshData &mesh,
+                        engine::resource::ResourceManager *resMgr);
+        bool uploadMeshGL(const std::string &textureId,
+                          const ChunkMeshData &mesh,
+                          engine::resource::ResourceManager *resMgr,
+                          engine::render::Renderer &renderer);
+
         // 生成或更新顶点数据（基于当前瓦片状态）
         bool buildMesh(const std::string &textureId,
                        const glm::ivec2 &tileSize,
@@ -63,6 +104,9 @@ namespace engine::world
             return glm::ivec2(m_chunkX * SIZE, m_chunkY * SIZE);
         }
 
+        // 区块坐标（单位：区块）
+        glm::ivec2 getCoord() const { return glm::ivec2(m_chunkX, m_chunkY); }
+
         glm::vec2 getWorldPosition(const glm::ivec2 &tileSize) const
         {
             return glm::vec2(m_chunkX * SIZE * tileSize.x, m_chunkY * SIZE * tileSize.y);
@@ -76,18 +120,42 @@ namespace engine::world
             return cx == m_chunkX && cy == m_chunkY;
         }
 
-        // 新增：创建/销毁物理体, 与物理管理器交互
-        void createPhysicsBodies(engine::physics::PhysicsManager *physicsMgr, glm::vec2 m_tileSize, float pixelsPerMeter);
+        // 新增：创建/销毁物理体, 与物理管理器交互（整块走批量接口）
+        void createPhysicsBodies(engine::physics::PhysicsManager *physicsMgr, glm::vec2 m_tileSize, float pixelsPerMeter,
+                                 ChunkColliderMode mode = ChunkColliderMode::Rectangles);
         void destroyPhysicsBodies(engine::physics::PhysicsManager *physicsMgr);
         void rebuildPhysicsBodies(engine::physics::PhysicsManager *physicsMgr, float pixelsPerMeter);
+        // 增量：RowRuns 模式只重建 localY 这一行的合并碰撞段；复合模式整块只有一个物理体，直接重建该物理体
+        void rebuildPhysicsRow(engine::physics::PhysicsManager *physicsMgr, int localY, float pixelsPerMeter);
+
+        void setColliderMode(ChunkColliderMode mode) { m_colliderMode = mode; }
+        ChunkColliderMode getColliderMode() const { return m_colliderMode; }
+
+        // 该瓦片类型是否生成碰撞体（Air、GroundDecor、WallDecor 不生成）
+        static bool hasCollision(TileType type) { return tileHasCollision(type); }
 
     private:
+        // 每行横向合并后的碰撞段
+        static constexpr int MAX_RUNS_PER_ROW = ChunkColliderBuilder::MAX_RUNS_PER_ROW;
+        struct PhysicsRow
+        {
+            std::array<b2BodyId, MAX_RUNS_PER_ROW> bodies{};
+            int count = 0;
+        };
+
+        // 生成 localY 行的合并碰撞盒，返回数量（out 至少 MAX_RUNS_PER_ROW 个）
+        int collectRowBoxes(int localY, float pixelsPerMeter, engine::physics::StaticBoxDesc *out) const;
+        void buildCompoundBody(engine::physics::PhysicsManager *physicsMgr, float pixelsPerMeter);
+
         int m_chunkX, m_chunkY;
         glm::vec2 m_tileSize;
-        std::array<engine::world::TileData, TILE_COUNT> m_tiles;
-        std::vector<b2BodyId> m_physicsBodies;
+        engine::world::ChunkTiles m_tiles;
+        std::array<PhysicsRow, SIZE> m_physicsRows{};               // RowRuns 模式
+        b2BodyId m_compoundBody = b2_nullBodyId;                      // Rectangles / Chains 模式
+        ChunkColliderMode m_colliderMode = ChunkColliderMode::Rectangles;
 
         bool m_dirty = true;     // 是否需要重新生成网格
+        bool m_modified = false; // 是否需要写回区域缓存
         size_t m_indexCount = 0; // 索引数量
 
         // 纹理图集ID（每个块使用同一个图集，实际可以全局统一）
@@ -0,0 +1,164 @@
+#include "chunk_collider_builder.h"
+#include <array>
+
+namespace engine::world
+{
+    namespace
+    {
+        constexpr int SIZE = ChunkColliderBuilder::SIZE;
+        constexpr int VERTS = SIZE + 1;
+
+        bool solidAt(const ChunkTiles &tiles, int x, int y)
+        {
+            if (x < 0 || y < 0 || x >= SIZE || y >= SIZE)
+                return false;
+            return tileHasCollision(tiles[y * SIZE + x].type);
+        }
+
+        // 方向：0 = +x, 1 = +y, 2 = -x, 3 = -y
+        constexpr glm::ivec2 kDirs[4] = {{1, 0}, {0, 1}, {-1, 0}, {0, -1}};
+
+        struct OutlineEdge
+        {
+            int from = 0;
+            int to = 0;
+            int dir = 0;
+            bool used = false;
+        };
+    }
+
+    int ChunkColliderBuilder::buildRowRuns(const ChunkTiles &tiles, int localY, ChunkColliderRect *out)
+    {
+        int count = 0;
+        int lx = 0;
+        while (lx < SIZE)
+        {
+            while (lx < SIZE && !solidAt(tiles, lx, localY))
+                ++lx;
+            if (lx >= SIZE)
+                break;
+
+            const int runStart = lx;
+            while (lx < SIZE && solidAt(tiles, lx, localY))
+                ++lx;
+            out[count++] = {runStart, localY, lx - runStart, 1};
+        }
+        return count;
+    }
+
+    void ChunkColliderBuilder::buildRectangles(const ChunkTiles &tiles, std::vector<ChunkColliderRect> &out)
+    {
+        std::array<bool, SIZE * SIZE> covered{};
+        auto open = [&](int x, int y)
+        { return solidAt(tiles, x, y) && !covered[y * SIZE + x]; };
+
+        for (int y = 0; y < SIZE; ++y)
+        {
+            for (int x = 0; x < SIZE; ++x)
+            {
+                if (!open(x, y))
+                    continue;
+
+                int w = 1;
+                while (x + w < SIZE && open(x + w, y))
+                    ++w;
+
+                int h = 1;
+                for (; y + h < SIZE; ++h)
+                {
+                    bool rowOpen = true;
+                    for (int i = 0; i < w && rowOpen; ++i)
+                        rowOpen = open(x + i, y + h);
+                    if (!rowOpen)
+                        break;
+                }
+
+                for (int dy = 0; dy < h; ++dy)
+                    for (int dx = 0; dx < w; ++dx)
+                        covered[(y + dy) * SIZE + x + dx] = true;
+                out.push_back({x, y, w, h});
+                x += w - 1;
+            }
+        }
+    }
+
+    void ChunkColliderBuilder::buildOutline(const ChunkTiles &tiles, ChunkColliderOutline &out)
+    {
+        out.clear();
+
+        // 1) 每个与空气（或区块边界）相邻的实心面生成一条有向单位边：外法线在边的右侧
+        std::vector<OutlineEdge> edges;
+        edges.reserve(SIZE * SIZE);
+        std::array<std::array<int, 2>, VERTS * VERTS> outgoing;
+        std::array<int, VERTS * VERTS> outgoingCount{};
+        auto vertex = [](int x, int y) { return x + y * VERTS; };
+        auto addEdge = [&](int x0, int y0, int x1, int y1, int dir)
+        {
+            const int from = vertex(x0, y0);
+            outgoing[from][outgoingCount[from]++] = static_cast<int>(edges.size());
+            edges.push_back({from, vertex(x1, y1), dir, false});
+        };
+
+        for (int y = 0; y < SIZE; ++y)
+        {
+            for (int x = 0; x < SIZE; ++x)
+            {
+                if (!solidAt(tiles, x, y))
+                    continue;
+                if (!solidAt(tiles, x, y - 1))
+                    addEdge(x, y, x + 1, y, 0);
+                if (!solidAt(tiles, x + 1, y))
+                    addEdge(x + 1, y, x + 1, y + 1, 1);
+                if (!solidAt(tiles, x, y + 1))
+                    addEdge(x + 1, y + 1, x, y + 1, 2);
+                if (!solidAt(tiles, x - 1, y))
+                    addEdge(x, y + 1, x, y, 3);
+            }
+        }
+
+        // 2) 沿边行走成环。鞍点（两条出边）选与入射方向叉积为正的一条，使对角瓦片各自成环
+        auto nextEdge = [&](const OutlineEdge &in)
+        {
+            const int v = in.to;
+            if (outgoingCount[v] == 1)
+                return outgoing[v][0];
+            const glm::ivec2 dIn = kDirs[in.dir];
+            for (int i = 0; i < outgoingCount[v]; ++i)
+            {
+                const glm::ivec2 dOut = kDirs[edges[outgoing[v][i]].dir];
+                if (dIn.x * dOut.y - dIn.y * dOut.x > 0)
+                    return outgoing[v][i];
+            }
+            return outgoing[v][0];
+        };
+
+        std::vector<int> loopEdges;
+        for (size_t start = 0; start < edges.size(); ++start)
+        {
+            if (edges[start].used)
+                continue;
+
+            loopEdges.clear();
+            int e = static_cast<int>(start);
+            while (!edges[e].used)
+            {
+                edges[e].used = true;
+                loopEdges.push_back(e);
+                e = nextEdge(edges[e]);
+            }
+
+            // 3) 只保留方向发生变化的拐点（合并共线单位边）
+            const size_t n = loopEdges.size();
+            const size_t before = out.points.size();
+            for (size_t i = 0; i < n; ++i)
+            {
+                const OutlineEdge &prev = edges[loopEdges[(i + n - 1) % n]];
+                const OutlineEdge &cur = edges[loopEdges[i]];
+                if (prev.dir == cur.dir)
+                    continue;
+                out.points.push_back({cur.from % VERTS, cur.from / VERTS});
+            }
+            out.loopSizes.push_back(static_cast<int>(out.points.size() - before));
+        }
+    }
+} // namespace engine::world
@@ -0,0 +1,66 @@
+// 区块碰撞几何生成（纯 CPU，不依赖 Box2D / 渲染，可在工具与基准中单独使用）
+// chunk_collider_builder.h
+//   - RowRuns    ：每行连续实心瓦片合并为一个盒体（旧模式，每段一个静态体）
+//   - Rectangles ：二维贪婪合并为极大矩形，整块一个静态体 + 多个多边形形状
+//   - Chains     ：沿实心/空气边界描出闭合轮廓，整块一个静态体 + 若干 b2ChainShape
+#pragma once
+#include "tile_info.h"
+#include <glm/vec2.hpp>
+#include <vector>
+
+namespace engine::world
+{
+    enum class ChunkColliderMode
+    {
+        RowRuns,
+        Rectangles,
+        Chains,
+    };
+
+    // 该瓦片类型是否生成碰撞体（Air、GroundDecor、WallDecor 不生成）
+    inline bool tileHasCollision(TileType type)
+    {
+        return type != TileType::Air && type != TileType::GroundDecor && type != TileType::WallDecor;
+    }
+
+    // 区块内矩形（瓦片单位，左上角 + 宽高）
+    struct ChunkColliderRect
+    {
+        int x = 0;
+        int y = 0;
+        int w = 0;
+        int h = 0;
+    };
+
+    // 区块轮廓：所有闭合环的顶点首尾相接存放，loopSizes[i] 为第 i 个环的顶点数（瓦片单位）
+    struct ChunkColliderOutline
+    {
+        std::vector<glm::ivec2> points;
+        std::vector<int> loopSizes;
+
+        void clear()
+        {
+            points.clear();
+            loopSizes.clear();
+        }
+    };
+
+    class ChunkColliderBuilder
+    {
+    public:
+        static constexpr int SIZE = WorldConfig::CHUNK_SIZE;
+        // 一行最多 SIZE/2 段（实心与空隙交替）
+        static constexpr int MAX_RUNS_PER_ROW = (SIZE + 1) / 2;
+
+        // 单行连续实心段（h 恒为 1），out 至少 MAX_RUNS_PER_ROW 个，返回段数
+        static int buildRowRuns(const ChunkTiles &tiles, int localY, ChunkColliderRect *out);
+        // 整块二维极大矩形：先沿 x 扩展宽度，再沿 y 扩展高度（逐行扫描，已覆盖的瓦片跳过）
+        static void buildRectangles(const ChunkTiles &tiles, std::vector<ChunkColliderRect> &out);
+        /**
+         * @brief 描出实心区域的闭合轮廓，共线边合并为一段
+         * 环的方向使外法线位于每条边的右侧（Box2D 链形单面碰撞约定），洞自动得到反向环。
+         * 对角相接的两个实心瓦片在公共顶点处拆为两个环。
+         */
+        static void buildOutline(const ChunkTiles &tiles, ChunkColliderOutline &out);
+    };
+} // namespace engine::world
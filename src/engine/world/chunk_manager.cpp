@@ -1,12 +1,15 @@
 #include "chunk_manager.h"
+#include <cstring>
 #include "terrain_generator.h"
 #include "../core/context.h"
+#include "../core/profiler.h"
 #include "../render/camera.h"
 #include "../render/renderer.h"
 #include "../resource/resource_manager.h"
 #include "world_config.h"
 #include "tile_info.h"
 #include <algorithm>
+#include <chrono>
 #include <set>
 #include <spdlog/spdlog.h>
 
@@ -19,11 +22,21 @@ namespace engine::world
                 : m_resMgr(resMgr),
           m_physicsMgr(physicsMgr)
                     , m_atlasTextureId(atlasTextureId)
+                    , m_atlasTexture(engine::resource::TextureRegistry::shared().acquire(atlasTextureId))
                     , m_tileSize(tileSize)
     {
+        m_streamer = std::make_unique<ChunkStreamer>();
     }
 
-    ChunkManager::~ChunkManager() = default;
+    ChunkManager::~ChunkManager()
+    {
+        // 先停掉工作线程（它们可能仍在使用 m_terrainGenerator / m_regionCache），再释放其余成员
+        m_inFlightLoads.clear();
+        m_streamer.reset();
+        // 改动过的区块写回缓存；RegionCache 析构时等待写线程排空
+        saveModifiedChunks();
+        m_regionCache.reset();
+    }
 
     void ChunkManager::rebuildChunkMesh(Chunk &chunk)
     {
@@ -70,13 +83,16 @@ namespace engine::world
         }
 
         TileData &currentTile = it->second->tileAt(lx, ly);
-        if (currentTile.type == tile.type)
+        if (currentTile == tile)
             return;
 
-        currentTile = std::move(tile);
-        it->second->setDirty();
-        it->second->rebuildPhysicsBodies(m_physicsMgr, WorldConfig::PIXELS_PER_METER);
-        rebuildChunkMesh(*it->second);
+        // 碰撞属性不变（如 Dirt → Stone）时无需触碰物理；否则只重建该行的合并段
+        const bool collisionChanged = Chunk::hasCollision(currentTile.type) != Chunk::hasCollision(tile.type);
+        currentTile = tile;
+        it->second->markModified();
+        if (collisionChanged)
+            it->second->rebuildPhysicsRow(m_physicsMgr, ly, WorldConfig::PIXELS_PER_METER);
+        markChunkDirty(key, *it->second, false);
     }
 
     void ChunkManager::setTileSilent(int worldX, int worldY, TileData tile)
@@ -94,27 +110,153 @@ namespace engine::world
         }
 
         TileData &currentTile = it->second->tileAt(lx, ly);
-        if (currentTile.type == tile.type)
+        if (currentTile == tile)
             return;
 
-        currentTile = std::move(tile);
-        it->second->setDirty(); // 只标脏，延迟重建
+        currentTile = tile;
+        it->second->markModified();
+        markChunkDirty(key, *it->second, true); // 只标脏，延迟重建
+    }
+
+    std::vector<glm::ivec2> ChunkManager::getLoadedChunkCoords() const
+    {
+        std::vector<glm::ivec2> coords;
+        coords.reserve(m_chunks.size());
+        for (const auto &[key, chunk] : m_chunks)
+            coords.push_back(chunk->getCoord());
+        return coords;
+    }
+
+    bool ChunkManager::copyChunkTiles(int chunkX, int chunkY, ChunkTiles &out) const
+    {
+        auto it = m_chunks.find(encodeChunkKey(chunkX, chunkY));
+        if (it == m_chunks.end())
+            return false;
+        out = it->second->tiles();
+        return true;
     }
 
-    void ChunkManager::rebuildDirtyChunks(int maxChunksToRebuild)
+    void ChunkManager::restoreChunkTiles(int chunkX, int chunkY, const ChunkTiles &tiles)
     {
-        int rebuiltCount = 0;
+        uint64_t key = encodeChunkKey(chunkX, chunkY);
+        auto it = m_chunks.find(key);
+        if (it == m_chunks.end())
+        {
+            loadChunk(chunkX, chunkY);
+            it = m_chunks.find(key);
+            if (it == m_chunks.end())
+                return;
+        }
+
+        // TileData 是 POD，整块比较即可跳过未改动的区块
+        if (std::memcmp(it->second->tiles().data(), tiles.data(), sizeof(ChunkTiles)) == 0)
+            return;
+        it->second->assignTiles(tiles);
+        it->second->markModified();
+        markChunkDirty(key, *it->second, true);
+    }
+
+    void ChunkManager::setColliderMode(ChunkColliderMode mode)
+    {
+        if (m_colliderMode == mode)
+            return;
+        m_colliderMode = mode;
         for (auto &[key, chunk] : m_chunks)
         {
-            if (chunk->isDirty())
-            {
-                chunk->rebuildPhysicsBodies(m_physicsMgr, WorldConfig::PIXELS_PER_METER);
-                rebuildChunkMesh(*chunk);
-                ++rebuiltCount;
-                if (maxChunksToRebuild >= 0 && rebuiltCount >= maxChunksToRebuild)
-                    break;
-            }
+            chunk->setColliderMode(mode);
+            chunk->rebuildPhysicsBodies(m_physicsMgr, WorldConfig::PIXELS_PER_METER);
+        }
+    }
+
+    void ChunkManager::markChunkDirty(uint64_t key, Chunk &chunk, bool physics)
+    {
+        chunk.setDirty();
+        m_dirtyMeshKeys.insert(key);
+        if (physics)
+            m_dirtyPhysicsKeys.insert(key);
+    }
+
+    void ChunkManager::rebuildDirtyPhysics()
+    {
+        if (m_dirtyPhysicsKeys.empty())
+            return;
+
+        const auto start = std::chrono::steady_clock::now();
+        int rebuilt = 0;
+        for (uint64_t key : m_dirtyPhysicsKeys)
+        {
+            auto it = m_chunks.find(key);
+            if (it == m_chunks.end())
+                continue;
+            it->second->rebuildPhysicsBodies(m_physicsMgr, WorldConfig::PIXELS_PER_METER);
+            ++rebuilt;
+        }
+        m_dirtyPhysicsKeys.clear();
+
+        m_rebuildStats.physicsRebuilt += rebuilt;
+        m_rebuildStats.physicsMs += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    void ChunkManager::rebuildDirtyChunks(float meshBudgetMs)
+    {
+        LSL_PROFILE_ZONE("ChunkManager::rebuildDirtyChunks");
+        rebuildDirtyPhysics();
+        if (m_dirtyMeshKeys.empty())
+            return;
+
+        // 优先级：(不可见, 到相机区块的距离²) 越小越先重建；相机每帧移动，因此每次调用重新建堆
+        struct Entry
+        {
+            int hidden;
+            int64_t distSq;
+            uint64_t key;
+        };
+        auto later = [](const Entry &a, const Entry &b)
+        {
+            return a.hidden != b.hidden ? a.hidden > b.hidden : a.distSq > b.distSq;
+        };
+
+        const engine::render::Camera *camera =
+            engine::core::Context::Current ? &engine::core::Context::Current->getCamera() : nullptr;
+        const glm::vec2 chunkWorldSize = glm::vec2(Chunk::SIZE * m_tileSize.x, Chunk::SIZE * m_tileSize.y);
+
+        std::vector<Entry> heap;
+        heap.reserve(m_dirtyMeshKeys.size());
+        for (uint64_t key : m_dirtyMeshKeys)
+        {
+            auto it = m_chunks.find(key);
+            if (it == m_chunks.end())
+                continue;
+            const glm::ivec2 coord = it->second->getCoord();
+            const int64_t dx = coord.x - m_focusChunk.x;
+            const int64_t dy = coord.y - m_focusChunk.y;
+            const bool visible = !camera || camera->isBoxInView(it->second->getWorldPosition(m_tileSize), chunkWorldSize);
+            heap.push_back({visible ? 0 : 1, dx * dx + dy * dy, key});
         }
+        std::make_heap(heap.begin(), heap.end(), later);
+
+        const auto start = std::chrono::steady_clock::now();
+        float elapsedMs = 0.0f;
+        while (!heap.empty())
+        {
+            std::pop_heap(heap.begin(), heap.end(), later);
+            const uint64_t key = heap.back().key;
+            heap.pop_back();
+
+            m_dirtyMeshKeys.erase(key);
+            rebuildChunkMesh(*m_chunks.at(key));
+            ++m_rebuildStats.meshRebuilt;
+
+            elapsedMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+            if (meshBudgetMs >= 0.0f && elapsedMs >= meshBudgetMs)
+                break;
+        }
+
+        // 已卸载区块的残留键顺带清掉
+        if (heap.empty())
+            m_dirtyMeshKeys.clear();
+        m_rebuildStats.meshMs += elapsedMs;
+        m_rebuildStats.meshBacklog = m_dirtyMeshKeys.size();
     }
 
     glm::ivec2 ChunkManager::worldToTile(const glm::vec2 &worldPos) const
@@ -150,6 +292,7 @@ namespace engine::world
         int camChunkX = static_cast<int>(std::floor(cameraPos.x / (Chunk::SIZE * m_tileSize.x)));
         int camChunkY = m_horizontalOnly ? m_fixedChunkRowY
                       : static_cast<int>(std::floor(cameraPos.y / (Chunk::SIZE * m_tileSize.y)));
+        m_focusChunk = {camChunkX, camChunkY};
 
         std::vector<uint64_t> toUnload;
         for (const auto &[key, chunk] : m_chunks)
@@ -189,6 +332,16 @@ namespace engine::world
             }
         }
 
+        // 已离开视野的在途任务直接取消，结果回到主线程时丢弃
+        std::vector<uint64_t> staleLoads;
+        for (const auto &[key, job] : m_inFlightLoads)
+        {
+            if (!desiredKeys.contains(key))
+                staleLoads.push_back(key);
+        }
+        for (auto key : staleLoads)
+            cancelInFlightLoad(key);
+
         if (!m_pendingChunkLoads.empty())
         {
             std::deque<std::pair<int, int>> filteredLoads;
@@ -224,7 +377,7 @@ namespace engine::world
         }
         else
         {
-            processPendingChunkLoads();
+            updateStreaming();
         }
 
         // 仅在区块集合发生变化时打印（避免每帧日志）
@@ -245,7 +398,7 @@ namespace engine::world
         const uint64_t key = encodeChunkKey(chunkX, chunkY);
         if (m_chunks.find(key) != m_chunks.end())
             return;
-        if (m_pendingChunkLoadKeys.contains(key))
+        if (m_pendingChunkLoadKeys.contains(key) || m_inFlightLoads.contains(key))
             return;
 
         m_pendingChunkLoads.emplace_back(chunkX, chunkY);
@@ -264,6 +417,221 @@ namespace engine::world
         }
     }
 
+    void ChunkManager::updateStreaming()
+    {
+        LSL_PROFILE_ZONE("ChunkManager::updateStreaming");
+        // 重建统计按帧累计：帧内额外的 rebuildDirtyPhysics / rebuildDirtyChunks 调用只会累加，不会清掉本帧已记的数
+        m_rebuildStats = {};
+        if (!m_asyncStreaming || !m_streamer)
+        {
+            processPendingChunkLoads();
+            return;
+        }
+
+        dispatchPendingChunkLoads();
+        integrateCompletedChunks();
+    }
+
+    void ChunkManager::setAsyncStreaming(bool enable)
+    {
+        if (m_asyncStreaming == enable)
+            return;
+
+        if (!enable)
+        {
+            // 在途任务退回同步队列
+            std::vector<std::pair<int, int>> requeue;
+            for (const auto &[key, job] : m_inFlightLoads)
+                requeue.emplace_back(job->chunkX, job->chunkY);
+            for (const auto &[cx, cy] : requeue)
+                cancelInFlightLoad(encodeChunkKey(cx, cy));
+            for (const auto &[cx, cy] : requeue)
+                enqueueChunkLoad(cx, cy);
+        }
+        m_asyncStreaming = enable;
+    }
+
+    ChunkStreamStats ChunkManager::getStreamStats() const
+    {
+        return m_streamer ? m_streamer->getStats() : ChunkStreamStats{};
+    }
+
+    std::vector<std::pair<int, int>> ChunkManager::cancelAllInFlightLoads()
+    {
+        std::vector<std::pair<int, int>> coords;
+        coords.reserve(m_inFlightLoads.size());
+        for (const auto &[key, job] : m_inFlightLoads)
+            coords.emplace_back(job->chunkX, job->chunkY);
+        for (const auto &[cx, cy] : coords)
+            cancelInFlightLoad(encodeChunkKey(cx, cy));
+        return coords;
+    }
+
+    void ChunkManager::enableRegionCache(const std::string &directory)
+    {
+        disableRegionCache();
+
+        // 在途任务可能已绕过缓存直接生成：全部取消，切换后重新排队
+        const auto requeue = cancelAllInFlightLoads();
+        m_regionCache = std::make_unique<RegionCache>(directory);
+        if (m_streamer)
+            m_streamer->setRegionCache(m_regionCache.get());
+        for (const auto &[cx, cy] : requeue)
+            enqueueChunkLoad(cx, cy);
+
+        // 已加载的区块视为未保存，卸载时写入新缓存
+        for (auto &[key, chunk] : m_chunks)
+            chunk->markModified();
+        spdlog::info("[ChunkManager] region cache enabled: {}", directory);
+    }
+
+    void ChunkManager::disableRegionCache()
+    {
+        if (!m_regionCache)
+            return;
+
+        const auto requeue = cancelAllInFlightLoads();
+        if (m_streamer)
+            m_streamer->setRegionCache(nullptr);
+        saveModifiedChunks(true);
+        m_regionCache.reset();
+        for (const auto &[cx, cy] : requeue)
+            enqueueChunkLoad(cx, cy);
+    }
+
+    RegionCacheStats ChunkManager::getRegionCacheStats() const
+    {
+        return m_regionCache ? m_regionCache->getStats() : RegionCacheStats{};
+    }
+
+    void ChunkManager::saveModifiedChunks(bool wait)
+    {
+        if (!m_regionCache)
+            return;
+        for (auto &[key, chunk] : m_chunks)
+        {
+            if (!chunk->isModified())
+                continue;
+            const glm::ivec2 coord = chunk->getCoord();
+            m_regionCache->store(coord.x, coord.y, chunk->tiles());
+            chunk->clearModified();
+        }
+        if (wait)
+            m_regionCache->flush();
+    }
+
+    bool ChunkManager::produceChunkTiles(int chunkX, int chunkY, ChunkTiles &tiles)
+    {
+        if (m_regionCache && m_regionCache->load(chunkX, chunkY, tiles))
+            return true;
+
+        tiles.fill(TileData(TileType::Air));
+        if (m_terrainGenerator)
+            m_terrainGenerator->generateChunk(chunkX, chunkY, tiles);
+        return false;
+    }
+
+    bool ChunkManager::streamingMeshParams(glm::vec2 &textureSize, bool &glLayout) const
+    {
+        textureSize = {0.0f, 0.0f};
+        glLayout = true;
+        if (!m_resMgr)
+            return false;
+
+        glLayout = (m_resMgr->getGPUDevice() == nullptr);
+        if (glLayout && !engine::core::Context::Current)
+            return false;
+
+        textureSize = m_resMgr->getTextureSize(m_atlasTexture);
+        return textureSize.x > 0.0f && textureSize.y > 0.0f;
+    }
+
+    void ChunkManager::dispatchPendingChunkLoads()
+    {
+        if (m_pendingChunkLoads.empty() || m_inFlightLoads.size() >= m_maxInFlightLoads)
+            return;
+
+        glm::vec2 textureSize;
+        bool glLayout = true;
+        streamingMeshParams(textureSize, glLayout);
+
+        while (!m_pendingChunkLoads.empty() && m_inFlightLoads.size() < m_maxInFlightLoads)
+        {
+            const auto [chunkX, chunkY] = m_pendingChunkLoads.front();
+            m_pendingChunkLoads.pop_front();
+            const uint64_t key = encodeChunkKey(chunkX, chunkY);
+            m_pendingChunkLoadKeys.erase(key);
+
+            if (m_horizontalOnly && chunkY != m_fixedChunkRowY)
+                continue;
+            if (m_chunks.find(key) != m_chunks.end() || m_inFlightLoads.contains(key))
+                continue;
+
+            m_inFlightLoads[key] = m_streamer->submit(chunkX, chunkY, m_tileSize, textureSize, glLayout);
+        }
+    }
+
+    void ChunkManager::integrateCompletedChunks()
+    {
+        float frameUploadMs = 0.0f;
+        int uploadsRemaining = m_streamingUploadBudget;
+        while (uploadsRemaining > 0)
+        {
+            std::unique_ptr<ChunkBuildJob> job(m_streamer->popCompleted());
+            if (!job)
+                break;
+            if (job->cancelled.load(std::memory_order_relaxed))
+                continue;
+
+            const uint64_t key = encodeChunkKey(job->chunkX, job->chunkY);
+            auto inFlight = m_inFlightLoads.find(key);
+            if (inFlight == m_inFlightLoads.end() || inFlight->second != job.get())
+                continue;
+            m_inFlightLoads.erase(inFlight);
+            if (m_chunks.find(key) != m_chunks.end())
+                continue;
+
+            const auto start = std::chrono::steady_clock::now();
+
+            auto chunk = std::make_unique<Chunk>(job->chunkX, job->chunkY);
+            chunk->assignTiles(job->tiles);
+            if (m_regionCache && !job->fromCache && m_cacheGeneratedChunks)
+                chunk->markModified();
+            chunk->createPhysicsBodies(m_physicsMgr, glm::vec2(m_tileSize), WorldConfig::PIXELS_PER_METER, m_colliderMode);
+
+            if (job->meshBuilt && job->glLayout)
+            {
+                if (engine::core::Context::Current)
+                    chunk->uploadMeshGL(m_atlasTextureId, job->mesh, m_resMgr, engine::core::Context::Current->getRenderer());
+            }
+            else if (job->meshBuilt)
+            {
+                chunk->uploadMesh(m_atlasTextureId, job->mesh, m_resMgr);
+            }
+            else
+            {
+                rebuildChunkMesh(*chunk);
+            }
+            m_chunks[key] = std::move(chunk);
+
+            const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start).count();
+            m_streamer->recordUpload(static_cast<uint64_t>(micros));
+            frameUploadMs += static_cast<float>(micros) / 1000.0f;
+            --uploadsRemaining;
+        }
+        m_streamer->setUploadLastFrame(frameUploadMs);
+    }
+
+    void ChunkManager::cancelInFlightLoad(uint64_t key)
+    {
+        auto it = m_inFlightLoads.find(key);
+        if (it == m_inFlightLoads.end())
+            return;
+        ChunkStreamer::cancel(it->second);
+        m_inFlightLoads.erase(it);
+    }
+
     void ChunkManager::loadChunk(int chunkX, int chunkY)
     {
         // 横向单行模式：拒绝加载非指定 chunk 行，防止 setTile/ore/tree 绕过约束
@@ -274,38 +642,55 @@ namespace engine::world
         }
         spdlog::debug("[ChunkManager] load chunk ({},{}) fixedRow={} horizontalOnly={}", chunkX, chunkY, m_fixedChunkRowY, m_horizontalOnly);
 
+        // 同步加载优先：同一区块的异步任务作废
+        cancelInFlightLoad(encodeChunkKey(chunkX, chunkY));
+
         auto chunk = std::make_unique<Chunk>(chunkX, chunkY);
 
-        // 使用地形生成器生成瓦片
-        if (m_terrainGenerator)
+        // 先查区域缓存，未命中再用地形生成器生成瓦片
+        if (m_regionCache || m_terrainGenerator)
         {
-            std::vector<TileData> tiles;
-            m_terrainGenerator->generateChunk(chunkX, chunkY, tiles);
-
-            for (int ly = 0; ly < Chunk::SIZE; ++ly)
-            {
-                for (int lx = 0; lx < Chunk::SIZE; ++lx)
-                {
-                    chunk->tileAt(lx, ly) = tiles[ly * Chunk::SIZE + lx];
-                }
-            }
+            ChunkTiles tiles;
+            const bool fromCache = produceChunkTiles(chunkX, chunkY, tiles);
+            chunk->assignTiles(tiles);
+            if (m_regionCache && !fromCache && m_cacheGeneratedChunks)
+                chunk->markModified();
         }
 
-        chunk->createPhysicsBodies(m_physicsMgr, glm::vec2(m_tileSize), WorldConfig::PIXELS_PER_METER);
+        chunk->createPhysicsBodies(m_physicsMgr, glm::vec2(m_tileSize), WorldConfig::PIXELS_PER_METER, m_colliderMode);
         rebuildChunkMesh(*chunk);
         m_chunks[encodeChunkKey(chunkX, chunkY)] = std::move(chunk);
     }
 
     void ChunkManager::setTerrainGenerator(std::unique_ptr<TerrainGenerator> generator)
     {
+        if (m_streamer)
+        {
+            // 在途任务仍引用旧生成器：全部取消、等待工作线程排空后再替换，并重新排队
+            const auto requeue = cancelAllInFlightLoads();
+            m_streamer->setGenerator(nullptr);
+
+            m_terrainGenerator = std::move(generator);
+            m_streamer->setGenerator(m_terrainGenerator.get());
+
+            for (const auto &[cx, cy] : requeue)
+                enqueueChunkLoad(cx, cy);
+            return;
+        }
         m_terrainGenerator = std::move(generator);
     }
 
     void ChunkManager::unloadChunk(int chunkX, int chunkY)
     {
+        cancelInFlightLoad(encodeChunkKey(chunkX, chunkY));
+        m_dirtyMeshKeys.erase(encodeChunkKey(chunkX, chunkY));
+        m_dirtyPhysicsKeys.erase(encodeChunkKey(chunkX, chunkY));
         auto it = m_chunks.find(encodeChunkKey(chunkX, chunkY));
         if (it != m_chunks.end())
         {
+            // 有改动的区块交给缓存写线程，主线程不等待磁盘
+            if (m_regionCache && it->second->isModified())
+                m_regionCache->store(chunkX, chunkY, it->second->tiles());
             it->second->destroyPhysicsBodies(m_physicsMgr);
             m_chunks.erase(it);
         }
@@ -1,5 +1,8 @@
 #pragma once
 #include "chunk.h"
+#include "chunk_streamer.h"
+#include "region_cache.h"
+#include "../resource/resource_handle.h"
 #include <deque>
 #include <unordered_set>
 #include <unordered_map>
@@ -8,6 +11,19 @@
 namespace engine::world
 {
     class TerrainGenerator;
+
+    /**
+     * @brief 最近一次 rebuildDirtyChunks 的统计
+     */
+    struct ChunkRebuildStats
+    {
+        int physicsRebuilt = 0;
+        int meshRebuilt = 0;
+        size_t meshBacklog = 0; // 预算用完后仍待重建的网格数
+        float physicsMs = 0.0f;
+        float meshMs = 0.0f;
+    };
+
     class ChunkManager
     {
     public:
@@ -22,13 +38,22 @@ namespace engine::world
         // 获取指定世界坐标的瓦片（线程安全？暂不考虑）
         TileData &tileAt(int worldX, int worldY);
 
-        // 设置瓦片并标记对应块为脏
+        // 设置瓦片：碰撞立即按行更新，网格进入脏队列延后重建
         void setTile(int worldX, int worldY, TileData tile);
 
-        // 批量写入 API：只标脏，不立即重建（适用于树木生成等批量操作）
+        // 批量写入 API：物理与网格都只进脏队列，不立即重建（适用于树木生成等批量操作）
         void setTileSilent(int worldX, int worldY, TileData tile);
-        // 重建脏块。maxChunksToRebuild < 0 表示重建全部；>=0 表示本次最多重建 N 个。
-        void rebuildDirtyChunks(int maxChunksToRebuild = -1);
+
+        // 立即重建脏队列中的所有物理体（同一区块多次编辑只重建一次），编辑后碰撞需马上生效时调用
+        void rebuildDirtyPhysics();
+        /**
+         * @brief 先 rebuildDirtyPhysics，再按优先级重建脏网格：视野内优先，其次离相机区块近的优先
+         * meshBudgetMs < 0 表示全部重建；否则用完预算即停（每次至少重建一个，保证队列前进）
+         */
+        void rebuildDirtyChunks(float meshBudgetMs = -1.0f);
+        size_t dirtyMeshCount() const { return m_dirtyMeshKeys.size(); }
+        // 本帧（自上次 updateStreaming 起）的重建统计
+        const ChunkRebuildStats &getRebuildStats() const { return m_rebuildStats; }
 
         glm::ivec2 worldToTile(const glm::vec2 &worldPos) const;
         glm::vec2 tileToWorld(const glm::ivec2 &tilePos) const;
@@ -39,6 +64,30 @@ namespace engine::world
         void updateVisibleChunks(const glm::vec2 &cameraPos, int viewDistanceInChunks,
                                   int viewDistanceYOverride = -1);
 
+        // 每帧调用：把待加载区块派发给工作线程，并在主线程集成已完成的区块（GPU 上传 + 物理体）
+        void updateStreaming();
+
+        // 异步流送开关；关闭时退回主线程同步加载（每帧最多 m_streamingLoadBudget 个）
+        void setAsyncStreaming(bool enable);
+        bool isAsyncStreaming() const { return m_asyncStreaming; }
+
+        // 流送统计：队列深度 + 各阶段耗时
+        ChunkStreamStats getStreamStats() const;
+
+        /**
+         * @brief 启用区域磁盘缓存：加载先查缓存再调用生成器，卸载时有改动的区块异步写回
+         * directory 应按世界（种子 / 生成器）区分；重复调用会先写完旧缓存再切换
+         */
+        void enableRegionCache(const std::string &directory);
+        // 写回所有改动过的已加载区块后关闭缓存
+        void disableRegionCache();
+        bool hasRegionCache() const { return m_regionCache != nullptr; }
+        RegionCacheStats getRegionCacheStats() const;
+        // 把所有改动过的已加载区块交给缓存写线程（存档 / 退出场景时调用），wait 为 true 时等待落盘
+        void saveModifiedChunks(bool wait = false);
+        // 新生成的区块是否也写入缓存（默认是：再次访问时省去生成；关闭则只保存玩家改动）
+        void setCacheGeneratedChunks(bool enable) { m_cacheGeneratedChunks = enable; }
+
         // 横向单行模式：启用后 updateVisibleChunks 始终锁定到指定 chunkRowY，垂直视距=0
         // fixedWorldY 为世界坐标 Y，内部转换为 chunk row（默认 0 即 worldY=0）
         void setHorizontalOnly(bool enable, float fixedWorldY = 0.0f);
@@ -51,9 +100,19 @@ namespace engine::world
         // 返回： pair<worldPos, worldSize>
         std::vector<std::pair<glm::vec2, glm::vec2>> getLoadedChunkBounds() const;
 
+        // 区块粒度的瓦片快照（编辑器 Play/Stop 回滚用）：每块一次 memcpy
+        std::vector<glm::ivec2> getLoadedChunkCoords() const;
+        bool copyChunkTiles(int chunkX, int chunkY, ChunkTiles &out) const;
+        // 写回整块瓦片（未加载则先加载），内容有变化时只标脏
+        void restoreChunkTiles(int chunkX, int chunkY, const ChunkTiles &tiles);
+
+        // 区块碰撞生成模式；切换时重建所有已加载区块的物理体
+        void setColliderMode(ChunkColliderMode mode);
+        ChunkColliderMode getColliderMode() const { return m_colliderMode; }
+
         // 获取已加载区块数量
         size_t loadedChunkCount() const { return m_chunks.size(); }
-        size_t pendingChunkLoadCount() const { return m_pendingChunkLoads.size(); }
+        size_t pendingChunkLoadCount() const { return m_pendingChunkLoads.size() + m_inFlightLoads.size(); }
 
         // 加载/卸载块（内部调用）
         void loadChunk(int chunkX, int chunkY);
@@ -66,16 +125,42 @@ namespace engine::world
         bool  m_horizontalOnly   = true;  // 横向单行模式（默认开启）
         int   m_fixedChunkRowY   = 0;     // 锁定的 chunk row（Y 轴）
         size_t m_prevChunkCount  = SIZE_MAX; // 上次日志时的 chunk 数量，避免每帧打印
-        int   m_streamingLoadBudget = 2;
+        int   m_streamingLoadBudget = 2;   // 同步模式：每帧最多加载的区块数
+        int   m_streamingUploadBudget = 8; // 异步模式：每帧最多集成（上传）的区块数
+        size_t m_maxInFlightLoads = 32;    // 异步模式：同时在途的最大任务数
+        bool  m_asyncStreaming = true;
+        bool  m_cacheGeneratedChunks = true;
+        ChunkColliderMode m_colliderMode = ChunkColliderMode::Rectangles;
 
         std::unordered_map<uint64_t, std::unique_ptr<Chunk>> m_chunks;
+
+        // 脏区块队列（集合去重：一帧内同一区块的多次编辑合并为一次重建）
+        std::unordered_set<uint64_t> m_dirtyMeshKeys;
+        std::unordered_set<uint64_t> m_dirtyPhysicsKeys;
+        glm::ivec2 m_focusChunk{0, 0}; // 最近一次 updateVisibleChunks 的相机所在区块
+        ChunkRebuildStats m_rebuildStats;
         std::deque<std::pair<int, int>> m_pendingChunkLoads;
         std::unordered_set<uint64_t> m_pendingChunkLoadKeys;
         std::string m_atlasTextureId;
+        engine::resource::TextureHandle m_atlasTexture; // 每帧查询图集尺寸用句柄，不哈希路径
         glm::ivec2 m_tileSize;
         std::unique_ptr<TerrainGenerator> m_terrainGenerator; // 地形生成器
+        std::unique_ptr<RegionCache> m_regionCache;           // 可选：区域磁盘缓存（须晚于 m_streamer 析构）
+
+        // 异步流送：在途任务（非拥有，任务最终经完成队列回到主线程释放）
+        std::unique_ptr<ChunkStreamer> m_streamer;
+        std::unordered_map<uint64_t, ChunkBuildJob *> m_inFlightLoads;
 
         void rebuildChunkMesh(Chunk &chunk);
+        void markChunkDirty(uint64_t key, Chunk &chunk, bool physics);
+        void dispatchPendingChunkLoads();
+        void integrateCompletedChunks();
+        void cancelInFlightLoad(uint64_t key);
+        // 取消全部在途任务，返回其区块坐标以便重新排队
+        std::vector<std::pair<int, int>> cancelAllInFlightLoads();
+        // 新区块的瓦片：先查缓存，未命中再调用生成器；返回是否来自缓存
+        bool produceChunkTiles(int chunkX, int chunkY, ChunkTiles &tiles);
+        bool streamingMeshParams(glm::vec2 &textureSize, bool &glLayout) const;
         void enqueueChunkLoad(int chunkX, int chunkY);
         void processPendingChunkLoads();
 
@@ -0,0 +1,221 @@
+#include "chunk_streamer.h"
+#include "terrain_generator.h"
+#include "region_cache.h"
+#include "../core/profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <spdlog/spdlog.h>
+
+namespace engine::world
+{
+    namespace
+    {
+        uint64_t elapsedMicros(std::chrono::steady_clock::time_point start)
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                             std::chrono::steady_clock::now() - start)
+                                             .count());
+        }
+
+        float averageMs(uint64_t micros, uint64_t count)
+        {
+            return count ? static_cast<float>(static_cast<double>(micros) / static_cast<double>(count) / 1000.0) : 0.0f;
+        }
+    }
+
+    ChunkStreamer::ChunkStreamer(int workerCount)
+    {
+        if (workerCount <= 0)
+        {
+            const unsigned hw = std::thread::hardware_concurrency();
+            workerCount = std::clamp(static_cast<int>(hw) - 1, 1, 4);
+        }
+
+        m_workers.reserve(static_cast<size_t>(workerCount));
+        for (int i = 0; i < workerCount; ++i)
+            m_workers.emplace_back([this] { workerLoop(); });
+
+        spdlog::debug("[ChunkStreamer] started {} worker(s)", workerCount);
+    }
+
+    ChunkStreamer::~ChunkStreamer()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+            for (ChunkBuildJob *job : m_jobs)
+                delete job;
+            m_jobs.clear();
+            m_queuedCount.store(0, std::memory_order_relaxed);
+        }
+        m_wakeCv.notify_all();
+        for (auto &worker : m_workers)
+        {
+            if (worker.joinable())
+                worker.join();
+        }
+
+        while (ChunkBuildJob *job = m_completed.pop())
+            delete job;
+    }
+
+    void ChunkStreamer::cancelQueuedAndWait()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (ChunkBuildJob *job : m_jobs)
+                cancel(job);
+        }
+        waitIdle();
+    }
+
+    void ChunkStreamer::setGenerator(const TerrainGenerator *generator)
+    {
+        cancelQueuedAndWait();
+        m_generator = generator;
+    }
+
+    void ChunkStreamer::setRegionCache(RegionCache *cache)
+    {
+        cancelQueuedAndWait();
+        m_cache = cache;
+    }
+
+    ChunkBuildJob *ChunkStreamer::submit(int chunkX, int chunkY,
+                                         const glm::ivec2 &tileSize,
+                                         const glm::vec2 &textureSize,
+                                         bool glLayout)
+    {
+        auto *job = new ChunkBuildJob();
+        job->chunkX = chunkX;
+        job->chunkY = chunkY;
+        job->tileSize = tileSize;
+        job->textureSize = textureSize;
+        job->glLayout = glLayout;
+
+        m_outstanding.fetch_add(1, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_jobs.push_back(job);
+            m_queuedCount.fetch_add(1, std::memory_order_relaxed);
+        }
+        m_wakeCv.notify_one();
+        return job;
+    }
+
+    ChunkBuildJob *ChunkStreamer::popCompleted()
+    {
+        ChunkBuildJob *job = m_completed.pop();
+        if (!job)
+            return nullptr;
+
+        m_completedCount.fetch_sub(1, std::memory_order_relaxed);
+        if (job->cancelled.load(std::memory_order_relaxed))
+            m_cancelledTotal.fetch_add(1, std::memory_order_relaxed);
+        else
+            m_finishedTotal.fetch_add(1, std::memory_order_relaxed);
+        return job;
+    }
+
+    void ChunkStreamer::waitIdle()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_idleCv.wait(lock, [this] { return m_outstanding.load(std::memory_order_acquire) == 0; });
+    }
+
+    void ChunkStreamer::recordUpload(uint64_t micros)
+    {
+        m_uploadMicros += micros;
+        ++m_uploadCount;
+    }
+
+    ChunkStreamStats ChunkStreamer::getStats() const
+    {
+        ChunkStreamStats stats;
+        stats.queuedJobs = m_queuedCount.load(std::memory_order_relaxed);
+        stats.activeJobs = m_activeCount.load(std::memory_order_relaxed);
+        stats.completedJobs = m_completedCount.load(std::memory_order_relaxed);
+        stats.finishedTotal = m_finishedTotal.load(std::memory_order_relaxed);
+        stats.cancelledTotal = m_cancelledTotal.load(std::memory_order_relaxed);
+        stats.cacheHitTotal = m_cacheHits.load(std::memory_order_relaxed);
+        stats.cacheLoadAvgMs = averageMs(m_cacheMicros.load(std::memory_order_relaxed), stats.cacheHitTotal);
+        stats.generateAvgMs = averageMs(m_generateMicros.load(std::memory_order_relaxed),
+                                        m_generateCount.load(std::memory_order_relaxed));
+        stats.meshAvgMs = averageMs(m_meshMicros.load(std::memory_order_relaxed),
+                                    m_meshCount.load(std::memory_order_relaxed));
+        stats.uploadAvgMs = averageMs(m_uploadMicros, m_uploadCount);
+        stats.uploadLastFrameMs = m_uploadLastFrameMs;
+        return stats;
+    }
+
+    void ChunkStreamer::workerLoop()
+    {
+        LSL_PROFILE_THREAD("ChunkStreamer");
+        for (;;)
+        {
+            ChunkBuildJob *job = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wakeCv.wait(lock, [this] { return m_stopping || !m_jobs.empty(); });
+                if (m_stopping)
+                    return;
+                job = m_jobs.front();
+                m_jobs.pop_front();
+                m_queuedCount.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            m_activeCount.fetch_add(1, std::memory_order_relaxed);
+            runJob(*job);
+            m_activeCount.fetch_sub(1, std::memory_order_relaxed);
+            finish(job);
+        }
+    }
+
+    void ChunkStreamer::runJob(ChunkBuildJob &job)
+    {
+        LSL_PROFILE_ZONE("ChunkStreamer::runJob");
+        if (job.cancelled.load(std::memory_order_relaxed))
+            return;
+
+        auto start = std::chrono::steady_clock::now();
+        if (m_cache && m_cache->load(job.chunkX, job.chunkY, job.tiles))
+        {
+            job.fromCache = true;
+            m_cacheMicros.fetch_add(elapsedMicros(start), std::memory_order_relaxed);
+            m_cacheHits.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            LSL_PROFILE_ZONE("TerrainGenerator::generateChunk");
+            start = std::chrono::steady_clock::now();
+            if (m_generator)
+                m_generator->generateChunk(job.chunkX, job.chunkY, job.tiles);
+            m_generateMicros.fetch_add(elapsedMicros(start), std::memory_order_relaxed);
+            m_generateCount.fetch_add(1, std::memory_order_relaxed);
+        }
+        job.generated = true;
+
+        if (job.cancelled.load(std::memory_order_relaxed) ||
+            job.textureSize.x <= 0.0f || job.textureSize.y <= 0.0f)
+            return;
+
+        LSL_PROFILE_ZONE("Chunk::buildMeshData");
+        start = std::chrono::steady_clock::now();
+        Chunk::buildMeshData(job.tiles.data(), job.chunkY, job.tileSize, job.textureSize, job.glLayout, job.mesh);
+        job.meshBuilt = true;
+        m_meshMicros.fetch_add(elapsedMicros(start), std::memory_order_relaxed);
+        m_meshCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void ChunkStreamer::finish(ChunkBuildJob *job)
+    {
+        m_completedCount.fetch_add(1, std::memory_order_relaxed);
+        m_completed.push(job);
+        if (m_outstanding.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            // 加锁后通知，避免 waitIdle 在检查谓词与进入等待之间错过唤醒
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_idleCv.notify_all();
+        }
+    }
+} // namespace engine::world
@@ -0,0 +1,143 @@
+// 区块异步流送管线
+// chunk_streamer.h
+//   阶段 1（工作线程）：先查 RegionCache，未命中再 TerrainGenerator::generateChunk，然后 CPU 侧顶点构建
+//   阶段 2（无锁完成队列）：工作线程把完成的任务推入 MPSC 队列
+//   阶段 3（主线程）：ChunkManager 取出结果，只做 GPU 上传与物理体创建
+#pragma once
+#include "chunk.h"
+#include "../utils/mpsc_queue.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace engine::world
+{
+    class TerrainGenerator;
+    class RegionCache;
+
+    /**
+     * @brief 单个区块的构建任务
+     * 生命周期：submit 创建 → 工作线程处理 → 完成队列 → 主线程 popCompleted 取回并释放。
+     * 被取消的任务同样会经过完成队列回到主线程，只是结果被丢弃。
+     */
+    struct ChunkBuildJob
+    {
+        int chunkX = 0;
+        int chunkY = 0;
+        std::atomic<bool> cancelled{false};
+
+        // 构建参数（提交时由主线程写入，工作线程只读）
+        glm::ivec2 tileSize{16, 16};
+        glm::vec2 textureSize{0.0f, 0.0f}; // <=0 表示不构建网格，由主线程回退到同步构建
+        bool glLayout = true;
+
+        // 构建结果
+        ChunkTiles tiles{};
+        ChunkMeshData mesh;
+        bool generated = false;
+        bool fromCache = false; // 瓦片来自区域缓存（未调用生成器）
+        bool meshBuilt = false;
+
+        std::atomic<ChunkBuildJob *> next{nullptr}; // MpscQueue 侵入式链接
+    };
+
+    /**
+     * @brief 流送统计（供 FrameProfiler / 调试面板读取）
+     * 耗时为累计平均值（毫秒），计数为自启动以来的总量
+     */
+    struct ChunkStreamStats
+    {
+        size_t queuedJobs = 0;     // 等待工作线程
+        size_t activeJobs = 0;     // 工作线程处理中
+        size_t completedJobs = 0;  // 已完成、等待主线程集成
+        uint64_t finishedTotal = 0;
+        uint64_t cancelledTotal = 0;
+        uint64_t cacheHitTotal = 0;
+        float cacheLoadAvgMs = 0.0f; // 阶段 1a：区域缓存读取（命中时）
+        float generateAvgMs = 0.0f; // 阶段 1a：地形生成
+        float meshAvgMs = 0.0f;     // 阶段 1b：CPU 网格构建
+        float uploadAvgMs = 0.0f;   // 阶段 3：GPU 上传 + 物理体
+        float uploadLastFrameMs = 0.0f;
+    };
+
+    class ChunkStreamer
+    {
+    public:
+        // workerCount <= 0 时按硬件线程数自动选择（保留一个核心给主线程）
+        explicit ChunkStreamer(int workerCount = 0);
+        ~ChunkStreamer();
+
+        ChunkStreamer(const ChunkStreamer &) = delete;
+        ChunkStreamer &operator=(const ChunkStreamer &) = delete;
+
+        // 设置地形生成器（非拥有）。切换前会取消并等待所有在途任务
+        void setGenerator(const TerrainGenerator *generator);
+        // 设置区域缓存（非拥有，可为 nullptr）。切换语义同 setGenerator
+        void setRegionCache(RegionCache *cache);
+
+        // 提交任务，返回的指针仅用于 cancel()；所有权在 popCompleted 时交还主线程
+        ChunkBuildJob *submit(int chunkX, int chunkY,
+                              const glm::ivec2 &tileSize,
+                              const glm::vec2 &textureSize,
+                              bool glLayout);
+
+        // 标记取消（线程安全）。工作线程在各阶段之间检查该标记
+        static void cancel(ChunkBuildJob *job)
+        {
+            if (job)
+                job->cancelled.store(true, std::memory_order_relaxed);
+        }
+
+        // 主线程：取出一个已完成（或已取消）的任务，调用方负责 delete
+        ChunkBuildJob *popCompleted();
+
+        // 阻塞直到所有已提交任务都进入完成队列
+        void waitIdle();
+
+        // 主线程统计上传阶段耗时
+        void recordUpload(uint64_t micros);
+        void setUploadLastFrame(float ms) { m_uploadLastFrameMs = ms; }
+
+        ChunkStreamStats getStats() const;
+        int workerCount() const { return static_cast<int>(m_workers.size()); }
+
+    private:
+        void workerLoop();
+        void runJob(ChunkBuildJob &job);
+        void finish(ChunkBuildJob *job);
+
+        void cancelQueuedAndWait();
+
+        const TerrainGenerator *m_generator = nullptr;
+        RegionCache *m_cache = nullptr;
+
+        std::vector<std::thread> m_workers;
+        std::mutex m_mutex;
+        std::condition_variable m_wakeCv;
+        std::condition_variable m_idleCv;
+        std::deque<ChunkBuildJob *> m_jobs; // 受 m_mutex 保护
+        bool m_stopping = false;
+
+        engine::utils::MpscQueue<ChunkBuildJob> m_completed;
+
+        std::atomic<size_t> m_queuedCount{0};
+        std::atomic<size_t> m_activeCount{0};
+        std::atomic<size_t> m_completedCount{0};
+        std::atomic<size_t> m_outstanding{0}; // 已提交但尚未进入完成队列
+        std::atomic<uint64_t> m_finishedTotal{0};
+        std::atomic<uint64_t> m_cancelledTotal{0};
+        std::atomic<uint64_t> m_cacheMicros{0};
+        std::atomic<uint64_t> m_cacheHits{0};
+        std::atomic<uint64_t> m_generateMicros{0};
+        std::atomic<uint64_t> m_generateCount{0};
+        std::atomic<uint64_t> m_meshMicros{0};
+        std::atomic<uint64_t> m_meshCount{0};
+        uint64_t m_uploadMicros = 0; // 仅主线程
+        uint64_t m_uploadCount = 0;
+        float m_uploadLastFrameMs = 0.0f;
+    };
+} // namespace engine::world
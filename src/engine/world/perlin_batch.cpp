@@ -0,0 +1,276 @@
+#include "perlin_batch.h"
+#include <algorithm>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define LSL_PERLIN_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define LSL_PERLIN_SSE2 1
+#endif
+
+namespace engine::world
+{
+    namespace
+    {
+        // 以下常量与梯度表取自 FastNoiseLite，保证结果逐位一致
+        constexpr int32_t kPrimeX = 501125321;
+        constexpr int32_t kPrimeY = 1136930381;
+        constexpr int32_t kHashMul = 0x27d4eb2d;
+        constexpr float kPerlinScale = 1.4247691104677813f;
+
+        alignas(32) constexpr float kGradients2D[256] = {
+            0.130526192220052f, 0.99144486137381f, 0.38268343236509f, 0.923879532511287f, 0.608761429008721f, 0.793353340291235f, 0.793353340291235f, 0.608761429008721f,
+            0.923879532511287f, 0.38268343236509f, 0.99144486137381f, 0.130526192220051f, 0.99144486137381f, -0.130526192220051f, 0.923879532511287f, -0.38268343236509f,
+            0.793353340291235f, -0.60876142900872f, 0.608761429008721f, -0.793353340291235f, 0.38268343236509f, -0.923879532511287f, 0.130526192220052f, -0.99144486137381f,
+            -0.130526192220052f, -0.99144486137381f, -0.38268343236509f, -0.923879532511287f, -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
+            -0.923879532511287f, -0.38268343236509f, -0.99144486137381f, -0.130526192220052f, -0.99144486137381f, 0.130526192220051f, -0.923879532511287f, 0.38268343236509f,
+            -0.793353340291235f, 0.608761429008721f, -0.608761429008721f, 0.793353340291235f, -0.38268343236509f, 0.923879532511287f, -0.130526192220052f, 0.99144486137381f,
+            0.130526192220052f, 0.99144486137381f, 0.38268343236509f, 0.923879532511287f, 0.608761429008721f, 0.793353340291235f, 0.793353340291235f, 0.608761429008721f,
+            0.923879532511287f, 0.38268343236509f, 0.99144486137381f, 0.130526192220051f, 0.99144486137381f, -0.130526192220051f, 0.923879532511287f, -0.38268343236509f,
+            0.793353340291235f, -0.60876142900872f, 0.608761429008721f, -0.793353340291235f, 0.38268343236509f, -0.923879532511287f, 0.130526192220052f, -0.99144486137381f,
+            -0.130526192220052f, -0.99144486137381f, -0.38268343236509f, -0.923879532511287f, -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
+            -0.923879532511287f, -0.38268343236509f, -0.99144486137381f, -0.130526192220052f, -0.99144486137381f, 0.130526192220051f, -0.923879532511287f, 0.38268343236509f,
+            -0.793353340291235f, 0.608761429008721f, -0.608761429008721f, 0.793353340291235f, -0.38268343236509f, 0.923879532511287f, -0.130526192220052f, 0.99144486137381f,
+            0.130526192220052f, 0.99144486137381f, 0.38268343236509f, 0.923879532511287f, 0.608761429008721f, 0.793353340291235f, 0.793353340291235f, 0.608761429008721f,
+            0.923879532511287f, 0.38268343236509f, 0.99144486137381f, 0.130526192220051f, 0.99144486137381f, -0.130526192220051f, 0.923879532511287f, -0.38268343236509f,
+            0.793353340291235f, -0.60876142900872f, 0.608761429008721f, -0.793353340291235f, 0.38268343236509f, -0.923879532511287f, 0.130526192220052f, -0.99144486137381f,
+            -0.130526192220052f, -0.99144486137381f, -0.38268343236509f, -0.923879532511287f, -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
+            -0.923879532511287f, -0.38268343236509f, -0.99144486137381f, -0.130526192220052f, -0.99144486137381f, 0.130526192220051f, -0.923879532511287f, 0.38268343236509f,
+            -0.793353340291235f, 0.608761429008721f, -0.608761429008721f, 0.793353340291235f, -0.38268343236509f, 0.923879532511287f, -0.130526192220052f, 0.99144486137381f,
+            0.130526192220052f, 0.99144486137381f, 0.38268343236509f, 0.923879532511287f, 0.608761429008721f, 0.793353340291235f, 0.793353340291235f, 0.608761429008721f,
+            0.923879532511287f, 0.38268343236509f, 0.99144486137381f, 0.130526192220051f, 0.99144486137381f, -0.130526192220051f, 0.923879532511287f, -0.38268343236509f,
+            0.793353340291235f, -0.60876142900872f, 0.608761429008721f, -0.793353340291235f, 0.38268343236509f, -0.923879532511287f, 0.130526192220052f, -0.99144486137381f,
+            -0.130526192220052f, -0.99144486137381f, -0.38268343236509f, -0.923879532511287f, -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
+            -0.923879532511287f, -0.38268343236509f, -0.99144486137381f, -0.130526192220052f, -0.99144486137381f, 0.130526192220051f, -0.923879532511287f, 0.38268343236509f,
+            -0.793353340291235f, 0.608761429008721f, -0.608761429008721f, 0.793353340291235f, -0.38268343236509f, 0.923879532511287f, -0.130526192220052f, 0.99144486137381f,
+            0.130526192220052f, 0.99144486137381f, 0.38268343236509f, 0.923879532511287f, 0.608761429008721f, 0.793353340291235f, 0.793353340291235f, 0.608761429008721f,
+            0.923879532511287f, 0.38268343236509f, 0.99144486137381f, 0.130526192220051f, 0.99144486137381f, -0.130526192220051f, 0.923879532511287f, -0.38268343236509f,
+            0.793353340291235f, -0.60876142900872f, 0.608761429008721f, -0.793353340291235f, 0.38268343236509f, -0.923879532511287f, 0.130526192220052f, -0.99144486137381f,
+            -0.130526192220052f, -0.99144486137381f, -0.38268343236509f, -0.923879532511287f, -0.608761429008721f, -0.793353340291235f, -0.793353340291235f, -0.608761429008721f,
+            -0.923879532511287f, -0.38268343236509f, -0.99144486137381f, -0.130526192220052f, -0.99144486137381f, 0.130526192220051f, -0.923879532511287f, 0.38268343236509f,
+            -0.793353340291235f, 0.608761429008721f, -0.608761429008721f, 0.793353340291235f, -0.38268343236509f, 0.923879532511287f, -0.130526192220052f, 0.99144486137381f,
+            0.38268343236509f, 0.923879532511287f, 0.923879532511287f, 0.38268343236509f, 0.923879532511287f, -0.38268343236509f, 0.38268343236509f, -0.923879532511287f,
+            -0.38268343236509f, -0.923879532511287f, -0.923879532511287f, -0.38268343236509f, -0.923879532511287f, 0.38268343236509f, -0.38268343236509f, 0.923879532511287f,
+        };
+
+        int fastFloor(float f) { return f >= 0 ? static_cast<int>(f) : static_cast<int>(f) - 1; }
+        float interpQuintic(float t) { return t * t * t * (t * (t * 6 - 15) + 10); }
+        float lerp(float a, float b, float t) { return a + t * (b - a); }
+
+        // 有符号溢出按补码回绕（FastNoiseLite 依赖同样的行为）
+        int32_t wrapMul(int32_t a, int32_t b)
+        {
+            return static_cast<int32_t>(static_cast<uint32_t>(a) * static_cast<uint32_t>(b));
+        }
+
+        int32_t wrapAdd(int32_t a, int32_t b)
+        {
+            return static_cast<int32_t>(static_cast<uint32_t>(a) + static_cast<uint32_t>(b));
+        }
+
+        float gradCoord(int32_t seed, int32_t xPrimed, int32_t yPrimed, float xd, float yd)
+        {
+            int32_t hash = wrapMul(seed ^ xPrimed ^ yPrimed, kHashMul);
+            hash ^= hash >> 15;
+            hash &= 127 << 1;
+            return xd * kGradients2D[hash] + yd * kGradients2D[hash | 1];
+        }
+
+        // 一个坐标轴上的可分离项：格点（已乘素数）、到两侧格点的距离、插值权重
+        struct AxisTerms
+        {
+            int32_t primed0;
+            int32_t primed1;
+            float d0;
+            float d1;
+            float s;
+        };
+
+        AxisTerms axisTerms(float v, int32_t prime)
+        {
+            const int i0 = fastFloor(v);
+            AxisTerms t;
+            t.d0 = static_cast<float>(v - i0);
+            t.d1 = t.d0 - 1;
+            t.s = interpQuintic(t.d0);
+            t.primed0 = wrapMul(i0, prime);
+            t.primed1 = wrapAdd(t.primed0, prime);
+            return t;
+        }
+
+        float perlinFromTerms(int32_t seed, const AxisTerms &x, const AxisTerms &y)
+        {
+            const float xf0 = lerp(gradCoord(seed, x.primed0, y.primed0, x.d0, y.d0),
+                                   gradCoord(seed, x.primed1, y.primed0, x.d1, y.d0), x.s);
+            const float xf1 = lerp(gradCoord(seed, x.primed0, y.primed1, x.d0, y.d1),
+                                   gradCoord(seed, x.primed1, y.primed1, x.d1, y.d1), x.s);
+            return lerp(xf0, xf1, y.s) * kPerlinScale;
+        }
+
+        // 列项按 SoA 排布，便于整段加载到 SIMD 寄存器
+        struct ColumnTerms
+        {
+            alignas(32) int32_t primed0[PerlinBatch::MAX_GRID];
+            alignas(32) int32_t primed1[PerlinBatch::MAX_GRID];
+            alignas(32) float d0[PerlinBatch::MAX_GRID];
+            alignas(32) float d1[PerlinBatch::MAX_GRID];
+            alignas(32) float s[PerlinBatch::MAX_GRID];
+        };
+
+#if defined(LSL_PERLIN_AVX2)
+        constexpr int kLanes = 8;
+
+        __m256 gradCoord8(__m256i seed, __m256i xPrimed, __m256i yPrimed, __m256 xd, __m256 yd)
+        {
+            __m256i hash = _mm256_xor_si256(seed, _mm256_xor_si256(xPrimed, yPrimed));
+            hash = _mm256_mullo_epi32(hash, _mm256_set1_epi32(kHashMul));
+            hash = _mm256_xor_si256(hash, _mm256_srai_epi32(hash, 15));
+            hash = _mm256_and_si256(hash, _mm256_set1_epi32(127 << 1));
+            const __m256 xg = _mm256_i32gather_ps(kGradients2D, hash, 4);
+            const __m256 yg = _mm256_i32gather_ps(kGradients2D, _mm256_or_si256(hash, _mm256_set1_epi32(1)), 4);
+            // 不使用 FMA：与标量路径保持相同的舍入
+            return _mm256_add_ps(_mm256_mul_ps(xd, xg), _mm256_mul_ps(yd, yg));
+        }
+
+        __m256 lerp8(__m256 a, __m256 b, __m256 t)
+        {
+            return _mm256_add_ps(a, _mm256_mul_ps(t, _mm256_sub_ps(b, a)));
+        }
+
+        int sampleRow(int32_t seed, const ColumnTerms &cols, int width, const AxisTerms &y, float *out)
+        {
+            const __m256i vSeed = _mm256_set1_epi32(seed);
+            const __m256i yP0 = _mm256_set1_epi32(y.primed0);
+            const __m256i yP1 = _mm256_set1_epi32(y.primed1);
+            const __m256 yd0 = _mm256_set1_ps(y.d0);
+            const __m256 yd1 = _mm256_set1_ps(y.d1);
+            const __m256 ys = _mm256_set1_ps(y.s);
+            const __m256 scale = _mm256_set1_ps(kPerlinScale);
+
+            int col = 0;
+            for (; col + kLanes <= width; col += kLanes)
+            {
+                const __m256i xP0 = _mm256_load_si256(reinterpret_cast<const __m256i *>(cols.primed0 + col));
+                const __m256i xP1 = _mm256_load_si256(reinterpret_cast<const __m256i *>(cols.primed1 + col));
+                const __m256 xd0 = _mm256_load_ps(cols.d0 + col);
+                const __m256 xd1 = _mm256_load_ps(cols.d1 + col);
+                const __m256 xs = _mm256_load_ps(cols.s + col);
+
+                const __m256 xf0 = lerp8(gradCoord8(vSeed, xP0, yP0, xd0, yd0), gradCoord8(vSeed, xP1, yP0, xd1, yd0), xs);
+                const __m256 xf1 = lerp8(gradCoord8(vSeed, xP0, yP1, xd0, yd1), gradCoord8(vSeed, xP1, yP1, xd1, yd1), xs);
+                _mm256_storeu_ps(out + col, _mm256_mul_ps(lerp8(xf0, xf1, ys), scale));
+            }
+            return col;
+        }
+#elif defined(LSL_PERLIN_SSE2)
+        constexpr int kLanes = 4;
+
+        // SSE2 没有 32 位低位乘法，用两次 32x32→64 乘法拼出
+        __m128i mullo4(__m128i a, __m128i b)
+        {
+            const __m128i even = _mm_mul_epu32(a, b);
+            const __m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+            return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                                      _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+        }
+
+        __m128 gradCoord4(__m128i seed, __m128i xPrimed, __m128i yPrimed, __m128 xd, __m128 yd)
+        {
+            __m128i hash = _mm_xor_si128(seed, _mm_xor_si128(xPrimed, yPrimed));
+            hash = mullo4(hash, _mm_set1_epi32(kHashMul));
+            hash = _mm_xor_si128(hash, _mm_srai_epi32(hash, 15));
+            hash = _mm_and_si128(hash, _mm_set1_epi32(127 << 1));
+
+            // 无 gather 指令：索引落地后逐通道取（梯度表只有 1KB，常驻 L1）
+            alignas(16) int32_t idx[4];
+            _mm_store_si128(reinterpret_cast<__m128i *>(idx), hash);
+            const __m128 xg = _mm_setr_ps(kGradients2D[idx[0]], kGradients2D[idx[1]], kGradients2D[idx[2]], kGradients2D[idx[3]]);
+            const __m128 yg = _mm_setr_ps(kGradients2D[idx[0] | 1], kGradients2D[idx[1] | 1], kGradients2D[idx[2] | 1], kGradients2D[idx[3] | 1]);
+            return _mm_add_ps(_mm_mul_ps(xd, xg), _mm_mul_ps(yd, yg));
+        }
+
+        __m128 lerp4(__m128 a, __m128 b, __m128 t)
+        {
+            return _mm_add_ps(a, _mm_mul_ps(t, _mm_sub_ps(b, a)));
+        }
+
+        int sampleRow(int32_t seed, const ColumnTerms &cols, int width, const AxisTerms &y, float *out)
+        {
+            const __m128i vSeed = _mm_set1_epi32(seed);
+            const __m128i yP0 = _mm_set1_epi32(y.primed0);
+            const __m128i yP1 = _mm_set1_epi32(y.primed1);
+            const __m128 yd0 = _mm_set1_ps(y.d0);
+            const __m128 yd1 = _mm_set1_ps(y.d1);
+            const __m128 ys = _mm_set1_ps(y.s);
+            const __m128 scale = _mm_set1_ps(kPerlinScale);
+
+            int col = 0;
+            for (; col + kLanes <= width; col += kLanes)
+            {
+                const __m128i xP0 = _mm_load_si128(reinterpret_cast<const __m128i *>(cols.primed0 + col));
+                const __m128i xP1 = _mm_load_si128(reinterpret_cast<const __m128i *>(cols.primed1 + col));
+                const __m128 xd0 = _mm_load_ps(cols.d0 + col);
+                const __m128 xd1 = _mm_load_ps(cols.d1 + col);
+                const __m128 xs = _mm_load_ps(cols.s + col);
+
+                const __m128 xf0 = lerp4(gradCoord4(vSeed, xP0, yP0, xd0, yd0), gradCoord4(vSeed, xP1, yP0, xd1, yd0), xs);
+                const __m128 xf1 = lerp4(gradCoord4(vSeed, xP0, yP1, xd0, yd1), gradCoord4(vSeed, xP1, yP1, xd1, yd1), xs);
+                _mm_storeu_ps(out + col, _mm_mul_ps(lerp4(xf0, xf1, ys), scale));
+            }
+            return col;
+        }
+#else
+        int sampleRow(int32_t, const ColumnTerms &, int, const AxisTerms &, float *)
+        {
+            return 0;
+        }
+#endif
+    }
+
+    const char *PerlinBatch::kernelName()
+    {
+#if defined(LSL_PERLIN_AVX2)
+        return "avx2";
+#elif defined(LSL_PERLIN_SSE2)
+        return "sse2";
+#else
+        return "scalar";
+#endif
+    }
+
+    float PerlinBatch::sample(float x, float y) const
+    {
+        return perlinFromTerms(m_seed, axisTerms(x * m_frequency, kPrimeX), axisTerms(y * m_frequency, kPrimeY));
+    }
+
+    void PerlinBatch::sampleGrid(int tileX, int tileY, int width, int height, float *out) const
+    {
+        width = std::clamp(width, 0, MAX_GRID);
+        height = std::clamp(height, 0, MAX_GRID);
+
+        ColumnTerms cols;
+        for (int col = 0; col < width; ++col)
+        {
+            const AxisTerms x = axisTerms(static_cast<float>(tileX + col) * m_frequency, kPrimeX);
+            cols.primed0[col] = x.primed0;
+            cols.primed1[col] = x.primed1;
+            cols.d0[col] = x.d0;
+            cols.d1[col] = x.d1;
+            cols.s[col] = x.s;
+        }
+
+        for (int row = 0; row < height; ++row)
+        {
+            const AxisTerms y = axisTerms(static_cast<float>(tileY + row) * m_frequency, kPrimeY);
+            float *rowOut = out + row * width;
+
+            // SIMD 主体 + 标量尾部
+            for (int col = sampleRow(m_seed, cols, width, y, rowOut); col < width; ++col)
+            {
+                const AxisTerms x{cols.primed0[col], cols.primed1[col], cols.d0[col], cols.d1[col], cols.s[col]};
+                rowOut[col] = perlinFromTerms(m_seed, x, y);
+            }
+        }
+    }
+} // namespace engine::world
@@ -0,0 +1,35 @@
+// 批量 2D Perlin 噪声
+// perlin_batch.h
+//   - 与 FastNoiseLite（NoiseType_Perlin、无分形、无域扭曲）的 GetNoise(x, y) 逐位一致
+//   - 网格采样按行列可分离：每列 / 每行的 floor、小数部分、五次插值只算一次，
+//     逐瓦片只剩 4 次哈希 + 梯度查表 + 插值，这部分按 SIMD 通道批量执行
+//   - x86-64 上默认走 SSE2（AVX2 编译时改走 8 通道 + gather），其它平台为标量实现
+#pragma once
+#include <cstdint>
+
+namespace engine::world
+{
+    class PerlinBatch
+    {
+    public:
+        PerlinBatch(int seed, float frequency) : m_seed(seed), m_frequency(frequency) {}
+
+        // 单点采样（与 FastNoiseLite::GetNoise 相同）
+        float sample(float x, float y) const;
+
+        /**
+         * @brief 整数网格采样：out[row * width + col] = noise(tileX + col, tileY + row)
+         * width / height 不超过 MAX_GRID，超出时由调用方分块
+         */
+        void sampleGrid(int tileX, int tileY, int width, int height, float *out) const;
+
+        static constexpr int MAX_GRID = 256;
+
+        // 当前编译产物使用的内核名称（基准输出用）
+        static const char *kernelName();
+
+    private:
+        int m_seed;
+        float m_frequency;
+    };
+} // namespace engine::world
@@ -1,139 +1,170 @@
 // 柏林噪声地形生成器
 #include "perlin_noise_generator.h"
-#include "FastNoiseLite.h"
-#include <memory>
-#include <cmath>
 #include <algorithm>
+#include <cmath>
 
 namespace engine::world
 {
+    namespace
+    {
+        // 按生物群系查表：0=草原 1=森林 2=岩地 3=矿山 4=洞穴（未知值按草原处理）
+        constexpr int BIOME_COUNT = 5;
+
+        // 振幅倍率（影响地形崎岖程度）
+        constexpr float kAmplitudeMult[BIOME_COUNT] = {
+            1.0f, // 草原：标准
+            0.7f, // 森林：较平缓
+            1.8f, // 岩地：极崎岖
+            1.5f, // 矿山：很崎岖
+            1.6f, // 洞穴：崎岖
+        };
+
+        // 洞穴密度阈值：|noise| < thresh → 空气（形成蠕虫状隧道/腔体）
+        constexpr float kCaveThreshold[BIOME_COUNT] = {
+            0.08f, // 草原：少量洞穴
+            0.05f, // 森林：极少洞穴
+            0.14f, // 岩地：中等洞穴
+            0.11f, // 矿山：少量洞穴
+            0.30f, // 洞穴：大量洞穴（蜂巢状）
+        };
+
+        // 洞穴雕刻从地表下第 3 格开始
+        constexpr int CAVE_MIN_DEPTH = 3;
+
+        // 每列的分层：地表瓦片 + 泥土层下界（不含），其下为石头
+        struct ColumnLayers
+        {
+            int surfaceY = 0;
+            int dirtEnd = 0;
+            TileType top = TileType::Grass;
+            float caveThreshold = 0.0f;
+        };
+    }
+
     PerlinNoiseGenerator::PerlinNoiseGenerator(const WorldConfig &config)
-        : TerrainGenerator(config)
+        : TerrainGenerator(config),
+          // 地表高度噪声
+          m_surfaceNoise(static_cast<int>(config.seed), config.noiseScale),
+          // 洞穴雕刻噪声（不同种子 + 较低频率，产生更大的洞穴腔体）
+          m_caveNoise(static_cast<int>(config.seed) ^ 0x7A3F1B2C, 0.035f)
     {
-        // 地表高度噪声
-        m_noise = std::make_unique<FastNoiseLite>();
-        m_noise->SetSeed(static_cast<int>(config.seed));
-        m_noise->SetNoiseType(FastNoiseLite::NoiseType_Perlin);
-        m_noise->SetFrequency(config.noiseScale);
-
-        // 洞穴雕刻噪声（不同种子 + 较低频率，产生更大的洞穴腔体）
-        m_caveNoise = std::make_unique<FastNoiseLite>();
-        m_caveNoise->SetSeed(static_cast<int>(config.seed) ^ 0x7A3F1B2C);
-        m_caveNoise->SetNoiseType(FastNoiseLite::NoiseType_Perlin);
-        m_caveNoise->SetFrequency(0.035f);
     }
 
     PerlinNoiseGenerator::~PerlinNoiseGenerator() = default;
 
     float PerlinNoiseGenerator::getHeightAt(int worldX, int worldY) const
     {
-        float noiseVal = m_noise->GetNoise(static_cast<float>(worldX), static_cast<float>(worldY));
+        float noiseVal = m_surfaceNoise.sample(static_cast<float>(worldX), static_cast<float>(worldY));
         return m_config.amplitude * (noiseVal * 0.5f + 0.5f);
     }
 
-    void PerlinNoiseGenerator::generateChunk(int chunkX, int chunkY, std::vector<TileData> &outTiles) const
+    void PerlinNoiseGenerator::computeColumns(int tileX, int count, uint8_t *outBiome, int *outSurfaceY) const
+    {
+        float noise[BLOCK];
+        m_surfaceNoise.sampleGrid(tileX, 0, count, 1, noise);
+
+        for (int i = 0; i < count; ++i)
+        {
+            const int biome = m_biomes.biomeAt(tileX + i);
+            outBiome[i] = static_cast<uint8_t>(biome < BIOME_COUNT ? biome : 0);
+
+            float heightOffset = m_config.amplitude * kAmplitudeMult[outBiome[i]] * (noise[i] * 0.5f + 0.5f);
+            outSurfaceY[i] = m_config.seaLevel - static_cast<int>(heightOffset);
+        }
+    }
+
+    void PerlinNoiseGenerator::computeSurfaceHeights(int tileX, int count, int *outSurfaceY) const
     {
-        outTiles.resize(WorldConfig::CHUNK_SIZE * WorldConfig::CHUNK_SIZE);
+        uint8_t biomes[BLOCK];
+        for (int start = 0; start < count; start += BLOCK)
+            computeColumns(tileX + start, std::min(BLOCK, count - start), biomes, outSurfaceY + start);
+    }
 
-        int baseX = chunkX * WorldConfig::CHUNK_SIZE;
-        int baseY = chunkY * WorldConfig::CHUNK_SIZE;
+    void PerlinNoiseGenerator::generateChunk(int chunkX, int chunkY, ChunkTiles &outTiles) const
+    {
+        generateBlock(chunkX * WorldConfig::CHUNK_SIZE, chunkY * WorldConfig::CHUNK_SIZE,
+                      WorldConfig::CHUNK_SIZE, WorldConfig::CHUNK_SIZE, outTiles.data(), WorldConfig::CHUNK_SIZE);
+    }
 
-        for (int ly = 0; ly < WorldConfig::CHUNK_SIZE; ++ly)
+    void PerlinNoiseGenerator::generateRegion(int tileX, int tileY, int width, int height, TileData *outTiles) const
+    {
+        for (int by = 0; by < height; by += BLOCK)
         {
-            for (int lx = 0; lx < WorldConfig::CHUNK_SIZE; ++lx)
+            for (int bx = 0; bx < width; bx += BLOCK)
             {
-                int worldX = baseX + lx;
-                int worldY = baseY + ly;
-
-                // ── 生物群系查询 ──
-                // 0=草原 1=森林 2=岩地 3=矿山 4=洞穴
-                int biome = m_biomeByZone ? m_biomeByZone(worldX) : 0;
-
-                // ── 振幅倍率（影响地形崎岖程度）──
-                float ampMult = 1.0f;
-                switch (biome)
-                {
-                case 2: ampMult = 1.8f; break;  // 岩地：极崎岖
-                case 3: ampMult = 1.5f; break;  // 矿山：很崎岖
-                case 4: ampMult = 1.6f; break;  // 洞穴：崎岖
-                case 1: ampMult = 0.7f; break;  // 森林：较平缓
-                default: ampMult = 1.0f; break; // 草原：标准
-                }
-
-                // ── 地表高度 ──
-                float noiseVal = m_noise->GetNoise(static_cast<float>(worldX), 0.0f);
-                float heightOffset = m_config.amplitude * ampMult * (noiseVal * 0.5f + 0.5f);
-                int surfaceY = m_config.seaLevel - static_cast<int>(heightOffset);
-
-                // ── 初始瓦片类型 ──
-                TileType type = TileType::Air;
-
-                if (worldY < surfaceY)
-                {
+                generateBlock(tileX + bx, tileY + by, std::min(BLOCK, width - bx), std::min(BLOCK, height - by),
+                              outTiles + static_cast<size_t>(by) * width + bx, width);
+            }
+        }
+    }
+
+    void PerlinNoiseGenerator::generateBlock(int tileX, int tileY, int width, int height, TileData *out, int stride) const
+    {
+        // ── 逐列：生物群系、地表高度、分层 ──
+        uint8_t biomes[BLOCK];
+        int surfaceY[BLOCK];
+        computeColumns(tileX, width, biomes, surfaceY);
+
+        ColumnLayers layers[BLOCK];
+        int minSurfaceY = surfaceY[0];
+        for (int col = 0; col < width; ++col)
+        {
+            ColumnLayers &c = layers[col];
+            c.surfaceY = surfaceY[col];
+            c.caveThreshold = kCaveThreshold[biomes[col]];
+            minSurfaceY = std::min(minSurfaceY, c.surfaceY);
+
+            switch (biomes[col])
+            {
+            case 1: // 森林：超厚泥土层，草地表面
+                c.top = TileType::Grass;
+                c.dirtEnd = c.surfaceY + m_config.grassDepth * 4;
+                break;
+            case 2: // 岩地：砾石表面，极薄泥土，大量裸石
+                c.top = TileType::Gravel;
+                c.dirtEnd = c.surfaceY + 2;
+                break;
+            case 3: // 矿山：纯石头（无草无土），矿脉另注入
+            case 4: // 洞穴：纯石头（靠洞穴雕刻产生视觉差异）
+                c.top = TileType::Stone;
+                c.dirtEnd = c.surfaceY;
+                break;
+            default: // 草原：标准分层
+                c.top = TileType::Grass;
+                c.dirtEnd = c.surfaceY + m_config.grassDepth;
+                break;
+            }
+        }
+
+        // ── 洞穴噪声：只有可能被雕刻的行才采样（整块一次批量求值）──
+        float cave[BLOCK * BLOCK];
+        const int caveRow0 = std::clamp(minSurfaceY + CAVE_MIN_DEPTH - tileY, 0, height);
+        m_caveNoise.sampleGrid(tileX, tileY + caveRow0, width, height - caveRow0, cave);
+
+        for (int row = 0; row < height; ++row)
+        {
+            const int worldY = tileY + row;
+            const float *caveRow = row >= caveRow0 ? cave + (row - caveRow0) * width : nullptr;
+            TileData *outRow = out + static_cast<size_t>(row) * stride;
+
+            for (int col = 0; col < width; ++col)
+            {
+                const ColumnLayers &c = layers[col];
+                TileType type;
+                if (worldY < c.surfaceY)
                     type = TileType::Air;
-                }
+                else if (worldY == c.surfaceY)
+                    type = c.top;
+                else if (worldY < c.dirtEnd)
+                    type = TileType::Dirt;
                 else
-                {
-                    switch (biome)
-                    {
-                    case 1: // 森林：超厚泥土层，草地表面
-                        if (worldY == surfaceY)
-                            type = TileType::Grass;
-                        else if (worldY < surfaceY + m_config.grassDepth * 4)
-                            type = TileType::Dirt;
-                        else
-                            type = TileType::Stone;
-                        break;
-
-                    case 2: // 岩地：砾石表面，极薄泥土，大量裸石
-                        if (worldY == surfaceY)
-                            type = TileType::Gravel;
-                        else if (worldY <= surfaceY + 1)
-                            type = TileType::Dirt;
-                        else
-                            type = TileType::Stone;
-                        break;
-
-                    case 3: // 矿山：纯石头（无草无土），矿脉另注入
-                    case 4: // 洞穴：纯石头（靠洞穴雕刻产生视觉差异）
-                        type = TileType::Stone;
-                        break;
-
-                    default: // 草原：标准分层
-                        if (worldY == surfaceY)
-                            type = TileType::Grass;
-                        else if (worldY < surfaceY + m_config.grassDepth)
-                            type = TileType::Dirt;
-                        else
-                            type = TileType::Stone;
-                        break;
-                    }
-                }
-
-                // ── 洞穴雕刻（地表下至少 3 格才开始）──
-                if (type != TileType::Air && worldY > surfaceY + 2)
-                {
-                    // 洞穴密度阈值，每个生物群系不同
-                    float thresh = 0.0f;
-                    switch (biome)
-                    {
-                    case 4: thresh = 0.30f; break;  // 洞穴：大量洞穴（蜂巢状）
-                    case 2: thresh = 0.14f; break;  // 岩地：中等洞穴
-                    case 3: thresh = 0.11f; break;  // 矿山：少量洞穴
-                    case 1: thresh = 0.05f; break;  // 森林：极少洞穴
-                    default: thresh = 0.08f; break; // 草原：少量洞穴
-                    }
-
-                    // |noise| < thresh → 空气（形成蠕虫状隧道/腔体）
-                    float cv = m_caveNoise->GetNoise(
-                        static_cast<float>(worldX),
-                        static_cast<float>(worldY));
-                    if (std::abs(cv) < thresh)
-                        type = TileType::Air;
-                }
-
-                outTiles[ly * WorldConfig::CHUNK_SIZE + lx] = TileData(type);
+                    type = TileType::Stone;
+
+                if (caveRow && worldY >= c.surfaceY + CAVE_MIN_DEPTH && std::abs(caveRow[col]) < c.caveThreshold)
+                    type = TileType::Air;
+
+                outRow[col] = TileData(type);
             }
         }
     }
-} // namespace engine::world
\ No newline at end of file
+} // namespace engine::world
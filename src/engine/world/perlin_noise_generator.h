@@ -1,12 +1,12 @@
 // 柏林噪声地形生成器
 // perlin_noise_generator.h
+//   - 生物群系来自 BiomeStrip（按区段查表，每列只解析一次）
+//   - 地表高度每列只算一次，洞穴噪声按整块走 PerlinBatch 向量化内核
+//   - generateChunk 与 generateRegion 共用同一块级实现，结果逐瓦片一致
 #pragma once
 #include "terrain_generator.h"
 #include "tile_info.h"
-#include <memory>
-#include <functional>
-
-class FastNoiseLite;
+#include "perlin_batch.h"
 
 namespace engine::world
 {
@@ -17,20 +17,31 @@ namespace engine::world
         ~PerlinNoiseGenerator() override;
 
         /**
-         * @brief 设置生物群系查询回调
-         *   fn(tileX) → int，返回值为 CellTerrain 的整数值
-         *   0=草原 1=森林 2=岩地 3=矿山 4=洞穴
+         * @brief 设置生物群系表（通常由路线沿 path 的格子地形构建，zoneWidth = TILES_PER_CELL）
+         * 生成期间不得修改；未设置时全部按草原生成
          */
-        using BiomeLookup = std::function<int(int tileX)>;
-        void setBiomeLookup(BiomeLookup fn) { m_biomeByZone = std::move(fn); }
+        void setBiomeStrip(BiomeStrip strip) { m_biomes = std::move(strip); }
+        const BiomeStrip &getBiomeStrip() const { return m_biomes; }
 
-        void generateChunk(int chunkX, int chunkY, std::vector<TileData> &outTiles) const override;
+        void generateChunk(int chunkX, int chunkY, ChunkTiles &outTiles) const override;
+        void generateRegion(int tileX, int tileY, int width, int height, TileData *outTiles) const override;
         float getHeightAt(int worldX, int worldY) const override;
 
+        // 批量地表高度：outSurfaceY[i] 为第 tileX + i 列的地表 Y（已含生物群系振幅倍率）
+        void computeSurfaceHeights(int tileX, int count, int *outSurfaceY) const;
+
+        // 块级生成的边长上限（栈上临时缓冲按此分配）
+        static constexpr int BLOCK = 64;
+
     private:
-        std::unique_ptr<FastNoiseLite> m_noise;
-        std::unique_ptr<FastNoiseLite> m_caveNoise;  // 2D 噪声用于洞穴雕刻
-        BiomeLookup m_biomeByZone;                   // 可选：生物群系查询
+        // 生成 width × height（均不超过 BLOCK）的一块，out 的行跨度为 stride
+        void generateBlock(int tileX, int tileY, int width, int height, TileData *out, int stride) const;
+        // 每列的生物群系与地表高度，count 不超过 BLOCK
+        void computeColumns(int tileX, int count, uint8_t *outBiome, int *outSurfaceY) const;
+
+        PerlinBatch m_surfaceNoise;
+        PerlinBatch m_caveNoise; // 2D 噪声用于洞穴雕刻
+        BiomeStrip m_biomes;
     };
 
-} // namespace engine::world
\ No newline at end of file
+} // namespace engine::world
@@ -0,0 +1,442 @@
+#include "region_cache.h"
+#include "../core/profiler.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+#include <spdlog/spdlog.h>
+
+namespace engine::world
+{
+    namespace
+    {
+        constexpr char kMagic[4] = {'L', 'S', 'L', 'R'};
+        constexpr uint16_t kVersion = 1;
+
+        // 编码标记
+        constexpr uint8_t kEncodingRaw = 0;
+        constexpr uint8_t kEncodingRle = 1;
+
+        // 空洞至少达到该字节数且超过存活数据时才压实，避免小文件频繁重写
+        constexpr uint64_t kCompactMinDeadBytes = 16 * 1024;
+
+        struct RegionFileHeader
+        {
+            char magic[4];
+            uint16_t version;
+            uint16_t chunkSize;
+            uint16_t regionSize;
+            uint16_t reserved0;
+            uint32_t reserved1;
+        };
+        static_assert(sizeof(RegionFileHeader) == 16, "区域文件头应为 16 字节");
+
+        int floorDiv(int v, int d) { return (v >= 0 ? v : v - d + 1) / d; }
+
+        uint64_t packKey(int x, int y)
+        {
+            return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+        }
+
+        int keyX(uint64_t key) { return static_cast<int>(static_cast<uint32_t>(key >> 32)); }
+        int keyY(uint64_t key) { return static_cast<int>(static_cast<uint32_t>(key)); }
+    }
+
+    // ── 编解码 ──
+
+    size_t RegionCache::encodeChunk(const ChunkTiles &tiles, uint8_t *out)
+    {
+        // RLE：(count, type, palette) 三元组；一旦不比原始数据小就改存原始字节
+        constexpr size_t RAW_SIZE = sizeof(ChunkTiles);
+        size_t size = 1;
+        out[0] = kEncodingRle;
+        for (size_t i = 0; i < tiles.size();)
+        {
+            size_t run = 1;
+            while (i + run < tiles.size() && run < 255 && tiles[i + run] == tiles[i])
+                ++run;
+            if (size + 3 > RAW_SIZE)
+            {
+                out[0] = kEncodingRaw;
+                std::memcpy(out + 1, tiles.data(), RAW_SIZE);
+                return 1 + RAW_SIZE;
+            }
+            out[size++] = static_cast<uint8_t>(run);
+            out[size++] = static_cast<uint8_t>(tiles[i].type);
+            out[size++] = tiles[i].palette;
+            i += run;
+        }
+        return size;
+    }
+
+    bool RegionCache::decodeChunk(const uint8_t *data, size_t size, ChunkTiles &out)
+    {
+        if (size < 1)
+            return false;
+
+        if (data[0] == kEncodingRaw)
+        {
+            if (size != 1 + sizeof(ChunkTiles))
+                return false;
+            std::memcpy(out.data(), data + 1, sizeof(ChunkTiles));
+            return true;
+        }
+        if (data[0] != kEncodingRle || (size - 1) % 3 != 0)
+            return false;
+
+        size_t tile = 0;
+        for (size_t i = 1; i < size; i += 3)
+        {
+            const size_t run = data[i];
+            if (run == 0 || tile + run > out.size())
+                return false;
+            const TileData value(static_cast<TileType>(data[i + 1]), data[i + 2]);
+            std::fill_n(out.begin() + static_cast<std::ptrdiff_t>(tile), run, value);
+            tile += run;
+        }
+        return tile == out.size();
+    }
+
+    // ── 生命周期 ──
+
+    RegionCache::RegionCache(std::string directory)
+        : m_directory(std::move(directory))
+    {
+        std::error_code ec;
+        std::filesystem::create_directories(m_directory, ec);
+        if (ec)
+            spdlog::warn("[RegionCache] 无法创建目录 {}: {}", m_directory, ec.message());
+
+        m_writer = std::thread([this] { writeLoop(); });
+    }
+
+    RegionCache::~RegionCache()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_pendingMutex);
+            m_stopping = true;
+        }
+        m_pendingCv.notify_all();
+        if (m_writer.joinable())
+            m_writer.join();
+    }
+
+    RegionCache::Region &RegionCache::regionFor(int chunkX, int chunkY, int &slot)
+    {
+        const int regionX = floorDiv(chunkX, REGION_SIZE);
+        const int regionY = floorDiv(chunkY, REGION_SIZE);
+        slot = (chunkY - regionY * REGION_SIZE) * REGION_SIZE + (chunkX - regionX * REGION_SIZE);
+
+        std::lock_guard<std::mutex> lock(m_regionsMutex);
+        auto &region = m_regions[packKey(regionX, regionY)];
+        if (!region)
+        {
+            region = std::make_unique<Region>();
+            region->path = (std::filesystem::path(m_directory) /
+                            ("r." + std::to_string(regionX) + "." + std::to_string(regionY) + ".lslr"))
+                               .string();
+        }
+        return *region;
+    }
+
+    // ── 读取 ──
+
+    void RegionCache::openRegion(Region &region)
+    {
+        region.opened = true;
+        if (!region.map.open(region.path))
+            return;
+
+        constexpr size_t HEADER_BYTES = sizeof(RegionFileHeader) + sizeof(ChunkSlot) * SLOTS;
+        RegionFileHeader header{};
+        if (region.map.size() < HEADER_BYTES)
+        {
+            spdlog::warn("[RegionCache] 区域文件过短，忽略: {}", region.path);
+            region.map.close();
+            return;
+        }
+        std::memcpy(&header, region.map.data(), sizeof(header));
+        if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.version != kVersion ||
+            header.chunkSize != WorldConfig::CHUNK_SIZE || header.regionSize != REGION_SIZE)
+        {
+            spdlog::warn("[RegionCache] 区域文件格式不匹配，忽略: {}", region.path);
+            region.map.close();
+            return;
+        }
+
+        std::memcpy(region.slots.data(), region.map.data() + sizeof(header), sizeof(ChunkSlot) * SLOTS);
+        region.fileSize = region.map.size();
+        region.liveBytes = 0;
+        for (ChunkSlot &slot : region.slots)
+        {
+            // 越界索引视为损坏，丢弃该区块（之后重新生成）
+            if (slot.offset != 0 && (slot.offset < HEADER_BYTES || slot.size > MAX_ENCODED_SIZE ||
+                                     static_cast<uint64_t>(slot.offset) + slot.size > region.fileSize))
+                slot = {};
+            region.liveBytes += slot.size;
+        }
+        region.fileExists = true;
+        region.mapStale = false;
+    }
+
+    bool RegionCache::remap(Region &region)
+    {
+        if (!region.mapStale)
+            return region.map.isOpen();
+        // 打开失败时保持 stale，下次 load 再试（文件可能正被替换）
+        if (!region.map.open(region.path))
+            return false;
+        region.mapStale = false;
+        return true;
+    }
+
+    bool RegionCache::load(int chunkX, int chunkY, ChunkTiles &out)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_pendingMutex);
+            auto it = m_pending.find(packKey(chunkX, chunkY));
+            if (it != m_pending.end())
+            {
+                out = it->second.tiles;
+                m_hits.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        int slotIndex = 0;
+        Region &region = regionFor(chunkX, chunkY, slotIndex);
+        std::lock_guard<std::mutex> lock(region.mutex);
+        if (!region.opened)
+            openRegion(region);
+
+        const ChunkSlot slot = region.slots[static_cast<size_t>(slotIndex)];
+        if (slot.offset == 0 || !remap(region) || slot.offset + slot.size > region.map.size() ||
+            !decodeChunk(region.map.data() + slot.offset, slot.size, out))
+        {
+            m_misses.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        m_hits.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // ── 写入 ──
+
+    void RegionCache::store(int chunkX, int chunkY, const ChunkTiles &tiles)
+    {
+        const uint64_t key = packKey(chunkX, chunkY);
+        {
+            std::lock_guard<std::mutex> lock(m_pendingMutex);
+            PendingWrite &pending = m_pending[key];
+            pending.tiles = tiles;
+            pending.version = m_nextVersion++;
+            if (pending.queued)
+                return; // 已排队：写线程取走时读到的就是最新瓦片
+            pending.queued = true;
+            m_writeQueue.push_back(key);
+        }
+        m_pendingCv.notify_one();
+    }
+
+    void RegionCache::flush()
+    {
+        std::unique_lock<std::mutex> lock(m_pendingMutex);
+        m_flushedCv.wait(lock, [this] { return m_writeQueue.empty() && !m_writing; });
+    }
+
+    void RegionCache::writeLoop()
+    {
+        LSL_PROFILE_THREAD("RegionCache");
+        struct BatchEntry
+        {
+            uint64_t regionKey;
+            uint64_t chunkKey;
+            PendingWrite write;
+        };
+        std::vector<BatchEntry> batch;
+        std::vector<EncodedChunk> encoded;
+
+        for (;;)
+        {
+            batch.clear();
+            {
+                std::unique_lock<std::mutex> lock(m_pendingMutex);
+                m_pendingCv.wait(lock, [this] { return m_stopping || !m_writeQueue.empty(); });
+                if (m_writeQueue.empty())
+                    return; // m_stopping 且已排空
+
+                for (uint64_t key : m_writeQueue)
+                {
+                    PendingWrite &pending = m_pending[key];
+                    pending.queued = false;
+                    const int cx = keyX(key);
+                    const int cy = keyY(key);
+                    batch.push_back({packKey(floorDiv(cx, REGION_SIZE), floorDiv(cy, REGION_SIZE)), key, pending});
+                }
+                m_writeQueue.clear();
+                m_writing = true;
+            }
+
+            // 按区域分组：每个区域只打开 / 追加一次
+            std::sort(batch.begin(), batch.end(),
+                      [](const BatchEntry &a, const BatchEntry &b) { return a.regionKey < b.regionKey; });
+
+            for (size_t begin = 0; begin < batch.size();)
+            {
+                size_t end = begin;
+                encoded.clear();
+                int slot = 0;
+                Region *region = nullptr;
+                for (; end < batch.size() && batch[end].regionKey == batch[begin].regionKey; ++end)
+                {
+                    region = &regionFor(keyX(batch[end].chunkKey), keyY(batch[end].chunkKey), slot);
+                    EncodedChunk &chunk = encoded.emplace_back();
+                    chunk.slot = slot;
+                    chunk.size = static_cast<uint32_t>(encodeChunk(batch[end].write.tiles, chunk.bytes.data()));
+                }
+
+                std::lock_guard<std::mutex> lock(region->mutex);
+                if (!region->opened)
+                    openRegion(*region);
+                if (!appendChunks(*region, encoded.data(), static_cast<int>(encoded.size())))
+                    spdlog::error("[RegionCache] 写入区域文件失败: {}", region->path);
+                begin = end;
+            }
+
+            {
+                // 只移除写入期间没有被再次 store 的条目；失败的写入同样移除，避免无限重试
+                std::lock_guard<std::mutex> lock(m_pendingMutex);
+                for (const BatchEntry &entry : batch)
+                {
+                    auto it = m_pending.find(entry.chunkKey);
+                    if (it != m_pending.end() && it->second.version == entry.write.version)
+                        m_pending.erase(it);
+                }
+                m_writing = false;
+            }
+            m_flushedCv.notify_all();
+        }
+    }
+
+    bool RegionCache::appendChunks(Region &region, const EncodedChunk *chunks, int count)
+    {
+        constexpr size_t HEADER_BYTES = sizeof(RegionFileHeader) + sizeof(ChunkSlot) * SLOTS;
+
+        // 写入前释放映射（Windows 下映射中的文件不能被截断 / 替换）
+        region.map.close();
+        region.mapStale = true;
+
+        if (!region.fileExists)
+        {
+            std::ofstream create(region.path, std::ios::binary | std::ios::trunc);
+            RegionFileHeader header{};
+            std::memcpy(header.magic, kMagic, sizeof(kMagic));
+            header.version = kVersion;
+            header.chunkSize = WorldConfig::CHUNK_SIZE;
+            header.regionSize = REGION_SIZE;
+            region.slots.fill({});
+            create.write(reinterpret_cast<const char *>(&header), sizeof(header));
+            create.write(reinterpret_cast<const char *>(region.slots.data()), sizeof(ChunkSlot) * SLOTS);
+            if (!create)
+                return false;
+            region.fileExists = true;
+            region.fileSize = HEADER_BYTES;
+            region.liveBytes = 0;
+        }
+
+        std::fstream file(region.path, std::ios::binary | std::ios::in | std::ios::out);
+        if (!file)
+            return false;
+
+        // 先追加数据再更新索引：中途崩溃时旧索引仍指向有效数据
+        file.seekp(static_cast<std::streamoff>(region.fileSize));
+        uint64_t written = 0;
+        for (int i = 0; i < count; ++i)
+        {
+            const EncodedChunk &chunk = chunks[i];
+            ChunkSlot &slot = region.slots[static_cast<size_t>(chunk.slot)];
+            file.write(reinterpret_cast<const char *>(chunk.bytes.data()), chunk.size);
+            region.liveBytes = region.liveBytes - slot.size + chunk.size;
+            slot = {static_cast<uint32_t>(region.fileSize), chunk.size};
+            region.fileSize += chunk.size;
+            written += chunk.size;
+        }
+        file.seekp(static_cast<std::streamoff>(sizeof(RegionFileHeader)));
+        file.write(reinterpret_cast<const char *>(region.slots.data()), sizeof(ChunkSlot) * SLOTS);
+        file.close();
+        if (file.fail())
+            return false;
+
+        m_chunksWritten.fetch_add(static_cast<uint64_t>(count), std::memory_order_relaxed);
+        m_bytesWritten.fetch_add(written, std::memory_order_relaxed);
+
+        const uint64_t deadBytes = region.fileSize - HEADER_BYTES - region.liveBytes;
+        if (deadBytes >= kCompactMinDeadBytes && deadBytes > region.liveBytes)
+            return compact(region);
+        return true;
+    }
+
+    bool RegionCache::compact(Region &region)
+    {
+        constexpr size_t HEADER_BYTES = sizeof(RegionFileHeader) + sizeof(ChunkSlot) * SLOTS;
+        if (!remap(region))
+            return false;
+
+        // 按原顺序复制存活区块到新文件，再原子替换
+        std::vector<uint8_t> image(HEADER_BYTES);
+        std::memcpy(image.data(), region.map.data(), sizeof(RegionFileHeader));
+        std::array<ChunkSlot, SLOTS> slots = region.slots;
+        for (ChunkSlot &slot : slots)
+        {
+            if (slot.offset == 0)
+                continue;
+            const uint8_t *src = region.map.data() + slot.offset;
+            slot.offset = static_cast<uint32_t>(image.size());
+            image.insert(image.end(), src, src + slot.size);
+        }
+        std::memcpy(image.data() + sizeof(RegionFileHeader), slots.data(), sizeof(ChunkSlot) * SLOTS);
+        region.map.close();
+        region.mapStale = true;
+
+        const std::string tmpPath = region.path + ".tmp";
+        {
+            std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+            out.write(reinterpret_cast<const char *>(image.data()), static_cast<std::streamsize>(image.size()));
+            if (!out)
+                return false;
+        }
+        std::error_code ec;
+        std::filesystem::rename(tmpPath, region.path, ec);
+        if (ec)
+        {
+            spdlog::warn("[RegionCache] 压实替换失败 {}: {}", region.path, ec.message());
+            std::filesystem::remove(tmpPath, ec);
+            return true; // 原文件仍然完整
+        }
+
+        region.slots = slots;
+        region.fileSize = image.size();
+        m_compactions.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    RegionCacheStats RegionCache::getStats() const
+    {
+        RegionCacheStats stats;
+        stats.hits = m_hits.load(std::memory_order_relaxed);
+        stats.misses = m_misses.load(std::memory_order_relaxed);
+        stats.chunksWritten = m_chunksWritten.load(std::memory_order_relaxed);
+        stats.bytesWritten = m_bytesWritten.load(std::memory_order_relaxed);
+        stats.compactions = m_compactions.load(std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(m_pendingMutex);
+            stats.pendingWrites = m_pending.size();
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_regionsMutex);
+            stats.openRegions = m_regions.size();
+        }
+        return stats;
+    }
+} // namespace engine::world
@@ -0,0 +1,136 @@
+// 区块磁盘缓存（区域文件）
+// region_cache.h
+//   - 每 32x32 个区块一个区域文件 r.<rx>.<ry>.lslr，按区块键索引
+//   - 读：内存映射整个文件，按索引定位后解压；可在任意线程调用
+//   - 写：store() 只把瓦片放进待写表，由后台写线程按区域批量追加，同一区块多次 store 合并为一次写入
+//   - 压缩：TileData 游程编码（RLE），编码后不小于原始数据时直接存原始字节
+//
+// 文件布局（小端）：
+//   RegionFileHeader | ChunkSlot[REGION_SIZE * REGION_SIZE] | 区块数据（只追加）
+// 覆盖写入旧数据成为空洞，空洞超过存活数据时整文件重写压实。
+#pragma once
+#include "tile_info.h"
+#include "../utils/mapped_file.h"
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+namespace engine::world
+{
+    /**
+     * @brief 缓存统计（供调试面板 / 基准读取），计数为自启动以来的总量
+     */
+    struct RegionCacheStats
+    {
+        uint64_t hits = 0;          // 命中（含待写表命中）
+        uint64_t misses = 0;
+        uint64_t chunksWritten = 0;
+        uint64_t bytesWritten = 0;  // 压缩后的区块数据字节数
+        uint64_t compactions = 0;
+        size_t pendingWrites = 0;   // 待写区块数
+        size_t openRegions = 0;
+    };
+
+    class RegionCache
+    {
+    public:
+        static constexpr int REGION_SIZE = 32; // 每个区域 32x32 个区块
+        static constexpr int SLOTS = REGION_SIZE * REGION_SIZE;
+        // 编码后单个区块的最大字节数（1 字节编码标记 + 最坏情况下的原始数据）
+        static constexpr size_t MAX_ENCODED_SIZE = 1 + sizeof(ChunkTiles);
+
+        // directory 不存在时自动创建；不同世界（种子 / 生成器）应使用不同目录
+        explicit RegionCache(std::string directory);
+        // 写完所有待写区块后返回
+        ~RegionCache();
+
+        RegionCache(const RegionCache &) = delete;
+        RegionCache &operator=(const RegionCache &) = delete;
+
+        // 读取区块（线程安全）。待写表中的最新版本优先；未缓存返回 false
+        bool load(int chunkX, int chunkY, ChunkTiles &out);
+        // 异步写入（线程安全），立即返回
+        void store(int chunkX, int chunkY, const ChunkTiles &tiles);
+        // 阻塞直到当前待写区块全部落盘
+        void flush();
+
+        RegionCacheStats getStats() const;
+        const std::string &getDirectory() const { return m_directory; }
+
+        // 区块编解码（纯函数，工具与基准可直接使用）
+        static size_t encodeChunk(const ChunkTiles &tiles, uint8_t *out);
+        static bool decodeChunk(const uint8_t *data, size_t size, ChunkTiles &out);
+
+    private:
+        struct ChunkSlot
+        {
+            uint32_t offset = 0; // 0 = 未缓存
+            uint32_t size = 0;
+        };
+
+        struct Region
+        {
+            std::mutex mutex;
+            std::string path;
+            bool opened = false;
+            utils::MappedFile map;
+            bool mapStale = true;     // 写入后需重新映射
+            bool fileExists = false;
+            std::array<ChunkSlot, SLOTS> slots{};
+            uint64_t fileSize = 0;
+            uint64_t liveBytes = 0;
+        };
+
+        struct PendingWrite
+        {
+            ChunkTiles tiles;
+            uint64_t version = 0;
+            bool queued = false; // 已在 m_writeQueue 中（写线程取走后清除）
+        };
+
+        struct EncodedChunk
+        {
+            int slot = 0;
+            uint32_t size = 0;
+            std::array<uint8_t, MAX_ENCODED_SIZE> bytes;
+        };
+
+        Region &regionFor(int chunkX, int chunkY, int &slot);
+        void writeLoop();
+
+        // 以下调用方必须持有 region.mutex
+        void openRegion(Region &region);
+        bool remap(Region &region);
+        bool appendChunks(Region &region, const EncodedChunk *chunks, int count);
+        bool compact(Region &region);
+
+        std::string m_directory;
+
+        mutable std::mutex m_regionsMutex;
+        std::unordered_map<uint64_t, std::unique_ptr<Region>> m_regions;
+
+        // 待写表：键 → 最新瓦片；写线程落盘后按版本号移除（期间再次 store 的保留）
+        mutable std::mutex m_pendingMutex;
+        std::condition_variable m_pendingCv;
+        std::condition_variable m_flushedCv;
+        std::unordered_map<uint64_t, PendingWrite> m_pending;
+        std::deque<uint64_t> m_writeQueue;
+        uint64_t m_nextVersion = 1;
+        bool m_writing = false;
+        bool m_stopping = false;
+        std::thread m_writer;
+
+        std::atomic<uint64_t> m_hits{0};
+        std::atomic<uint64_t> m_misses{0};
+        std::atomic<uint64_t> m_chunksWritten{0};
+        std::atomic<uint64_t> m_bytesWritten{0};
+        std::atomic<uint64_t> m_compactions{0};
+    };
+} // namespace engine::world
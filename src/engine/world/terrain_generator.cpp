@@ -1 +1,43 @@
-// 地形生成器接口/基类
\ No newline at end of file
+// 地形生成器接口/基类
+#include "terrain_generator.h"
+#include <algorithm>
+
+namespace engine::world
+{
+    namespace
+    {
+        int floorDiv(int v, int d) { return (v >= 0 ? v : v - d + 1) / d; }
+    }
+
+    void TerrainGenerator::generateRegion(int tileX, int tileY, int width, int height, TileData *outTiles) const
+    {
+        constexpr int CS = WorldConfig::CHUNK_SIZE;
+        if (width <= 0 || height <= 0)
+            return;
+
+        ChunkTiles chunk;
+        const int firstCX = floorDiv(tileX, CS);
+        const int lastCX = floorDiv(tileX + width - 1, CS);
+        const int firstCY = floorDiv(tileY, CS);
+        const int lastCY = floorDiv(tileY + height - 1, CS);
+
+        for (int cy = firstCY; cy <= lastCY; ++cy)
+        {
+            for (int cx = firstCX; cx <= lastCX; ++cx)
+            {
+                generateChunk(cx, cy, chunk);
+
+                // 区块与区域的交集逐行拷贝
+                const int x0 = std::max(cx * CS, tileX);
+                const int x1 = std::min(cx * CS + CS, tileX + width);
+                const int y0 = std::max(cy * CS, tileY);
+                const int y1 = std::min(cy * CS + CS, tileY + height);
+                for (int wy = y0; wy < y1; ++wy)
+                {
+                    const TileData *src = chunk.data() + (wy - cy * CS) * CS + (x0 - cx * CS);
+                    std::copy(src, src + (x1 - x0), outTiles + static_cast<size_t>(wy - tileY) * width + (x0 - tileX));
+                }
+            }
+        }
+    }
+} // namespace engine::world
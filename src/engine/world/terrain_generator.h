@@ -2,12 +2,33 @@
 // terrain_generator.h
 #pragma once
 #include "world_config.h"
+#include "tile_info.h"
 #include <glm/glm.hpp>
+#include <algorithm>
 #include <cstdint>
+#include <vector>
 
 namespace engine::world
 {
-    class TileData;
+    /**
+     * @brief 按横向区段划分的生物群系表（替代逐瓦片的回调查询）
+     *   zone = floor(tileX / zoneWidth)，zones[zone] 为 CellTerrain 的整数值
+     *   0=草原 1=森林 2=岩地 3=矿山 4=洞穴；区段越界时沿用首 / 尾值，空表恒为 0
+     */
+    struct BiomeStrip
+    {
+        int zoneWidth = 100;
+        std::vector<uint8_t> zones;
+
+        int biomeAt(int tileX) const
+        {
+            if (zones.empty() || zoneWidth <= 0)
+                return 0;
+            const int zone = (tileX >= 0 ? tileX : tileX - zoneWidth + 1) / zoneWidth;
+            return zones[static_cast<size_t>(std::clamp(zone, 0, static_cast<int>(zones.size()) - 1))];
+        }
+    };
+
     // 地形生成器抽象基类
     class TerrainGenerator
     {
@@ -16,8 +37,15 @@ namespace engine::world
         virtual ~TerrainGenerator() = default;
 
         // 根据区块坐标生成该区块的所有瓦片数据
-        // 返回一个二维数组（或直接填充传入的缓冲区），大小 = CHUNK_SIZE * CHUNK_SIZE
-        virtual void generateChunk(int chunkX, int chunkY, std::vector<TileData> &outTiles) const = 0;
+        // 直接填充传入的定长缓冲区（行优先，大小 = CHUNK_SIZE * CHUNK_SIZE），必须线程安全
+        virtual void generateChunk(int chunkX, int chunkY, ChunkTiles &outTiles) const = 0;
+
+        /**
+         * @brief 批量生成任意矩形区域 [tileX, tileX+width) × [tileY, tileY+height)
+         * 行优先写入 outTiles（width * height 个），用于小地图预览、路线校验、预烘焙等大范围生成。
+         * 默认实现逐区块调用 generateChunk 再拷贝；子类可覆写为按列 / 按整区批量计算。必须线程安全
+         */
+        virtual void generateRegion(int tileX, int tileY, int width, int height, TileData *outTiles) const;
 
         // 获取某个世界坐标的高度（用于辅助）
         virtual float getHeightAt(int worldX, int worldY) const = 0;
@@ -26,4 +54,4 @@ namespace engine::world
         WorldConfig m_config;
     };
 
-} // namespace engine::world
\ No newline at end of file
+} // namespace engine::world
@@ -1,7 +1,11 @@
 // tile_info.h
 #pragma once
 
+#include "world_config.h"
+#include <array>
+#include <cstdint>
 #include <string>
+#include <type_traits>
 #include <glm/glm.hpp>
 
 namespace engine::world
@@ -34,62 +38,31 @@ namespace engine::world
     }
 
     /**
-     * @brief 单个瓦片的渲染和逻辑信息
+     * @brief 单个瓦片的逻辑信息（2 字节 POD）
+     * 只保存类型与调色板索引；UV 与纹理名通过 TileKindTable 解析。
+     * 可直接 memcpy，整块 8x8 区块仅占 128 字节。
      */
     struct TileData
     {
-        glm::vec4 uv_rect;      // 纹理坐标
-        TileType type;          // 瓦片类型
-        std::string texture_id; // 纹理ID（多图片模式）
+        TileType type = TileType::Air; // 瓦片类型
+        uint8_t palette = 0;           // TileKindTable 中的种类索引
 
-        // 默认构造函数
-        TileData() = default;
+        constexpr TileData() = default;
 
-        // 新增：接受 TileType 的构造函数
-        explicit TileData(TileType t)
-            : type(t)
-        {
-            // 根据瓦片类型设置 UV 坐标（像素坐标）
-            switch (t)
-            {
-            case TileType::Stone:
-                uv_rect = glm::vec4(0.0f, 0.0f, 16.0f, 16.0f);
-                break;
-            case TileType::Dirt:
-                uv_rect = glm::vec4(16.0f, 0.0f, 16.0f, 16.0f);
-                break;
-            case TileType::Grass:
-                uv_rect = glm::vec4(32.0f, 0.0f, 16.0f, 16.0f);
-                break;
-            case TileType::Wood:
-                uv_rect = glm::vec4(48.0f, 0.0f, 16.0f, 16.0f);
-                break;
-            case TileType::Leaves:
-                uv_rect = glm::vec4(64.0f, 0.0f, 16.0f, 16.0f);
-                break;
-            case TileType::Ore:
-                uv_rect = glm::vec4(80.0f, 0.0f, 16.0f, 16.0f);
-                break;
-            case TileType::Gravel:
-                uv_rect = glm::vec4(96.0f, 0.0f, 16.0f, 16.0f);
-                break;
-            case TileType::GroundDecor:
-                // 使用与 Grass 相同的 UV（渲染由 faceTint 决定颜色）
-                uv_rect = glm::vec4(32.0f, 0.0f, 16.0f, 16.0f);
-                break;
-            case TileType::WallDecor:
-                // 同 Stone UV，但平面渲染为远景墙狱
-                uv_rect = glm::vec4(0.0f, 0.0f, 16.0f, 16.0f);
-                break;
-            default:
-                uv_rect = glm::vec4(0.0f, 0.0f, 16.0f, 16.0f);
-                break;
-            }
-        }
+        // 使用该类型的内置种类（调色板索引 == 类型值）
+        constexpr explicit TileData(TileType t)
+            : type(t), palette(static_cast<uint8_t>(t)) {}
 
-        // 原有的三参数构造函数
-        TileData(glm::vec4 uv_rect, TileType type, std::string texture_id)
-            : uv_rect(uv_rect), type(type), texture_id(std::move(texture_id)) {}
+        constexpr TileData(TileType t, uint8_t paletteIndex)
+            : type(t), palette(paletteIndex) {}
+
+        bool operator==(const TileData &) const = default;
     };
 
+    static_assert(sizeof(TileData) == 2, "TileData 应保持 2 字节");
+    static_assert(std::is_trivially_copyable_v<TileData>, "TileData 必须可 memcpy");
+
+    // 一个区块的全部瓦片（定长，生成器直接填充，不产生堆分配）
+    using ChunkTiles = std::array<TileData, WorldConfig::CHUNK_SIZE * WorldConfig::CHUNK_SIZE>;
+
 } // namespace engine::world
\ No newline at end of file
@@ -0,0 +1,76 @@
+#include "tile_kind_table.h"
+#include <spdlog/spdlog.h>
+
+namespace engine::world
+{
+    namespace
+    {
+        glm::vec4 builtinUvRect(TileType type)
+        {
+            // 根据瓦片类型设置 UV 坐标（像素坐标）
+            switch (type)
+            {
+            case TileType::Stone:       return {0.0f, 0.0f, 16.0f, 16.0f};
+            case TileType::Dirt:        return {16.0f, 0.0f, 16.0f, 16.0f};
+            case TileType::Grass:       return {32.0f, 0.0f, 16.0f, 16.0f};
+            case TileType::Wood:        return {48.0f, 0.0f, 16.0f, 16.0f};
+            case TileType::Leaves:      return {64.0f, 0.0f, 16.0f, 16.0f};
+            case TileType::Ore:         return {80.0f, 0.0f, 16.0f, 16.0f};
+            case TileType::Gravel:      return {96.0f, 0.0f, 16.0f, 16.0f};
+            // 使用与 Grass 相同的 UV（渲染由 faceTint 决定颜色）
+            case TileType::GroundDecor: return {32.0f, 0.0f, 16.0f, 16.0f};
+            // 同 Stone UV，但平面渲染为远景墙
+            case TileType::WallDecor:   return {0.0f, 0.0f, 16.0f, 16.0f};
+            default:                    return {0.0f, 0.0f, 16.0f, 16.0f};
+            }
+        }
+
+        constexpr size_t kBuiltinCount = static_cast<size_t>(TileType::WallDecor) + 1;
+    }
+
+    TileKindTable &TileKindTable::shared()
+    {
+        static TileKindTable table;
+        return table;
+    }
+
+    TileKindTable::TileKindTable()
+    {
+        resetToBuiltins();
+    }
+
+    void TileKindTable::resetToBuiltins()
+    {
+        for (auto &kind : m_kinds)
+            kind = TileKind{};
+        for (size_t i = 0; i < kBuiltinCount; ++i)
+        {
+            const auto type = static_cast<TileType>(i);
+            m_kinds[i].type = type;
+            m_kinds[i].uv_rect = builtinUvRect(type);
+        }
+        m_count = kBuiltinCount;
+    }
+
+    uint8_t TileKindTable::registerKind(TileType type, const glm::vec4 &uvRect, const std::string &textureId)
+    {
+        for (size_t i = 0; i < m_count; ++i)
+        {
+            const auto &kind = m_kinds[i];
+            if (kind.type == type && kind.uv_rect == uvRect && kind.texture_id == textureId)
+                return static_cast<uint8_t>(i);
+        }
+
+        if (m_count >= CAPACITY)
+        {
+            spdlog::warn("TileKindTable: 种类表已满（{}），回退为内置种类 {}", CAPACITY, static_cast<int>(type));
+            return static_cast<uint8_t>(type);
+        }
+
+        auto &kind = m_kinds[m_count];
+        kind.type = type;
+        kind.uv_rect = uvRect;
+        kind.texture_id = textureId;
+        return static_cast<uint8_t>(m_count++);
+    }
+} // namespace engine::world
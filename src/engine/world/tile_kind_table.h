@@ -0,0 +1,52 @@
+// tile_kind_table.h
+#pragma once
+#include "tile_info.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <glm/glm.hpp>
+
+namespace engine::world
+{
+    /**
+     * @brief 瓦片种类：TileData::palette 指向的共享渲染信息
+     */
+    struct TileKind
+    {
+        glm::vec4 uv_rect{0.0f, 0.0f, 16.0f, 16.0f}; // 纹理坐标（像素）
+        TileType type = TileType::Air;
+        std::string texture_id;                       // 纹理ID（空 = 使用区块图集）
+    };
+
+    /**
+     * @brief 全局瓦片种类表（调色板）
+     * - 索引 0..WallDecor 固定为各 TileType 的内置种类，与旧版 TileData(TileType) 的 UV 一致
+     * - 其余槽位由 game::world::GroundTileCatalog 在加载时注册
+     * - 容量固定，注册不会搬移已有条目；工作线程可并发只读，注册只应在主线程加载阶段进行
+     */
+    class TileKindTable
+    {
+    public:
+        static constexpr size_t CAPACITY = 256;
+
+        static TileKindTable &shared();
+
+        const TileKind &kind(uint8_t palette) const { return m_kinds[palette]; }
+        const glm::vec4 &uvRect(TileData tile) const { return m_kinds[tile.palette].uv_rect; }
+        const std::string &textureId(TileData tile) const { return m_kinds[tile.palette].texture_id; }
+        size_t size() const { return m_count; }
+
+        // 注册（或复用完全相同的）种类，返回调色板索引；表满时退回该类型的内置种类
+        uint8_t registerKind(TileType type, const glm::vec4 &uvRect, const std::string &textureId);
+
+        // 丢弃所有已注册种类，仅保留内置种类
+        void resetToBuiltins();
+
+    private:
+        TileKindTable();
+
+        std::array<TileKind, CAPACITY> m_kinds;
+        size_t m_count = 0;
+    };
+} // namespace engine::world
@@ -1,6 +1,8 @@
 // 世界配置（种子、参数）
 #include "world_config.h"
 #include "world_config.h"
+#include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <nlohmann/json.hpp>
 #include <spdlog/spdlog.h>
@@ -39,4 +41,32 @@ bool engine::world::WorldConfig::loadFromFile(const std::string &path) {
         spdlog::error("读取世界配置文件异常: {}，错误: {}", path, e.what());
     }
     return false;
+}
+
+std::string engine::world::WorldConfig::fingerprint() const {
+    // FNV-1a，逐字段按值的字节序列累加（不哈希整个结构体，避免填充字节）
+    uint64_t hash = 14695981039346656037ULL;
+    auto mix = [&hash](const auto &value) {
+        unsigned char bytes[sizeof(value)];
+        std::memcpy(bytes, &value, sizeof(value));
+        for (unsigned char b : bytes) {
+            hash ^= b;
+            hash *= 1099511628211ULL;
+        }
+    };
+    mix(seed);
+    mix(seaLevel);
+    mix(noiseScale);
+    mix(amplitude);
+    mix(grassDepth);
+    mix(dirtDepth);
+    mix(stoneStart);
+    mix(treeMinTrunkHeight);
+    mix(treeMaxTrunkHeight);
+    mix(treeSpacing);
+    mix(treeCrownRadius);
+
+    char text[17];
+    std::snprintf(text, sizeof(text), "%016llx", static_cast<unsigned long long>(hash));
+    return text;
 }
\ No newline at end of file
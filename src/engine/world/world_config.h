@@ -29,6 +29,8 @@ struct WorldConfig {
     static constexpr float PIXELS_PER_METER = 32.0f; // 32像素 = 1米
     // 可加载配置文件
     bool loadFromFile(const std::string& path);
+    // 生成参数指纹（16 位十六进制）：参数相同的世界得到相同的值，用于给区域缓存等按世界分目录
+    std::string fingerprint() const;
 };
 
 } // namespace engine::world
\ No newline at end of file
@@ -126,6 +126,9 @@ namespace game::animation
             clip.frame_count = static_cast<int>(framesJson.size());
             clip.frame_duration = 0.1f;
             clip.frames.reserve(framesJson.size());
+            // 动作可单独指定精灵表；未指定时沿用整套动画的 texture（由调用方设置到 Sprite 上）
+            if (const std::string actionTexture = action.value("texture", std::string{}); !actionTexture.empty())
+                clip.texture = engine::resource::TextureRegistry::shared().acquire(actionTexture);
 
             for (const auto& frameJson : framesJson)
             {
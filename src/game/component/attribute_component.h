@@ -1,5 +1,5 @@
 #pragma once
-#include "../../engine/component/component.h"
+#include "game_component_types.h"
 #include <string>
 #include <vector>
 
@@ -67,6 +67,8 @@ namespace game::component
     class AttributeComponent final : public engine::component::Component
     {
     public:
+        static constexpr engine::component::ComponentTypeId TYPE_ID = game::component::component_type::Attribute;
+
         explicit AttributeComponent(BaseStats base = {});
 
         // ── 当前值读取 ─────────────────────────────────────────────────────────
@@ -0,0 +1,11 @@
+#pragma once
+#include "../../engine/component/component.h"
+
+namespace game::component::component_type
+{
+    // 游戏层组件的类型编号，接在引擎组件之后（上限 engine::component::component_type::COUNT）
+    using engine::component::component_type::GAME_BASE;
+
+    constexpr engine::component::ComponentTypeId Attribute = GAME_BASE + 0;
+    constexpr engine::component::ComponentTypeId MonsterAI = GAME_BASE + 1;
+}
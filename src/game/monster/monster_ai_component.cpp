@@ -106,7 +106,7 @@ namespace game::monster
         if (!_owner || !m_target)
             return {0.0f, 0.0f};
 
-        auto *selfTransform = _owner->getComponent<engine::component::TransformComponent>();
+        auto *selfTransform = m_transform;
         auto *targetTransform = m_target->getComponent<engine::component::TransformComponent>();
         if (!selfTransform || !targetTransform)
             return {0.0f, 0.0f};
@@ -117,7 +117,7 @@ namespace game::monster
     bool MonsterAIComponent::isGrounded() const
     {
         if (!_owner) return false;
-        auto *physics = _owner->getComponent<engine::component::PhysicsComponent>();
+        auto *physics = m_physics;
         if (!physics) return false;
         return std::abs(physics->getVelocity().y) < 0.15f;
     }
@@ -166,8 +166,8 @@ namespace game::monster
 
     void MonsterAIComponent::updateSlime(float dt)
     {
-        auto *physics = _owner->getComponent<engine::component::PhysicsComponent>();
-        auto *sprite = _owner->getComponent<engine::component::SpriteComponent>();
+        auto *physics = m_physics;
+        auto *sprite = m_sprite;
         if (!physics || !sprite) return;
 
         glm::vec2 delta = getTargetDelta();
@@ -217,8 +217,8 @@ namespace game::monster
 
     void MonsterAIComponent::updateWolf(float dt)
     {
-        auto *physics = _owner->getComponent<engine::component::PhysicsComponent>();
-        auto *sprite = _owner->getComponent<engine::component::SpriteComponent>();
+        auto *physics = m_physics;
+        auto *sprite = m_sprite;
         if (!physics || !sprite) return;
 
         glm::vec2 delta = getTargetDelta();
@@ -258,8 +258,8 @@ namespace game::monster
 
     void MonsterAIComponent::updateWhiteApe(float dt)
     {
-        auto *physics = _owner->getComponent<engine::component::PhysicsComponent>();
-        auto *sprite = _owner->getComponent<engine::component::SpriteComponent>();
+        auto *physics = m_physics;
+        auto *sprite = m_sprite;
         if (!physics || !sprite) return;
 
         glm::vec2 delta = getTargetDelta();
@@ -307,8 +307,8 @@ namespace game::monster
         if (!_owner)
             return;
 
-        auto *controller = _owner->getComponent<engine::component::ControllerComponent>();
-        auto *sprite = _owner->getComponent<engine::component::SpriteComponent>();
+        auto *controller = m_controller;
+        auto *sprite = m_sprite;
         if (!controller || !sprite)
             return;
 
@@ -316,6 +316,14 @@ namespace game::monster
             controller->getFacingDirection() == engine::component::ControllerComponent::FacingDirection::Left);
     }
 
+    void MonsterAIComponent::resolveSiblings()
+    {
+        m_transform = _owner->getComponent<engine::component::TransformComponent>();
+        m_physics = _owner->getComponent<engine::component::PhysicsComponent>();
+        m_sprite = _owner->getComponent<engine::component::SpriteComponent>();
+        m_controller = _owner->getComponent<engine::component::ControllerComponent>();
+    }
+
     void MonsterAIComponent::update(float delta_time)
     {
         if (!_owner) return;
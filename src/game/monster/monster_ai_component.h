@@ -1,10 +1,17 @@
 #pragma once
 
-#include "../../engine/component/component.h"
+#include "../component/game_component_types.h"
 #include <glm/vec2.hpp>
 
 namespace engine::object { class GameObject; }
 namespace engine::world { class ChunkManager; }
+namespace engine::component
+{
+    class TransformComponent;
+    class PhysicsComponent;
+    class SpriteComponent;
+    class ControllerComponent;
+}
 
 namespace game::monster
 {
@@ -18,6 +25,8 @@ namespace game::monster
     class MonsterAIComponent final : public engine::component::Component
     {
     public:
+        static constexpr engine::component::ComponentTypeId TYPE_ID = game::component::component_type::MonsterAI;
+
         enum class DriveMode
         {
             Autonomous,
@@ -59,6 +68,12 @@ namespace game::monster
         float m_alertTimer = 0.0f;
         int m_nearbyAllies = 0;
 
+        // 缓存的兄弟组件，见 resolveSiblings
+        engine::component::TransformComponent *m_transform = nullptr;
+        engine::component::PhysicsComponent *m_physics = nullptr;
+        engine::component::SpriteComponent *m_sprite = nullptr;
+        engine::component::ControllerComponent *m_controller = nullptr;
+
         bool isGrounded() const;
         void updateSlime(float dt);
         void updateWolf(float dt);
@@ -67,6 +82,7 @@ namespace game::monster
         void updatePlayerControlled(float dt);
         void refreshAiState(float dt, float distanceToTarget);
 
+        void resolveSiblings() override;
         void handleInput() override {}
         void update(float delta_time) override;
         void render() override {}
@@ -25,6 +25,12 @@ namespace game::monster
         constexpr float kSpawnOuterRadius = 960.0f;
         constexpr float kCleanupRadius = 1500.0f;
         constexpr float kPixelsPerMeter = 32.0f;
+        constexpr float kDepthWeight = 0.42f;   // 2.5D 距离中深度（y）分量的权重
+        constexpr float kAllyRadius = 260.0f;   // 分离计数半径（2.5D 距离）
+        // 网格单元：深度方向按权重放大，使单元格在 2.5D 距离下近似正方形；边长与分离半径同量级（分离查询约 3×3 格）
+        constexpr float kGridCellSize = 256.0f;
+        // 网格在 update() 中重建，同帧稍后的战斗查询发生时怪物可能已移动：候选区域外扩该余量，再按当前位置精确判定
+        constexpr float kGridSlack = 32.0f;
 
         const char* textureForMonster(MonsterType type)
         {
@@ -118,7 +124,6 @@ namespace game::monster
 
         float distance2p5d(const glm::vec2 &a, const glm::vec2 &b)
         {
-            constexpr float kDepthWeight = 0.42f;
             const glm::vec2 d = a - b;
             return std::sqrt(d.x * d.x + d.y * d.y * kDepthWeight * kDepthWeight);
         }
@@ -148,6 +153,8 @@ namespace game::monster
         , m_player(player)
         , m_anchorActor(player)
         , m_hostileTarget(player)
+        , m_grid({kGridCellSize, kGridCellSize / kDepthWeight})
+        , m_maxMonsters(kMaxMonsters)
         , m_rng(1234567u)
     {
     }
@@ -222,7 +229,7 @@ namespace game::monster
 
     void MonsterManager::spawnMonster()
     {
-        if (m_monsters.size() >= kMaxMonsters)
+        if (m_monsters.size() >= m_maxMonsters)
             return;
 
         glm::vec2 spawnPos{};
@@ -262,6 +269,14 @@ namespace game::monster
         m_monsters.push_back({monster, type});
     }
 
+    int MonsterManager::spawnBatch(int count)
+    {
+        const size_t before = m_monsters.size();
+        for (int i = 0; i < count && m_monsters.size() < m_maxMonsters; ++i)
+            spawnMonster();
+        return static_cast<int>(m_monsters.size() - before);
+    }
+
     void MonsterManager::cleanupMonsters()
     {
         engine::object::GameObject *anchor = m_anchorActor ? m_anchorActor : m_player;
@@ -310,6 +325,10 @@ namespace game::monster
             spawnMonster();
         }
 
+        rebuildGrid();
+
+        // 2.5D 半径在网格坐标下是椭圆，先取外接矩形的候选再精确判定
+        const glm::vec2 allyExtent{kAllyRadius, kAllyRadius / kDepthWeight};
         for (auto &entry : m_monsters)
         {
             if (!entry.actor || entry.actor->isNeedRemove() || entry.actor == m_possessedMonster)
@@ -322,23 +341,32 @@ namespace game::monster
 
             int nearbyAllies = 0;
             const glm::vec2 pos = transform->getPosition();
-            for (const auto &other : m_monsters)
+            m_grid.queryRect(pos - allyExtent, pos + allyExtent,
+                             [&](engine::object::GameObject *other, const glm::vec2 &otherPos)
             {
-                if (!other.actor || other.actor == entry.actor || other.actor->isNeedRemove() || other.actor == m_possessedMonster)
-                    continue;
-
-                auto *otherTransform = other.actor->getComponent<engine::component::TransformComponent>();
-                if (!otherTransform)
-                    continue;
-
-                    if (distance2p5d(otherTransform->getPosition(), pos) <= 260.0f)
+                if (other == entry.actor || other == m_possessedMonster)
+                    return;
+                if (distance2p5d(otherPos, pos) <= kAllyRadius)
                     ++nearbyAllies;
-            }
+            });
 
             ai->setNearbyAllies(nearbyAllies);
         }
     }
 
+    void MonsterManager::rebuildGrid()
+    {
+        m_grid.clear();
+        for (const auto &entry : m_monsters)
+        {
+            if (!entry.actor || entry.actor->isNeedRemove())
+                continue;
+            if (auto *transform = entry.actor->getComponent<engine::component::TransformComponent>())
+                m_grid.insert(entry.actor, transform->getPosition());
+        }
+        m_grid.build();
+    }
+
     MonsterType MonsterManager::getMonsterType(const engine::object::GameObject *monster) const
     {
         for (const auto &entry : m_monsters)
@@ -358,24 +386,24 @@ namespace game::monster
 
     engine::object::GameObject *MonsterManager::findNearestMonster(const glm::vec2 &origin, float maxDistance) const
     {
-        engine::object::GameObject *best = nullptr;
-        float bestDistanceSq = maxDistance * maxDistance;
+        // 网格位置可能落后一帧：多取几个候选，再按当前位置选最近
+        constexpr size_t kCandidates = 4;
+        m_grid.queryNearest(origin, kCandidates, maxDistance + kGridSlack, kDepthWeight, m_queryScratch,
+                            [](engine::object::GameObject *actor) { return !actor->isNeedRemove(); });
 
-        for (const auto &entry : m_monsters)
+        engine::object::GameObject *best = nullptr;
+        float bestDistance = maxDistance;
+        for (auto *actor : m_queryScratch)
         {
-            if (!entry.actor || entry.actor->isNeedRemove())
-                continue;
-
-            auto *transform = entry.actor->getComponent<engine::component::TransformComponent>();
+            auto *transform = actor->getComponent<engine::component::TransformComponent>();
             if (!transform)
                 continue;
 
-                const float dist2p5d = distance2p5d(transform->getPosition(), origin);
-                const float distanceSq = dist2p5d * dist2p5d;
-            if (distanceSq <= bestDistanceSq)
+            const float dist2p5d = distance2p5d(transform->getPosition(), origin);
+            if (dist2p5d <= bestDistance)
             {
-                bestDistanceSq = distanceSq;
-                best = entry.actor;
+                bestDistance = dist2p5d;
+                best = actor;
             }
         }
 
@@ -527,22 +555,22 @@ namespace game::monster
         int crushed = 0;
         const float radiusSq = radius * radius;
 
-        for (auto &entry : m_monsters)
+        m_grid.queryRadius(center, radius + kGridSlack, [&](engine::object::GameObject *actor, const glm::vec2 &)
         {
-            if (!entry.actor || entry.actor->isNeedRemove())
-                continue;
+            if (actor->isNeedRemove())
+                return;
 
-            auto *transform = entry.actor->getComponent<engine::component::TransformComponent>();
+            auto *transform = actor->getComponent<engine::component::TransformComponent>();
             if (!transform)
-                continue;
+                return;
 
             glm::vec2 delta = transform->getPosition() - center;
             if (glm::dot(delta, delta) > radiusSq)
-                continue;
+                return;
 
-            entry.actor->setNeedRemove(true);
+            actor->setNeedRemove(true);
             ++crushed;
-        }
+        });
 
         return crushed;
     }
@@ -553,33 +581,7 @@ namespace game::monster
                                       float halfHeight,
                                       std::vector<glm::vec2> *defeatPositions)
     {
-        int slain = 0;
-        const float rangeSq = range * range;
-
-        for (auto &entry : m_monsters)
-        {
-            if (!entry.actor || entry.actor->isNeedRemove())
-                continue;
-
-            auto *transform = entry.actor->getComponent<engine::component::TransformComponent>();
-            if (!transform)
-                continue;
-
-            glm::vec2 delta = transform->getPosition() - origin;
-            if (glm::dot(delta, delta) > rangeSq)
-                continue;
-            if (delta.x * facing < -18.0f)
-                continue;
-            if (std::abs(delta.y) > halfHeight)
-                continue;
-
-            entry.actor->setNeedRemove(true);
-            if (defeatPositions)
-                defeatPositions->push_back(transform->getPosition());
-            ++slain;
-        }
-
-        return slain;
+        return sweepMonsters(origin, facing, range, halfHeight, nullptr, defeatPositions);
     }
 
     int MonsterManager::strikeMonstersFrom(engine::object::GameObject *source,
@@ -595,31 +597,43 @@ namespace game::monster
         if (!transform)
             return 0;
 
+        return sweepMonsters(transform->getPosition(), facing, range, halfHeight, source, defeatPositions);
+    }
+
+    int MonsterManager::sweepMonsters(const glm::vec2 &origin,
+                                      float facing,
+                                      float range,
+                                      float halfHeight,
+                                      engine::object::GameObject *exclude,
+                                      std::vector<glm::vec2> *defeatPositions)
+    {
         int slain = 0;
-        const glm::vec2 origin = transform->getPosition();
         const float rangeSq = range * range;
-        for (auto &entry : m_monsters)
+        // 判定区域：半径 range 的圆 ∩ 前方（身后最多 18px）∩ 深度 ±halfHeight
+        const glm::vec2 extent{range + kGridSlack, std::min(range, halfHeight) + kGridSlack};
+
+        m_grid.queryRect(origin - extent, origin + extent, [&](engine::object::GameObject *actor, const glm::vec2 &)
         {
-            if (!entry.actor || entry.actor == source || entry.actor->isNeedRemove())
-                continue;
+            if (actor == exclude || actor->isNeedRemove())
+                return;
 
-            auto *targetTransform = entry.actor->getComponent<engine::component::TransformComponent>();
-            if (!targetTransform)
-                continue;
+            auto *transform = actor->getComponent<engine::component::TransformComponent>();
+            if (!transform)
+                return;
 
-            const glm::vec2 delta = targetTransform->getPosition() - origin;
+            const glm::vec2 delta = transform->getPosition() - origin;
             if (glm::dot(delta, delta) > rangeSq)
-                continue;
+                return;
             if (delta.x * facing < -18.0f)
-                continue;
+                return;
             if (std::abs(delta.y) > halfHeight)
-                continue;
+                return;
 
-            entry.actor->setNeedRemove(true);
+            actor->setNeedRemove(true);
             if (defeatPositions)
-                defeatPositions->push_back(targetTransform->getPosition());
+                defeatPositions->push_back(transform->getPosition());
             ++slain;
-        }
+        });
 
         return slain;
     }
@@ -631,24 +645,24 @@ namespace game::monster
     {
         int slain = 0;
         const float radiusSq = radius * radius;
-        for (auto &entry : m_monsters)
+        m_grid.queryRadius(center, radius + kGridSlack, [&](engine::object::GameObject *actor, const glm::vec2 &)
         {
-            if (!entry.actor || entry.actor == source || entry.actor->isNeedRemove())
-                continue;
+            if (actor == source || actor->isNeedRemove())
+                return;
 
-            auto *transform = entry.actor->getComponent<engine::component::TransformComponent>();
+            auto *transform = actor->getComponent<engine::component::TransformComponent>();
             if (!transform)
-                continue;
+                return;
 
             const glm::vec2 delta = transform->getPosition() - center;
             if (glm::dot(delta, delta) > radiusSq)
-                continue;
+                return;
 
-            entry.actor->setNeedRemove(true);
+            actor->setNeedRemove(true);
             if (defeatPositions)
                 defeatPositions->push_back(transform->getPosition());
             ++slain;
-        }
+        });
 
         return slain;
     }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "monster_ai_component.h"
+#include "../../engine/utils/spatial_grid.h"
 #include <glm/vec2.hpp>
 #include <vector>
 #include <random>
@@ -50,6 +51,11 @@ namespace game::monster
                       float radius,
                       std::vector<glm::vec2> *defeatPositions = nullptr);
         size_t monsterCount() const { return m_monsters.size(); }
+        /** 同时存在的怪物上限（默认 10；压力测试时可调大） */
+        void setMaxMonsters(size_t count) { m_maxMonsters = count; }
+        size_t getMaxMonsters() const { return m_maxMonsters; }
+        /** 立即生成最多 count 个怪物（不等生成计时，仍受上限约束；压力测试 / 基准用），返回实际生成数 */
+        int spawnBatch(int count);
 
     private:
         struct MonsterEntry
@@ -67,11 +73,23 @@ namespace game::monster
         engine::object::GameObject *m_hostileTarget = nullptr;
         engine::object::GameObject *m_possessedMonster = nullptr;
         std::vector<MonsterEntry> m_monsters;
+        // 按 2.5D 地面位置索引的存活怪物，update() 中每帧重建一次；
+        // 分离计数与所有战斗查询都先走网格取候选，再用当前位置精确判定
+        engine::utils::SpatialGrid<engine::object::GameObject *> m_grid;
+        mutable std::vector<engine::object::GameObject *> m_queryScratch;
+        size_t m_maxMonsters;
         std::mt19937 m_rng;
         float m_spawnTimer = 0.0f;
 
         void spawnMonster();
         void cleanupMonsters();
+        void rebuildGrid();
+        int sweepMonsters(const glm::vec2 &origin,
+                          float facing,
+                          float range,
+                          float halfHeight,
+                          engine::object::GameObject *exclude,
+                          std::vector<glm::vec2> *defeatPositions);
         bool findSpawnPosition(glm::vec2 &outWorldPos);
         MonsterType pickMonsterType() const;
     };
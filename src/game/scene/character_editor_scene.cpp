@@ -5,6 +5,7 @@
 #include "../../engine/input/input_manager.h"
 #include "../../engine/render/renderer.h"
 #include "../../engine/resource/resource_manager.h"
+#include "../../engine/resource/resource_types.h"
 #include "../../engine/scene/scene_manager.h"
 #include "../locale/locale_manager.h"
 
@@ -913,8 +914,10 @@ namespace game::scene
             m_selectedTextureAsset < static_cast<int>(m_textureAssets.size()))
         {
             const std::string& picked = m_textureAssets[static_cast<size_t>(m_selectedTextureAsset)];
-            const unsigned int gt = _context.getResourceManager().getGLTexture(picked);
-            const glm::vec2 ts    = _context.getResourceManager().getTextureSize(picked);
+            // 预览走异步流送，加载完成前显示占位纹理
+            const auto* pickedTexture = _context.getResourceManager().requestTexture(picked, 1);
+            const unsigned int gt = pickedTexture ? pickedTexture->gl_tex : 0;
+            const glm::vec2 ts    = pickedTexture ? pickedTexture->size : glm::vec2(0.0f);
             if (gt != 0 && ts.x > 0.0f)
             {
                 const float pw = kPreviewW - 8.0f;
@@ -922,8 +925,10 @@ namespace game::scene
                 ImGui::Image((ImTextureID)(intptr_t)gt, ImVec2(pw, ph));
             }
             ImGui::TextWrapped("%s", picked.c_str());
-            const glm::vec2 ts2 = _context.getResourceManager().getTextureSize(picked);
-            ImGui::TextDisabled("%.0f × %.0f px", ts2.x, ts2.y);
+            if (pickedTexture && pickedTexture->isReady())
+                ImGui::TextDisabled("%.0f × %.0f px", ts.x, ts.y);
+            else
+                ImGui::TextDisabled("加载中...");
         }
         else
         {
@@ -1,6 +1,7 @@
 // DNF 风格地下城地形生成器实现
 #include "dnf_terrain_generator.h"
 #include "../../engine/world/world_config.h"
+#include <algorithm>
 #include <cmath>
 
 namespace game::scene
@@ -69,28 +70,40 @@ namespace game::scene
         return (h & 0xFFFF) < static_cast<uint64_t>(thresh * 65536.0);
     }
 
-    // ── 生成核心：每个 16×16 区块 ────────────────────────────────────────────
-    void DnfTerrainGenerator::generateChunk(int chunkX, int chunkY,
-                                             std::vector<engine::world::TileData> &outTiles) const
+    engine::world::TileType DnfTerrainGenerator::rowType(int wy)
     {
         using T = engine::world::TileType;
-        const int CS = engine::world::WorldConfig::CHUNK_SIZE; // = 16
+        return (wy == 0)              ? T::WallDecor
+             : (wy >= 1 && wy <= 5)   ? T::GroundDecor
+             :                          T::Air;
+    }
+
+    // ── 生成核心：每个 8×8 区块 ──────────────────────────────────────────────
+    void DnfTerrainGenerator::generateChunk(int chunkX, int chunkY,
+                                             engine::world::ChunkTiles &outTiles) const
+    {
+        const int CS = engine::world::WorldConfig::CHUNK_SIZE;
 
         // 2.5D 地板平面布局（chunk row 0，tile Y [0..7] = pixel [0..127]）：
         //   wy=0 (px  0-15):  后背景墙 WallDecor（暗蓝灰，无物理）
         //   wy=1 (px 16-31):  地板走廊层起始 GroundDecor（无物理）
         //   wy=2..5:          地板走廊层      GroundDecor
         //   wy=6+:            Air（屏幕下方不可见区域）
-        outTiles.resize(static_cast<size_t>(CS * CS));
         for (int ly = 0; ly < CS; ++ly)
         {
-            int wy   = chunkY * CS + ly;
-            T   type = (wy == 0)          ? T::WallDecor
-                     : (wy >= 1 && wy <= 5) ? T::GroundDecor
-                     :                        T::Air;
             // 整行同类型，直接 std::fill 填充一整行
             std::fill(outTiles.begin() + ly * CS, outTiles.begin() + (ly + 1) * CS,
-                      engine::world::TileData(type));
+                      engine::world::TileData(rowType(chunkY * CS + ly)));
+        }
+    }
+
+    void DnfTerrainGenerator::generateRegion(int /*tileX*/, int tileY, int width, int height,
+                                              engine::world::TileData *outTiles) const
+    {
+        for (int row = 0; row < height; ++row)
+        {
+            engine::world::TileData *dst = outTiles + static_cast<size_t>(row) * width;
+            std::fill(dst, dst + width, engine::world::TileData(rowType(tileY + row)));
         }
     }
 
@@ -8,7 +8,6 @@
 #include "../../engine/world/terrain_generator.h"
 #include "../../engine/world/tile_info.h"
 #include "../../game/route/route_data.h"
-#include <functional>
 #include <cstdint>
 
 namespace game::scene
@@ -16,21 +15,20 @@ namespace game::scene
     class DnfTerrainGenerator : public engine::world::TerrainGenerator
     {
     public:
-        using BiomeLookup = std::function<int(int tileX)>;
-
         explicit DnfTerrainGenerator(const engine::world::WorldConfig &config);
         ~DnfTerrainGenerator() override = default;
 
-        // 设置路线节区查询（tileX → CellTerrain int）
-        void setBiomeLookup(BiomeLookup fn) { m_biomeLookup = std::move(fn); }
-
         void generateChunk(int chunkX, int chunkY,
-                           std::vector<engine::world::TileData> &outTiles) const override;
+                           engine::world::ChunkTiles &outTiles) const override;
+        // 每行类型只取决于 wy，整区按行填充
+        void generateRegion(int tileX, int tileY, int width, int height,
+                            engine::world::TileData *outTiles) const override;
 
         float getHeightAt(int /*worldX*/, int /*worldY*/) const override { return 0.f; }
 
     private:
-        BiomeLookup m_biomeLookup;
+        // 地板平面布局的行类型（见 generateChunk）
+        static engine::world::TileType rowType(int wy);
 
         // 房间常数（瓦片单位）
         // Chunk::SIZE=8，chunk row 0 = tile Y [0..7] = pixel [0..127]
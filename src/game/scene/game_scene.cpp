@@ -14,11 +14,13 @@
 #include "../../engine/component/parallax_component.h"
 #include "../../engine/core/context.h"
 #include "../../engine/core/time.h"
+#include "../../engine/core/profiler.h"
 #include "../../engine/render/sprite_render_system.h"
 #include "../../engine/render/parallax_render_system.h"
 #include "../../engine/render/tilelayer_render_system.h"
 #include "../../engine/resource/resource_manager.h"
 #include "../../engine/resource/font_manager.h"
+#include "../../engine/audio/voice_pool.h"
 #include "../../engine/input/input_manager.h"
 #include "../../engine/render/camera.h"
 #include "../../engine/world/world_config.h"
@@ -1097,7 +1099,10 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
 
         physics_manager = std::make_unique<engine::physics::PhysicsManager>();
         // DNF 2.5D: Y轴为深度方向，由控制器软边界管理，不需要 Box2D 重力
-        physics_manager->init({0.0f, 0.0f});
+        physics_manager->init({0.0f, 0.0f}, &_context.getJobSystem());
+        physics_manager->setTickRate(static_cast<float>(loadConfigInt("performance", "physics_hz", 60)));
+        physics_manager->setMaxStepsPerFrame(loadConfigInt("performance", "physics_max_steps", 4));
+        physics_manager->setSubStepCount(2);
 
         engine::world::WorldConfig config;
         config.loadFromFile("assets/world_config.json");
@@ -1343,6 +1348,12 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
             config.TILE_SIZE,
             &_context.getResourceManager(),
             nullptr);
+
+        // 可选：区域磁盘缓存（空字符串表示关闭）
+        // 每个星球的种子与地形参数不同：按生成参数指纹分子目录，不同星球互不读取对方的区块
+        const std::string regionCacheDir = loadConfigString("game", "region_cache_dir", "");
+        if (!regionCacheDir.empty())
+            chunk_manager->enableRegionCache(regionCacheDir + "/" + config.fingerprint());
     }
 
     void GameScene::setupSkyBackgroundScene()
@@ -1377,22 +1388,32 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
             glm::bvec2{true, false});
     }
 
+    const std::vector<std::string> &GameScene::sceneTexturePaths()
+    {
+        static const std::vector<std::string> paths = {
+            "assets/textures/Tiles/tileset.svg",
+            "assets/textures/Characters/player_sheet.svg",
+            "assets/textures/Actors/eagle-attack.png",
+            "assets/textures/Actors/opossum.png",
+            "assets/textures/Actors/frog.png",
+            "assets/textures/Props/tileset_atlas.svg",
+            "assets/textures/Props/rock.png",
+            "assets/textures/Props/rock-1.png",
+            "assets/textures/Props/rock-2.png",
+            // 背景纹理：天空 + 地面建筑。
+            "assets/textures/Layers/back.png",
+            "assets/textures/Props/big-house.png",
+            "assets/textures/Props/tree-house.png",
+        };
+        return paths;
+    }
+
     void GameScene::warmupSceneTextures()
     {
+        // 经 LoadingScene 进入时大多已流送完毕；仍在途的纹理由同步接口当场补完
         auto& resMgr = _context.getResourceManager();
-        resMgr.getGLTexture("assets/textures/Tiles/tileset.svg");
-        resMgr.getGLTexture("assets/textures/Characters/player_sheet.svg");
-        resMgr.getGLTexture("assets/textures/Actors/eagle-attack.png");
-        resMgr.getGLTexture("assets/textures/Actors/opossum.png");
-        resMgr.getGLTexture("assets/textures/Actors/frog.png");
-        resMgr.getGLTexture("assets/textures/Props/tileset_atlas.svg");
-        resMgr.getGLTexture("assets/textures/Props/rock.png");
-        resMgr.getGLTexture("assets/textures/Props/rock-1.png");
-        resMgr.getGLTexture("assets/textures/Props/rock-2.png");
-        // 背景纹理：天空 + 地面建筑。
-        resMgr.getGLTexture("assets/textures/Layers/back.png");
-        resMgr.getGLTexture("assets/textures/Props/big-house.png");
-        resMgr.getGLTexture("assets/textures/Props/tree-house.png");
+        for (const std::string& path : sceneTexturePaths())
+            resMgr.getGLTexture(path);
         spdlog::info("纹理预热完毕（天空层/地面建筑层/地面瓦片层）");
     }
 
@@ -1422,7 +1443,7 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
     void GameScene::updateFlightAmbientSound(float dt)
     {
         constexpr const char* kFlightAmbientPath = "assets/audio/hurry_up_and_run.ogg";
-        constexpr const char* kTakeoffWhooshPath = "assets/audio/cartoon-jump-6462.mp3";
+        constexpr const char* kTakeoffWhooshSound = "cartoon-jump-6462";
 
         auto* controlled = getControlledActor();
         auto* ctrl = controlled ? controlled->getComponent<engine::component::ControllerComponent>() : nullptr;
@@ -1448,14 +1469,8 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
         auto& resourceManager = _context.getResourceManager();
         MIX_Mixer* mixer = resourceManager.getAudioMixer();
 
-        if (flyMode && !m_flightAmbientWasFlyMode && mixer)
-        {
-            if (MIX_Audio* liftAudio = resourceManager.getAudio(kTakeoffWhooshPath))
-            {
-                if (!MIX_PlayAudio(mixer, liftAudio))
-                    spdlog::debug("起飞瞬态音播放失败: {}", SDL_GetError());
-            }
-        }
+        if (flyMode && !m_flightAmbientWasFlyMode)
+            playSoundEffect(kTakeoffWhooshSound);
 
         if (!m_flightAmbientReady && mixer)
         {
@@ -1505,6 +1520,29 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
         m_flightAmbientWasFlyMode = false;
     }
 
+    void GameScene::playSoundEffect(const std::string& name, std::optional<glm::vec2> worldPos)
+    {
+        auto& resourceManager = _context.getResourceManager();
+        auto* bank = resourceManager.getSoundBank();
+        auto* voices = resourceManager.getVoicePool();
+        if (!bank || !voices)
+            return;
+
+        const engine::audio::SoundId sound = bank->find(name);
+        if (sound == engine::audio::INVALID_SOUND)
+        {
+            // 音效库在加载期已按文件名登记 assets/audio 下全部 .wav / .ogg / .mp3，查不到即文件缺失；每个名字只警告一次
+            if (m_missingSounds.insert(name).second)
+                spdlog::warn("音效 '{}' 不在音效库中（assets/audio 下无同名文件）", name);
+            return;
+        }
+
+        if (worldPos)
+            voices->play(*bank, sound, *worldPos);
+        else
+            voices->play2D(*bank, sound);
+    }
+
     void GameScene::emitSkillVFX(game::skill::SkillEffect type, glm::vec2 worldPos, float maxAge, float param)
     {
         acquirePooledSlot(m_skillVfxList, 512, [&](SkillVFX& vfx) {
@@ -1562,11 +1600,14 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
 
     void GameScene::update(float delta_time)
     {
+        LSL_PROFILE_ZONE("GameScene::update");
         const Uint64 perfFreq = SDL_GetPerformanceFrequency();
         const Uint64 updateStart = SDL_GetPerformanceCounter();
         m_frameProfiler.frameDeltaMs = delta_time * 1000.0f;
 
-        auto measure = [&](PerfMetric& metric, auto&& fn) {
+        // 扁平指标供叠加层显示；同名区段进入分层剖析器（zone 须为字符串字面量）
+        auto measure = [&](PerfMetric& metric, const char* zone, auto&& fn) {
+            LSL_PROFILE_ZONE(zone);
             const Uint64 start = SDL_GetPerformanceCounter();
             fn();
             recordPerfMetric(metric, elapsedMilliseconds(start, SDL_GetPerformanceCounter(), perfFreq));
@@ -1575,26 +1616,34 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
         const bool runGameplayTick = m_gameplayRunning && (!m_gameplayPaused || m_stepOneFrame);
         if (!runGameplayTick)
         {
-            measure(m_frameProfiler.coreLogic, [&] {
+            measure(m_frameProfiler.coreLogic, "GameScene::coreLogic", [&] {
                 Scene::update(delta_time);
                 updateSettingsParticles(delta_time);
             });
-            measure(m_frameProfiler.cameraUpdate, [&] {
+            measure(m_frameProfiler.cameraUpdate, "GameScene::cameraUpdate", [&] {
                 _context.getCamera().update(delta_time);
             });
-            measure(m_frameProfiler.chunkStreamUpdate, [&] {
+            measure(m_frameProfiler.chunkStreamUpdate, "GameScene::chunkStreamUpdate", [&] {
                 if (chunk_manager)
-                    chunk_manager->rebuildDirtyChunks(2);
+                {
+                    chunk_manager->updateStreaming();
+                    chunk_manager->rebuildDirtyChunks(1.0f);
+                }
             });
 
             m_frameProfiler.loadedChunks = chunk_manager ? chunk_manager->loadedChunkCount() : 0;
             m_frameProfiler.pendingChunkLoads = chunk_manager ? chunk_manager->pendingChunkLoadCount() : 0;
+            if (chunk_manager)
+            {
+                m_frameProfiler.chunkStream = chunk_manager->getStreamStats();
+                m_frameProfiler.chunkRebuild = chunk_manager->getRebuildStats();
+            }
             recordPerfMetric(m_frameProfiler.updateTotal,
                              elapsedMilliseconds(updateStart, SDL_GetPerformanceCounter(), perfFreq));
             return;
         }
 
-        measure(m_frameProfiler.coreLogic, [&] {
+        measure(m_frameProfiler.coreLogic, "GameScene::coreLogic", [&] {
             Scene::update(delta_time);
 
             m_mechAttackCooldown = std::max(0.0f, m_mechAttackCooldown - delta_time);
@@ -1624,6 +1673,14 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
             }
 
             updateFlightAmbientSound(delta_time);
+            if (auto* voices = _context.getResourceManager().getVoicePool())
+            {
+                if (auto* controlled = getControlledActor())
+                {
+                    if (auto* transform = controlled->getComponent<engine::component::TransformComponent>())
+                        voices->setListener(transform->getPosition());
+                }
+            }
 
             // 机甲飞行时解除相机 Y 轴锁定，让视角跟随机甲上升/下降。
             bool unlockCameraY = false;
@@ -1702,7 +1759,7 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
             m_cannonTimer      = std::max(0.0f, m_cannonTimer      - delta_time);
         });
 
-        measure(m_frameProfiler.monsterUpdate, [&] {
+        measure(m_frameProfiler.monsterUpdate, "GameScene::monsterUpdate", [&] {
             if (m_monsterManager)
             {
                 m_monsterManager->setAnchorActor(getControlledActor());
@@ -1711,19 +1768,21 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
             }
         });
 
-        measure(m_frameProfiler.cameraUpdate, [&] {
+        measure(m_frameProfiler.cameraUpdate, "GameScene::cameraUpdate", [&] {
             _context.getCamera().update(delta_time);
         });
 
-        measure(m_frameProfiler.physicsUpdate, [&] {
+        measure(m_frameProfiler.physicsUpdate, "GameScene::physicsUpdate", [&] {
             if (physics_manager)
             {
-                const float physDt = std::min(delta_time, 1.0f / 30.0f);
-                physics_manager->update(physDt, 2);
+                // 固定步长推进，PhysicsComponent::update 按 alpha 插值写回 Transform
+                m_frameProfiler.physicsSteps = physics_manager->advance(delta_time);
+                m_frameProfiler.physicsAlpha = physics_manager->getInterpolationAlpha();
+                m_frameProfiler.physicsTickHz = physics_manager->getTickRate();
             }
         });
 
-        measure(m_frameProfiler.actorUpdate, [&] {
+        measure(m_frameProfiler.actorUpdate, "GameScene::actorUpdate", [&] {
             if (actor_manager)
             {
                 for (const auto& holder : actor_manager->getActors())
@@ -1751,7 +1810,7 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
 
         updatePossession(delta_time);
 
-        measure(m_frameProfiler.stateMachineUpdate, [&] {
+        measure(m_frameProfiler.stateMachineUpdate, "GameScene::stateMachineUpdate", [&] {
             tickPlayerSM(delta_time);
             syncPlayerPresentation();
         });
@@ -1771,13 +1830,13 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
         }
 
         // 更新掉落物（重力、拾取）
-        measure(m_frameProfiler.dropUpdate, [&] {
+        measure(m_frameProfiler.dropUpdate, "GameScene::dropUpdate", [&] {
             glm::vec2 ppos = getActorWorldPosition(getControlledActor());
             m_treeManager.updateDrops(delta_time, ppos, m_inventory, *chunk_manager);
         });
 
         // 更新天气
-        measure(m_frameProfiler.weatherUpdate, [&] {
+        measure(m_frameProfiler.weatherUpdate, "GameScene::weatherUpdate", [&] {
             const auto &io = ImGui::GetIO();
             glm::vec2 rainMotion{0.0f, 0.0f};
             if (auto* actor = getControlledActor())
@@ -1793,7 +1852,7 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
         });
 
         // 更新星球任务规划 UI
-        measure(m_frameProfiler.missionUpdate, [&] {
+        measure(m_frameProfiler.missionUpdate, "GameScene::missionUpdate", [&] {
             glm::vec2 ppos = getActorWorldPosition(getControlledActor());
             m_missionUI.update(delta_time, ppos, *chunk_manager);
         });
@@ -1821,19 +1880,30 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
         const float chunkWorldWidth = static_cast<float>(engine::world::Chunk::SIZE * chunk_manager->getTileSize().x);
         const int currentChunkX = static_cast<int>(std::floor(playerPos.x / chunkWorldWidth));
         const int lastChunkX = static_cast<int>(std::floor(m_lastChunkUpdatePos.x / chunkWorldWidth));
-        measure(m_frameProfiler.chunkStreamUpdate, [&] {
+        measure(m_frameProfiler.chunkStreamUpdate, "GameScene::chunkStreamUpdate", [&] {
             if (currentChunkX != lastChunkX)
             {
                 chunk_manager->updateVisibleChunks({playerPos.x, 0.0f}, 3);
                 m_lastChunkUpdatePos = playerPos;
             }
+            else
+            {
+                // 跨区块才重算可见集合；异步流送的派发/集成每帧推进
+                chunk_manager->updateStreaming();
+            }
 
-            // 限额重建脏区块，避免技能批量破坏时单帧重建过多 chunk 导致卡顿
-            chunk_manager->rebuildDirtyChunks(1);
+            // 限时重建脏区块（近处、视野内优先），避免技能批量破坏时单帧重建过多 chunk 导致卡顿
+            chunk_manager->rebuildDirtyChunks(1.0f);
         });
 
         m_frameProfiler.loadedChunks = chunk_manager ? chunk_manager->loadedChunkCount() : 0;
         m_frameProfiler.pendingChunkLoads = chunk_manager ? chunk_manager->pendingChunkLoadCount() : 0;
+        if (chunk_manager)
+        {
+            m_frameProfiler.chunkStream = chunk_manager->getStreamStats();
+            m_frameProfiler.chunkRebuild = chunk_manager->getRebuildStats();
+        }
+        m_frameProfiler.renderStats = _context.getRenderer().getRenderStats();
         if (m_stepOneFrame)
             m_stepOneFrame = false;
         recordPerfMetric(m_frameProfiler.updateTotal,
@@ -1842,9 +1912,13 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
 
     void GameScene::render()
     {
+        LSL_PROFILE_ZONE("GameScene::render");
         const Uint64 perfFreq = SDL_GetPerformanceFrequency();
         const Uint64 renderStart = SDL_GetPerformanceCounter();
-        auto measure = [&](PerfMetric& metric, auto&& fn) {
+        // 渲染阶段同时记录 CPU 区段与同名 GPU 区段
+        auto measure = [&](PerfMetric& metric, const char* zone, auto&& fn) {
+            LSL_PROFILE_ZONE(zone);
+            LSL_PROFILE_GPU_ZONE(_context.getRenderer(), zone);
             const Uint64 start = SDL_GetPerformanceCounter();
             fn();
             recordPerfMetric(metric, elapsedMilliseconds(start, SDL_GetPerformanceCounter(), perfFreq));
@@ -1864,18 +1938,18 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
             recordPerfMetric(m_frameProfiler.backgroundRender,
                              elapsedMilliseconds(backgroundStart, SDL_GetPerformanceCounter(), perfFreq));
         }
-        measure(m_frameProfiler.chunkRender, [&] { chunk_manager->renderAll(_context); });
-        measure(m_frameProfiler.parallaxRender, [&] { _context.getParallaxRenderSystem().renderAll(_context); });
-        measure(m_frameProfiler.spriteRender, [&] { _context.getSpriteRenderSystem().renderAll(_context); });
-        measure(m_frameProfiler.tileRender, [&] { _context.getTilelayerRenderSystem().renderAll(_context); });
-        measure(m_frameProfiler.shadowRender, [&] { renderActorGroundShadows(); });
+        measure(m_frameProfiler.chunkRender, "GameScene::chunkRender", [&] { chunk_manager->renderAll(_context); });
+        measure(m_frameProfiler.parallaxRender, "GameScene::parallaxRender", [&] { _context.getParallaxRenderSystem().renderAll(_context); });
+        measure(m_frameProfiler.spriteRender, "GameScene::spriteRender", [&] { _context.getSpriteRenderSystem().renderAll(_context); });
+        measure(m_frameProfiler.tileRender, "GameScene::tileRender", [&] { _context.getTilelayerRenderSystem().renderAll(_context); });
+        measure(m_frameProfiler.shadowRender, "GameScene::shadowRender", [&] { renderActorGroundShadows(); });
 
-        measure(m_frameProfiler.actorRender, [&] {
+        measure(m_frameProfiler.actorRender, "GameScene::actorRender", [&] {
             if (actor_manager)
                 actor_manager->render();
         });
 
-        measure(m_frameProfiler.lightingRender, [&] {
+        measure(m_frameProfiler.lightingRender, "GameScene::lightingRender", [&] {
             m_timeOfDaySystem.renderLighting(_context);
         });
 
@@ -1909,18 +1983,19 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
                 std::string text = "X: " + std::to_string(static_cast<int>(pos.x)) +
                                    " Y: " + std::to_string(static_cast<int>(pos.y));
 
-                auto glyphs = text_renderer->prepareText(text, 10.0f, 10.0f);
-                auto& renderer = _context.getRenderer();
-
-                for (const auto& glyph : glyphs)
-                {
-                    renderer.drawTexture(glyph.texture, glyph.x, glyph.y, glyph.w, glyph.h);
-                }
+                // 字形都在图集页上：按页合批后一次绑定一次绘制
+                for (auto& [page, vertices] : m_textBatch)
+                    vertices.clear();
+                text_renderer->appendText(text, 10.0f, 10.0f, glm::vec4(1.0f), m_textBatch);
+                _context.getRenderer().drawScreenVertices(m_textBatch);
             }
         }
 
+        // ImGui 直接调用 GL，先提交排队中的精灵批次
+        _context.getRenderer().flush();
+
         // ImGui滑块 + 武器显示
-        measure(m_frameProfiler.imguiRender, [&] {
+        measure(m_frameProfiler.imguiRender, "GameScene::imguiRender", [&] {
         if (m_glContext)
         {
             ImGui_ImplOpenGL3_NewFrame();
@@ -2135,6 +2210,7 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
                 if (m_showHierarchyPanel)     renderHierarchyPanel();
                 if (m_showInspectorPanel)     renderInspectorPanel();
                 if (m_showEntityManagerPanel) renderEntityManagerPanel();
+                if (m_showProfilerPanel)      renderProfilerPanel();
             }
 
             // 星球任务规划 UI
@@ -2846,9 +2922,15 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
 
             if (paintDown || eraseDown)
             {
-                const engine::world::TileType paintType = eraseDown
-                    ? engine::world::TileType::Air
-                    : m_mapEditorPaintTile;
+                // 选中的目录种类可能带自定义外观（调色板索引），优先使用
+                engine::world::TileData paintTile(engine::world::TileType::Air);
+                if (!eraseDown)
+                {
+                    const auto catalogTile = m_groundTileCatalog.tileForKey(m_mapEditorPaintTileKey);
+                    paintTile = (catalogTile && catalogTile->type == m_mapEditorPaintTile)
+                        ? *catalogTile
+                        : engine::world::TileData(m_mapEditorPaintTile);
+                }
                 const int r = std::max(0, m_mapEditorBrushRadius);
                 for (int dy = -r; dy <= r; ++dy)
                 {
@@ -2862,10 +2944,10 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
                             + glm::vec2(chunk_manager->getTileSize()) * 0.5f;
                         if (m_groundCollisionLowerHalfOnly && !isGroundZoneAt(tileCenter))
                             continue;
-                        chunk_manager->setTileSilent(tx, ty, engine::world::TileData(paintType));
+                        chunk_manager->setTileSilent(tx, ty, paintTile);
                     }
                 }
-                chunk_manager->rebuildDirtyChunks(4);
+                chunk_manager->rebuildDirtyChunks(2.0f);
             }
 
             // 编辑模式下屏蔽战斗输入，避免左键同时攻击。
@@ -4059,6 +4141,35 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
         ImGui::Text("Chunk: 已加载 %zu  待加载 %zu",
             m_frameProfiler.loadedChunks,
             m_frameProfiler.pendingChunkLoads);
+        {
+            const auto& cs = m_frameProfiler.chunkStream;
+            ImGui::Text("流送队列: 排队 %zu  处理中 %zu  待集成 %zu  (完成 %llu / 取消 %llu)",
+                cs.queuedJobs, cs.activeJobs, cs.completedJobs,
+                static_cast<unsigned long long>(cs.finishedTotal),
+                static_cast<unsigned long long>(cs.cancelledTotal));
+            ImGui::Text("流送耗时: 生成 %.3fms  网格 %.3fms  上传 %.3fms (本帧 %.3fms)",
+                cs.generateAvgMs, cs.meshAvgMs, cs.uploadAvgMs, cs.uploadLastFrameMs);
+            if (cs.cacheHitTotal > 0)
+                ImGui::Text("区域缓存: 命中 %llu  读取 %.3fms",
+                    static_cast<unsigned long long>(cs.cacheHitTotal), cs.cacheLoadAvgMs);
+            const auto& rb = m_frameProfiler.chunkRebuild;
+            ImGui::Text("脏块重建: 物理 %d (%.3fms)  网格 %d (%.3fms)  积压 %zu",
+                rb.physicsRebuilt, rb.physicsMs, rb.meshRebuilt, rb.meshMs, rb.meshBacklog);
+        }
+        {
+            const auto& rs = m_frameProfiler.renderStats;
+            ImGui::Text("绘制: draw call %d  批次 %d  四边形 %d  (换纹理 %d / 换状态 %d)",
+                rs.drawCalls, rs.batches, rs.quads, rs.textureBreaks, rs.stateBreaks);
+            if (rs.batching)
+                ImGui::Text("图集: %d 页 / %d 张纹理  顶点缓冲: %s  等待 GPU %d 次",
+                    rs.atlasPages, rs.atlasTextures, rs.persistentMapped ? "持久映射" : "orphan", rs.streamStalls);
+            auto& renderer = _context.getRenderer();
+            bool batching = renderer.isSpriteBatching();
+            if (ImGui::Checkbox("精灵批处理", &batching))
+                renderer.setSpriteBatching(batching);
+        }
+        ImGui::Text("物理: %.0f Hz  本帧 %d 步  alpha %.2f",
+            m_frameProfiler.physicsTickHz, m_frameProfiler.physicsSteps, m_frameProfiler.physicsAlpha);
 
         if (ImGui::BeginTable("##perf_breakdown", 5,
                               ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg |
@@ -4488,6 +4599,24 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
             return;
         }
         m_playerSM.init(&m_playerSMData);
+
+        // 触发器名 → ID，tickPlayerSM 每帧只置位
+        auto& ids = m_playerSMTriggers;
+        ids.grounded    = m_playerSM.triggerId("GROUNDED");
+        ids.airborne    = m_playerSM.triggerId("AIRBORNE");
+        ids.rising      = m_playerSM.triggerId("RISING");
+        ids.falling     = m_playerSM.triggerId("FALLING");
+        ids.land        = m_playerSM.triggerId("LAND");
+        ids.moveL       = m_playerSM.triggerId("KEY_MOVE_L");
+        ids.moveR       = m_playerSM.triggerId("KEY_MOVE_R");
+        ids.noInput     = m_playerSM.triggerId("NO_INPUT");
+        ids.isMoving    = m_playerSM.triggerId("IS_MOVING");
+        ids.isDashing   = m_playerSM.triggerId("IS_DASHING");
+        ids.isAttacking = m_playerSM.triggerId("IS_ATTACKING");
+        ids.keyAttack   = m_playerSM.triggerId("KEY_ATTACK");
+        ids.keyJump     = m_playerSM.triggerId("KEY_JUMP");
+        ids.keySkill1   = m_playerSM.triggerId("KEY_SKILL_1");
+
         m_playerSMPath   = smJsonPath;
         m_playerSMLoaded = true;
         spdlog::info("[GameScene] 玩家状态机加载完成: {} (初始: {})",
@@ -4523,14 +4652,10 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
         // 立即播放初始状态对应的动画（init 内部用 dummy result，stateChanged 不会传出来）
         auto* smTarget = getControlledActor();
         if (!smTarget) smTarget = m_player;
-        if (smTarget && !m_playerSMData.initialState.empty())
+        if (smTarget && !m_playerSM.getCurrentAnimation().empty())
         {
-            auto it = m_playerSMData.states.find(m_playerSMData.initialState);
-            if (it != m_playerSMData.states.end() && !it->second.animationId.empty())
-            {
-                if (auto* anim = smTarget->getComponent<engine::component::AnimationComponent>())
-                    anim->forcePlay(it->second.animationId);
-            }
+            if (auto* anim = smTarget->getComponent<engine::component::AnimationComponent>())
+                anim->forcePlay(m_playerSM.getCurrentAnimation());
         }
     }
 
@@ -4574,14 +4699,15 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
     //  每帧驱动玩家状态机
     //
     //  activeInputs 构成规则：
-    //    - 持续型条件：每帧根据物理/输入状态判断后直接放入
+    //    - 持续型条件：每帧根据物理/输入状态判断后直接置位
     //    - 瞬间型按键：通过 m_playerSM.pushInput() 放入 0.2s 缓冲池
-    //    - LAND 落地事件：仅在从 AIRBORNE→GROUNDED 的那一帧放入
+    //    - LAND 落地事件：仅在从 AIRBORNE→GROUNDED 的那一帧置位
     //
     //  如何自定义新触发器：
     //    1. 在 sm_types.h kTriggerPresets 中添加字符串（供编辑器显示）
-    //    2. 在本函数中用 activeInputs.push_back("YOUR_TRIGGER") 添加判断
-    //    3. 在 *.sm.json 的 transitions 里用相同字符串引用
+    //    2. 在 PlayerSMTriggers 中加字段，loadPlayerSM 里用 triggerId() 解析
+    //    3. 在本函数中用 activeInputs.set(ids.yourTrigger) 添加判断
+    //    4. 在 *.sm.json 的 transitions 里用相同字符串引用
     // ─────────────────────────────────────────────────────────────────────────
     void GameScene::tickPlayerSM(float dt)
     {
@@ -4608,24 +4734,24 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
 
         // ── 2. 构建持续型 activeInputs ────────────────────────────────────
         //  规则：每帧只要条件成立就放入，状态机内部对持续型无缓冲要求
-        std::vector<std::string> activeInputs;
-        activeInputs.reserve(8);
+        const auto& ids = m_playerSMTriggers;
+        TriggerMask activeInputs;
 
         // 物理/重力
-        if (grounded)      activeInputs.push_back("GROUNDED");
-        else               activeInputs.push_back("AIRBORNE");
-        if (vel.y < -0.5f) activeInputs.push_back("RISING");   // Box2D y-up → 上升时 vy < 0
-        if (vel.y >  0.5f) activeInputs.push_back("FALLING");  // 下落时 vy > 0
-        if (land)          activeInputs.push_back("LAND");
+        if (grounded)      activeInputs.set(ids.grounded);
+        else               activeInputs.set(ids.airborne);
+        if (vel.y < -0.5f) activeInputs.set(ids.rising);   // Box2D y-up → 上升时 vy < 0
+        if (vel.y >  0.5f) activeInputs.set(ids.falling);  // 下落时 vy > 0
+        if (land)          activeInputs.set(ids.land);
 
         // 移动方向键（按住 ≡ 持续型）
         const auto& inp = _context.getInputManager();
         const bool moveL = inp.isActionDown("move_left");
         const bool moveR = inp.isActionDown("move_right");
-        if (moveL) activeInputs.push_back("KEY_MOVE_L");
-        if (moveR) activeInputs.push_back("KEY_MOVE_R");
-        if (!moveL && !moveR) activeInputs.push_back("NO_INPUT");
-        if (moveL || moveR)   activeInputs.push_back("IS_MOVING");
+        if (moveL) activeInputs.set(ids.moveL);
+        if (moveR) activeInputs.set(ids.moveR);
+        if (!moveL && !moveR) activeInputs.set(ids.noInput);
+        if (moveL || moveR)   activeInputs.set(ids.isMoving);
 
         // ── 根据移动方向更新朝向与精灵翻转（ATTACK 期间不翻转，避免中途换向）──
         const bool inAttack = (m_playerSM.getCurrentState().rfind("ATTACK", 0) == 0);
@@ -4644,24 +4770,24 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
         }
 
         // 冲刺持续
-        if (m_isDashing) activeInputs.push_back("IS_DASHING");
+        if (m_isDashing) activeInputs.set(ids.isDashing);
 
         // 当前是否处于攻击状态
         if (m_playerSM.getCurrentState().find("ATTACK") != std::string::npos)
-            activeInputs.push_back("IS_ATTACKING");
+            activeInputs.set(ids.isAttacking);
 
         // ── 3. 瞬间型按键 → pushInput（仅在按下那帧调用）────────────────
         //  这些按键有 0.2s 缓冲，可以提前按下并在连招窗口期生效
         static float s_smTime = 0.0f;
         s_smTime += dt;
 
-        if (inp.isActionPressed("attack"))    m_playerSM.pushInput("KEY_ATTACK",  s_smTime);
-        if (inp.isActionPressed("jump"))      m_playerSM.pushInput("KEY_JUMP",    s_smTime);
-        if (inp.isActionPressed("skill_use")) m_playerSM.pushInput("KEY_SKILL_1", s_smTime);
+        if (inp.isActionPressed("attack"))    m_playerSM.pushInput(ids.keyAttack, s_smTime);
+        if (inp.isActionPressed("jump"))      m_playerSM.pushInput(ids.keyJump,   s_smTime);
+        if (inp.isActionPressed("skill_use")) m_playerSM.pushInput(ids.keySkill1, s_smTime);
         // 如需 dash/block/skill_2/3，在 config.json 中绑定按键后在此处添加同样的逻辑
 
         // ── 4. 驱动状态机 ────────────────────────────────────────────────
-        const UpdateResult result = m_playerSM.update(dt, activeInputs, s_smTime);
+        const TickResult& result = m_playerSM.tick(dt, activeInputs, s_smTime);
 
         // ── 5. 应用根位移（Root Motion）──────────────────────────────────
         if (result.rootMotionDx != 0.0f || result.rootMotionDy != 0.0f)
@@ -4673,27 +4799,14 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
         }
 
         // ── 6. 帧事件回调 ─────────────────────────────────────────────────
-        for (const auto& evt : result.firedEvents)
+        for (const EventId evtId : result.firedEvents)
         {
+            const std::string& evt = m_playerSM.eventName(evtId);
             // 格式："动词:参数"，e.g. "play_sound:ghost_swordsman_attack1"
             if (evt.rfind("play_sound:", 0) == 0)
             {
-                const std::string soundName = evt.substr(11); // "play_sound:" 占 11 字符
-                const std::string audioPath = "assets/audio/" + soundName + ".mp3";
-                auto& resMgr = _context.getResourceManager();
-                MIX_Mixer* mixer = resMgr.getAudioMixer();
-                if (mixer)
-                {
-                    if (MIX_Audio* audio = resMgr.getAudio(audioPath))
-                    {
-                        if (!MIX_PlayAudio(mixer, audio))
-                            spdlog::debug("[SM] 音效播放失败: {} ({})", soundName, SDL_GetError());
-                    }
-                    else
-                    {
-                        spdlog::debug("[SM] 未找到音效文件: {}", audioPath);
-                    }
-                }
+                // 玩家自身动作的音效就在听者位置，不做距离衰减与声像
+                playSoundEffect(evt.substr(11)); // "play_sound:" 占 11 字符
             }
             else if (evt.rfind("spawn_hitbox:", 0) == 0)
             {
@@ -4748,18 +4861,15 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
         // ── 7. 同步动画组件 ────────────────────────────────────────────────
         if (result.stateChanged)
         {
-            spdlog::info("[SM] {} → {}", m_playerSM.getCurrentState().empty() ? "(init)" : result.currentState, result.currentState);
+            const std::string& stateName = m_playerSM.getCurrentState();
+            spdlog::info("[SM] {} → {}", stateName.empty() ? "(init)" : stateName, stateName);
 
-            auto it = m_playerSMData.states.find(result.currentState);
-            if (it != m_playerSMData.states.end())
+            const std::string& clipName = m_playerSM.getCurrentAnimation();
+            if (!clipName.empty())
             {
-                const std::string& clipName = it->second.animationId;
-                if (!clipName.empty())
-                {
-                    auto* anim = target->getComponent<engine::component::AnimationComponent>();
-                    if (anim)
-                        anim->play(clipName);
-                }
+                auto* anim = target->getComponent<engine::component::AnimationComponent>();
+                if (anim)
+                    anim->play(clipName);
             }
         }
     }
@@ -5258,7 +5368,13 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
             perfPercent(m_frameProfiler.updateTotal.lastMs, frameMs),
             m_frameProfiler.renderTotal.lastMs,
             perfPercent(m_frameProfiler.renderTotal.lastMs, frameMs));
-        ImGui::Text("Chunk 已加载 %zu | 待加载 %zu", m_frameProfiler.loadedChunks, m_frameProfiler.pendingChunkLoads);
+        ImGui::Text("Chunk 已加载 %zu | 待加载 %zu | 流送队列 %zu/%zu/%zu",
+            m_frameProfiler.loadedChunks, m_frameProfiler.pendingChunkLoads,
+            m_frameProfiler.chunkStream.queuedJobs,
+            m_frameProfiler.chunkStream.activeJobs,
+            m_frameProfiler.chunkStream.completedJobs);
+        ImGui::Text("物理 %.0fHz | 步数 %d | alpha %.2f",
+            m_frameProfiler.physicsTickHz, m_frameProfiler.physicsSteps, m_frameProfiler.physicsAlpha);
 
         struct Hotspot { const char* label; float ms; };
         std::array<Hotspot, 16> hotspots{{
@@ -7488,8 +7604,9 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
                 }
             }
         }
+        // 碰撞立即生效；网格交给每帧的限时重建
         if (changedTiles)
-            chunk_manager->rebuildDirtyChunks(2);
+            chunk_manager->rebuildDirtyPhysics();
 
         std::vector<glm::vec2> defeatPositions;
         int slain = m_monsterManager
@@ -7582,8 +7699,9 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
             }
         }
 
+        // 碰撞立即生效；网格交给每帧的限时重建
         if (hasBatchedTileChanges)
-            chunk_manager->rebuildDirtyChunks(2);
+            chunk_manager->rebuildDirtyPhysics();
 
         int crushedMonsters = m_monsterManager ? m_monsterManager->crushMonstersInRadius(center, radius + 32.0f) : 0;
         glm::vec2 vel = mechPhysics->getVelocity();
@@ -7779,8 +7897,9 @@ void GameScene::updateActorFootTileContact(engine::object::GameObject* actor)
             }
         }
 
+        // 碰撞立即生效；网格交给每帧的限时重建
         if (hasBatchedTileChanges)
-            chunk_manager->rebuildDirtyChunks(2);
+            chunk_manager->rebuildDirtyPhysics();
 
         int crushed = m_monsterManager
             ? m_monsterManager->crushMonstersInRadius(attackPos, radius + 18.0f)
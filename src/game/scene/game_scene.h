@@ -8,6 +8,7 @@
 #include "../../engine/world/world_config.h"
 #include "../../engine/physics/physics_manager.h"
 #include "../../engine/actor/actor_manager.h"
+#include "../../engine/render/renderer.h"
 #include "../../engine/render/text_renderer.h"
 #include "../../engine/ecs/registry.h"
 #include "../inventory/inventory.h"
@@ -70,8 +71,14 @@ namespace game::scene
         PerfMetric lightingRender;
         PerfMetric imguiRender;
         float frameDeltaMs = 0.0f;
+        float physicsAlpha = 0.0f;   // 固定步插值系数
+        int physicsSteps = 0;        // 本帧物理步数
+        float physicsTickHz = 0.0f;
         size_t loadedChunks = 0;
         size_t pendingChunkLoads = 0;
+        engine::world::ChunkStreamStats chunkStream; // 异步流送队列深度 / 各阶段耗时
+        engine::world::ChunkRebuildStats chunkRebuild; // 脏区块重建：物理 / 网格数量、耗时、积压
+        engine::render::RenderStats renderStats;       // 上一帧 draw call / 批次 / 图集
     };
 
     class GameScene : public engine::scene::Scene
@@ -89,11 +96,15 @@ namespace game::scene
         void handleInput() override;
         void clean() override;
 
+        /** @brief 进入场景时预热的纹理（LoadingScene 据此提前异步流送） */
+        static const std::vector<std::string> &sceneTexturePaths();
+
     private:
         std::unique_ptr<engine::world::ChunkManager> chunk_manager;
         std::unique_ptr<engine::physics::PhysicsManager> physics_manager;
         std::unique_ptr<engine::actor::ActorManager> actor_manager;
         engine::render::TextRenderer* text_renderer = nullptr;
+        engine::render::TextVertexBatch m_textBatch; // 每帧复用的文字顶点（按图集页分组）
         engine::ecs::Registry ecs_registry;
 
         engine::object::GameObject* m_player = nullptr;
@@ -155,6 +166,7 @@ namespace game::scene
         MIX_Track* m_flightAmbientTrack = nullptr;
         bool m_flightAmbientReady = false;
         bool m_flightAmbientWasFlyMode = false;
+        std::unordered_set<std::string> m_missingSounds; // 已警告过的缺失音效名
         bool m_vsyncEnabled = true;
         glm::vec2 m_cameraFollowDeadzonePx = {140.0f, 56.0f};
         bool m_showSettings = false;
@@ -175,6 +187,9 @@ namespace game::scene
         bool m_showAnimationEditorPanel = false;
         bool m_showShaderEditorPanel = false;
         bool m_showProfilerPanel = false;
+        bool m_profilerFrozen = false;          // 冻结时火焰图停在所选帧
+        uint64_t m_profilerSelectedFrame = 0;   // 帧号，0 = 最新一帧
+        std::string m_profilerExportStatus;
         bool m_showHierarchyPanel = true;
         bool m_showInspectorPanel = true;
         bool m_gameplayRunning = false;
@@ -305,9 +320,9 @@ namespace game::scene
 
         struct TileRuntimeSnapshot
         {
-            int x = 0;
-            int y = 0;
-            engine::world::TileData tile{};
+            int chunkX = 0;
+            int chunkY = 0;
+            engine::world::ChunkTiles tiles{};
         };
 
         struct UiRuntimeSnapshot
@@ -447,6 +462,8 @@ namespace game::scene
         void preallocateRuntimeBuffers();
         void updateFlightAmbientSound(float dt);
         void shutdownFlightAmbientSound();
+        // 通过语音池播放 assets/audio/<name>.mp3；worldPos 为空时不做距离衰减（玩家自身 / 界面音效）
+        void playSoundEffect(const std::string& name, std::optional<glm::vec2> worldPos = std::nullopt);
         void emitSkillVFX(game::skill::SkillEffect type, glm::vec2 worldPos, float maxAge, float param);
         void emitSkillProjectile(game::skill::SkillEffect type,
                      glm::vec2 originPos,
@@ -669,9 +686,19 @@ namespace game::scene
         //  1. 在 init() 或切换角色时调用 loadPlayerSM("xxx.sm.json")
         //  2. 在 update() 中调用 tickPlayerSM(dt)：
         //     - 根据按键/物理状态构建 activeInputs
-        //     - 调用 m_playerSM.update() 并应用根位移/帧事件
+        //     - 调用 m_playerSM.tick() 并应用根位移/帧事件
         engine::statemachine::StateController m_playerSM;
         engine::statemachine::StateMachineData m_playerSMData;
+        // tickPlayerSM 用到的触发器 ID（loadPlayerSM 时解析一次；未被 .sm.json 引用的为 INVALID_SYMBOL）
+        struct PlayerSMTriggers
+        {
+            using TriggerId = engine::statemachine::TriggerId;
+            static constexpr TriggerId kInvalid = engine::statemachine::INVALID_SYMBOL;
+            TriggerId grounded = kInvalid, airborne = kInvalid, rising = kInvalid, falling = kInvalid, land = kInvalid;
+            TriggerId moveL = kInvalid, moveR = kInvalid, noInput = kInvalid, isMoving = kInvalid;
+            TriggerId isDashing = kInvalid, isAttacking = kInvalid;
+            TriggerId keyAttack = kInvalid, keyJump = kInvalid, keySkill1 = kInvalid;
+        } m_playerSMTriggers;
         std::string m_playerSMPath;
         bool   m_playerSMLoaded  = false;
         bool   m_prevGrounded    = true;   // 上帧落地状态（用于检测 LAND 事件）
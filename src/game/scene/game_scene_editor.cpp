@@ -7,17 +7,21 @@
 #include "../../engine/component/sprite_component.h"
 #include "../../engine/component/transform_component.h"
 #include "../../engine/core/context.h"
+#include "../../engine/core/profiler.h"
 #include "../../engine/object/game_object.h"
 #include "../../engine/render/camera.h"
 #include "../../engine/render/renderer.h"
 #include "../../engine/resource/resource_manager.h"
+#include "../../engine/resource/resource_types.h"
 #include <algorithm>
 #include <cctype>
 #include <cmath>
 #include <cstdio>
+#include <ctime>
 #include <filesystem>
 #include <fstream>
 #include <functional>
+#include <string_view>
 #include <imgui.h>
 #include <nlohmann/json.hpp>
 #include <spdlog/spdlog.h>
@@ -548,25 +552,15 @@ void GameScene::capturePlaySnapshot()
 
     if (chunk_manager)
     {
-        const auto tileSize = chunk_manager->getTileSize();
-        const auto loadedBounds = chunk_manager->getLoadedChunkBounds();
-        for (const auto& [worldPos, worldSize] : loadedBounds)
+        const auto loadedCoords = chunk_manager->getLoadedChunkCoords();
+        m_playTileSnapshots.reserve(loadedCoords.size());
+        for (const auto& coord : loadedCoords)
         {
-            const int startX = static_cast<int>(std::floor(worldPos.x / std::max(1, tileSize.x)));
-            const int startY = static_cast<int>(std::floor(worldPos.y / std::max(1, tileSize.y)));
-            const int widthTiles = std::max(1, static_cast<int>(std::round(worldSize.x / std::max(1, tileSize.x))));
-            const int heightTiles = std::max(1, static_cast<int>(std::round(worldSize.y / std::max(1, tileSize.y))));
-            for (int y = 0; y < heightTiles; ++y)
-            {
-                for (int x = 0; x < widthTiles; ++x)
-                {
-                    TileRuntimeSnapshot tile;
-                    tile.x = startX + x;
-                    tile.y = startY + y;
-                    tile.tile = chunk_manager->tileAt(tile.x, tile.y);
-                    m_playTileSnapshots.push_back(tile);
-                }
-            }
+            TileRuntimeSnapshot snapshot;
+            snapshot.chunkX = coord.x;
+            snapshot.chunkY = coord.y;
+            if (chunk_manager->copyChunkTiles(coord.x, coord.y, snapshot.tiles))
+                m_playTileSnapshots.push_back(snapshot);
         }
     }
 
@@ -683,8 +677,8 @@ bool GameScene::restorePlaySnapshot()
 
     if (chunk_manager)
     {
-        for (const auto& tile : m_playTileSnapshots)
-            chunk_manager->setTileSilent(tile.x, tile.y, tile.tile);
+        for (const auto& snapshot : m_playTileSnapshots)
+            chunk_manager->restoreChunkTiles(snapshot.chunkX, snapshot.chunkY, snapshot.tiles);
         chunk_manager->rebuildDirtyChunks();
     }
 
@@ -723,7 +717,7 @@ bool GameScene::restorePlaySnapshot()
     m_weatherSystem.restoreRuntimeState(m_playWeatherSnapshot);
     m_hasPlaySnapshot = false;
 
-    spdlog::info("编辑器回滚完成: actors={}, tiles={}", m_playActorSnapshots.size(), m_playTileSnapshots.size());
+    spdlog::info("编辑器回滚完成: actors={}, chunks={}", m_playActorSnapshots.size(), m_playTileSnapshots.size());
     return true;
 }
 
@@ -1311,7 +1305,9 @@ void GameScene::renderResourceExplorerPanel()
 
                 if (isImageResource(path) && m_glContext)
                 {
-                    const unsigned int textureId = _context.getResourceManager().getGLTexture(fullPath);
+                    // 缩略图走异步流送：首次打开不再逐张同步解码，选中项优先
+                    const auto* texture = _context.getResourceManager().requestTexture(fullPath, selected ? 1 : 0);
+                    const unsigned int textureId = texture ? texture->gl_tex : 0;
                     if (textureId != 0)
                     {
                         ImGui::Image(static_cast<ImTextureID>(static_cast<uintptr_t>(textureId)), ImVec2(96.0f, 72.0f));
@@ -1715,17 +1711,162 @@ void GameScene::renderProfilerPanel()
     if (!m_showProfilerPanel)
         return;
 
-    ImGui::SetNextWindowSize(ImVec2(500.0f, 300.0f), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowSize(ImVec2(760.0f, 460.0f), ImGuiCond_FirstUseEver);
     if (!ImGui::Begin("性能分析器", &m_showProfilerPanel))
     {
         ImGui::End();
         return;
     }
 
+    using engine::core::Profiler;
     ImGui::Text("帧耗时 %.2f ms", m_frameProfiler.frameDeltaMs);
-    ImGui::Text("Update %.2f ms  Render %.2f ms", m_frameProfiler.updateTotal.lastMs, m_frameProfiler.renderTotal.lastMs);
+    ImGui::SameLine();
+    ImGui::TextDisabled("Update %.2f ms  Render %.2f ms", m_frameProfiler.updateTotal.lastMs, m_frameProfiler.renderTotal.lastMs);
+
+#if LSL_PROFILER
+    // ── 采集控制 ──
+    bool capturing = Profiler::isEnabled();
+    if (ImGui::Checkbox("采集", &capturing))
+        Profiler::setEnabled(capturing);
+    ImGui::SameLine();
+    ImGui::Checkbox("冻结", &m_profilerFrozen);
+    ImGui::SameLine();
+    if (ImGui::Button("导出 Chrome Trace"))
+    {
+        const std::string path = "profiles/trace_" + std::to_string(static_cast<long long>(std::time(nullptr))) + ".json";
+        m_profilerExportStatus = Profiler::exportChromeTrace(path) ? "已导出 " + path + "（chrome://tracing 或 ui.perfetto.dev 打开）"
+                                                                  : std::string("导出失败，详见日志");
+    }
+    const engine::core::ProfilerStats stats = Profiler::getStats();
+    ImGui::SameLine();
+    ImGui::TextDisabled("轨道 %d  区段 %llu  GPU %llu", stats.tracks,
+                        static_cast<unsigned long long>(stats.events), static_cast<unsigned long long>(stats.gpuEvents));
+    if (!m_profilerExportStatus.empty())
+        ImGui::TextDisabled("%s", m_profilerExportStatus.c_str());
+
+    const std::vector<engine::core::ProfileFrame> frames = Profiler::frames();
+    if (frames.empty())
+    {
+        ImGui::TextDisabled("勾选“采集”后开始记录；关闭时区段只有一次原子读的开销。");
+        ImGui::End();
+        return;
+    }
+
+    // ── 帧历史：点击柱子选中该帧并冻结 ──
+    const engine::core::ProfileFrame *selected = &frames.back();
+    if (m_profilerFrozen && m_profilerSelectedFrame != 0)
+    {
+        const auto it = std::find_if(frames.begin(), frames.end(), [&](const engine::core::ProfileFrame &frame) {
+            return frame.index == m_profilerSelectedFrame;
+        });
+        if (it != frames.end())
+            selected = &*it;
+    }
+    if (!m_profilerFrozen)
+        m_profilerSelectedFrame = selected->index;
+
+    constexpr float kHistoryHeight = 56.0f;
+    constexpr float kBudgetMs = 1000.0f / 60.0f;
+    ImDrawList *dl = ImGui::GetWindowDrawList();
+    const ImVec2 historyMin = ImGui::GetCursorScreenPos();
+    const float historyWidth = std::max(ImGui::GetContentRegionAvail().x, 120.0f);
+    const size_t barCount = std::min<size_t>(frames.size(), static_cast<size_t>(historyWidth / 3.0f));
+    const float barWidth = historyWidth / static_cast<float>(std::max<size_t>(barCount, 1));
+    const size_t firstBar = frames.size() - barCount;
+    dl->AddRectFilled(historyMin, ImVec2(historyMin.x + historyWidth, historyMin.y + kHistoryHeight), IM_COL32(20, 24, 32, 220));
+    // 纵轴满格为两倍帧预算，中线即 60FPS 预算
+    const float budgetY = historyMin.y + kHistoryHeight * 0.5f;
+    dl->AddLine(ImVec2(historyMin.x, budgetY), ImVec2(historyMin.x + historyWidth, budgetY), IM_COL32(120, 120, 140, 120));
+    for (size_t i = 0; i < barCount; ++i)
+    {
+        const engine::core::ProfileFrame &frame = frames[firstBar + i];
+        const float ms = static_cast<float>(frame.endNs - frame.startNs) / 1.0e6f;
+        const float h = kHistoryHeight * std::clamp(ms / (kBudgetMs * 2.0f), 0.02f, 1.0f);
+        const float x = historyMin.x + barWidth * static_cast<float>(i);
+        const ImU32 color = frame.index == selected->index ? IM_COL32(255, 240, 110, 255)
+                            : ms <= kBudgetMs               ? IM_COL32(80, 200, 110, 220)
+                            : ms <= kBudgetMs * 2.0f        ? IM_COL32(230, 180, 60, 220)
+                                                            : IM_COL32(230, 80, 70, 220);
+        dl->AddRectFilled(ImVec2(x, historyMin.y + kHistoryHeight - h),
+                          ImVec2(x + std::max(barWidth - 1.0f, 1.0f), historyMin.y + kHistoryHeight), color);
+    }
+    ImGui::InvisibleButton("##profiler_history", ImVec2(historyWidth, kHistoryHeight));
+    if (ImGui::IsItemHovered() && barCount > 0)
+    {
+        const size_t bar = std::min(barCount - 1, static_cast<size_t>((ImGui::GetIO().MousePos.x - historyMin.x) / barWidth));
+        const engine::core::ProfileFrame &hovered = frames[firstBar + bar];
+        ImGui::SetTooltip("帧 %llu  %.2f ms", static_cast<unsigned long long>(hovered.index),
+                          static_cast<double>(hovered.endNs - hovered.startNs) / 1.0e6);
+        if (ImGui::IsMouseClicked(ImGuiMouseButton_Left))
+        {
+            m_profilerSelectedFrame = hovered.index;
+            m_profilerFrozen = true;
+            selected = &hovered;
+        }
+    }
+
+    const double frameNs = static_cast<double>(std::max<uint64_t>(selected->endNs - selected->startNs, 1));
+    ImGui::Text("帧 %llu  %.2f ms  分配 %llu 次 / %.1f KB", static_cast<unsigned long long>(selected->index), frameNs / 1.0e6,
+                static_cast<unsigned long long>(selected->allocs), static_cast<double>(selected->allocBytes) / 1024.0);
+
+    // ── 火焰图：每个轨道按深度分行，横轴为所选帧的时间范围 ──
+    const engine::core::ProfileCapture capture = Profiler::capture(*selected);
+    constexpr float kRowHeight = 18.0f;
+    ImGui::BeginChild("##profiler_flame", ImVec2(0.0f, 0.0f), ImGuiChildFlags_Borders);
+    ImDrawList *flame = ImGui::GetWindowDrawList();
+    const float flameWidth = std::max(ImGui::GetContentRegionAvail().x, 120.0f);
+    for (const engine::core::ProfileTrack &track : capture.tracks)
+    {
+        uint16_t maxDepth = 0;
+        for (const engine::core::ProfileEvent &event : track.events)
+            maxDepth = std::max(maxDepth, event.depth);
+
+        ImGui::TextDisabled("%s", track.name.c_str());
+        const ImVec2 origin = ImGui::GetCursorScreenPos();
+        const float trackHeight = kRowHeight * static_cast<float>(maxDepth + 1);
+        ImGui::Dummy(ImVec2(flameWidth, trackHeight));
+        const bool trackHovered = ImGui::IsItemHovered();
+        const ImVec2 mouse = ImGui::GetIO().MousePos;
+
+        for (const engine::core::ProfileEvent &event : track.events)
+        {
+            // 跨帧的区段裁到帧范围内
+            const double startNs = static_cast<double>(std::max(event.startNs, selected->startNs) - selected->startNs);
+            const double endNs = static_cast<double>(std::min(event.endNs, selected->endNs) - selected->startNs);
+            const float x0 = origin.x + static_cast<float>(startNs / frameNs) * flameWidth;
+            const float x1 = std::max(origin.x + static_cast<float>(endNs / frameNs) * flameWidth, x0 + 1.0f);
+            const float y0 = origin.y + kRowHeight * static_cast<float>(event.depth);
+            const float y1 = y0 + kRowHeight - 1.0f;
+
+            // 按名称着色，同一区段在各帧颜色一致
+            static constexpr ImU32 kZoneColors[] = {
+                IM_COL32(122, 184, 232, 255), IM_COL32(232, 170, 110, 255), IM_COL32(140, 210, 140, 255),
+                IM_COL32(220, 140, 180, 255), IM_COL32(200, 200, 120, 255), IM_COL32(150, 150, 230, 255),
+                IM_COL32(110, 210, 200, 255), IM_COL32(230, 130, 120, 255)};
+            const size_t hash = std::hash<std::string_view>{}(event.name ? event.name : "");
+            flame->AddRectFilled(ImVec2(x0, y0), ImVec2(x1, y1), kZoneColors[hash % IM_ARRAYSIZE(kZoneColors)]);
+            if (x1 - x0 > 24.0f && event.name)
+            {
+                flame->PushClipRect(ImVec2(x0, y0), ImVec2(x1, y1), true);
+                flame->AddText(ImVec2(x0 + 3.0f, y0 + 2.0f), IM_COL32(20, 20, 24, 255), event.name);
+                flame->PopClipRect();
+            }
+            if (trackHovered && mouse.x >= x0 && mouse.x < x1 && mouse.y >= y0 && mouse.y < y1)
+            {
+                const double ms = static_cast<double>(event.endNs - event.startNs) / 1.0e6;
+                ImGui::SetTooltip("%s\n%.3f ms（%.1f%% 帧）\n分配 %u 次\n深度 %u", event.name ? event.name : "?", ms,
+                                  ms * 1.0e6 / frameNs * 100.0, event.allocs, static_cast<unsigned>(event.depth));
+            }
+        }
+        ImGui::Spacing();
+    }
+    if (capture.tracks.empty())
+        ImGui::TextDisabled("该帧的区段已被环形缓冲覆盖。");
+    ImGui::EndChild();
+#else
     ImGui::Separator();
-    ImGui::TextDisabled("详细采样表和折线图后续接入。当前显示实时核心指标。");
+    ImGui::TextDisabled("分层剖析器未编译进来（CMake 选项 LSL_PROFILER=OFF）。");
+#endif
 
     ImGui::End();
 }
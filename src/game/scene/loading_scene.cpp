@@ -3,6 +3,9 @@
 #include "game_scene.h"
 #include "../../engine/core/context.h"
 #include "../../engine/render/renderer.h"
+#include "../../engine/resource/resource_manager.h"
+#include "../../engine/resource/resource_types.h"
+#include "../../engine/audio/sound_bank.h"
 #include "../../engine/scene/scene_manager.h"
 
 #include <imgui.h>
@@ -47,6 +50,13 @@ namespace game::scene
             }
         }
 
+        m_streamedTextures.clear();
+        for (const std::string& path : GameScene::sceneTexturePaths())
+        {
+            if (auto* texture = _context.getResourceManager().requestTexture(path))
+                m_streamedTextures.push_back(texture);
+        }
+
         m_planetDataPath = planetDataPathFor(m_routeData.selectedPlanet);
         m_progress = 0.02f;
         m_status = "加载星球数据...";
@@ -202,7 +212,37 @@ namespace game::scene
                 }
             }
 
+            m_progress = 0.86f;
+            m_step = LoadStep::DecodeSounds;
+            return;
+        }
+
+        if (m_step == LoadStep::DecodeSounds)
+        {
+            // 音效整段解码成 PCM，进入游戏后首次触发不再在主线程上解码
+            m_status = "解码音效...";
+            if (auto* bank = _context.getResourceManager().getSoundBank())
+                bank->loadDirectory("assets/audio");
             m_progress = 0.88f;
+            m_step = LoadStep::StreamTextures;
+            return;
+        }
+
+        if (m_step == LoadStep::StreamTextures)
+        {
+            m_status = "加载纹理...";
+            size_t settled = 0;
+            for (const auto* texture : m_streamedTextures)
+                settled += texture->state != engine::resource::TextureState::Pending ? 1u : 0u;
+
+            const float texturePhase = m_streamedTextures.empty()
+                ? 1.0f
+                : static_cast<float>(settled) / static_cast<float>(m_streamedTextures.size());
+            m_progress = 0.88f + texturePhase * 0.1f;
+            if (settled < m_streamedTextures.size())
+                return;
+
+            m_streamedTextures.clear();
             m_step = LoadStep::EnterGame;
             return;
         }
@@ -6,6 +6,11 @@
 #include <string>
 #include <vector>
 
+namespace engine::resource
+{
+    struct TextureResource;
+}
+
 namespace game::scene
 {
     class LoadingScene : public engine::scene::Scene
@@ -29,6 +34,8 @@ namespace game::scene
             ValidateMapFile,
             ValidateTileCatalog,
             LoadCharacterProfiles,
+            DecodeSounds,
+            StreamTextures,
             EnterGame,
             Done
         };
@@ -54,6 +61,9 @@ namespace game::scene
         int m_invalidCharacterCount = 0;
         size_t m_characterScanIndex = 0;
 
+        // GameScene 预热纹理：init 时异步请求，各步骤期间后台解码、每帧按预算上传
+        std::vector<engine::resource::TextureResource*> m_streamedTextures;
+
         std::string planetDataPathFor(game::route::PlanetType type) const;
         bool fileExists(const std::string& path) const;
     };
@@ -0,0 +1,230 @@
+#include "voxel_mesher.h"
+#include "../../engine/core/profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <spdlog/spdlog.h>
+
+namespace game::scene
+{
+    void VoxelPaddedChunk::reset(int sx, int sy, int sz)
+    {
+        sizeX = sx;
+        sizeY = sy;
+        sizeZ = sz;
+        cells.assign(static_cast<size_t>((sx + 2) * (sy + 2) * (sz + 2)), 0);
+    }
+
+    void VoxelMesher::build(const VoxelPaddedChunk &chunk, std::vector<VoxelPackedVertex> &out)
+    {
+        out.clear();
+        const int dims[3] = {chunk.sizeX, chunk.sizeY, chunk.sizeZ};
+
+        std::vector<uint8_t> mask;
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            // u × v == axis 正方向，保证正向面逆时针
+            const int u = (axis + 1) % 3;
+            const int v = (axis + 2) % 3;
+            const int dimU = dims[u];
+            const int dimV = dims[v];
+            mask.resize(static_cast<size_t>(dimU * dimV));
+
+            for (int dir = 0; dir < 2; ++dir)
+            {
+                const bool positive = dir == 0;
+                const int normalIndex = axis * 2 + dir;
+                const int step = positive ? 1 : -1;
+
+                for (int slice = 0; slice < dims[axis]; ++slice)
+                {
+                    // 1) 生成该层的可见面掩码（体素非空且朝向的邻居为空）
+                    int pos[3];
+                    int nbPos[3];
+                    pos[axis] = slice;
+                    nbPos[axis] = slice + step;
+                    bool any = false;
+                    for (int b = 0; b < dimV; ++b)
+                    {
+                        pos[v] = nbPos[v] = b;
+                        for (int a = 0; a < dimU; ++a)
+                        {
+                            pos[u] = nbPos[u] = a;
+                            const uint8_t mat = chunk.at(pos[0], pos[1], pos[2]);
+                            const bool visible = mat != 0 && chunk.at(nbPos[0], nbPos[1], nbPos[2]) == 0;
+                            mask[static_cast<size_t>(a + b * dimU)] = visible ? mat : 0;
+                            any |= visible;
+                        }
+                    }
+                    if (!any)
+                        continue;
+
+                    // 2) 贪婪合并：先沿 u 扩展宽度，再沿 v 扩展高度
+                    for (int b = 0; b < dimV; ++b)
+                    {
+                        for (int a = 0; a < dimU;)
+                        {
+                            const uint8_t mat = mask[static_cast<size_t>(a + b * dimU)];
+                            if (mat == 0)
+                            {
+                                ++a;
+                                continue;
+                            }
+
+                            int w = 1;
+                            while (a + w < dimU && mask[static_cast<size_t>(a + w + b * dimU)] == mat)
+                                ++w;
+
+                            int h = 1;
+                            for (; b + h < dimV; ++h)
+                            {
+                                const uint8_t *row = &mask[static_cast<size_t>(a + (b + h) * dimU)];
+                                if (!std::all_of(row, row + w, [mat](uint8_t m) { return m == mat; }))
+                                    break;
+                            }
+
+                            for (int hb = 0; hb < h; ++hb)
+                                std::fill_n(&mask[static_cast<size_t>(a + (b + hb) * dimU)], w, uint8_t{0});
+
+                            // 3) 输出矩形：c0 → c1(+u) → c2(+u+v) → c3(+v)
+                            int base[3];
+                            base[axis] = slice + (positive ? 1 : 0);
+                            base[u] = a;
+                            base[v] = b;
+                            int du[3] = {0, 0, 0};
+                            int dv[3] = {0, 0, 0};
+                            du[u] = w;
+                            dv[v] = h;
+
+                            const uint8_t nm = packNormalMaterial(normalIndex, mat);
+                            auto corner = [&](int cu, int cv) {
+                                return VoxelPackedVertex{
+                                    static_cast<uint8_t>(base[0] + du[0] * cu + dv[0] * cv),
+                                    static_cast<uint8_t>(base[1] + du[1] * cu + dv[1] * cv),
+                                    static_cast<uint8_t>(base[2] + du[2] * cu + dv[2] * cv),
+                                    nm};
+                            };
+                            const VoxelPackedVertex c0 = corner(0, 0);
+                            const VoxelPackedVertex c1 = corner(1, 0);
+                            const VoxelPackedVertex c2 = corner(1, 1);
+                            const VoxelPackedVertex c3 = corner(0, 1);
+                            if (positive)
+                                out.insert(out.end(), {c0, c1, c2, c0, c2, c3});
+                            else
+                                out.insert(out.end(), {c0, c3, c2, c0, c2, c1});
+
+                            a += w;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    VoxelMeshWorker::VoxelMeshWorker(int workerCount)
+    {
+        workerCount = std::max(workerCount, 1);
+        m_workers.reserve(static_cast<size_t>(workerCount));
+        for (int i = 0; i < workerCount; ++i)
+            m_workers.emplace_back([this] { workerLoop(); });
+        spdlog::debug("[VoxelMeshWorker] started {} worker(s)", workerCount);
+    }
+
+    VoxelMeshWorker::~VoxelMeshWorker()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+            for (VoxelMeshJob *job : m_jobs)
+                delete job;
+            m_jobs.clear();
+        }
+        m_wakeCv.notify_all();
+        for (auto &worker : m_workers)
+        {
+            if (worker.joinable())
+                worker.join();
+        }
+
+        while (VoxelMeshJob *job = m_completed.pop())
+            delete job;
+        for (VoxelMeshJob *job : m_freeJobs)
+            delete job;
+    }
+
+    VoxelMeshJob *VoxelMeshWorker::acquire()
+    {
+        if (m_freeJobs.empty())
+            return new VoxelMeshJob();
+        VoxelMeshJob *job = m_freeJobs.back();
+        m_freeJobs.pop_back();
+        return job;
+    }
+
+    void VoxelMeshWorker::submit(VoxelMeshJob *job)
+    {
+        m_inFlight.fetch_add(1, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_jobs.push_back(job);
+            m_queued.fetch_add(1, std::memory_order_relaxed);
+        }
+        m_wakeCv.notify_one();
+    }
+
+    VoxelMeshJob *VoxelMeshWorker::popCompleted()
+    {
+        VoxelMeshJob *job = m_completed.pop();
+        if (job)
+            m_inFlight.fetch_sub(1, std::memory_order_relaxed);
+        return job;
+    }
+
+    void VoxelMeshWorker::release(VoxelMeshJob *job)
+    {
+        if (job)
+            m_freeJobs.push_back(job);
+    }
+
+    VoxelMeshStats VoxelMeshWorker::getStats() const
+    {
+        VoxelMeshStats stats;
+        stats.queuedJobs = m_queued.load(std::memory_order_relaxed);
+        stats.inFlightJobs = m_inFlight.load(std::memory_order_relaxed);
+        stats.builtTotal = m_builtTotal.load(std::memory_order_relaxed);
+        const uint64_t micros = m_buildMicros.load(std::memory_order_relaxed);
+        stats.buildAvgMs = stats.builtTotal
+            ? static_cast<float>(static_cast<double>(micros) / static_cast<double>(stats.builtTotal) / 1000.0)
+            : 0.0f;
+        stats.buildLastMs = static_cast<float>(m_lastBuildMicros.load(std::memory_order_relaxed)) / 1000.0f;
+        return stats;
+    }
+
+    void VoxelMeshWorker::workerLoop()
+    {
+        LSL_PROFILE_THREAD("VoxelMeshWorker");
+        for (;;)
+        {
+            VoxelMeshJob *job = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wakeCv.wait(lock, [this] { return m_stopping || !m_jobs.empty(); });
+                if (m_stopping)
+                    return;
+                job = m_jobs.front();
+                m_jobs.pop_front();
+                m_queued.fetch_sub(1, std::memory_order_relaxed);
+            }
+
+            LSL_PROFILE_ZONE("VoxelMesher::build");
+            const auto start = std::chrono::steady_clock::now();
+            VoxelMesher::build(job->padded, job->vertices);
+            job->buildMicros = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                                         std::chrono::steady_clock::now() - start)
+                                                         .count());
+            m_buildMicros.fetch_add(job->buildMicros, std::memory_order_relaxed);
+            m_lastBuildMicros.store(job->buildMicros, std::memory_order_relaxed);
+            m_builtTotal.fetch_add(1, std::memory_order_relaxed);
+            m_completed.push(job);
+        }
+    }
+} // namespace game::scene
@@ -0,0 +1,132 @@
+// 体素区块网格构建
+// voxel_mesher.h
+//   - VoxelPaddedChunk：区块体素 + 四周一圈邻块边界（越界/未加载为空气），网格构建期间不再查询哈希表
+//   - VoxelMesher：贪婪合并同材质共面面片，输出 4 字节压缩顶点
+//   - VoxelMeshWorker：后台线程构建 CPU 网格，主线程只做 GPU 上传
+#pragma once
+#include "../../engine/utils/mpsc_queue.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace game::scene
+{
+    /**
+     * @brief 压缩区块顶点（4 字节）
+     * x/y/z 为区块内顶点坐标（0..尺寸，含上界），nm = 法线索引(低 3 位) | 材质(高 5 位)。
+     * 作为 4 x GL_UNSIGNED_BYTE 非归一化属性上传，着色器内按区块原点 + 调色板还原。
+     */
+    struct VoxelPackedVertex
+    {
+        uint8_t x = 0;
+        uint8_t y = 0;
+        uint8_t z = 0;
+        uint8_t nm = 0;
+    };
+    static_assert(sizeof(VoxelPackedVertex) == 4, "VoxelPackedVertex 应为 4 字节");
+
+    /**
+     * @brief 带一圈邻块边界的区块体素拷贝
+     * 坐标范围 [-1, size]，内部按 (x + 1) + (y + 1) * px + (z + 1) * px * py 存储
+     */
+    struct VoxelPaddedChunk
+    {
+        int sizeX = 0;
+        int sizeY = 0;
+        int sizeZ = 0;
+        std::vector<uint8_t> cells;
+
+        // 重设尺寸并清零（边界默认空气）
+        void reset(int sx, int sy, int sz);
+
+        int paddedX() const { return sizeX + 2; }
+        int paddedY() const { return sizeY + 2; }
+        int index(int x, int y, int z) const { return (x + 1) + (y + 1) * paddedX() + (z + 1) * paddedX() * paddedY(); }
+        uint8_t at(int x, int y, int z) const { return cells[static_cast<size_t>(index(x, y, z))]; }
+        void set(int x, int y, int z, uint8_t value) { cells[static_cast<size_t>(index(x, y, z))] = value; }
+    };
+
+    class VoxelMesher
+    {
+    public:
+        // 法线索引：axis * 2 + (负方向 ? 1 : 0)，即 +X,-X,+Y,-Y,+Z,-Z
+        static constexpr int FACE_COUNT = 6;
+        // 压缩顶点中可编码的材质数（5 位），超出的材质归入最后一个调色板槽
+        static constexpr int PALETTE_SIZE = 32;
+
+        static uint8_t packNormalMaterial(int normalIndex, uint8_t material)
+        {
+            const int mat = material < PALETTE_SIZE ? material : PALETTE_SIZE - 1;
+            return static_cast<uint8_t>((mat << 3) | (normalIndex & 7));
+        }
+
+        // 贪婪网格构建：每个可见面朝向逐层扫描，合并相同材质的矩形，输出三角形列表（6 顶点/矩形）
+        static void build(const VoxelPaddedChunk &chunk, std::vector<VoxelPackedVertex> &out);
+    };
+
+    /**
+     * @brief 单个区块的网格构建任务
+     * 主线程填入 padded 与 key/revision；工作线程写 vertices/buildMicros
+     */
+    struct VoxelMeshJob
+    {
+        int64_t key = 0;
+        uint64_t revision = 0;
+        VoxelPaddedChunk padded;
+        std::vector<VoxelPackedVertex> vertices;
+        uint64_t buildMicros = 0;
+
+        std::atomic<VoxelMeshJob *> next{nullptr}; // MpscQueue 侵入式链接
+    };
+
+    struct VoxelMeshStats
+    {
+        size_t queuedJobs = 0;
+        size_t inFlightJobs = 0; // 已提交、尚未被主线程取回
+        uint64_t builtTotal = 0;
+        float buildAvgMs = 0.0f;
+        float buildLastMs = 0.0f;
+    };
+
+    class VoxelMeshWorker
+    {
+    public:
+        explicit VoxelMeshWorker(int workerCount = 1);
+        ~VoxelMeshWorker();
+
+        VoxelMeshWorker(const VoxelMeshWorker &) = delete;
+        VoxelMeshWorker &operator=(const VoxelMeshWorker &) = delete;
+
+        // 主线程：取一个空闲任务（复用缓冲），填好后 submit
+        VoxelMeshJob *acquire();
+        void submit(VoxelMeshJob *job);
+        // 主线程：取出已完成任务，用完后 release 归还
+        VoxelMeshJob *popCompleted();
+        void release(VoxelMeshJob *job);
+
+        size_t inFlight() const { return m_inFlight.load(std::memory_order_relaxed); }
+        VoxelMeshStats getStats() const;
+
+    private:
+        void workerLoop();
+
+        std::vector<std::thread> m_workers;
+        std::mutex m_mutex;
+        std::condition_variable m_wakeCv;
+        std::deque<VoxelMeshJob *> m_jobs; // 受 m_mutex 保护
+        bool m_stopping = false;
+
+        engine::utils::MpscQueue<VoxelMeshJob> m_completed;
+        std::vector<VoxelMeshJob *> m_freeJobs; // 仅主线程
+
+        std::atomic<size_t> m_queued{0};
+        std::atomic<size_t> m_inFlight{0};
+        std::atomic<uint64_t> m_builtTotal{0};
+        std::atomic<uint64_t> m_buildMicros{0};
+        std::atomic<uint64_t> m_lastBuildMicros{0};
+    };
+} // namespace game::scene
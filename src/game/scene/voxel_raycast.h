@@ -0,0 +1,176 @@
+// 体素射线检测
+// voxel_raycast.h
+//   - VoxelOccupancy：单个区块的实心位图（16x24x16 bit = 96 个 uint64），与密度阈值判定保持同步
+//   - VoxelOccupancyCursor：按世界坐标查询位图，缓存上一次命中的区块，同一区块内的连续查询不再查哈希表
+//   - traceVoxelRay：Amanatides–Woo DDA，沿射线逐个访问穿过的单元格（每格一次），返回命中格、入射面与法线
+//   - traceVoxelRays：批量射线（AI 视线、投射物碰撞），共用同一个游标
+#pragma once
+#include <glm/glm.hpp>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace game::scene
+{
+    /**
+     * @brief 区块实心位图
+     * 位序与区块体素数组相同：x + y * SIZE_X + z * SIZE_X * SIZE_Y
+     */
+    struct VoxelOccupancy
+    {
+        static constexpr int SIZE_X = 16;
+        static constexpr int SIZE_Y = 24;
+        static constexpr int SIZE_Z = 16;
+        static constexpr int WORD_COUNT = SIZE_X * SIZE_Y * SIZE_Z / 64;
+
+        std::array<uint64_t, WORD_COUNT> words{};
+
+        static int bitIndex(int x, int y, int z) { return x + y * SIZE_X + z * SIZE_X * SIZE_Y; }
+
+        bool test(int x, int y, int z) const
+        {
+            const int bit = bitIndex(x, y, z);
+            return (words[static_cast<size_t>(bit >> 6)] >> (bit & 63)) & 1u;
+        }
+
+        void assign(int x, int y, int z, bool solid)
+        {
+            const int bit = bitIndex(x, y, z);
+            const uint64_t mask = uint64_t{1} << (bit & 63);
+            uint64_t &word = words[static_cast<size_t>(bit >> 6)];
+            word = solid ? (word | mask) : (word & ~mask);
+        }
+
+        void clear() { words.fill(0); }
+    };
+
+    /**
+     * @brief 按世界坐标查询实心位图
+     * @tparam Lookup const VoxelOccupancy *(int chunkX, int chunkZ)，区块不存在 / 未生成时返回 nullptr
+     * 世界范围外一律视为空气；游标持有上一次的区块指针，区块增删后需重新创建
+     */
+    template <typename Lookup>
+    class VoxelOccupancyCursor
+    {
+    public:
+        VoxelOccupancyCursor(Lookup lookup, int worldWidth, int worldDepth)
+            : m_lookup(std::move(lookup)), m_worldWidth(worldWidth), m_worldDepth(worldDepth)
+        {
+        }
+
+        bool operator()(const glm::ivec3 &cell)
+        {
+            if (cell.x < 0 || cell.x >= m_worldWidth || cell.y < 0 || cell.y >= VoxelOccupancy::SIZE_Y ||
+                cell.z < 0 || cell.z >= m_worldDepth)
+                return false;
+
+            const int chunkX = cell.x / VoxelOccupancy::SIZE_X;
+            const int chunkZ = cell.z / VoxelOccupancy::SIZE_Z;
+            if (chunkX != m_chunkX || chunkZ != m_chunkZ)
+            {
+                m_chunk = m_lookup(chunkX, chunkZ);
+                m_chunkX = chunkX;
+                m_chunkZ = chunkZ;
+            }
+            return m_chunk && m_chunk->test(cell.x - chunkX * VoxelOccupancy::SIZE_X, cell.y,
+                                            cell.z - chunkZ * VoxelOccupancy::SIZE_Z);
+        }
+
+    private:
+        Lookup m_lookup;
+        int m_worldWidth = 0;
+        int m_worldDepth = 0;
+        int m_chunkX = std::numeric_limits<int>::min();
+        int m_chunkZ = std::numeric_limits<int>::min();
+        const VoxelOccupancy *m_chunk = nullptr;
+    };
+
+    struct VoxelRay
+    {
+        glm::vec3 origin{0.0f};
+        glm::vec3 dir{0.0f, 0.0f, 1.0f}; // 需归一化，distance 才是世界单位
+        float maxDistance = 0.0f;
+    };
+
+    struct VoxelRayHit
+    {
+        bool hit = false;
+        glm::ivec3 cell{0};   // 命中的实心格
+        glm::ivec3 normal{0}; // 入射面法线；起点已在实心格内时为 0
+        int face = -1;        // 入射面索引，与 VoxelMesher 相同：+X,-X,+Y,-Y,+Z,-Z；起点在实心格内时为 -1
+        float distance = 0.0f; // 起点到入射面的距离
+        int visited = 0;      // 访问过的单元格数（含起点格）
+    };
+
+    /**
+     * @brief Amanatides–Woo 体素遍历
+     * @param solid bool(const glm::ivec3 &cell)
+     * 按射线穿过单元格边界的先后依次访问，每格恰好一次；入射距离超过 maxDistance 即停止
+     */
+    template <typename Solid>
+    VoxelRayHit traceVoxelRay(const VoxelRay &ray, Solid &&solid)
+    {
+        VoxelRayHit result;
+        glm::ivec3 cell = glm::ivec3(glm::floor(ray.origin));
+        result.visited = 1;
+        if (solid(cell))
+        {
+            result.hit = true;
+            result.cell = cell;
+            return result;
+        }
+
+        constexpr float kInf = std::numeric_limits<float>::infinity();
+        glm::ivec3 step{0};
+        glm::vec3 tMax{kInf};
+        glm::vec3 tDelta{kInf};
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const float d = ray.dir[axis];
+            if (d > 0.0f)
+            {
+                step[axis] = 1;
+                tDelta[axis] = 1.0f / d;
+                tMax[axis] = (static_cast<float>(cell[axis] + 1) - ray.origin[axis]) * tDelta[axis];
+            }
+            else if (d < 0.0f)
+            {
+                step[axis] = -1;
+                tDelta[axis] = -1.0f / d;
+                tMax[axis] = (ray.origin[axis] - static_cast<float>(cell[axis])) * tDelta[axis];
+            }
+        }
+
+        for (;;)
+        {
+            const int axis = tMax.x <= tMax.y ? (tMax.x <= tMax.z ? 0 : 2) : (tMax.y <= tMax.z ? 1 : 2);
+            const float t = tMax[axis];
+            if (t > ray.maxDistance)
+                return result;
+
+            cell[axis] += step[axis];
+            tMax[axis] += tDelta[axis];
+            ++result.visited;
+            if (solid(cell))
+            {
+                result.hit = true;
+                result.cell = cell;
+                result.normal[axis] = -step[axis];
+                result.face = axis * 2 + (step[axis] > 0 ? 1 : 0);
+                result.distance = t;
+                return result;
+            }
+        }
+    }
+
+    /** 批量射线：逐条遍历并写入 hits[i]，同一个 solid 游标跨射线复用区块缓存 */
+    template <typename Solid>
+    void traceVoxelRays(const VoxelRay *rays, size_t count, VoxelRayHit *hits, Solid &&solid)
+    {
+        for (size_t i = 0; i < count; ++i)
+            hits[i] = traceVoxelRay(rays[i], solid);
+    }
+} // namespace game::scene
@@ -15,17 +15,16 @@
 #include <imgui_impl_opengl3.h>
 #define IMGUI_IMPL_OPENGL_LOADER_CUSTOM
 #include <imgui_impl_opengl3_loader.h>
-#define TINYGLTF_IMPLEMENTATION
-#define STB_IMAGE_IMPLEMENTATION
-#define STB_IMAGE_WRITE_IMPLEMENTATION
-#include <tiny_gltf.h>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <cstring>
 #include <fstream>
 #include <regex>
 #include <sstream>
+#include <spdlog/spdlog.h>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -37,6 +36,12 @@
 #ifndef GL_STATIC_DRAW
 #define GL_STATIC_DRAW 0x88E4
 #endif
+#ifndef GL_ELEMENT_ARRAY_BUFFER
+#define GL_ELEMENT_ARRAY_BUFFER 0x8893
+#endif
+#ifndef GL_UNSIGNED_INT
+#define GL_UNSIGNED_INT 0x1405
+#endif
 #ifndef GL_DEPTH_BUFFER_BIT
 #define GL_DEPTH_BUFFER_BIT 0x00000100
 #endif
@@ -108,6 +113,8 @@ namespace game::scene
         constexpr float kPlayerJumpVelocity = 8.8f;
         constexpr float kPlayerEyeHeight = 1.72f;
         constexpr float kFireProjectileGravity = 15.0f;
+        constexpr float kSolidDensity = 0.08f;   // 密度超过此值视为实心
+        constexpr float kBlockReach = 8.0f;      // 准星选中方块的最远距离
         constexpr float kFireProjectileHorizontalSpeed = 15.5f;
         constexpr float kFireProjectileMinFlightTime = 0.24f;
         constexpr float kFireProjectileMaxFlightTime = 0.72f;
@@ -332,34 +339,17 @@ namespace game::scene
             return 10.0f;
         }
 
-        std::vector<std::string> splitString(const std::string &text, char delimiter)
+        // 摆放只含平移 + 绕 Y 旋转 + 等比缩放，直接拼出 translate * rotateY * scale
+        glm::mat4 placedModelMatrix(const glm::vec3 &position, float yawDegrees, float scale)
         {
-            std::vector<std::string> parts;
-            std::stringstream stream(text);
-            std::string part;
-            while (std::getline(stream, part, delimiter))
-                parts.push_back(part);
-            return parts;
-        }
-
-        struct ObjIndex
-        {
-            int position = 0;
-            int uv = 0;
-            int normal = 0;
-        };
-
-        ObjIndex parseObjIndex(const std::string &token)
-        {
-            ObjIndex index{};
-            auto parts = splitString(token, '/');
-            if (!parts.empty() && !parts[0].empty())
-                index.position = std::stoi(parts[0]);
-            if (parts.size() > 1 && !parts[1].empty())
-                index.uv = std::stoi(parts[1]);
-            if (parts.size() > 2 && !parts[2].empty())
-                index.normal = std::stoi(parts[2]);
-            return index;
+            const float c = std::cos(glm::radians(yawDegrees)) * scale;
+            const float s = std::sin(glm::radians(yawDegrees)) * scale;
+            glm::mat4 model(1.0f);
+            model[0] = {c, 0.0f, -s, 0.0f};
+            model[1] = {0.0f, scale, 0.0f, 0.0f};
+            model[2] = {s, 0.0f, c, 0.0f};
+            model[3] = glm::vec4(position, 1.0f);
+            return model;
         }
 
         unsigned int compileShader(unsigned int type, const char *source)
@@ -547,6 +537,52 @@ void main()
         m_glUniform2f = reinterpret_cast<Uniform2fProc>(SDL_GL_GetProcAddress("glUniform2f"));
         m_glBlendFunc = reinterpret_cast<BlendFuncProc>(SDL_GL_GetProcAddress("glBlendFunc"));
         m_glDepthMask = reinterpret_cast<DepthMaskProc>(SDL_GL_GetProcAddress("glDepthMask"));
+        m_glDrawElementsInstanced = reinterpret_cast<DrawElementsInstancedProc>(SDL_GL_GetProcAddress("glDrawElementsInstanced"));
+        m_glVertexAttribDivisor = reinterpret_cast<VertexAttribDivisorProc>(SDL_GL_GetProcAddress("glVertexAttribDivisor"));
+
+        // 区块着色器：顶点为 4 x uint8（区块内坐标 + 法线/材质），颜色查调色板，片元部分与 m_shader 相同
+        const char *chunkVertSrc = R"(
+#version 330 core
+layout(location = 0) in vec4 aPacked;
+out vec3 vColor;
+out vec3 vNormal;
+out vec3 vWorldPos;
+uniform mat4 uMVP;
+uniform vec3 uChunkOrigin;
+uniform vec3 uPalette[32];
+const vec3 kNormals[6] = vec3[6](vec3(1, 0, 0), vec3(-1, 0, 0), vec3(0, 1, 0),
+                                 vec3(0, -1, 0), vec3(0, 0, 1), vec3(0, 0, -1));
+// 顶面稍亮，底面与侧面稍暗，增加立体感
+const float kFaceBrightness[6] = float[6](0.72, 0.72, 1.0, 0.55, 0.82, 0.82);
+void main()
+{
+    int nm = int(aPacked.w + 0.5);
+    int normalIndex = nm & 7;
+    vec3 worldPos = uChunkOrigin + aPacked.xyz;
+    gl_Position = uMVP * vec4(worldPos, 1.0);
+    vColor = uPalette[nm >> 3] * kFaceBrightness[normalIndex];
+    vNormal = kNormals[normalIndex];
+    vWorldPos = worldPos;
+}
+)";
+        unsigned int chunkVs = compileShader(GL_VERTEX_SHADER, chunkVertSrc);
+        unsigned int chunkFs = compileShader(GL_FRAGMENT_SHADER, fragSrc);
+        m_chunkShader = glCreateProgram();
+        glAttachShader(m_chunkShader, chunkVs);
+        glAttachShader(m_chunkShader, chunkFs);
+        glLinkProgram(m_chunkShader);
+        glDeleteShader(chunkVs);
+        glDeleteShader(chunkFs);
+        m_chunkOriginLoc = glGetUniformLocation(m_chunkShader, "uChunkOrigin");
+        if (m_glUniform3fv)
+        {
+            std::array<glm::vec3, VoxelMesher::PALETTE_SIZE> palette;
+            for (int i = 0; i < VoxelMesher::PALETTE_SIZE; ++i)
+                palette[static_cast<size_t>(i)] = blockColor(static_cast<unsigned char>(i), 1.0f);
+            glUseProgram(m_chunkShader);
+            m_glUniform3fv(glGetUniformLocation(m_chunkShader, "uPalette"), VoxelMesher::PALETTE_SIZE, glm::value_ptr(palette[0]));
+            glUseProgram(0);
+        }
 
         glGenVertexArrays(1, &m_monsterVao);
         glGenBuffers(1, &m_monsterVbo);
@@ -602,18 +638,22 @@ void main()
 layout(location = 0) in vec3 aPos;
 layout(location = 1) in vec3 aNormal;
 layout(location = 2) in vec2 aUV;
+layout(location = 3) in mat4 aModel;
+layout(location = 7) in vec4 aTint;
 out vec3 vNormal;
 out vec3 vWorldPos;
 out vec2 vUV;
-uniform mat4 uMVP;
-uniform mat4 uModel;
+out vec4 vTint;
+uniform mat4 uViewProj;
 void main()
 {
-    vec4 worldPos = uModel * vec4(aPos, 1.0);
-    gl_Position = uMVP * vec4(aPos, 1.0);
+    vec4 worldPos = aModel * vec4(aPos, 1.0);
+    gl_Position = uViewProj * worldPos;
     vWorldPos = worldPos.xyz;
-    vNormal = mat3(transpose(inverse(uModel))) * aNormal;
+    // 摆放只含旋转与等比缩放，模型矩阵本身即可变换法线（片元内归一化）
+    vNormal = mat3(aModel) * aNormal;
     vUV = aUV;
+    vTint = aTint;
 }
 )";
 
@@ -622,6 +662,7 @@ void main()
 in vec3 vNormal;
 in vec3 vWorldPos;
 in vec2 vUV;
+in vec4 vTint;
 out vec4 FragColor;
 uniform sampler2D uTex;
 uniform vec3 uLightDir;
@@ -634,7 +675,7 @@ uniform float uFogFar;
 uniform float uFlash;
 void main()
 {
-    vec3 baseColor = texture(uTex, vUV).rgb;
+    vec3 baseColor = texture(uTex, vUV).rgb * vTint.rgb;
     vec3 normal = normalize(vNormal);
     float lambert = max(dot(normal, normalize(-uLightDir)), 0.0);
     vec3 lit = baseColor * (uAmbientStrength + lambert * uDiffuseStrength + uFlash * 0.25);
@@ -654,6 +695,16 @@ void main()
         glLinkProgram(m_modelShader);
         glDeleteShader(modelVs);
         glDeleteShader(modelFs);
+        m_modelUniforms.viewProj = glGetUniformLocation(m_modelShader, "uViewProj");
+        m_modelUniforms.tex = glGetUniformLocation(m_modelShader, "uTex");
+        m_modelUniforms.lightDir = glGetUniformLocation(m_modelShader, "uLightDir");
+        m_modelUniforms.cameraPos = glGetUniformLocation(m_modelShader, "uCameraPos");
+        m_modelUniforms.fogColor = glGetUniformLocation(m_modelShader, "uFogColor");
+        m_modelUniforms.ambientStrength = glGetUniformLocation(m_modelShader, "uAmbientStrength");
+        m_modelUniforms.diffuseStrength = glGetUniformLocation(m_modelShader, "uDiffuseStrength");
+        m_modelUniforms.fogNear = glGetUniformLocation(m_modelShader, "uFogNear");
+        m_modelUniforms.fogFar = glGetUniformLocation(m_modelShader, "uFogFar");
+        m_modelUniforms.flash = glGetUniformLocation(m_modelShader, "uFlash");
 
         const char *dashStarVertSrc = R"(
 #version 330 core
@@ -1721,6 +1772,9 @@ void main()
         loadStaticModelMeshGLB("character_glb", "assets/models/GLB format/character-female-a.glb");
         loadStaticModelMeshGLB("wheelchair_glb", "assets/models/GLB format/wheelchair-power-deluxe.glb");
         loadStaticModelMeshGLB("mask_glb", "assets/models/GLB format/aid-mask.glb");
+
+        const auto stats = m_meshCache.getStats();
+        spdlog::info("模型加载 {:.1f} ms：缓存命中 {}，导入 {}，失败 {}", stats.loadMs, stats.hits, stats.imports, stats.failures);
     }
 
     unsigned int VoxelScene::loadModelTexture(const std::string &path)
@@ -1778,248 +1832,54 @@ void main()
 
     bool VoxelScene::loadStaticModelMesh(const std::string &name, const std::string &objPath, const std::string &texturePath)
     {
-        std::ifstream file(objPath);
-        if (!file.is_open())
+        engine::resource::MeshData mesh;
+        if (!m_meshCache.load(objPath, mesh))
             return false;
-
-        std::vector<glm::vec3> positions;
-        std::vector<glm::vec3> normals;
-        std::vector<glm::vec2> uvs;
-        std::vector<ModelVertex> vertices;
-        std::string line;
-
-        while (std::getline(file, line))
-        {
-            if (line.empty() || line[0] == '#')
-                continue;
-
-            std::istringstream stream(line);
-            std::string type;
-            stream >> type;
-            if (type == "v")
-            {
-                glm::vec3 position{0.0f};
-                stream >> position.x >> position.y >> position.z;
-                positions.push_back(position);
-            }
-            else if (type == "vn")
-            {
-                glm::vec3 normal{0.0f};
-                stream >> normal.x >> normal.y >> normal.z;
-                normals.push_back(glm::normalize(normal));
-            }
-            else if (type == "vt")
-            {
-                glm::vec2 uv{0.0f};
-                stream >> uv.x >> uv.y;
-                uvs.push_back({uv.x, 1.0f - uv.y});
-            }
-            else if (type == "f")
-            {
-                std::vector<ObjIndex> face;
-                std::string token;
-                while (stream >> token)
-                    face.push_back(parseObjIndex(token));
-                if (face.size() < 3)
-                    continue;
-
-                for (size_t i = 1; i + 1 < face.size(); ++i)
-                {
-                    ObjIndex tri[3] = {face[0], face[i], face[i + 1]};
-                    glm::vec3 fallbackNormal{0.0f, 1.0f, 0.0f};
-                    if (tri[0].position > 0 && tri[1].position > 0 && tri[2].position > 0)
-                    {
-                        const glm::vec3 &a = positions[static_cast<size_t>(tri[0].position - 1)];
-                        const glm::vec3 &b = positions[static_cast<size_t>(tri[1].position - 1)];
-                        const glm::vec3 &c = positions[static_cast<size_t>(tri[2].position - 1)];
-                        glm::vec3 n = glm::cross(b - a, c - a);
-                        if (glm::length(n) > 0.0001f)
-                            fallbackNormal = glm::normalize(n);
-                    }
-
-                    for (const ObjIndex &idx : tri)
-                    {
-                        ModelVertex vertex{};
-                        if (idx.position > 0)
-                            vertex.pos = positions[static_cast<size_t>(idx.position - 1)];
-                        vertex.normal = idx.normal > 0 ? normals[static_cast<size_t>(idx.normal - 1)] : fallbackNormal;
-                        vertex.uv = idx.uv > 0 ? uvs[static_cast<size_t>(idx.uv - 1)] : glm::vec2(0.0f);
-                        vertices.push_back(vertex);
-                    }
-                }
-            }
-        }
-
-        if (vertices.empty())
-            return false;
-
-        StaticModelMesh mesh;
-        mesh.name = name;
-        mesh.texture = loadModelTexture(texturePath);
-        mesh.vertexCount = static_cast<int>(vertices.size());
-        glGenVertexArrays(1, &mesh.vao);
-        glGenBuffers(1, &mesh.vbo);
-        glBindVertexArray(mesh.vao);
-        glBindBuffer(GL_ARRAY_BUFFER, mesh.vbo);
-        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(ModelVertex), vertices.data(), GL_STATIC_DRAW);
-        glEnableVertexAttribArray(0);
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(ModelVertex), (void*)offsetof(ModelVertex, pos));
-        glEnableVertexAttribArray(1);
-        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(ModelVertex), (void*)offsetof(ModelVertex, normal));
-        glEnableVertexAttribArray(2);
-        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(ModelVertex), (void*)offsetof(ModelVertex, uv));
-        glBindVertexArray(0);
-        m_staticModelLibrary.push_back(mesh);
-        return true;
+        return uploadStaticModelMesh(name, loadModelTexture(texturePath), mesh.vertices, mesh.indices);
     }
 
     bool VoxelScene::loadStaticModelMeshGLB(const std::string &name, const std::string &glbPath)
     {
-        tinygltf::Model model;
-        tinygltf::TinyGLTF loader;
-        std::string warn;
-        std::string err;
-        if (!loader.LoadBinaryFromFile(&model, &err, &warn, glbPath))
-            return false;
-
-        const tinygltf::Mesh *meshRef = nullptr;
-        if (!model.meshes.empty())
-            meshRef = &model.meshes.front();
-        if (!meshRef || meshRef->primitives.empty())
-            return false;
-
-        const tinygltf::Primitive &primitive = meshRef->primitives.front();
-        auto posIt = primitive.attributes.find("POSITION");
-        if (posIt == primitive.attributes.end())
+        engine::resource::MeshData mesh;
+        if (!m_meshCache.load(glbPath, mesh))
             return false;
 
-        auto readVec3 = [&](int accessorIndex) -> std::vector<glm::vec3>
-        {
-            std::vector<glm::vec3> out;
-            const auto &accessor = model.accessors[static_cast<size_t>(accessorIndex)];
-            const auto &view = model.bufferViews[static_cast<size_t>(accessor.bufferView)];
-            const auto &buffer = model.buffers[static_cast<size_t>(view.buffer)];
-            const unsigned char *data = buffer.data.data() + view.byteOffset + accessor.byteOffset;
-            const size_t stride = accessor.ByteStride(view) > 0 ? static_cast<size_t>(accessor.ByteStride(view)) : sizeof(float) * 3;
-            out.resize(accessor.count);
-            for (size_t i = 0; i < accessor.count; ++i)
-            {
-                const float *src = reinterpret_cast<const float *>(data + i * stride);
-                out[i] = {src[0], src[1], src[2]};
-            }
-            return out;
-        };
-
-        auto readVec2 = [&](int accessorIndex) -> std::vector<glm::vec2>
+        unsigned int texture = 0;
+        if (!mesh.baseColor.empty())
         {
-            std::vector<glm::vec2> out;
-            const auto &accessor = model.accessors[static_cast<size_t>(accessorIndex)];
-            const auto &view = model.bufferViews[static_cast<size_t>(accessor.bufferView)];
-            const auto &buffer = model.buffers[static_cast<size_t>(view.buffer)];
-            const unsigned char *data = buffer.data.data() + view.byteOffset + accessor.byteOffset;
-            const size_t stride = accessor.ByteStride(view) > 0 ? static_cast<size_t>(accessor.ByteStride(view)) : sizeof(float) * 2;
-            out.resize(accessor.count);
-            for (size_t i = 0; i < accessor.count; ++i)
-            {
-                const float *src = reinterpret_cast<const float *>(data + i * stride);
-                out[i] = {src[0], 1.0f - src[1]};
-            }
-            return out;
-        };
-
-        std::vector<glm::vec3> positions = readVec3(posIt->second);
-        std::vector<glm::vec3> normals;
-        std::vector<glm::vec2> uvs;
-        if (auto normalIt = primitive.attributes.find("NORMAL"); normalIt != primitive.attributes.end())
-            normals = readVec3(normalIt->second);
-        if (auto uvIt = primitive.attributes.find("TEXCOORD_0"); uvIt != primitive.attributes.end())
-            uvs = readVec2(uvIt->second);
-
-        std::vector<uint32_t> indices;
-        if (primitive.indices >= 0)
-        {
-            const auto &accessor = model.accessors[static_cast<size_t>(primitive.indices)];
-            const auto &view = model.bufferViews[static_cast<size_t>(accessor.bufferView)];
-            const auto &buffer = model.buffers[static_cast<size_t>(view.buffer)];
-            const unsigned char *data = buffer.data.data() + view.byteOffset + accessor.byteOffset;
-            indices.resize(accessor.count);
-            for (size_t i = 0; i < accessor.count; ++i)
-            {
-                switch (accessor.componentType)
-                {
-                case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
-                    indices[i] = reinterpret_cast<const uint16_t *>(data)[i];
-                    break;
-                case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT:
-                    indices[i] = reinterpret_cast<const uint32_t *>(data)[i];
-                    break;
-                case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
-                    indices[i] = reinterpret_cast<const uint8_t *>(data)[i];
-                    break;
-                default:
-                    indices[i] = 0;
-                    break;
-                }
-            }
+            glGenTextures(1, &texture);
+            glBindTexture(GL_TEXTURE_2D, texture);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, mesh.baseColor.width, mesh.baseColor.height, 0, GL_RGBA,
+                         GL_UNSIGNED_BYTE, mesh.baseColor.rgba.data());
+            glBindTexture(GL_TEXTURE_2D, 0);
         }
         else
         {
-            indices.resize(positions.size());
-            for (size_t i = 0; i < positions.size(); ++i)
-                indices[i] = static_cast<uint32_t>(i);
+            texture = loadModelTexture(glbPath + "#fallback");
         }
 
-        std::vector<ModelVertex> vertices;
-        vertices.reserve(indices.size());
-        for (uint32_t index : indices)
-        {
-            if (index >= positions.size())
-                continue;
-            ModelVertex vertex{};
-            vertex.pos = positions[index];
-            vertex.normal = index < normals.size() ? normals[index] : glm::vec3(0.0f, 1.0f, 0.0f);
-            vertex.uv = index < uvs.size() ? uvs[index] : glm::vec2(0.0f);
-            vertices.push_back(vertex);
-        }
-        if (vertices.empty())
-            return false;
+        return uploadStaticModelMesh(name, texture, mesh.vertices, mesh.indices);
+    }
 
-        unsigned int texture = 0;
-        if (primitive.material >= 0)
-        {
-            const auto &material = model.materials[static_cast<size_t>(primitive.material)];
-            int textureIndex = material.pbrMetallicRoughness.baseColorTexture.index;
-            if (textureIndex >= 0 && textureIndex < static_cast<int>(model.textures.size()))
-            {
-                int imageIndex = model.textures[static_cast<size_t>(textureIndex)].source;
-                if (imageIndex >= 0 && imageIndex < static_cast<int>(model.images.size()))
-                {
-                    const auto &image = model.images[static_cast<size_t>(imageIndex)];
-                    if (!image.image.empty() && image.width > 0 && image.height > 0)
-                    {
-                        glGenTextures(1, &texture);
-                        glBindTexture(GL_TEXTURE_2D, texture);
-                        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-                        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-                        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-                        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-                        GLenum format = image.component == 4 ? GL_RGBA : (image.component == 3 ? GL_RGB : GL_RGBA);
-                        glTexImage2D(GL_TEXTURE_2D, 0, format, image.width, image.height, 0, format,
-                                     GL_UNSIGNED_BYTE, image.image.data());
-                        glBindTexture(GL_TEXTURE_2D, 0);
-                    }
-                }
-            }
-        }
-        if (texture == 0)
-            texture = loadModelTexture(glbPath + "#fallback");
+    bool VoxelScene::uploadStaticModelMesh(const std::string &name, unsigned int texture,
+                                           const std::vector<ModelVertex> &vertices, const std::vector<uint32_t> &indices)
+    {
+        if (vertices.empty() || indices.empty())
+            return false;
 
         StaticModelMesh mesh;
         mesh.name = name;
         mesh.texture = texture;
         mesh.vertexCount = static_cast<int>(vertices.size());
+        mesh.indexCount = static_cast<int>(indices.size());
         glGenVertexArrays(1, &mesh.vao);
         glGenBuffers(1, &mesh.vbo);
+        glGenBuffers(1, &mesh.ebo);
+        glGenBuffers(1, &mesh.instanceVbo);
         glBindVertexArray(mesh.vao);
         glBindBuffer(GL_ARRAY_BUFFER, mesh.vbo);
         glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(ModelVertex), vertices.data(), GL_STATIC_DRAW);
@@ -2029,8 +1889,29 @@ void main()
         glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(ModelVertex), (void*)offsetof(ModelVertex, normal));
         glEnableVertexAttribArray(2);
         glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(ModelVertex), (void*)offsetof(ModelVertex, uv));
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.ebo);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(uint32_t), indices.data(), GL_STATIC_DRAW);
+
+        // 每实例属性：mat4 占 4 个连续 location
+        glBindBuffer(GL_ARRAY_BUFFER, mesh.instanceVbo);
+        glBufferData(GL_ARRAY_BUFFER, 0, nullptr, GL_DYNAMIC_DRAW);
+        for (unsigned int column = 0; column < 4; ++column)
+        {
+            glEnableVertexAttribArray(3 + column);
+            glVertexAttribPointer(3 + column, 4, GL_FLOAT, GL_FALSE, sizeof(ModelInstance),
+                                  (void*)(offsetof(ModelInstance, model) + sizeof(glm::vec4) * column));
+            if (m_glVertexAttribDivisor)
+                m_glVertexAttribDivisor(3 + column, 1);
+        }
+        glEnableVertexAttribArray(7);
+        glVertexAttribPointer(7, 4, GL_FLOAT, GL_FALSE, sizeof(ModelInstance), (void*)offsetof(ModelInstance, tint));
+        if (m_glVertexAttribDivisor)
+            m_glVertexAttribDivisor(7, 1);
         glBindVertexArray(0);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
         m_staticModelLibrary.push_back(mesh);
+        m_modelInstancesDirty = true;
         return true;
     }
 
@@ -2041,6 +1922,18 @@ void main()
             glDeleteBuffers(1, &mesh.vbo);
             mesh.vbo = 0;
         }
+        if (mesh.ebo)
+        {
+            glDeleteBuffers(1, &mesh.ebo);
+            mesh.ebo = 0;
+        }
+        if (mesh.instanceVbo)
+        {
+            glDeleteBuffers(1, &mesh.instanceVbo);
+            mesh.instanceVbo = 0;
+        }
+        mesh.instanceCapacity = 0;
+        mesh.instanceCount = 0;
         if (mesh.vao)
         {
             glDeleteVertexArrays(1, &mesh.vao);
@@ -2052,6 +1945,7 @@ void main()
     {
         m_chunkMeshes.clear();
         m_activeChunkKeys.clear();
+        m_meshWorker = std::make_unique<VoxelMeshWorker>(1);
         glBindVertexArray(0);
     }
 
@@ -2072,7 +1966,14 @@ void main()
 
     bool VoxelScene::isSolid(int x, int y, int z) const
     {
-        return densityAt(x, y, z) > 0.08f;
+        if (!isInside(x, y, z))
+            return false;
+
+        glm::ivec2 chunkCoord = worldToChunkXZ(x, z);
+        const VoxelChunkMesh *chunk = findChunk(chunkCoord.x, chunkCoord.y);
+        if (!chunk || !chunk->generated)
+            return false;
+        return chunk->occupancy.test(x - chunkCoord.x * CHUNK_SIZE_X, y, z - chunkCoord.y * CHUNK_SIZE_Z);
     }
 
     float VoxelScene::densityAt(int x, int y, int z) const
@@ -2109,7 +2010,7 @@ void main()
 
     unsigned char VoxelScene::voxelAt(int x, int y, int z) const
     {
-        return densityAt(x, y, z) > 0.08f ? rawVoxelAt(x, y, z) : 0;
+        return isSolid(x, y, z) ? rawVoxelAt(x, y, z) : 0;
     }
 
     void VoxelScene::setVoxel(int x, int y, int z, unsigned char value)
@@ -2126,6 +2027,7 @@ void main()
         if (chunk.densities.empty())
             chunk.densities.assign(CHUNK_SIZE_X * WORLD_Y * CHUNK_SIZE_Z, 0.0f);
         chunk.densities[index] = value != 0 ? 1.0f : 0.0f;
+        chunk.occupancy.assign(localX, y, localZ, value != 0);
         markChunkDirtyAt(x, z);
     }
 
@@ -2176,6 +2078,7 @@ void main()
                     }
 
                     chunk.densities[index] = next;
+                    chunk.occupancy.assign(localX, y, localZ, next > kSolidDensity);
                     markChunkDirtyAt(x, z);
                     changed = true;
                 }
@@ -2221,91 +2124,76 @@ void main()
 
     void VoxelScene::rebuildChunkMesh(VoxelChunkMesh &chunk)
     {
-        std::vector<Vertex> vertices;
-        vertices.reserve(CHUNK_SIZE_X * WORLD_Y * CHUNK_SIZE_Z * 12);
-
-        const int startX = chunk.chunkX * CHUNK_SIZE_X;
-        const int endX = std::min(startX + CHUNK_SIZE_X, worldWidth());
-        const int startZ = chunk.chunkZ * CHUNK_SIZE_Z;
-        const int endZ = std::min(startZ + CHUNK_SIZE_Z, worldDepth());
-        const int sizeX = endX - startX;
-        const int sizeZ = endZ - startZ;
-
-        // ── 八方旅人风格：平面六面体网格（取消平滑插值，每个体素块逐面渲染）──
-        // 只输出非空体素的可见（邻接为空）面，使用法线和 AO 阴影着色
-        // 面朝向及其法线: +Z, -Z, -X, +X, +Y, -Y
-        static const glm::vec3 faceNormals[6] = {
-            { 0,  0,  1}, { 0,  0, -1},
-            {-1,  0,  0}, { 1,  0,  0},
-            { 0,  1,  0}, { 0, -1,  0},
-        };
-        static const glm::ivec3 faceNeighbors[6] = {
-            { 0,  0,  1}, { 0,  0, -1},
-            {-1,  0,  0}, { 1,  0,  0},
-            { 0,  1,  0}, { 0, -1,  0},
-        };
-        // 每个面的4个顶点（以体素坐标为原点，单位立方体角落）
-        static const glm::vec3 faceQuads[6][4] = {
-            {{0,0,1},{1,0,1},{1,1,1},{0,1,1}},  // +Z
-            {{1,0,0},{0,0,0},{0,1,0},{1,1,0}},  // -Z
-            {{0,0,0},{0,0,1},{0,1,1},{0,1,0}},  // -X
-            {{1,0,1},{1,0,0},{1,1,0},{1,1,1}},  // +X
-            {{0,1,1},{1,1,1},{1,1,0},{0,1,0}},  // +Y
-            {{0,0,0},{1,0,0},{1,0,1},{0,0,1}},  // -Y
-        };
-        // 每面两个三角形的顶点索引
-        static const int faceTriA[3] = {0,1,2};
-        static const int faceTriB[3] = {0,2,3};
+        // 同步路径：与工作线程使用同一套贪婪网格构建
+        const auto start = std::chrono::steady_clock::now();
+        fillPaddedChunk(chunk, m_meshScratchPadded);
+        VoxelMesher::build(m_meshScratchPadded, m_meshScratchVertices);
+        m_syncMeshBuildMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+        uploadChunkMesh(chunk, m_meshScratchVertices);
+        chunk.meshRevision = ++m_meshRevisionCounter; // 作废仍在途的异步结果
+        chunk.dirty = false;
+    }
 
-        // 顶面（+Y）稍亮，底面(-Y)和侧面稍暗，增加立体感
-        static const float faceBrightness[6] = {0.82f, 0.82f, 0.72f, 0.72f, 1.0f, 0.55f};
+    void VoxelScene::fillPaddedChunk(const VoxelChunkMesh &chunk, VoxelPaddedChunk &out) const
+    {
+        // 区块体素 + 四个水平邻块的一圈边界；上下边界在世界外，保持空气。
+        // 世界边缘外的体素在 generateChunk 中本就为 0，因此无需再按 worldWidth 裁剪。
+        out.reset(CHUNK_SIZE_X, WORLD_Y, CHUNK_SIZE_Z);
+        if (chunk.voxels.empty())
+            return;
 
-        for (int localZ = 0; localZ < sizeZ; ++localZ)
+        for (int z = 0; z < CHUNK_SIZE_Z; ++z)
         {
             for (int y = 0; y < WORLD_Y; ++y)
             {
-                for (int localX = 0; localX < sizeX; ++localX)
-                {
-                    int wx = startX + localX;
-                    int wz = startZ + localZ;
-                    unsigned char mat = rawVoxelAt(wx, y, wz);
-                    if (mat == 0) continue;
-
-                    glm::vec3 baseColor = blockColor(mat, 1.0f);
-                    glm::vec3 origin(static_cast<float>(wx),
-                                     static_cast<float>(y),
-                                     static_cast<float>(wz));
+                const unsigned char *src = &chunk.voxels[static_cast<size_t>(chunkVoxelIndex(0, y, z))];
+                std::copy_n(src, CHUNK_SIZE_X, &out.cells[static_cast<size_t>(out.index(0, y, z))]);
+            }
+        }
 
-                    for (int f = 0; f < 6; ++f)
-                    {
-                        const glm::ivec3 &nb = faceNeighbors[f];
-                        if (rawVoxelAt(wx + nb.x, y + nb.y, wz + nb.z) != 0)
-                            continue; // 邻接体素不透明，跳过该面
-
-                        glm::vec3 col   = baseColor * faceBrightness[f];
-                        glm::vec3 norm  = faceNormals[f];
-
-                        glm::vec3 q[4];
-                        for (int i = 0; i < 4; ++i)
-                            q[i] = origin + faceQuads[f][i];
-
-                        // 三角形 A
-                        vertices.push_back({q[faceTriA[0]], col, norm});
-                        vertices.push_back({q[faceTriA[1]], col, norm});
-                        vertices.push_back({q[faceTriA[2]], col, norm});
-                        // 三角形 B
-                        vertices.push_back({q[faceTriB[0]], col, norm});
-                        vertices.push_back({q[faceTriB[1]], col, norm});
-                        vertices.push_back({q[faceTriB[2]], col, norm});
-                    }
+        auto copyBorder = [&](int neighbourX, int neighbourZ, int srcLocalX, int srcLocalZ, int dstX, int dstZ, bool alongX) {
+            const VoxelChunkMesh *nb = findChunk(neighbourX, neighbourZ);
+            if (!nb || !nb->generated || nb->voxels.empty())
+                return;
+            const int count = alongX ? CHUNK_SIZE_X : CHUNK_SIZE_Z;
+            for (int y = 0; y < WORLD_Y; ++y)
+            {
+                for (int i = 0; i < count; ++i)
+                {
+                    const int sx = alongX ? i : srcLocalX;
+                    const int sz = alongX ? srcLocalZ : i;
+                    const int dx = alongX ? i : dstX;
+                    const int dz = alongX ? dstZ : i;
+                    out.set(dx, y, dz, nb->voxels[static_cast<size_t>(chunkVoxelIndex(sx, y, sz))]);
                 }
             }
-        }
+        };
+        copyBorder(chunk.chunkX - 1, chunk.chunkZ, CHUNK_SIZE_X - 1, 0, -1, 0, false);
+        copyBorder(chunk.chunkX + 1, chunk.chunkZ, 0, 0, CHUNK_SIZE_X, 0, false);
+        copyBorder(chunk.chunkX, chunk.chunkZ - 1, 0, CHUNK_SIZE_Z - 1, 0, -1, true);
+        copyBorder(chunk.chunkX, chunk.chunkZ + 1, 0, 0, 0, CHUNK_SIZE_Z, true);
+    }
 
+    void VoxelScene::uploadChunkMesh(VoxelChunkMesh &chunk, const std::vector<VoxelPackedVertex> &vertices)
+    {
         glBindBuffer(GL_ARRAY_BUFFER, chunk.vbo);
-        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), vertices.data(), GL_DYNAMIC_DRAW);
+        glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(VoxelPackedVertex), vertices.data(), GL_DYNAMIC_DRAW);
         chunk.vertexCount = static_cast<int>(vertices.size());
-        chunk.dirty = false;
+    }
+
+    void VoxelScene::integrateCompletedChunkMeshes()
+    {
+        if (!m_meshWorker)
+            return;
+
+        while (VoxelMeshJob *job = m_meshWorker->popCompleted())
+        {
+            // 区块已卸载，或提交后又被修改（已有更新的任务/同步重建）时丢弃
+            auto it = m_chunkMeshes.find(job->key);
+            if (it != m_chunkMeshes.end() && it->second.meshRevision == job->revision)
+                uploadChunkMesh(it->second, job->vertices);
+            m_meshWorker->release(job);
+        }
     }
 
     void VoxelScene::rebuildDirtyChunkMeshes()
@@ -2329,6 +2217,7 @@ void main()
             }
         }
 
+        integrateCompletedChunkMeshes();
         if (meshBudget <= 0)
             return;
 
@@ -2360,7 +2249,23 @@ void main()
             auto it = m_chunkMeshes.find(candidate.key);
             if (it == m_chunkMeshes.end() || !it->second.dirty || !it->second.generated)
                 continue;
-            rebuildChunkMesh(it->second);
+            VoxelChunkMesh &chunk = it->second;
+            if (m_asyncChunkMeshing && m_meshWorker)
+            {
+                // 主线程只拷贝带边界的体素（约 8KB），网格构建交给工作线程；
+                // 预算按在途任务数限制，而非每帧重建数
+                if (m_meshWorker->inFlight() >= m_maxMeshJobsInFlight)
+                    break;
+                VoxelMeshJob *job = m_meshWorker->acquire();
+                job->key = candidate.key;
+                job->revision = ++m_meshRevisionCounter;
+                fillPaddedChunk(chunk, job->padded);
+                chunk.meshRevision = job->revision;
+                chunk.dirty = false;
+                m_meshWorker->submit(job);
+                continue;
+            }
+            rebuildChunkMesh(chunk);
             if (++rebuiltCount >= meshBudget)
                 break;
         }
@@ -2570,11 +2475,7 @@ void main()
             glBindBuffer(GL_ARRAY_BUFFER, chunk.vbo);
             glBufferData(GL_ARRAY_BUFFER, 0, nullptr, GL_DYNAMIC_DRAW);
             glEnableVertexAttribArray(0);
-            glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, pos));
-            glEnableVertexAttribArray(1);
-            glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, color));
-            glEnableVertexAttribArray(2);
-            glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, normal));
+            glVertexAttribPointer(0, 4, GL_UNSIGNED_BYTE, GL_FALSE, sizeof(VoxelPackedVertex), (void*)0);
             glBindVertexArray(0);
         }
 
@@ -2731,11 +2632,27 @@ void main()
             }
         }
 
+        rebuildChunkOccupancy(chunk);
         chunk.generated = true;
         chunk.densityCacheDirty = true;
         chunk.dirty = true;
     }
 
+    void VoxelScene::rebuildChunkOccupancy(VoxelChunkMesh &chunk)
+    {
+        chunk.occupancy.clear();
+        for (int z = 0; z < CHUNK_SIZE_Z; ++z)
+            for (int y = 0; y < WORLD_Y; ++y)
+                for (int x = 0; x < CHUNK_SIZE_X; ++x)
+                {
+                    const int index = chunkVoxelIndex(x, y, z);
+                    const bool solid = chunk.densities.empty() ? chunk.voxels[index] != 0
+                                                               : chunk.densities[index] > kSolidDensity;
+                    if (solid)
+                        chunk.occupancy.assign(x, y, z, true);
+                }
+    }
+
     void VoxelScene::markChunkDirtyAt(int x, int z)
     {
         glm::ivec2 chunkCoord = worldToChunkXZ(x, z);
@@ -3021,6 +2938,7 @@ void main()
     void VoxelScene::populateRouteModels()
     {
         m_worldModels.clear();
+        m_modelInstancesDirty = true;
         if (m_staticModelLibrary.empty() || !m_routeData.isValid())
             return;
 
@@ -3133,56 +3051,126 @@ void main()
         default:
             break;
         }
+        if (model.consumed)
+            m_modelInstancesDirty = true;
+    }
+
+    void VoxelScene::rebuildModelInstances()
+    {
+        m_modelInstanceGroups.resize(m_staticModelLibrary.size());
+        for (auto &group : m_modelInstanceGroups)
+            group.clear();
+
+        auto collect = [&](const std::vector<PlacedModel> &models)
+        {
+            for (const PlacedModel &placed : models)
+            {
+                if (placed.consumed || placed.meshIndex >= m_staticModelLibrary.size())
+                    continue;
+                m_modelInstanceGroups[placed.meshIndex].push_back(
+                    {placedModelMatrix(placed.position, placed.yawDegrees, placed.scale), glm::vec4(placed.tint, 1.0f)});
+            }
+        };
+        collect(m_worldModels);
+        collect(m_stressModels);
+
+        for (size_t meshIndex = 0; meshIndex < m_staticModelLibrary.size(); ++meshIndex)
+        {
+            StaticModelMesh &mesh = m_staticModelLibrary[meshIndex];
+            const auto &group = m_modelInstanceGroups[meshIndex];
+            mesh.instanceCount = group.size();
+            if (group.empty() || !mesh.instanceVbo)
+                continue;
+            glBindBuffer(GL_ARRAY_BUFFER, mesh.instanceVbo);
+            if (group.size() > mesh.instanceCapacity)
+            {
+                glBufferData(GL_ARRAY_BUFFER, group.size() * sizeof(ModelInstance), group.data(), GL_DYNAMIC_DRAW);
+                mesh.instanceCapacity = group.size();
+            }
+            else
+            {
+                glBufferSubData(GL_ARRAY_BUFFER, 0, group.size() * sizeof(ModelInstance), group.data());
+            }
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        m_modelInstancesDirty = false;
+    }
+
+    void VoxelScene::scatterStressModels(int count)
+    {
+        m_stressModels.clear();
+        m_modelInstancesDirty = true;
+        if (count <= 0 || m_staticModelLibrary.empty())
+            return;
+
+        // 以玩家为中心撒在已加载的区块范围内，落在地表上
+        const float radius = static_cast<float>(LOAD_CHUNK_RADIUS * CHUNK_SIZE_X);
+        m_stressModels.reserve(static_cast<size_t>(count));
+        for (int i = 0; i < count; ++i)
+        {
+            PlacedModel placed;
+            placed.meshIndex = static_cast<size_t>(nextRand() % m_staticModelLibrary.size());
+            placed.position.x = std::clamp(m_cameraPos.x + (randFloat() * 2.0f - 1.0f) * radius, 1.0f, static_cast<float>(worldWidth() - 1));
+            placed.position.z = std::clamp(m_cameraPos.z + (randFloat() * 2.0f - 1.0f) * radius, 1.0f, static_cast<float>(worldDepth() - 1));
+            const int groundY = findGroundY(static_cast<int>(std::floor(placed.position.x)), static_cast<int>(std::floor(placed.position.z)));
+            placed.position.y = static_cast<float>(std::max(groundY + 1, 1));
+            placed.yawDegrees = randFloat() * 360.0f;
+            placed.scale = 2.5f + randFloat() * 2.0f;
+            placed.tint = glm::vec3(0.75f) + glm::vec3(randFloat(), randFloat(), randFloat()) * 0.25f;
+            m_stressModels.push_back(placed);
+        }
     }
 
     void VoxelScene::renderStaticModels(const glm::mat4 &proj, const glm::mat4 &view, const glm::vec3 &renderCamera,
                                         const glm::vec3 &lightDir, const glm::vec3 &fogColor,
                                         float ambientStrength, float diffuseStrength, float fogNear, float fogFar, float flash)
     {
-        if (m_modelShader == 0 || m_worldModels.empty())
+        m_modelRenderStats = {};
+        if (m_modelShader == 0 || !m_glDrawElementsInstanced)
             return;
+        if (m_worldModels.empty() && m_stressModels.empty())
+            return;
+
+        const auto submitStart = std::chrono::steady_clock::now();
+        if (m_modelInstancesDirty)
+            rebuildModelInstances();
 
         glUseProgram(m_modelShader);
-        glUniform1i(glGetUniformLocation(m_modelShader, "uTex"), 0);
+        glUniform1i(m_modelUniforms.tex, 0);
+        const glm::mat4 viewProj = proj * view;
+        glUniformMatrix4fv(m_modelUniforms.viewProj, 1, GL_FALSE, glm::value_ptr(viewProj));
         if (m_glUniform3fv)
         {
-            m_glUniform3fv(glGetUniformLocation(m_modelShader, "uLightDir"), 1, glm::value_ptr(lightDir));
-            m_glUniform3fv(glGetUniformLocation(m_modelShader, "uCameraPos"), 1, glm::value_ptr(renderCamera));
-            m_glUniform3fv(glGetUniformLocation(m_modelShader, "uFogColor"), 1, glm::value_ptr(fogColor));
+            m_glUniform3fv(m_modelUniforms.lightDir, 1, glm::value_ptr(lightDir));
+            m_glUniform3fv(m_modelUniforms.cameraPos, 1, glm::value_ptr(renderCamera));
+            m_glUniform3fv(m_modelUniforms.fogColor, 1, glm::value_ptr(fogColor));
         }
         if (m_glUniform1f)
         {
-            m_glUniform1f(glGetUniformLocation(m_modelShader, "uAmbientStrength"), ambientStrength);
-            m_glUniform1f(glGetUniformLocation(m_modelShader, "uDiffuseStrength"), diffuseStrength);
-            m_glUniform1f(glGetUniformLocation(m_modelShader, "uFogNear"), fogNear);
-            m_glUniform1f(glGetUniformLocation(m_modelShader, "uFogFar"), fogFar);
-            m_glUniform1f(glGetUniformLocation(m_modelShader, "uFlash"), flash);
+            m_glUniform1f(m_modelUniforms.ambientStrength, ambientStrength);
+            m_glUniform1f(m_modelUniforms.diffuseStrength, diffuseStrength);
+            m_glUniform1f(m_modelUniforms.fogNear, fogNear);
+            m_glUniform1f(m_modelUniforms.fogFar, fogFar);
+            m_glUniform1f(m_modelUniforms.flash, flash);
         }
 
+        // 每个网格一次实例化绘制
         glActiveTexture(GL_TEXTURE0);
-        for (const PlacedModel &placed : m_worldModels)
+        for (const StaticModelMesh &mesh : m_staticModelLibrary)
         {
-            if (placed.consumed)
-                continue;
-            if (placed.meshIndex >= m_staticModelLibrary.size())
-                continue;
-            const StaticModelMesh &mesh = m_staticModelLibrary[placed.meshIndex];
-            if (mesh.vertexCount <= 0)
+            if (mesh.instanceCount == 0 || mesh.indexCount <= 0)
                 continue;
-
-            glm::mat4 model = glm::translate(glm::mat4(1.0f), placed.position);
-            model = glm::rotate(model, glm::radians(placed.yawDegrees), glm::vec3(0.0f, 1.0f, 0.0f));
-            model = glm::scale(model, glm::vec3(placed.scale));
-            glm::mat4 mvp = proj * view * model;
-            glUniformMatrix4fv(glGetUniformLocation(m_modelShader, "uMVP"), 1, GL_FALSE, glm::value_ptr(mvp));
-            glUniformMatrix4fv(glGetUniformLocation(m_modelShader, "uModel"), 1, GL_FALSE, glm::value_ptr(model));
             glBindTexture(GL_TEXTURE_2D, mesh.texture);
             glBindVertexArray(mesh.vao);
-            if (m_glDrawArrays)
-                m_glDrawArrays(GL_TRIANGLES, 0, mesh.vertexCount);
+            m_glDrawElementsInstanced(GL_TRIANGLES, mesh.indexCount, GL_UNSIGNED_INT, nullptr,
+                                      static_cast<int>(mesh.instanceCount));
+            ++m_modelRenderStats.drawCalls;
+            m_modelRenderStats.instances += static_cast<int>(mesh.instanceCount);
         }
         glBindVertexArray(0);
         glBindTexture(GL_TEXTURE_2D, 0);
+        m_modelRenderStats.submitMs =
+            std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - submitStart).count();
     }
 
     void VoxelScene::spawnMonster()
@@ -3228,27 +3216,40 @@ void main()
         return glm::normalize(glm::cross(getForward(), glm::vec3(0.0f, 1.0f, 0.0f)));
     }
 
+    const VoxelOccupancy *VoxelScene::ChunkOccupancyLookup::operator()(int chunkX, int chunkZ) const
+    {
+        const VoxelChunkMesh *chunk = scene->findChunk(chunkX, chunkZ);
+        return chunk && chunk->generated ? &chunk->occupancy : nullptr;
+    }
+
+    VoxelScene::OccupancyCursor VoxelScene::occupancyCursor() const
+    {
+        return OccupancyCursor(ChunkOccupancyLookup{this}, worldWidth(), worldDepth());
+    }
+
+    VoxelRayHit VoxelScene::raycastVoxels(const glm::vec3 &origin, const glm::vec3 &dir, float maxDistance) const
+    {
+        const float length = glm::length(dir);
+        VoxelRay ray{origin, length > 1e-6f ? dir / length : glm::vec3(0.0f), maxDistance};
+        return traceVoxelRay(ray, occupancyCursor());
+    }
+
+    void VoxelScene::raycastVoxels(const VoxelRay *rays, size_t count, VoxelRayHit *hits) const
+    {
+        traceVoxelRays(rays, count, hits, occupancyCursor());
+    }
+
     VoxelScene::TargetBlock VoxelScene::raycastBlock() const
     {
         TargetBlock result;
-        glm::vec3 origin = m_cameraPos;
-        glm::vec3 dir = getForward();
-        glm::vec3 lastAir = origin;
-
-        for (float t = 0.0f; t < 8.0f; t += 0.08f)
+        const VoxelRayHit hit = raycastVoxels(m_cameraPos, getForward(), kBlockReach);
+        if (hit.hit)
         {
-            glm::vec3 sample = origin + dir * t;
-            glm::ivec3 block = glm::floor(sample);
-            if (isSolid(block.x, block.y, block.z))
-            {
-                result.hit = true;
-                result.block = block;
-                result.place = glm::floor(lastAir);
-                return result;
-            }
-            lastAir = sample;
+            result.hit = true;
+            result.block = hit.cell;
+            result.normal = hit.normal;
+            result.place = hit.cell + hit.normal;
         }
-
         return result;
     }
 
@@ -3514,8 +3515,12 @@ void main()
         if (m_skillProjectiles.empty())
             return;
 
-        for (auto &proj : m_skillProjectiles)
+        // 1. 运动积分，收集本帧位移线段；所有投射物的地形碰撞合成一批射线检测
+        std::vector<VoxelRay> rays(m_skillProjectiles.size());
+        std::vector<VoxelRayHit> hits(m_skillProjectiles.size());
+        for (size_t index = 0; index < m_skillProjectiles.size(); ++index)
         {
+            auto &proj = m_skillProjectiles[index];
             proj.age += dt;
             proj.lastWorldPos = proj.worldPos;
             proj.velocity.y -= kFireProjectileGravity * dt;
@@ -3533,24 +3538,29 @@ void main()
                 m_fireTrailParticles.push_back(particle);
             }
 
+            glm::vec3 segment = proj.worldPos - proj.lastWorldPos;
+            float segmentLength = glm::length(segment);
+            VoxelRay &ray = rays[index];
+            ray.origin = proj.lastWorldPos;
+            ray.dir = segmentLength > 1e-6f ? segment / segmentLength : forward;
+            // 刚出手的投射物还在施法点附近，不做碰撞
+            ray.maxDistance = proj.age > 0.04f ? segmentLength : -1.0f;
+        }
+        raycastVoxels(rays.data(), rays.size(), hits.data());
+
+        // 2. 结算命中 / 抵达目标 / 超时
+        for (size_t index = 0; index < m_skillProjectiles.size(); ++index)
+        {
+            auto &proj = m_skillProjectiles[index];
             bool explode = false;
             glm::vec3 impactPos = proj.worldPos;
 
-            if (proj.age > 0.04f)
+            const VoxelRayHit &hit = hits[index];
+            if (rays[index].maxDistance >= 0.0f && hit.hit)
             {
-                constexpr int kSamples = 5;
-                for (int sample = 1; sample <= kSamples; ++sample)
-                {
-                    float t = static_cast<float>(sample) / static_cast<float>(kSamples);
-                    glm::vec3 probe = glm::mix(proj.lastWorldPos, proj.worldPos, t);
-                    glm::ivec3 block = glm::floor(probe);
-                    if (isInside(block.x, block.y, block.z) && isSolid(block.x, block.y, block.z))
-                    {
-                        impactPos = probe - glm::normalize(proj.velocity) * 0.15f;
-                        explode = true;
-                        break;
-                    }
-                }
+                glm::vec3 entry = rays[index].origin + rays[index].dir * hit.distance;
+                impactPos = entry - glm::normalize(proj.velocity) * 0.15f;
+                explode = true;
             }
 
             glm::vec3 travel = proj.targetPos - proj.originPos;
@@ -5498,10 +5508,37 @@ void main()
         ImGui::Text("活跃区块: %d", static_cast<int>(m_activeChunkKeys.size()));
         ImGui::Text("待加载队列: %d", static_cast<int>(m_pendingChunkLoads.size()));
         ImGui::Text("已生成/脏区块: %d / %d", static_cast<int>(generatedChunks), static_cast<int>(dirtyChunks));
-        ImGui::Text("总顶点数: %d", static_cast<int>(totalVertices));
+        ImGui::Text("总顶点数: %d (显存 %.1f KB, %d B/顶点)", static_cast<int>(totalVertices),
+            static_cast<float>(totalVertices * sizeof(VoxelPackedVertex)) / 1024.0f,
+            static_cast<int>(sizeof(VoxelPackedVertex)));
+        if (m_asyncChunkMeshing && m_meshWorker)
+        {
+            const VoxelMeshStats meshStats = m_meshWorker->getStats();
+            ImGui::Text("网格线程: 排队 %d / 在途 %d / 已构建 %llu",
+                static_cast<int>(meshStats.queuedJobs), static_cast<int>(meshStats.inFlightJobs),
+                static_cast<unsigned long long>(meshStats.builtTotal));
+            ImGui::Text("网格构建: 平均 %.3f ms / 最近 %.3f ms", meshStats.buildAvgMs, meshStats.buildLastMs);
+        }
+        else
+        {
+            ImGui::Text("网格构建(同步): 最近 %.3f ms", m_syncMeshBuildMs);
+        }
+        ImGui::Checkbox("后台构建区块网格", &m_asyncChunkMeshing);
         ImGui::Text("区块CPU内存: %.2f MB", totalChunkMB);
         ImGui::Text("怪物/背包槽位: %d / %d", static_cast<int>(m_monsters.size()), m_inventory.getSlotCount());
 
+        ImGui::SeparatorText("静态模型");
+        ImGui::Text("网格/摆放: %d / %d (压力测试 %d)", static_cast<int>(m_staticModelLibrary.size()),
+            static_cast<int>(m_worldModels.size() + m_stressModels.size()), static_cast<int>(m_stressModels.size()));
+        ImGui::Text("实例化绘制: %d draw call / %d 实例, CPU 提交 %.3f ms",
+            m_modelRenderStats.drawCalls, m_modelRenderStats.instances, m_modelRenderStats.submitMs);
+        ImGui::SliderInt("压力测试道具数", &m_stressModelCount, 1000, 50000);
+        if (ImGui::Button("撒布压力测试道具"))
+            scatterStressModels(m_stressModelCount);
+        ImGui::SameLine();
+        if (ImGui::Button("清除压力测试道具"))
+            scatterStressModels(0);
+
         ImGui::SeparatorText("输入管理器");
         ImGui::Text("动作绑定: %d", static_cast<int>(inputStats.actionBindingCount));
         ImGui::Text("输入映射: %d", static_cast<int>(inputStats.inputBindingCount));
@@ -5527,6 +5564,14 @@ void main()
         ImGui::Text("字体/着色器: %d / %d",
             static_cast<int>(resourceStats.fontCount),
             static_cast<int>(resourceStats.shaderCount));
+        ImGui::Text("纹理句柄: 已驻留路径 %d", static_cast<int>(resourceStats.textureHandleCount));
+        ImGui::Text("音效/语音: 预解码 %d，发声 %d / %d",
+            static_cast<int>(resourceStats.soundCount),
+            resourceStats.activeVoices,
+            resourceStats.voiceCount);
+        ImGui::Text("异步纹理: 在途 %d，上帧上传 %.1f KB",
+            static_cast<int>(resourceStats.pendingTextureCount),
+            static_cast<float>(resourceStats.textureUploadBytesLastFrame) / 1024.0f);
 
         ImGui::SeparatorText("玩法系统");
         ImGui::Text("天气/时段: %s / %s", m_weatherSystem.getCurrentWeatherName(), m_timeOfDaySystem.getPhaseName());
@@ -5783,7 +5828,7 @@ void main()
             ImGui::End();
         }
 
-        m_weatherSystem.render(ImGui::GetIO().DisplaySize.x, ImGui::GetIO().DisplaySize.y);
+        m_weatherSystem.render(&_context.getRenderer(), ImGui::GetIO().DisplaySize.x, ImGui::GetIO().DisplaySize.y);
 
         ImDrawList *dl = ImGui::GetForegroundDrawList();
         ImVec2 center = {ImGui::GetIO().DisplaySize.x * 0.5f, ImGui::GetIO().DisplaySize.y * 0.5f};
@@ -6224,21 +6269,21 @@ void main()
         float fogFar = 20.0f + skyVisibility * 26.0f;
         float flash = m_weatherSystem.getCurrentWeather() == game::weather::WeatherType::Thunderstorm ? (1.0f - skyVisibility) * 0.25f : 0.0f;
 
-        glUseProgram(m_shader);
-        glUniformMatrix4fv(glGetUniformLocation(m_shader, "uMVP"), 1, GL_FALSE, glm::value_ptr(mvp));
+        glUseProgram(m_chunkShader);
+        glUniformMatrix4fv(glGetUniformLocation(m_chunkShader, "uMVP"), 1, GL_FALSE, glm::value_ptr(mvp));
         if (m_glUniform3fv)
         {
-            m_glUniform3fv(glGetUniformLocation(m_shader, "uLightDir"), 1, glm::value_ptr(lightDir));
-            m_glUniform3fv(glGetUniformLocation(m_shader, "uCameraPos"), 1, glm::value_ptr(renderCamera));
-            m_glUniform3fv(glGetUniformLocation(m_shader, "uFogColor"), 1, glm::value_ptr(fogColor));
+            m_glUniform3fv(glGetUniformLocation(m_chunkShader, "uLightDir"), 1, glm::value_ptr(lightDir));
+            m_glUniform3fv(glGetUniformLocation(m_chunkShader, "uCameraPos"), 1, glm::value_ptr(renderCamera));
+            m_glUniform3fv(glGetUniformLocation(m_chunkShader, "uFogColor"), 1, glm::value_ptr(fogColor));
         }
         if (m_glUniform1f)
         {
-            m_glUniform1f(glGetUniformLocation(m_shader, "uAmbientStrength"), ambientStrength);
-            m_glUniform1f(glGetUniformLocation(m_shader, "uDiffuseStrength"), diffuseStrength);
-            m_glUniform1f(glGetUniformLocation(m_shader, "uFogNear"), fogNear);
-            m_glUniform1f(glGetUniformLocation(m_shader, "uFogFar"), fogFar);
-            m_glUniform1f(glGetUniformLocation(m_shader, "uFlash"), flash);
+            m_glUniform1f(glGetUniformLocation(m_chunkShader, "uAmbientStrength"), ambientStrength);
+            m_glUniform1f(glGetUniformLocation(m_chunkShader, "uDiffuseStrength"), diffuseStrength);
+            m_glUniform1f(glGetUniformLocation(m_chunkShader, "uFogNear"), fogNear);
+            m_glUniform1f(glGetUniformLocation(m_chunkShader, "uFogFar"), fogFar);
+            m_glUniform1f(glGetUniformLocation(m_chunkShader, "uFlash"), flash);
         }
         for (int64_t chunkKeyValue : m_activeChunkKeys)
         {
@@ -6246,9 +6291,16 @@ void main()
             if (it == m_chunkMeshes.end())
                 continue;
             const auto &chunk = it->second;
+            if (!m_glDrawArrays || chunk.vertexCount <= 0)
+                continue;
+            if (m_glUniform3fv)
+            {
+                const glm::vec3 origin(static_cast<float>(chunk.chunkX * CHUNK_SIZE_X), 0.0f,
+                                       static_cast<float>(chunk.chunkZ * CHUNK_SIZE_Z));
+                m_glUniform3fv(m_chunkOriginLoc, 1, glm::value_ptr(origin));
+            }
             glBindVertexArray(chunk.vao);
-            if (m_glDrawArrays && chunk.vertexCount > 0)
-                m_glDrawArrays(GL_TRIANGLES, 0, chunk.vertexCount);
+            m_glDrawArrays(GL_TRIANGLES, 0, chunk.vertexCount);
         }
         renderStaticModels(proj, view, renderCamera, lightDir, fogColor, ambientStrength, diffuseStrength, fogNear, fogFar, flash);
         renderSkillEffects3D(proj, view, renderCamera, lightDir, fogColor, ambientStrength, diffuseStrength, fogNear, fogFar, flash);
@@ -6310,11 +6362,17 @@ void main()
 
     void VoxelScene::clean()
     {
+        m_meshWorker.reset();
         if (m_shader)
         {
             glDeleteProgram(m_shader);
             m_shader = 0;
         }
+        if (m_chunkShader)
+        {
+            glDeleteProgram(m_chunkShader);
+            m_chunkShader = 0;
+        }
         if (m_modelShader)
         {
             glDeleteProgram(m_modelShader);
@@ -6363,6 +6421,9 @@ void main()
             m_dashGradientBTexture = 0;
         }
         m_worldModels.clear();
+        m_stressModels.clear();
+        m_modelInstanceGroups.clear();
+        m_modelInstancesDirty = true;
         if (m_monsterVbo)
         {
             glDeleteBuffers(1, &m_monsterVbo);
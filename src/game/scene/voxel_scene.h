@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../../engine/resource/mesh_cache.h"
 #include "../../engine/scene/scene.h"
 #include "../inventory/inventory.h"
 #include "../route/route_data.h"
@@ -7,10 +8,13 @@
 #include "../skill/star_skill.h"
 #include "../world/time_of_day_system.h"
 #include "../weather/weather_system.h"
+#include "voxel_mesher.h"
+#include "voxel_raycast.h"
 #include <SDL3/SDL.h>
 #include <cstdint>
 #include <glm/glm.hpp>
 #include <array>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -36,12 +40,7 @@ namespace game::scene
             glm::vec3 normal;
         };
 
-        struct ModelVertex
-        {
-            glm::vec3 pos;
-            glm::vec3 normal;
-            glm::vec2 uv;
-        };
+        using ModelVertex = engine::resource::MeshVertex;
 
         struct DashStarVertex
         {
@@ -55,8 +54,20 @@ namespace game::scene
             std::string name;
             unsigned int vao = 0;
             unsigned int vbo = 0;
+            unsigned int ebo = 0;
+            unsigned int instanceVbo = 0; // ModelInstance 数组，VAO 内 divisor = 1
             unsigned int texture = 0;
             int vertexCount = 0;
+            int indexCount = 0;
+            size_t instanceCapacity = 0;  // instanceVbo 已分配的实例数
+            size_t instanceCount = 0;     // 最近一次上传的实例数
+        };
+
+        /** 静态模型每实例数据（location 3..6 = 模型矩阵列，7 = 染色） */
+        struct ModelInstance
+        {
+            glm::mat4 model{1.0f};
+            glm::vec4 tint{1.0f};
         };
 
         struct PlacedModel
@@ -69,6 +80,7 @@ namespace game::scene
             std::string prompt;
             uint8_t interactionType = 0;
             bool consumed = false;
+            glm::vec3 tint{1.0f};
         };
 
         struct SkillVFX
@@ -138,12 +150,14 @@ namespace game::scene
             unsigned int vao = 0;
             unsigned int vbo = 0;
             int vertexCount = 0;
+            uint64_t meshRevision = 0; // 最近一次提交的网格任务版本，过期结果直接丢弃
             bool dirty = true;
             bool densityCacheDirty = true;
             bool generated = false;
             std::vector<unsigned char> voxels;
             std::vector<float> densities;
             std::vector<float> cornerDensityCache;
+            VoxelOccupancy occupancy; // densities > 阈值 的实心位图，随密度写入同步
         };
 
         enum class SettingsPage : uint8_t
@@ -168,7 +182,16 @@ namespace game::scene
             bool hit = false;
             glm::ivec3 block{0, 0, 0};
             glm::ivec3 place{0, 0, 0};
+            glm::ivec3 normal{0, 0, 0}; // 命中面法线，place = block + normal
+        };
+
+        // 射线检测用的区块位图查询（见 VoxelOccupancyCursor）
+        struct ChunkOccupancyLookup
+        {
+            const VoxelScene *scene = nullptr;
+            const VoxelOccupancy *operator()(int chunkX, int chunkZ) const;
         };
+        using OccupancyCursor = VoxelOccupancyCursor<ChunkOccupancyLookup>;
 
         static constexpr int WORLD_Y = 24;
         static constexpr int CHUNK_SIZE_X = 16;
@@ -178,7 +201,24 @@ namespace game::scene
 
         SDL_GLContext m_glContext = nullptr;
         unsigned int m_shader = 0;
+        unsigned int m_chunkShader = 0;   // 区块专用：解码 VoxelPackedVertex
+        int m_chunkOriginLoc = -1;
         unsigned int m_modelShader = 0;
+        // 模型着色器 uniform 位置，链接后查询一次
+        struct ModelShaderUniforms
+        {
+            int viewProj = -1;
+            int tex = -1;
+            int lightDir = -1;
+            int cameraPos = -1;
+            int fogColor = -1;
+            int ambientStrength = -1;
+            int diffuseStrength = -1;
+            int fogNear = -1;
+            int fogFar = -1;
+            int flash = -1;
+        };
+        ModelShaderUniforms m_modelUniforms;
         unsigned int m_dashStarShader = 0;
         unsigned int m_dashScreenShader = 0;
         unsigned int m_fireFieldShader = 0;
@@ -232,6 +272,8 @@ namespace game::scene
         using Uniform2fProc = void(*)(int, float, float);
         using BlendFuncProc = void(*)(unsigned int, unsigned int);
         using DepthMaskProc = void(*)(unsigned char);
+        using DrawElementsInstancedProc = void(*)(unsigned int, int, unsigned int, const void *, int);
+        using VertexAttribDivisorProc = void(*)(unsigned int, unsigned int);
         // HD-2D: FBO function pointer types
         using GenFramebuffersProc      = void(*)(int, unsigned int*);
         using BindFramebufferProc      = void(*)(unsigned int, unsigned int);
@@ -249,6 +291,8 @@ namespace game::scene
         Uniform2fProc m_glUniform2f = nullptr;
         BlendFuncProc m_glBlendFunc = nullptr;
         DepthMaskProc m_glDepthMask = nullptr;
+        DrawElementsInstancedProc m_glDrawElementsInstanced = nullptr;
+        VertexAttribDivisorProc m_glVertexAttribDivisor = nullptr;
         // HD-2D: FBO function pointers
         GenFramebuffersProc      m_glGenFramebuffers      = nullptr;
         BindFramebufferProc      m_glBindFramebuffer      = nullptr;
@@ -264,7 +308,21 @@ namespace game::scene
         std::unordered_map<std::string, unsigned int> m_modelTextures;
         std::vector<int64_t> m_activeChunkKeys;
         std::vector<StaticModelMesh> m_staticModelLibrary;
+        engine::resource::MeshCache m_meshCache{"cache/meshes"}; // 模型导入结果的二进制缓存
         std::vector<PlacedModel> m_worldModels;
+
+        // 静态模型实例化：摆放按网格分组写入各网格的实例缓冲，摆放变化时才重建
+        struct ModelRenderStats
+        {
+            int drawCalls = 0;
+            int instances = 0;
+            float submitMs = 0.0f;
+        };
+        std::vector<std::vector<ModelInstance>> m_modelInstanceGroups; // 下标 = meshIndex
+        bool m_modelInstancesDirty = true;
+        std::vector<PlacedModel> m_stressModels; // 压力测试道具（不可交互）
+        int m_stressModelCount = 10000;
+        ModelRenderStats m_modelRenderStats;
         glm::vec3 m_cameraPos{24.0f, 11.0f, 42.0f};
         float m_yaw = -90.0f;
         float m_pitch = -30.0f;          // Octopath: more top-down diorama angle
@@ -297,6 +355,15 @@ namespace game::scene
         float m_thirdPersonDistance = 7.0f;  // Octopath: wider stage view
         int m_chunkLoadBudget = 3;
         int m_chunkMeshBudget = 2;
+
+        // 区块网格：后台线程贪婪构建，主线程只上传
+        std::unique_ptr<VoxelMeshWorker> m_meshWorker;
+        bool m_asyncChunkMeshing = true;
+        size_t m_maxMeshJobsInFlight = 8;
+        uint64_t m_meshRevisionCounter = 0;
+        VoxelPaddedChunk m_meshScratchPadded;               // 同步路径复用
+        std::vector<VoxelPackedVertex> m_meshScratchVertices;
+        float m_syncMeshBuildMs = 0.0f;
         SettingsPage m_settingsPage = SettingsPage::World;
         SetupPhase m_setupPhase = SetupPhase::PlanetSelect;
         game::route::RouteData m_routeData;
@@ -356,6 +423,9 @@ namespace game::scene
         void generateWorld();
         void rebuildMesh();
         void rebuildChunkMesh(VoxelChunkMesh &chunk);
+        void fillPaddedChunk(const VoxelChunkMesh &chunk, VoxelPaddedChunk &out) const;
+        void uploadChunkMesh(VoxelChunkMesh &chunk, const std::vector<VoxelPackedVertex> &vertices);
+        void integrateCompletedChunkMeshes();
         void rebuildDirtyChunkMeshes();
         void updateStreamedChunks();
         void releaseChunk(VoxelChunkMesh &chunk);
@@ -445,14 +515,22 @@ namespace game::scene
         void setVoxel(int x, int y, int z, unsigned char value);
         bool applyDensityBrush(const glm::vec3 &center, float radius, float delta, unsigned char fillMaterial);
         void updateChunkDensityCache(VoxelChunkMesh &chunk);
+        void rebuildChunkOccupancy(VoxelChunkMesh &chunk);
+        OccupancyCursor occupancyCursor() const;
         unsigned int loadModelTexture(const std::string &path);
         bool loadStaticModelMesh(const std::string &name, const std::string &objPath, const std::string &texturePath);
         bool loadStaticModelMeshGLB(const std::string &name, const std::string &glbPath);
+        bool uploadStaticModelMesh(const std::string &name, unsigned int texture,
+                                   const std::vector<ModelVertex> &vertices, const std::vector<uint32_t> &indices);
         void releaseStaticModelMesh(StaticModelMesh &mesh);
+        void rebuildModelInstances();
+        void scatterStressModels(int count);
 
         glm::vec3 getForward() const;
         glm::vec3 getRight() const;
         glm::vec3 blockColor(unsigned char type, float shade) const;
         TargetBlock raycastBlock() const;
+        VoxelRayHit raycastVoxels(const glm::vec3 &origin, const glm::vec3 &dir, float maxDistance) const;
+        void raycastVoxels(const VoxelRay *rays, size_t count, VoxelRayHit *hits) const;
     };
 }
\ No newline at end of file
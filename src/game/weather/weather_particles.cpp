@@ -0,0 +1,292 @@
+#include "weather_particles.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define LSL_WEATHER_SSE2 1
+#endif
+
+namespace game::weather
+{
+    namespace
+    {
+        // 标量路径与 SIMD 路径共用：运算顺序与旧版逐粒子更新相同，结果逐位一致
+        inline void stepRain(float &x, float &y, float speed, float depth, const RainStepParams &p)
+        {
+            const float parallax = 0.68f + depth * 0.52f;
+            x -= p.driftX * parallax;
+            y -= p.driftY * parallax;
+            y += speed * p.dt;
+            x += p.windDx * speed * p.dt;
+        }
+
+        inline bool rainFlagged(float x, float y, const RainStepParams &p)
+        {
+            const bool inBand = p.splashBand && y >= p.bandMinY && y <= p.bandMaxY;
+            return inBand || y > p.respawnY || x < p.minX || x > p.maxX;
+        }
+
+        inline bool stepSplash(RainSplashes &s, size_t i, float dt, float driftX, float driftY)
+        {
+            s.x[i] -= driftX;
+            s.y[i] -= driftY;
+            s.age[i] += dt;
+            const float t = s.age[i] / s.maxAge[i];
+            s.radius[i] = s.maxRadius[i] * t;
+            s.alpha[i] = (1.0f - t * t) * 0.85f;
+            return s.age[i] >= s.maxAge[i];
+        }
+
+        inline void pushFlags(int mask, size_t base, std::vector<uint32_t> &flagged)
+        {
+            for (int lane = 0; mask != 0; ++lane, mask >>= 1)
+                if (mask & 1)
+                    flagged.push_back(static_cast<uint32_t>(base + lane));
+        }
+
+        uint8_t alphaByte(float alpha, float scale)
+        {
+            return static_cast<uint8_t>(std::min(alpha * scale, scale));
+        }
+    }
+
+    const char *particleKernelName()
+    {
+#if defined(LSL_WEATHER_SSE2)
+        return "sse2";
+#else
+        return "scalar";
+#endif
+    }
+
+    // ──────────────────────────────────────────────
+    // 积分内核
+    // ──────────────────────────────────────────────
+    void integrateRain(RainStreaks &rain, const RainStepParams &params, std::vector<uint32_t> &flagged)
+    {
+        flagged.clear();
+        const size_t count = particleCount(rain);
+        float *x = rain.x.data();
+        float *y = rain.y.data();
+        const float *speed = rain.speed.data();
+        const float *depth = rain.depth.data();
+        size_t i = 0;
+
+#if defined(LSL_WEATHER_SSE2)
+        const __m128 dt = _mm_set1_ps(params.dt);
+        const __m128 driftX = _mm_set1_ps(params.driftX);
+        const __m128 driftY = _mm_set1_ps(params.driftY);
+        const __m128 wind = _mm_set1_ps(params.windDx);
+        const __m128 parallaxBase = _mm_set1_ps(0.68f);
+        const __m128 parallaxScale = _mm_set1_ps(0.52f);
+        const __m128 bandMin = _mm_set1_ps(params.bandMinY);
+        const __m128 bandMax = _mm_set1_ps(params.bandMaxY);
+        const __m128 bandEnabled = _mm_castsi128_ps(_mm_set1_epi32(params.splashBand ? -1 : 0));
+        const __m128 respawnY = _mm_set1_ps(params.respawnY);
+        const __m128 minX = _mm_set1_ps(params.minX);
+        const __m128 maxX = _mm_set1_ps(params.maxX);
+        for (; i + 4 <= count; i += 4)
+        {
+            const __m128 vs = _mm_loadu_ps(speed + i);
+            const __m128 parallax = _mm_add_ps(parallaxBase, _mm_mul_ps(_mm_loadu_ps(depth + i), parallaxScale));
+            __m128 vx = _mm_sub_ps(_mm_loadu_ps(x + i), _mm_mul_ps(driftX, parallax));
+            __m128 vy = _mm_sub_ps(_mm_loadu_ps(y + i), _mm_mul_ps(driftY, parallax));
+            vy = _mm_add_ps(vy, _mm_mul_ps(vs, dt));
+            vx = _mm_add_ps(vx, _mm_mul_ps(_mm_mul_ps(wind, vs), dt));
+            _mm_storeu_ps(x + i, vx);
+            _mm_storeu_ps(y + i, vy);
+
+            const __m128 inBand = _mm_and_ps(bandEnabled, _mm_and_ps(_mm_cmpge_ps(vy, bandMin), _mm_cmple_ps(vy, bandMax)));
+            const __m128 out = _mm_or_ps(_mm_cmpgt_ps(vy, respawnY),
+                                         _mm_or_ps(_mm_cmplt_ps(vx, minX), _mm_cmpgt_ps(vx, maxX)));
+            pushFlags(_mm_movemask_ps(_mm_or_ps(inBand, out)), i, flagged);
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            stepRain(x[i], y[i], speed[i], depth[i], params);
+            if (rainFlagged(x[i], y[i], params))
+                flagged.push_back(static_cast<uint32_t>(i));
+        }
+    }
+
+    void ageSplashes(RainSplashes &splashes, float dt, float driftX, float driftY)
+    {
+        const size_t count = particleCount(splashes);
+        int expired = 0;
+        size_t i = 0;
+
+#if defined(LSL_WEATHER_SSE2)
+        const __m128 vdt = _mm_set1_ps(dt);
+        const __m128 vdx = _mm_set1_ps(driftX);
+        const __m128 vdy = _mm_set1_ps(driftY);
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 fade = _mm_set1_ps(0.85f);
+        for (; i + 4 <= count; i += 4)
+        {
+            _mm_storeu_ps(splashes.x.data() + i, _mm_sub_ps(_mm_loadu_ps(splashes.x.data() + i), vdx));
+            _mm_storeu_ps(splashes.y.data() + i, _mm_sub_ps(_mm_loadu_ps(splashes.y.data() + i), vdy));
+            const __m128 maxAge = _mm_loadu_ps(splashes.maxAge.data() + i);
+            const __m128 age = _mm_add_ps(_mm_loadu_ps(splashes.age.data() + i), vdt);
+            const __m128 t = _mm_div_ps(age, maxAge);
+            _mm_storeu_ps(splashes.age.data() + i, age);
+            _mm_storeu_ps(splashes.radius.data() + i, _mm_mul_ps(_mm_loadu_ps(splashes.maxRadius.data() + i), t));
+            _mm_storeu_ps(splashes.alpha.data() + i, _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(t, t)), fade));
+            expired |= _mm_movemask_ps(_mm_cmpge_ps(age, maxAge));
+        }
+#endif
+        for (; i < count; ++i)
+            expired |= stepSplash(splashes, i, dt, driftX, driftY) ? 1 : 0;
+
+        if (expired)
+            compactParticles(splashes, [&splashes](size_t k) { return splashes.age[k] < splashes.maxAge[k]; });
+    }
+
+    void integrateScreenDrops(ScreenDrops &drops, float dt, float boostX, float boostY,
+                              float displayW, float displayH, std::vector<uint32_t> &flagged)
+    {
+        flagged.clear();
+        const size_t count = particleCount(drops);
+        // 数量很少（几十条），交给编译器自动向量化
+        for (size_t i = 0; i < count; ++i)
+        {
+            drops.x[i] += (drops.vx[i] + boostX) * dt;
+            drops.y[i] += (drops.vy[i] + boostY) * dt;
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (drops.y[i] > displayH + drops.length[i] + 12.0f || drops.x[i] < -120.0f || drops.x[i] > displayW + 120.0f)
+                flagged.push_back(static_cast<uint32_t>(i));
+        }
+    }
+
+    void integrateLensDrops(LensDrops &drops, float dt, float shiftX, float smearGain, float displayH,
+                            std::vector<uint32_t> &flagged)
+    {
+        flagged.clear();
+        const size_t count = particleCount(drops);
+        const float smearDecay = 1.0f - dt * 0.8f;
+        for (size_t i = 0; i < count; ++i)
+        {
+            drops.age[i] += dt;
+            drops.y[i] += drops.vy[i] * dt;
+            drops.x[i] += shiftX;
+            drops.smear[i] = std::max(drops.radius[i] * 1.1f, drops.smear[i] * smearDecay + smearGain);
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (drops.age[i] >= drops.maxAge[i] || drops.y[i] > displayH + drops.smear[i] + drops.radius[i])
+                flagged.push_back(static_cast<uint32_t>(i));
+        }
+    }
+
+    // ──────────────────────────────────────────────
+    // 实例打包
+    // ──────────────────────────────────────────────
+    void packRain(const RainStreaks &rain, float intensity, float windDx, std::vector<ParticleInstance> &out)
+    {
+        const size_t count = particleCount(rain);
+        out.reserve(out.size() + count * 2);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const float alpha = rain.alpha[i] * intensity;
+            if (alpha <= 0.01f)
+                continue;
+
+            const float x = rain.x[i];
+            const float y = rain.y[i];
+            const float depth = rain.depth[i];
+            const float dx = windDx * rain.length[i];
+            const float dy = rain.length[i];
+            const uint8_t a = alphaByte(alpha, 255.0f);
+
+            // 主雨线：淡蓝白色
+            out.push_back({x, y, x + dx, y + dy, 0.75f + depth * 0.95f,
+                           packColor(165 + static_cast<int>(depth * 20.0f), 205 + static_cast<int>(depth * 15.0f), 255, a)});
+
+            // 高光细线（仅中雨以上可见），模拟雨滴反光
+            if (alpha > 0.32f && depth > 0.35f)
+                out.push_back({x - 0.6f, y, x + dx - 0.6f, y + dy, 0.5f + depth * 0.25f,
+                               packColor(220, 240, 255, static_cast<int>(a * (0.18f + depth * 0.22f)))});
+        }
+    }
+
+    void packScreenDrops(const ScreenDrops &drops, float intensity, std::vector<ParticleInstance> &out)
+    {
+        const size_t count = particleCount(drops);
+        out.reserve(out.size() + count * 2);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const float alpha = drops.alpha[i] * intensity;
+            if (alpha <= 0.01f)
+                continue;
+
+            const float x = drops.x[i];
+            const float y = drops.y[i];
+            const float dx = drops.vx[i] * 0.020f;
+            const float dy = drops.length[i];
+            const uint8_t a = alphaByte(alpha, 255.0f);
+            out.push_back({x, y, x + dx, y + dy, drops.width[i], packColor(210, 232, 255, a)});
+            out.push_back({x - 0.8f, y - 2.0f, x + dx - 0.8f, y + dy - 2.0f, 0.7f,
+                           packColor(255, 255, 255, static_cast<int>(a * 0.22f))});
+        }
+    }
+
+    void packSplashes(const RainSplashes &splashes, float intensity, std::vector<ParticleInstance> &out)
+    {
+        const size_t count = particleCount(splashes);
+        out.reserve(out.size() + count * 2);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const float effAlpha = splashes.alpha[i] * intensity;
+            if (effAlpha <= 0.01f)
+                continue;
+
+            const float r = splashes.radius[i];
+            const uint8_t a = alphaByte(effAlpha, 210.0f);
+            // 外椭圆涟漪
+            out.push_back({splashes.x[i], splashes.y[i], r * 2.2f, r * 0.75f, 1.0f, packColor(160, 215, 255, a)});
+            // 内小圆
+            if (r > 1.5f)
+                out.push_back({splashes.x[i], splashes.y[i], r * 0.9f, r * 0.32f, 0.8f,
+                               packColor(200, 235, 255, static_cast<int>(a * 0.6f))});
+        }
+    }
+
+    void packLensDrops(const LensDrops &drops, float intensity, float motionX,
+                       std::vector<ParticleInstance> &discs, std::vector<ParticleInstance> &tails)
+    {
+        const size_t count = particleCount(drops);
+        discs.reserve(discs.size() + count * 4);
+        tails.reserve(tails.size() + count * 2);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const float lifeT = std::clamp(drops.age[i] / std::max(drops.maxAge[i], 0.0001f), 0.0f, 1.0f);
+            const float alpha = drops.alpha[i] * intensity * (1.0f - lifeT * 0.35f);
+            if (alpha <= 0.008f)
+                continue;
+
+            const float x = drops.x[i];
+            const float y = drops.y[i];
+            const float r = drops.radius[i];
+            const float tailLen = drops.smear[i] * (0.65f + 0.35f * lifeT);
+            const int coreA = static_cast<int>(std::min(alpha * 255.0f, 255.0f));
+            const int glowA = static_cast<int>(coreA * 0.28f);
+            const int tailA = static_cast<int>(coreA * 0.18f);
+
+            discs.push_back({x, y, r * 1.85f, r * 1.85f, 0.0f, packColor(160, 205, 255, glowA)});
+            discs.push_back({x, y, r, r, 0.0f, packColor(185, 220, 255, static_cast<int>(coreA * 0.45f))});
+            discs.push_back({x - r * 0.22f, y - r * 0.28f, r * 0.32f, r * 0.32f, 0.0f,
+                             packColor(255, 255, 255, static_cast<int>(coreA * 0.75f))});
+            discs.push_back({x + r * 0.12f, y + r * 0.10f, r * 0.82f, r * 0.82f, 1.0f,
+                             packColor(140, 190, 245, static_cast<int>(coreA * 0.22f))});
+
+            tails.push_back({x, y + r * 0.35f, x - motionX * 0.02f, y + tailLen, std::max(1.0f, r * 0.42f),
+                             packColor(185, 220, 255, tailA)});
+            tails.push_back({x - r * 0.18f, y + r * 0.10f, x - motionX * 0.028f, y + tailLen * 0.92f,
+                             std::max(0.8f, r * 0.18f), packColor(255, 255, 255, static_cast<int>(tailA * 0.55f))});
+        }
+    }
+
+} // namespace game::weather
@@ -0,0 +1,173 @@
+// 天气粒子：SoA 存储、SIMD 运动积分与实例打包
+// weather_particles.h
+//   - 每种粒子一组按字段分开的 float 数组，逐帧运动积分按 SIMD 通道批量执行
+//     （x86-64 默认 SSE2，其它平台为标量实现；两者逐位一致）
+//   - 积分内核顺带标出需要后续处理的粒子（落进地面走廊、飞出屏幕），
+//     依赖随机数的水花 / 重生只对这些粒子逐个处理，随机数消耗顺序与逐个更新时相同
+//   - pack*() 把粒子写成 render::ParticleInstance，每种形状交给渲染器一次实例化绘制
+#pragma once
+#include "../../engine/render/render_types.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace game::weather
+{
+    using engine::render::ParticleInstance;
+
+    // ──────────────────────────────────────────────
+    // SoA 存储
+    // ──────────────────────────────────────────────
+
+    /** 雨丝（屏幕坐标） */
+    struct RainStreaks
+    {
+        std::vector<float> x, y;  // 屏幕坐标（像素）
+        std::vector<float> speed; // 垂直速度（像素/秒）
+        std::vector<float> length;
+        std::vector<float> alpha;
+        std::vector<float> depth; // 0=远景 1=近景
+
+        template <typename Fn>
+        void forEachField(Fn &&fn) { fn(x); fn(y); fn(speed); fn(length); fn(alpha); fn(depth); }
+    };
+
+    /** 地面水花涟漪；数组里只保存存活的水花 */
+    struct RainSplashes
+    {
+        std::vector<float> x, y;
+        std::vector<float> radius, maxRadius;
+        std::vector<float> age, maxAge;
+        std::vector<float> alpha;
+
+        template <typename Fn>
+        void forEachField(Fn &&fn) { fn(x); fn(y); fn(radius); fn(maxRadius); fn(age); fn(maxAge); fn(alpha); }
+    };
+
+    /** 贴屏雨丝（镜头前飞过的雨线） */
+    struct ScreenDrops
+    {
+        std::vector<float> x, y;
+        std::vector<float> vx, vy;
+        std::vector<float> length;
+        std::vector<float> alpha;
+        std::vector<float> width;
+
+        template <typename Fn>
+        void forEachField(Fn &&fn) { fn(x); fn(y); fn(vx); fn(vy); fn(length); fn(alpha); fn(width); }
+    };
+
+    /** 镜头水珠 */
+    struct LensDrops
+    {
+        std::vector<float> x, y;
+        std::vector<float> radius;
+        std::vector<float> alpha;
+        std::vector<float> vy;
+        std::vector<float> smear; // 拖尾长度
+        std::vector<float> age, maxAge;
+
+        template <typename Fn>
+        void forEachField(Fn &&fn) { fn(x); fn(y); fn(radius); fn(alpha); fn(vy); fn(smear); fn(age); fn(maxAge); }
+    };
+
+    template <typename Arrays>
+    size_t particleCount(const Arrays &arrays) { return arrays.x.size(); }
+
+    template <typename Arrays>
+    void resizeParticles(Arrays &arrays, size_t count)
+    {
+        arrays.forEachField([count](std::vector<float> &field) { field.resize(count); });
+    }
+
+    template <typename Arrays>
+    void reserveParticles(Arrays &arrays, size_t count)
+    {
+        arrays.forEachField([count](std::vector<float> &field) { field.reserve(count); });
+    }
+
+    /**
+     * @brief 原地保序压缩：移除 keep(i) 为 false 的粒子
+     * 按行搬移，keep(i) 读取第 i 行时该行尚未被覆盖
+     */
+    template <typename Arrays, typename Keep>
+    void compactParticles(Arrays &arrays, Keep &&keep)
+    {
+        const size_t count = particleCount(arrays);
+        size_t out = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (!keep(i))
+                continue;
+            if (out != i)
+                arrays.forEachField([out, i](std::vector<float> &field) { field[out] = field[i]; });
+            ++out;
+        }
+        resizeParticles(arrays, out);
+    }
+
+    // ──────────────────────────────────────────────
+    // 积分内核
+    // ──────────────────────────────────────────────
+
+    struct RainStepParams
+    {
+        float dt = 0.0f;
+        float driftX = 0.0f, driftY = 0.0f; // 相机位移（屏幕像素），按深度视差抵消
+        float windDx = 0.0f;                // 水平 / 垂直移动比
+        bool  splashBand = false;           // 是否检测地面走廊
+        float bandMinY = 0.0f, bandMaxY = 0.0f;
+        float respawnY = 0.0f;              // y 超过此值重生
+        float minX = 0.0f, maxX = 0.0f;     // x 超出此范围重生
+    };
+
+    /**
+     * @brief 雨丝运动积分
+     * @param flagged 输出：落进 [bandMinY, bandMaxY]（splashBand 时）或越界的粒子下标，升序
+     */
+    void integrateRain(RainStreaks &rain, const RainStepParams &params, std::vector<uint32_t> &flagged);
+
+    /** 水花平移 + 老化；寿命到期的水花被移除（保序） */
+    void ageSplashes(RainSplashes &splashes, float dt, float driftX, float driftY);
+
+    /**
+     * @brief 贴屏雨丝积分
+     * @param flagged 输出：越界需要重生的下标，升序
+     */
+    void integrateScreenDrops(ScreenDrops &drops, float dt, float boostX, float boostY,
+                              float displayW, float displayH, std::vector<uint32_t> &flagged);
+
+    /**
+     * @brief 镜头水珠积分
+     * @param flagged 输出：寿命到期或滑出屏幕的下标，升序
+     */
+    void integrateLensDrops(LensDrops &drops, float dt, float shiftX, float smearGain, float displayH,
+                            std::vector<uint32_t> &flagged);
+
+    /** 当前编译产物使用的内核名称（基准输出用） */
+    const char *particleKernelName();
+
+    // ──────────────────────────────────────────────
+    // 实例打包（追加到 out）
+    // ──────────────────────────────────────────────
+
+    constexpr uint32_t packColor(int r, int g, int b, int a)
+    {
+        return static_cast<uint32_t>(r & 0xFF) | static_cast<uint32_t>(g & 0xFF) << 8 |
+               static_cast<uint32_t>(b & 0xFF) << 16 | static_cast<uint32_t>(a & 0xFF) << 24;
+    }
+
+    /** 雨丝主线 + 高光细线（LINE） */
+    void packRain(const RainStreaks &rain, float intensity, float windDx, std::vector<ParticleInstance> &out);
+    /** 贴屏雨丝主线 + 高光（LINE） */
+    void packScreenDrops(const ScreenDrops &drops, float intensity, std::vector<ParticleInstance> &out);
+    /** 水花外椭圆 + 内椭圆描边（ELLIPSE） */
+    void packSplashes(const RainSplashes &splashes, float intensity, std::vector<ParticleInstance> &out);
+    /**
+     * @brief 镜头水珠：光晕 / 主体 / 高光 / 描边写入 discs（ELLIPSE），拖尾写入 tails（LINE）
+     * @param motionX 视角水平速度 × 运动缩放，拖尾向反方向偏移
+     */
+    void packLensDrops(const LensDrops &drops, float intensity, float motionX,
+                       std::vector<ParticleInstance> &discs, std::vector<ParticleInstance> &tails);
+
+} // namespace game::weather
@@ -1,4 +1,5 @@
 #include "weather_system.h"
+#include "../../engine/render/renderer.h"
 #include <imgui.h>
 #include <cmath>
 #include <algorithm>
@@ -8,6 +9,8 @@ namespace game::weather
     namespace
     {
         constexpr size_t kMaxSplashPoolSize = 256;
+
+        using engine::render::ParticleShape;
     }
 
     WeatherSystem::WeatherSystem()
@@ -15,10 +18,10 @@ namespace game::weather
     {
         m_autoChangeTimer = autoChangePeriod;
         // 预留容量避免运行时反复内存分配
-        m_particles.reserve(500);
-        m_splashes.reserve(80);
-        m_screenDrops.reserve(64);
-        m_lensDrops.reserve(24);
+        reserveParticles(m_particles, 500);
+        reserveParticles(m_splashes, kMaxSplashPoolSize);
+        reserveParticles(m_screenDrops, 64);
+        reserveParticles(m_lensDrops, 24);
     }
 
     void WeatherSystem::setScreenRainOverlayStrength(float strength)
@@ -181,119 +184,108 @@ namespace game::weather
     // ──────────────────────────────────────────────
     void WeatherSystem::spawnParticle(float displayW, float displayH)
     {
-        RainParticle p;
-        p.depth  = randFloat();
-        p.x      = randFloat() * (displayW + 120.0f) - 60.0f;
-        p.y      = randFloat() * -displayH;  // 从屏幕上方随机位置开始
-        const float depthScale = 0.55f + p.depth * 0.85f;
-        p.speed  = particleSpeed()  * depthScale * (0.78f + randFloat() * 0.36f);
-        p.length = particleLength() * (0.60f + p.depth * 0.95f) * (0.72f + randFloat() * 0.50f);
-        p.alpha  = particleAlpha()  * (0.32f + p.depth * 0.68f) * (0.45f + randFloat() * 0.45f) * m_intensity;
-        m_particles.push_back(p);
+        const size_t i = particleCount(m_particles);
+        resizeParticles(m_particles, i + 1);
+        const float depth = randFloat();
+        m_particles.depth[i] = depth;
+        m_particles.x[i]     = randFloat() * (displayW + 120.0f) - 60.0f;
+        m_particles.y[i]     = randFloat() * -displayH;  // 从屏幕上方随机位置开始
+        const float depthScale = 0.55f + depth * 0.85f;
+        m_particles.speed[i]  = particleSpeed()  * depthScale * (0.78f + randFloat() * 0.36f);
+        m_particles.length[i] = particleLength() * (0.60f + depth * 0.95f) * (0.72f + randFloat() * 0.50f);
+        m_particles.alpha[i]  = particleAlpha()  * (0.32f + depth * 0.68f) * (0.45f + randFloat() * 0.45f) * m_intensity;
     }
 
-    void WeatherSystem::respawnParticle(RainParticle &p, float displayW, float /*displayH*/)
+    void WeatherSystem::respawnParticle(size_t i, float displayW, float /*displayH*/)
     {
-        p.depth  = randFloat();
-        p.x      = randFloat() * (displayW + 120.0f) - 60.0f;
-        const float depthScale = 0.55f + p.depth * 0.85f;
-        p.speed  = particleSpeed()  * depthScale * (0.78f + randFloat() * 0.36f);
-        p.length = particleLength() * (0.60f + p.depth * 0.95f) * (0.72f + randFloat() * 0.50f);
-        p.y      = -p.length - randFloat() * 30.0f;
-        p.alpha  = particleAlpha()  * (0.32f + p.depth * 0.68f) * (0.45f + randFloat() * 0.45f) * m_intensity;
+        const float depth = randFloat();
+        m_particles.depth[i] = depth;
+        m_particles.x[i]     = randFloat() * (displayW + 120.0f) - 60.0f;
+        const float depthScale = 0.55f + depth * 0.85f;
+        m_particles.speed[i]  = particleSpeed()  * depthScale * (0.78f + randFloat() * 0.36f);
+        m_particles.length[i] = particleLength() * (0.60f + depth * 0.95f) * (0.72f + randFloat() * 0.50f);
+        m_particles.y[i]      = -m_particles.length[i] - randFloat() * 30.0f;
+        m_particles.alpha[i]  = particleAlpha()  * (0.32f + depth * 0.68f) * (0.45f + randFloat() * 0.45f) * m_intensity;
     }
 
     void WeatherSystem::spawnScreenDrop(float displayW, float displayH)
     {
-        ScreenRainDrop drop;
-        respawnScreenDrop(drop, displayW, displayH, false);
-        m_screenDrops.push_back(drop);
+        const size_t i = particleCount(m_screenDrops);
+        resizeParticles(m_screenDrops, i + 1);
+        respawnScreenDrop(i, displayW, displayH, false);
     }
 
-    void WeatherSystem::respawnScreenDrop(ScreenRainDrop &drop, float displayW, float displayH, bool topOnly)
+    void WeatherSystem::respawnScreenDrop(size_t i, float displayW, float displayH, bool topOnly)
     {
         const float baseSpeed = particleSpeed() * (1.35f + randFloat() * 0.55f);
         const float lateralFromMotion = -m_viewMotionX * m_screenRainMotionScale * (0.85f + randFloat() * 0.45f);
 
-        drop.x = randFloat() * (displayW + 180.0f) - 90.0f;
-        drop.y = topOnly ? (-40.0f - randFloat() * 80.0f) : (randFloat() * displayH);
-        drop.vy = baseSpeed;
-        drop.vx = WIND_DX * baseSpeed * (0.9f + randFloat() * 0.45f) + lateralFromMotion;
-        drop.length = particleLength() * (1.3f + 0.8f * m_screenRainOverlayStrength + randFloat() * 1.5f)
+        ScreenDrops &d = m_screenDrops;
+        d.x[i] = randFloat() * (displayW + 180.0f) - 90.0f;
+        d.y[i] = topOnly ? (-40.0f - randFloat() * 80.0f) : (randFloat() * displayH);
+        d.vy[i] = baseSpeed;
+        d.vx[i] = WIND_DX * baseSpeed * (0.9f + randFloat() * 0.45f) + lateralFromMotion;
+        d.length[i] = particleLength() * (1.3f + 0.8f * m_screenRainOverlayStrength + randFloat() * 1.5f)
             + std::abs(m_viewMotionX) * 0.015f * m_screenRainMotionScale;
-        drop.alpha = std::min(0.95f, particleAlpha() * (0.22f + 0.14f * m_screenRainOverlayStrength + randFloat() * 0.24f));
-        drop.width = 1.1f + randFloat() * 1.4f;
+        d.alpha[i] = std::min(0.95f, particleAlpha() * (0.22f + 0.14f * m_screenRainOverlayStrength + randFloat() * 0.24f));
+        d.width[i] = 1.1f + randFloat() * 1.4f;
     }
 
     void WeatherSystem::spawnLensDrop(float displayW, float displayH)
     {
-        LensRainDrop drop;
-        respawnLensDrop(drop, displayW, displayH, false);
-        m_lensDrops.push_back(drop);
+        const size_t i = particleCount(m_lensDrops);
+        resizeParticles(m_lensDrops, i + 1);
+        respawnLensDrop(i, displayW, displayH, false);
     }
 
-    void WeatherSystem::respawnLensDrop(LensRainDrop &drop, float displayW, float displayH, bool topOnly)
+    void WeatherSystem::respawnLensDrop(size_t i, float displayW, float displayH, bool topOnly)
     {
-        drop.x = randFloat() * (displayW * 0.94f) + displayW * 0.03f;
-        drop.y = topOnly ? (-20.0f - randFloat() * 50.0f) : (randFloat() * displayH * 0.74f);
-        drop.radius = (4.5f + randFloat() * 7.0f) * (0.85f + m_screenRainOverlayStrength * 0.35f);
-        drop.alpha = std::min(0.34f, particleAlpha() * (0.10f + randFloat() * 0.10f) * (0.75f + 0.35f * m_screenRainOverlayStrength));
-        drop.vy = 8.0f + randFloat() * 20.0f + std::abs(m_viewMotionY) * 0.015f;
-        drop.smear = drop.radius * (1.6f + randFloat() * 2.8f) + std::abs(m_viewMotionX) * 0.020f * m_screenRainMotionScale;
-        drop.age = 0.0f;
-        drop.maxAge = 1.6f + randFloat() * 3.0f;
+        LensDrops &d = m_lensDrops;
+        d.x[i] = randFloat() * (displayW * 0.94f) + displayW * 0.03f;
+        d.y[i] = topOnly ? (-20.0f - randFloat() * 50.0f) : (randFloat() * displayH * 0.74f);
+        d.radius[i] = (4.5f + randFloat() * 7.0f) * (0.85f + m_screenRainOverlayStrength * 0.35f);
+        d.alpha[i] = std::min(0.34f, particleAlpha() * (0.10f + randFloat() * 0.10f) * (0.75f + 0.35f * m_screenRainOverlayStrength));
+        d.vy[i] = 8.0f + randFloat() * 20.0f + std::abs(m_viewMotionY) * 0.015f;
+        d.smear[i] = d.radius[i] * (1.6f + randFloat() * 2.8f) + std::abs(m_viewMotionX) * 0.020f * m_screenRainMotionScale;
+        d.age[i] = 0.0f;
+        d.maxAge[i] = 1.6f + randFloat() * 3.0f;
     }
 
-    void WeatherSystem::emitSplash(float x, float y)
+    void WeatherSystem::resetSplash(size_t i, float x, float y)
     {
-        for (auto &s : m_splashes)
-        {
-            if (s.active)
-                continue;
-
-            s.x = x;
-            s.y = y;
-            s.radius = 0.0f;
-            s.maxRadius = 4.0f + randFloat() * 9.0f;
-            s.age = 0.0f;
-            s.maxAge = 0.22f + randFloat() * 0.20f;
-            s.alpha = 0.55f + randFloat() * 0.35f;
-            s.active = true;
-            return;
-        }
+        m_splashes.x[i] = x;
+        m_splashes.y[i] = y;
+        m_splashes.radius[i] = 0.0f;
+        m_splashes.maxRadius[i] = 4.0f + randFloat() * 9.0f;
+        m_splashes.age[i] = 0.0f;
+        m_splashes.maxAge[i] = 0.22f + randFloat() * 0.20f;
+        m_splashes.alpha[i] = 0.55f + randFloat() * 0.35f;
+    }
 
-        if (m_splashes.size() < kMaxSplashPoolSize)
+    void WeatherSystem::emitSplash(float x, float y)
+    {
+        // 数组里只有存活的水花：未满时追加，满了替换寿命进度最大的一个
+        const size_t count = particleCount(m_splashes);
+        if (count < kMaxSplashPoolSize)
         {
-            RainSplash s{};
-            s.x = x;
-            s.y = y;
-            s.radius = 0.0f;
-            s.maxRadius = 4.0f + randFloat() * 9.0f;
-            s.age = 0.0f;
-            s.maxAge = 0.22f + randFloat() * 0.20f;
-            s.alpha = 0.55f + randFloat() * 0.35f;
-            s.active = true;
-            m_splashes.push_back(s);
+            resizeParticles(m_splashes, count + 1);
+            resetSplash(count, x, y);
             return;
         }
 
-        auto it = std::max_element(m_splashes.begin(), m_splashes.end(), [](const RainSplash &a, const RainSplash &b) {
-            float ar = a.maxAge > 0.0001f ? (a.age / a.maxAge) : a.age;
-            float br = b.maxAge > 0.0001f ? (b.age / b.maxAge) : b.age;
-            return ar < br;
-        });
-
-        if (it != m_splashes.end())
+        size_t oldest = 0;
+        float oldestRatio = -1.0f;
+        for (size_t i = 0; i < count; ++i)
         {
-            it->x = x;
-            it->y = y;
-            it->radius = 0.0f;
-            it->maxRadius = 4.0f + randFloat() * 9.0f;
-            it->age = 0.0f;
-            it->maxAge = 0.22f + randFloat() * 0.20f;
-            it->alpha = 0.55f + randFloat() * 0.35f;
-            it->active = true;
+            const float maxAge = m_splashes.maxAge[i];
+            const float ratio = maxAge > 0.0001f ? (m_splashes.age[i] / maxAge) : m_splashes.age[i];
+            if (ratio > oldestRatio)
+            {
+                oldestRatio = ratio;
+                oldest = i;
+            }
         }
+        resetSplash(oldest, x, y);
     }
 
     // ──────────────────────────────────────────────
@@ -308,9 +300,9 @@ namespace game::weather
         m_transitionTimer    = 0.0f;
         m_intensity          = 0.0f;     // 从零开始淡入
         m_isTransitioning    = true;
-        m_particles.clear();             // 清除旧粒子，让新天气自然生成
-        m_screenDrops.clear();
-        m_lensDrops.clear();
+        resizeParticles(m_particles, 0); // 清除旧粒子，让新天气自然生成
+        resizeParticles(m_screenDrops, 0);
+        resizeParticles(m_lensDrops, 0);
 
         // 重置雷电计时（切换到雷雨时稍后触发）
         m_lightningFlash    = 0.0f;
@@ -382,115 +374,79 @@ namespace game::weather
 
         // ── 粒子池管理 ──
         int target = targetParticleCount();
-        int deficit = target - static_cast<int>(m_particles.size());
+        int deficit = target - static_cast<int>(particleCount(m_particles));
         int spawnBudget = std::min(deficit, 36);
         while (spawnBudget-- > 0)
             spawnParticle(displayW, displayH);
-        if (static_cast<int>(m_particles.size()) > target)
-            m_particles.resize(static_cast<size_t>(target));
+        if (static_cast<int>(particleCount(m_particles)) > target)
+            resizeParticles(m_particles, static_cast<size_t>(target));
 
         const int screenTarget = targetScreenDropCount();
-        int screenDeficit = screenTarget - static_cast<int>(m_screenDrops.size());
+        int screenDeficit = screenTarget - static_cast<int>(particleCount(m_screenDrops));
         int screenSpawnBudget = std::min(screenDeficit, 8);
         while (screenSpawnBudget-- > 0)
             spawnScreenDrop(displayW, displayH);
-        if (static_cast<int>(m_screenDrops.size()) > screenTarget)
-            m_screenDrops.resize(static_cast<size_t>(screenTarget));
+        if (static_cast<int>(particleCount(m_screenDrops)) > screenTarget)
+            resizeParticles(m_screenDrops, static_cast<size_t>(screenTarget));
 
         const int lensTarget = targetLensDropCount();
-        int lensDeficit = lensTarget - static_cast<int>(m_lensDrops.size());
+        int lensDeficit = lensTarget - static_cast<int>(particleCount(m_lensDrops));
         int lensSpawnBudget = std::min(lensDeficit, 3);
         while (lensSpawnBudget-- > 0)
             spawnLensDrop(displayW, displayH);
-        if (static_cast<int>(m_lensDrops.size()) > lensTarget)
-            m_lensDrops.resize(static_cast<size_t>(lensTarget));
+        if (static_cast<int>(particleCount(m_lensDrops)) > lensTarget)
+            resizeParticles(m_lensDrops, static_cast<size_t>(lensTarget));
 
         // ── 粒子物理 ──
-        for (auto &p : m_particles)
+        // 雨水落在地面走廊范围内时产生水花
+        // gMin = 走廊远端屏幕Y（背景侧），gMax = 走廊前沿屏幕Y（玩家侧）
+        const float gMax = (m_groundScreenY    > 0.0f) ? m_groundScreenY    : displayH * 0.88f;
+        const float gMin = (m_groundMinScreenY > 0.0f) ? m_groundMinScreenY : displayH * 0.33f;
+        RainStepParams step;
+        step.dt         = dt;
+        step.driftX     = cameraDriftX;
+        step.driftY     = cameraDriftY;
+        step.windDx     = WIND_DX;
+        step.splashBand = m_current != WeatherType::Clear && m_intensity > 0.3f;
+        step.bandMinY   = gMin;
+        step.bandMaxY   = gMax + displayH * 0.03f;
+        step.respawnY   = gMax + 5.0f;   // 到达地面前沿（gMax）或离开屏幕 → 重新生成
+        step.minX       = -100.0f;
+        step.maxX       = displayW + 100.0f;
+        integrateRain(m_particles, step, m_flagged);
+
+        // 只有被标出的粒子需要随机数，按下标顺序处理
+        const float spawnProb = particleAlpha() * m_intensity; // 按雨强决定生成概率
+        for (uint32_t i : m_flagged)
         {
-            const float parallax = 0.68f + p.depth * 0.52f;
-            p.x -= cameraDriftX * parallax;
-            p.y -= cameraDriftY * parallax;
-            p.y += p.speed * dt;
-            p.x += WIND_DX * p.speed * dt;
-
-            // 雨水落在地面走廊范围内时产生水花
-            // gMin = 走廊远端屏幕Y（背景侧），gMax = 走廊前沿屏幕Y（玩家侧）
-            float gMax = (m_groundScreenY    > 0.0f) ? m_groundScreenY    : displayH * 0.88f;
-            float gMin = (m_groundMinScreenY > 0.0f) ? m_groundMinScreenY : displayH * 0.33f;
-            if (p.y >= gMin && p.y <= gMax + displayH * 0.03f
-                && m_current != WeatherType::Clear && m_intensity > 0.3f)
+            const float px = m_particles.x[i];
+            const float py = m_particles.y[i];
+            if (step.splashBand && py >= step.bandMinY && py <= step.bandMaxY)
             {
-                // 按雨强决定生成概率
-                float spawnProb = particleAlpha() * m_intensity;
                 if ((nextRand() & 0x7F) < static_cast<uint32_t>(spawnProb * 24))
                 {
-                    const float sx = p.x + (static_cast<float>(nextRand() & 0x7) - 3.5f);
-                    const float sy = p.y + (static_cast<float>(nextRand() & 0x7) - 3.5f) * 0.4f;
+                    const float sx = px + (static_cast<float>(nextRand() & 0x7) - 3.5f);
+                    const float sy = py + (static_cast<float>(nextRand() & 0x7) - 3.5f) * 0.4f;
                     emitSplash(sx, sy);
                 }
             }
-
-            // 到达地面前沿（gMax）或离开屏幕 → 重新生成
-            if (p.y > gMax + 5.0f ||
-                p.x < -100.0f     ||
-                p.x > displayW + 100.0f)
-            {
-                respawnParticle(p, displayW, displayH);
-            }
+            if (py > step.respawnY || px < step.minX || px > step.maxX)
+                respawnParticle(i, displayW, displayH);
         }
 
-        for (auto &s : m_splashes)
-        {
-            if (!s.active)
-                continue;
-            s.x -= cameraDriftX;
-            s.y -= cameraDriftY;
-        }
+        const float motionBoostX = -m_viewMotionX * 1.2f * m_screenRainMotionScale;
+        const float motionBoostY = std::abs(m_viewMotionY) * 0.10f;
+        integrateScreenDrops(m_screenDrops, dt, motionBoostX, motionBoostY, displayW, displayH, m_flagged);
+        for (uint32_t i : m_flagged)
+            respawnScreenDrop(i, displayW, displayH, true);
 
-        for (auto &drop : m_screenDrops)
-        {
-            const float motionBoostX = -m_viewMotionX * 1.2f * m_screenRainMotionScale;
-            const float motionBoostY = std::abs(m_viewMotionY) * 0.10f;
-            drop.x += (drop.vx + motionBoostX) * dt;
-            drop.y += (drop.vy + motionBoostY) * dt;
-
-            if (drop.y > displayH + drop.length + 12.0f ||
-                drop.x < -120.0f ||
-                drop.x > displayW + 120.0f)
-            {
-                respawnScreenDrop(drop, displayW, displayH, true);
-            }
-        }
+        integrateLensDrops(m_lensDrops, dt, -m_viewMotionX * 0.04f * m_screenRainMotionScale * dt,
+                           std::abs(m_viewMotionX) * 0.018f * m_screenRainMotionScale, displayH, m_flagged);
+        for (uint32_t i : m_flagged)
+            respawnLensDrop(i, displayW, displayH, true);
 
-        for (auto &drop : m_lensDrops)
-        {
-            drop.age += dt;
-            drop.y += drop.vy * dt;
-            drop.x += -m_viewMotionX * 0.04f * m_screenRainMotionScale * dt;
-            drop.smear = std::max(drop.radius * 1.1f,
-                                  drop.smear * (1.0f - dt * 0.8f)
-                                      + std::abs(m_viewMotionX) * 0.018f * m_screenRainMotionScale);
-
-            if (drop.age >= drop.maxAge ||
-                drop.y > displayH + drop.smear + drop.radius)
-            {
-                respawnLensDrop(drop, displayW, displayH, true);
-            }
-        }
-
-        // ── 水花涟漪更新 ──
-        for (auto &s : m_splashes)
-        {
-            if (!s.active)
-                continue;
-            s.age += dt;
-            float t  = s.age / s.maxAge;
-            s.radius = s.maxRadius * t;
-            s.alpha  = (1.0f - t * t) * 0.85f;
-            if (s.age >= s.maxAge)
-                s.active = false;
-        }
+        // ── 水花涟漪更新（含本帧新生成的）──
+        ageSplashes(m_splashes, dt, cameraDriftX, cameraDriftY);
 
         // ── 雾气时间累计 ──
         m_fogTime += dt;
@@ -498,26 +454,17 @@ namespace game::weather
         // ── 晴天：淡出并清理粒子 ──
         if (m_current == WeatherType::Clear)
         {
-            for (auto &p : m_particles)
-                p.alpha -= dt * 0.8f;
-            m_particles.erase(
-                std::remove_if(m_particles.begin(), m_particles.end(),
-                               [](const RainParticle &p){ return p.alpha <= 0.0f; }),
-                m_particles.end());
-
-            for (auto &drop : m_screenDrops)
-                drop.alpha -= dt * 0.9f;
-            m_screenDrops.erase(
-                std::remove_if(m_screenDrops.begin(), m_screenDrops.end(),
-                               [](const ScreenRainDrop &drop){ return drop.alpha <= 0.0f; }),
-                m_screenDrops.end());
-
-            for (auto &drop : m_lensDrops)
-                drop.alpha -= dt * 0.22f;
-            m_lensDrops.erase(
-                std::remove_if(m_lensDrops.begin(), m_lensDrops.end(),
-                               [](const LensRainDrop &drop){ return drop.alpha <= 0.0f; }),
-                m_lensDrops.end());
+            for (float &alpha : m_particles.alpha)
+                alpha -= dt * 0.8f;
+            compactParticles(m_particles, [this](size_t i) { return m_particles.alpha[i] > 0.0f; });
+
+            for (float &alpha : m_screenDrops.alpha)
+                alpha -= dt * 0.9f;
+            compactParticles(m_screenDrops, [this](size_t i) { return m_screenDrops.alpha[i] > 0.0f; });
+
+            for (float &alpha : m_lensDrops.alpha)
+                alpha -= dt * 0.22f;
+            compactParticles(m_lensDrops, [this](size_t i) { return m_lensDrops.alpha[i] > 0.0f; });
         }
 
         // ── 雷电（仅雷雨天气）──
@@ -558,68 +505,57 @@ namespace game::weather
     }
 
     // ──────────────────────────────────────────────
-    // render()  —  在 ImGui::NewFrame() 后调用
+    // render()  —  在 ImGui::NewFrame() 后、ImGui::Render() 前调用
     // ──────────────────────────────────────────────
-    void WeatherSystem::render(float displayW, float displayH)
+    void WeatherSystem::drawInstances(engine::render::Renderer *renderer, ParticleShape shape,
+                                      std::vector<ParticleInstance> &instances, const glm::vec2 &viewSize,
+                                      bool foreground)
     {
-        ImDrawList *bg = ImGui::GetBackgroundDrawList();
-
-        // ── 天空暗化（阴云效果）��─
-        float dim = getDimAlpha() * m_intensity;
-        if (dim > 0.0f)
-        {
-            bg->AddRectFilled(
-                ImVec2(0.0f, 0.0f),
-                ImVec2(displayW, displayH),
-                IM_COL32(8, 16, 40, static_cast<int>(dim * 230)));
-        }
-
-        // ── 雨滴条纹（增强：主线 + 高光细线）──
-        for (const auto &p : m_particles)
+        if (instances.empty())
+            return;
+        if (!renderer || !renderer->drawParticleInstances(shape, instances.data(), instances.size(), viewSize))
         {
-            float alpha = p.alpha * m_intensity;
-            if (alpha <= 0.01f) continue;
-
-            uint8_t a  = static_cast<uint8_t>(std::min(alpha * 255.0f, 255.0f));
-            float   dx = WIND_DX * p.length;
-            float   dy = p.length;
-            const float thickness = 0.75f + p.depth * 0.95f;
-
-            // 主雨线：淡蓝白色
-            bg->AddLine(
-                ImVec2(p.x,        p.y),
-                ImVec2(p.x + dx,   p.y + dy),
-                IM_COL32(165 + static_cast<int>(p.depth * 20.0f), 205 + static_cast<int>(p.depth * 15.0f), 255, a),
-                thickness);
-
-            // 高光细线（仅中雨以上可见），模拟雨滴反光
-            if (alpha > 0.32f && p.depth > 0.35f)
+            // 回退：逐个交给 ImGui DrawList（颜色打包格式与 IM_COL32 相同）
+            ImDrawList *dl = foreground ? ImGui::GetForegroundDrawList() : ImGui::GetBackgroundDrawList();
+            for (const ParticleInstance &p : instances)
             {
-                bg->AddLine(
-                    ImVec2(p.x - 0.6f,      p.y),
-                    ImVec2(p.x + dx - 0.6f, p.y + dy),
-                    IM_COL32(220, 240, 255, static_cast<int>(a * (0.18f + p.depth * 0.22f))), 0.5f + p.depth * 0.25f);
+                switch (shape)
+                {
+                case ParticleShape::LINE:
+                    dl->AddLine(ImVec2(p.x0, p.y0), ImVec2(p.x1, p.y1), p.color, p.width);
+                    break;
+                case ParticleShape::ELLIPSE:
+                    if (p.width > 0.0f)
+                        dl->AddEllipse(ImVec2(p.x0, p.y0), ImVec2(p.x1, p.y1), p.color, 0.0f, 0, p.width);
+                    else
+                        dl->AddEllipseFilled(ImVec2(p.x0, p.y0), ImVec2(p.x1, p.y1), p.color);
+                    break;
+                case ParticleShape::RECT:
+                    dl->AddRectFilled(ImVec2(p.x0, p.y0), ImVec2(p.x1, p.y1), p.color, p.width);
+                    break;
+                }
             }
         }
+        instances.clear();
+    }
 
-        for (const auto &drop : m_screenDrops)
-        {
-            float alpha = drop.alpha * m_intensity;
-            if (alpha <= 0.01f) continue;
-
-            const float dx = drop.vx * 0.020f;
-            const float dy = drop.length;
-            const uint8_t a = static_cast<uint8_t>(std::min(alpha * 255.0f, 255.0f));
-            bg->AddLine(
-                ImVec2(drop.x, drop.y),
-                ImVec2(drop.x + dx, drop.y + dy),
-                IM_COL32(210, 232, 255, a), drop.width);
-
-            bg->AddLine(
-                ImVec2(drop.x - 0.8f, drop.y - 2.0f),
-                ImVec2(drop.x + dx - 0.8f, drop.y + dy - 2.0f),
-                IM_COL32(255, 255, 255, static_cast<int>(a * 0.22f)), 0.7f);
-        }
+    void WeatherSystem::render(engine::render::Renderer *renderer, float displayW, float displayH)
+    {
+        const glm::vec2 viewSize{displayW, displayH};
+
+        // 绘制顺序：暗化 → 雨丝 → 雾气 → 水花 → 闪电；矩形层只有十几个实例，按层分开提交以保持叠放顺序
+
+        // ── 天空暗化（阴云效果）──
+        float dim = getDimAlpha() * m_intensity;
+        if (dim > 0.0f)
+            m_rectInstances.push_back({0.0f, 0.0f, displayW, displayH, 0.0f,
+                                       packColor(8, 16, 40, static_cast<int>(dim * 230))});
+        drawInstances(renderer, ParticleShape::RECT, m_rectInstances, viewSize, false);
+
+        // ── 雨滴条纹（主线 + 高光细线）与贴屏雨丝：一次绘制 ──
+        packRain(m_particles, m_intensity, WIND_DX, m_lineInstances);
+        packScreenDrops(m_screenDrops, m_intensity, m_lineInstances);
+        drawInstances(renderer, ParticleShape::LINE, m_lineInstances, viewSize, false);
 
         // ── 地面流动雾气 ──
         if (m_current != WeatherType::Clear && m_intensity > 0.15f)
@@ -635,10 +571,8 @@ namespace game::weather
                 float aVal  = (1.0f - t) * fogStrength * 95.0f;
                 if (aVal < 1.0f) continue;
                 float xOff  = std::sin(m_fogTime * 0.25f + t * 1.8f) * 35.0f;
-                bg->AddRectFilled(
-                    ImVec2(-50.0f + xOff, y),
-                    ImVec2(displayW + 50.0f, displayH),
-                    IM_COL32(12, 22, 50, static_cast<int>(aVal)));
+                m_rectInstances.push_back({-50.0f + xOff, y, displayW + 50.0f, displayH, 0.0f,
+                                           packColor(12, 22, 50, static_cast<int>(aVal))});
             }
 
             // 水平漂移雾带（3 条，速度各异）
@@ -654,89 +588,33 @@ namespace game::weather
                 for (int rep = -1; rep <= 1; ++rep)
                 {
                     float bx = offset + rep * period - displayW * 0.3f;
-                    bg->AddRectFilled(
-                        ImVec2(bx,  bandY - 22.0f),
-                        ImVec2(bx + displayW * 0.65f, bandY + 22.0f),
-                        IM_COL32(14, 28, 58, static_cast<int>(bAlpha)), 22.0f);
+                    m_rectInstances.push_back({bx, bandY - 22.0f, bx + displayW * 0.65f, bandY + 22.0f, 22.0f,
+                                               packColor(14, 28, 58, static_cast<int>(bAlpha))});
                 }
             }
         }
+        drawInstances(renderer, ParticleShape::RECT, m_rectInstances, viewSize, false);
 
         // ── 水花涟漪 ──
-        for (const auto &s : m_splashes)
-        {
-            if (!s.active)
-                continue;
-            float effAlpha = s.alpha * m_intensity;
-            if (effAlpha <= 0.01f) continue;
-            uint8_t a = static_cast<uint8_t>(std::min(effAlpha * 210.0f, 210.0f));
-            ImU32  sc = IM_COL32(160, 215, 255, a);
-            // 外椭圆涟漪
-            bg->AddEllipse(ImVec2(s.x, s.y),
-                ImVec2{s.radius * 2.2f, s.radius * 0.75f}, sc, 0.0f, 22, 1.0f);
-            // 内小圆
-            if (s.radius > 1.5f)
-                bg->AddEllipse(ImVec2(s.x, s.y),
-                    ImVec2{s.radius * 0.9f, s.radius * 0.32f},
-                    IM_COL32(200, 235, 255, static_cast<int>(a * 0.6f)), 0.0f, 16, 0.8f);
-        }
+        packSplashes(m_splashes, m_intensity, m_ellipseInstances);
+        drawInstances(renderer, ParticleShape::ELLIPSE, m_ellipseInstances, viewSize, false);
 
         // ── 闪电全屏白光 ──
         if (m_lightningFlash > 0.0f)
         {
-            uint8_t fa = static_cast<uint8_t>(m_lightningFlash * 195.0f);
-            bg->AddRectFilled(
-                ImVec2(0.0f, 0.0f),
-                ImVec2(displayW, displayH),
-                IM_COL32(255, 255, 245, fa));
+            m_rectInstances.push_back({0.0f, 0.0f, displayW, displayH, 0.0f,
+                                       packColor(255, 255, 245, static_cast<int>(m_lightningFlash * 195.0f))});
+            drawInstances(renderer, ParticleShape::RECT, m_rectInstances, viewSize, false);
         }
     }
 
-    void WeatherSystem::renderForeground(float /*displayW*/, float /*displayH*/)
+    void WeatherSystem::renderForeground(engine::render::Renderer *renderer, float displayW, float displayH)
     {
-        ImDrawList *fg = ImGui::GetForegroundDrawList();
-
-        for (const auto &drop : m_lensDrops)
-        {
-            const float lifeT = std::clamp(drop.age / std::max(drop.maxAge, 0.0001f), 0.0f, 1.0f);
-            const float alpha = drop.alpha * m_intensity * (1.0f - lifeT * 0.35f);
-            if (alpha <= 0.008f) continue;
-
-            const float tailLen = drop.smear * (0.65f + 0.35f * lifeT);
-            const int coreA = static_cast<int>(std::min(alpha * 255.0f, 255.0f));
-            const int glowA = static_cast<int>(coreA * 0.28f);
-            const int tailA = static_cast<int>(coreA * 0.18f);
-
-            fg->AddCircleFilled(
-                ImVec2(drop.x, drop.y),
-                drop.radius * 1.85f,
-                IM_COL32(160, 205, 255, glowA), 20);
-            fg->AddCircleFilled(
-                ImVec2(drop.x, drop.y),
-                drop.radius,
-                IM_COL32(185, 220, 255, static_cast<int>(coreA * 0.45f)), 20);
-            fg->AddCircleFilled(
-                ImVec2(drop.x - drop.radius * 0.22f, drop.y - drop.radius * 0.28f),
-                drop.radius * 0.32f,
-                IM_COL32(255, 255, 255, static_cast<int>(coreA * 0.75f)), 12);
-            fg->AddCircle(
-                ImVec2(drop.x + drop.radius * 0.12f, drop.y + drop.radius * 0.10f),
-                drop.radius * 0.82f,
-                IM_COL32(140, 190, 245, static_cast<int>(coreA * 0.22f)), 18, 1.0f);
-
-            fg->AddLine(
-                ImVec2(drop.x, drop.y + drop.radius * 0.35f),
-                ImVec2(drop.x - m_viewMotionX * 0.02f * m_screenRainMotionScale,
-                       drop.y + tailLen),
-                IM_COL32(185, 220, 255, tailA),
-                std::max(1.0f, drop.radius * 0.42f));
-            fg->AddLine(
-                ImVec2(drop.x - drop.radius * 0.18f, drop.y + drop.radius * 0.10f),
-                ImVec2(drop.x - m_viewMotionX * 0.028f * m_screenRainMotionScale,
-                       drop.y + tailLen * 0.92f),
-                IM_COL32(255, 255, 255, static_cast<int>(tailA * 0.55f)),
-                std::max(0.8f, drop.radius * 0.18f));
-        }
+        const glm::vec2 viewSize{displayW, displayH};
+        packLensDrops(m_lensDrops, m_intensity, m_viewMotionX * m_screenRainMotionScale,
+                      m_ellipseInstances, m_lineInstances);
+        drawInstances(renderer, ParticleShape::ELLIPSE, m_ellipseInstances, viewSize, true);
+        drawInstances(renderer, ParticleShape::LINE, m_lineInstances, viewSize, true);
     }
 
 } // namespace game::weather
@@ -1,7 +1,13 @@
 #pragma once
+#include "weather_particles.h"
 #include <vector>
 #include <cstdint>
 
+namespace engine::render
+{
+    class Renderer;
+}
+
 namespace game::weather
 {
     // ──────────────────────────────────────────────
@@ -16,57 +22,12 @@ namespace game::weather
         Thunderstorm = 4,  // 雷雨
     };
 
-    // ──────────────────────────────────────────────
-    // 单个雨滴粒子（屏幕坐标）
-    // ──────────────────────────────────────────────
-    struct RainParticle
-    {
-        float x, y;      // 屏幕坐标（像素）
-        float speed;     // 垂直速度（像素/秒）
-        float length;    // 条纹长度（像素）
-        float alpha;     // 不透明度 0..1
-        float depth;     // 0=远景 1=近景
-    };
-
-    // ──────────────────────────────────────────────
-    // 雨水落地水花/涟漪粒子
-    // ──────────────────────────────────────────────
-    struct RainSplash
-    {
-        float x, y;        // 屏幕坐标
-        float radius;      // 当前半径
-        float maxRadius;   // 最大半径
-        float age;         // 已存活时间
-        float maxAge;      // 最大寿命
-        float alpha;       // 当前透明度
-        bool active = false;
-    };
-
-    struct ScreenRainDrop
-    {
-        float x, y;      // 屏幕坐标
-        float vx, vy;    // 屏幕空间速度
-        float length;    // 条纹长度
-        float alpha;     // 不透明度 0..1
-        float width;     // 线宽
-    };
-
-    struct LensRainDrop
-    {
-        float x, y;        // 屏幕坐标
-        float radius;      // 主水珠半径
-        float alpha;       // 不透明度 0..1
-        float vy;          // 缓慢下滑速度
-        float smear;       // 拖尾长度
-        float age;         // 已存在时间
-        float maxAge;      // 生命周期
-    };
-
     // ──────────────────────────────────────────────
     // 天气系统
     //   update()  — 每帧调用（粒子物理、闪电计时等）
-    //   render()  — 在 ImGui::NewFrame() 之后调用
-    //               使用 GetBackgroundDrawList() 绘制在ImGui窗口之下
+    //   render()  — 在 ImGui::Render() 之前调用，绘制在 ImGui 窗口之下
+    //               粒子按形状打包成实例，每种形状交给渲染器一次实例化绘制；
+    //               渲染器不支持时（或传入 nullptr）回退到 ImGui 背景 DrawList
     // ──────────────────────────────────────────────
     class WeatherSystem
     {
@@ -88,9 +49,10 @@ namespace game::weather
         /** 每帧更新粒子位置、闪电计时、自动切换天气 */
         void update(float dt, float displayW, float displayH);
 
-        /** 在 ImGui 帧内调用，通过背景 DrawList 绘制天气效果 */
-        void render(float displayW, float displayH);
-        void renderForeground(float displayW, float displayH);
+        /** 在 ImGui 帧内调用，绘制天空暗化、雨丝、雾气、水花与闪电 */
+        void render(engine::render::Renderer *renderer, float displayW, float displayH);
+        /** 镜头水珠；需盖在 UI 之上时在 ImGui 绘制之后调用（回退路径使用前景 DrawList） */
+        void renderForeground(engine::render::Renderer *renderer, float displayW, float displayH);
 
         /**
          * @brief 切换天气
@@ -144,13 +106,19 @@ namespace game::weather
         float m_transitionDuration = 3.0f;
         bool  m_isTransitioning  = false;
 
-        std::vector<RainParticle> m_particles;
-        std::vector<RainSplash>   m_splashes;    // 地面水花涟漪
-        std::vector<ScreenRainDrop> m_screenDrops;
-        std::vector<LensRainDrop> m_lensDrops;
-        float                     m_fogTime = 0.0f; // 雾气动画累计时间
+        RainStreaks  m_particles;
+        RainSplashes m_splashes;    // 地面水花涟漪（只含存活的）
+        ScreenDrops  m_screenDrops;
+        LensDrops    m_lensDrops;
+        float        m_fogTime = 0.0f; // 雾气动画累计时间
         uint64_t m_rng;
 
+        // 每帧复用的缓冲：积分内核标出的粒子下标、按形状打包的实例
+        std::vector<uint32_t> m_flagged;
+        std::vector<ParticleInstance> m_rectInstances;
+        std::vector<ParticleInstance> m_lineInstances;
+        std::vector<ParticleInstance> m_ellipseInstances;
+
         // 雷电
         float m_lightningFlash    = 0.0f;   // 0..1 闪光强度
         float m_lightningNextTime = 8.0f;   // 到下次雷电的倒计时
@@ -187,14 +155,19 @@ namespace game::weather
         uint64_t nextRand();
         float    randFloat();  // [0, 1)
 
-        // ── 粒子生命周期 ──
+        // ── 粒子生命周期（参数 i 为 SoA 下标）──
         void spawnParticle(float displayW, float displayH);
-        void respawnParticle(RainParticle &p, float displayW, float displayH);
+        void respawnParticle(size_t i, float displayW, float displayH);
         void spawnScreenDrop(float displayW, float displayH);
-        void respawnScreenDrop(ScreenRainDrop &drop, float displayW, float displayH, bool topOnly);
+        void respawnScreenDrop(size_t i, float displayW, float displayH, bool topOnly);
         void spawnLensDrop(float displayW, float displayH);
-        void respawnLensDrop(LensRainDrop &drop, float displayW, float displayH, bool topOnly);
+        void respawnLensDrop(size_t i, float displayW, float displayH, bool topOnly);
         void emitSplash(float x, float y);
+        void resetSplash(size_t i, float x, float y);
+
+        // ── 绘制 ──
+        void drawInstances(engine::render::Renderer *renderer, engine::render::ParticleShape shape,
+                           std::vector<ParticleInstance> &instances, const glm::vec2 &viewSize, bool foreground);
     };
 
 } // namespace game::weather
@@ -2,6 +2,7 @@
 
 #include "../../engine/world/chunk_manager.h"
 #include "../../engine/world/tile_info.h"
+#include "../../engine/world/tile_kind_table.h"
 #include <algorithm>
 #include <fstream>
 #include <nlohmann/json.hpp>
@@ -79,6 +80,17 @@ bool GroundTileCatalog::loadFromFile(const std::string& filePath)
         kind.displayName = item.value("display_name", key);
         kind.tileType = maybeType.value();
         kind.heightPx = item.value("height_px", 0.0f);
+        kind.palette = static_cast<uint8_t>(kind.tileType);
+
+        // 可选：自定义外观（uv_rect 为像素 [x, y, w, h]），注册为独立调色板种类
+        const auto uvIt = item.find("uv_rect");
+        if (uvIt != item.end() && uvIt->is_array() && uvIt->size() == 4)
+        {
+            const glm::vec4 uvRect((*uvIt)[0].get<float>(), (*uvIt)[1].get<float>(),
+                                   (*uvIt)[2].get<float>(), (*uvIt)[3].get<float>());
+            kind.palette = engine::world::TileKindTable::shared().registerKind(
+                kind.tileType, uvRect, item.value("texture", ""));
+        }
 
         m_kinds.push_back(kind);
         m_typeByKey[kind.key] = kind.tileType;
@@ -116,6 +128,14 @@ std::optional<engine::world::TileType> GroundTileCatalog::typeForKey(const std::
     return it->second;
 }
 
+std::optional<engine::world::TileData> GroundTileCatalog::tileForKey(const std::string& key) const
+{
+    const GroundTileKind* kind = kindForKey(key);
+    if (!kind)
+        return std::nullopt;
+    return engine::world::TileData(kind->tileType, kind->palette);
+}
+
 std::optional<float> GroundTileCatalog::heightForType(engine::world::TileType type) const
 {
     const auto it = m_heightByType.find(static_cast<int>(type));
@@ -129,11 +149,11 @@ bool GroundTileCatalog::placeTileByKey(engine::world::ChunkManager& chunkManager
                                        int worldTileY,
                                        const std::string& key) const
 {
-    const auto maybeType = typeForKey(key);
-    if (!maybeType.has_value())
+    const auto maybeTile = tileForKey(key);
+    if (!maybeTile.has_value())
         return false;
 
-    chunkManager.setTile(worldTileX, worldTileY, engine::world::TileData(maybeType.value()));
+    chunkManager.setTile(worldTileX, worldTileY, maybeTile.value());
     return true;
 }
 
@@ -144,8 +164,8 @@ void GroundTileCatalog::fillRectByKey(engine::world::ChunkManager& chunkManager,
                                       int maxTileY,
                                       const std::string& key) const
 {
-    const auto maybeType = typeForKey(key);
-    if (!maybeType.has_value())
+    const auto maybeTile = tileForKey(key);
+    if (!maybeTile.has_value())
         return;
 
     const int x0 = std::min(minTileX, maxTileX);
@@ -156,7 +176,7 @@ void GroundTileCatalog::fillRectByKey(engine::world::ChunkManager& chunkManager,
     for (int y = y0; y <= y1; ++y)
     {
         for (int x = x0; x <= x1; ++x)
-            chunkManager.setTileSilent(x, y, engine::world::TileData(maybeType.value()));
+            chunkManager.setTileSilent(x, y, maybeTile.value());
     }
 
     chunkManager.rebuildDirtyChunks();
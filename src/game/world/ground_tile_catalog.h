@@ -9,6 +9,7 @@
 namespace engine::world
 {
     class ChunkManager;
+    struct TileData;
     enum class TileType : uint8_t;
 }
 
@@ -20,6 +21,7 @@ namespace game::world
         std::string displayName;
         engine::world::TileType tileType;
         float heightPx = 0.0f;
+        uint8_t palette = 0; // engine::world::TileKindTable 中的种类索引
     };
 
     class GroundTileCatalog
@@ -31,6 +33,7 @@ namespace game::world
         const GroundTileKind* kindForKey(const std::string& key) const;
         const GroundTileKind* kindForType(engine::world::TileType type) const;
         std::optional<engine::world::TileType> typeForKey(const std::string& key) const;
+        std::optional<engine::world::TileData> tileForKey(const std::string& key) const;
         std::optional<float> heightForType(engine::world::TileType type) const;
 
         bool placeTileByKey(engine::world::ChunkManager& chunkManager,
@@ -1,11 +1,23 @@
 #include <iostream>
+#include <cstdlib>
+#include <cstring>
 #include "engine/core/game_app.h"
+#include "engine/physics/physics_stress.h"
 #include <spdlog/spdlog.h>
 
-int main(int, char**){
+int main(int argc, char** argv){
     spdlog::set_level(spdlog::level::info);
 
+    // 无窗口物理压力测试：--physics-stress [bodyCount] [measureSteps]
+    if (argc > 1 && std::strcmp(argv[1], "--physics-stress") == 0)
+    {
+        engine::physics::PhysicsStressOptions options;
+        if (argc > 2) options.bodyCount = std::atoi(argv[2]);
+        if (argc > 3) options.measureSteps = std::atoi(argv[3]);
+        return engine::physics::runPhysicsStress(options);
+    }
+
     engine::core::GameApp app;
     app.run();
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,157 @@
+// mesh_cooker.cpp
+// 离线网格烘焙：递归扫描模型目录，把 .obj / .glb 转成 MeshCache 的 .lslm 缓存，并报告整目录的冷 / 热加载耗时
+//   - cold：解析源文件（OBJ 文本 / GLB）+ 写缓存，即游戏首次启动、缓存缺失时的路径
+//   - warm：映射缓存文件 + 解码量化顶点，即之后每次启动的路径
+//   - 各行只累计成功烘焙并回读一致的文件；files / failed 列给出失败数
+// 树内没有 FBX 导入器（tinygltf 只支持 glTF / GLB），.fbx 只计数跳过，运行时也不加载 FBX
+// 用法：mesh_cooker [modelsDir] [cacheDir]   默认 assets/models cache/meshes
+#include "../src/engine/resource/mesh_cache.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace
+{
+    namespace fs = std::filesystem;
+    using engine::resource::MeshCache;
+    using engine::resource::MeshData;
+
+    struct FormatStats
+    {
+        int files = 0;
+        int failed = 0;
+        uint64_t sourceBytes = 0;
+        uint64_t cacheBytes = 0;
+        uint64_t vertices = 0;
+        uint64_t triangles = 0;
+        double coldMs = 0.0;
+        double warmMs = 0.0;
+    };
+
+    template <typename Fn>
+    double measureMs(Fn &&fn)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    std::string lowerExtension(const fs::path &path)
+    {
+        std::string ext = path.extension().string();
+        std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return ext;
+    }
+
+    void printRow(const char *name, const FormatStats &stats)
+    {
+        if (stats.files > 0 && stats.failed == stats.files)
+        {
+            // 整个格式都没导入成功（如链接的是不带实现的 tinygltf），没有可报告的耗时
+            std::printf("  %-5s %6d %6d %10s %10s %10s %10s %9s %9s %9s\n", name, stats.files, stats.failed, "n/a", "n/a",
+                        "n/a", "n/a", "n/a", "n/a", "n/a");
+            return;
+        }
+        std::printf("  %-5s %6d %6d %10.1f %10.1f %10.2f %10.2f %8.1fx %9llu %9llu\n", name, stats.files, stats.failed,
+                    stats.sourceBytes / 1024.0, stats.cacheBytes / 1024.0, stats.coldMs, stats.warmMs,
+                    stats.warmMs > 0.0 ? stats.coldMs / stats.warmMs : 0.0,
+                    static_cast<unsigned long long>(stats.vertices), static_cast<unsigned long long>(stats.triangles));
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const std::string modelsDir = argc > 1 ? argv[1] : "assets/models";
+    const std::string cacheDir = argc > 2 ? argv[2] : "cache/meshes";
+
+    std::error_code ec;
+    if (!fs::is_directory(modelsDir, ec))
+    {
+        std::fprintf(stderr, "mesh_cooker: %s 不是目录\n", modelsDir.c_str());
+        return 1;
+    }
+
+    std::vector<std::string> sources;
+    int skippedFbx = 0;
+    for (const auto &entry : fs::recursive_directory_iterator(modelsDir, ec))
+    {
+        if (!entry.is_regular_file())
+            continue;
+        const std::string ext = lowerExtension(entry.path());
+        if (ext == ".fbx")
+            ++skippedFbx;
+        else if (engine::resource::isImportableMesh(entry.path().string()))
+            sources.push_back(entry.path().generic_string());
+    }
+    std::sort(sources.begin(), sources.end());
+
+    MeshCache cache(cacheDir);
+    FormatStats obj, glb, total;
+    int cooked = 0, upToDate = 0;
+    for (const std::string &source : sources)
+    {
+        FormatStats &format = lowerExtension(source) == ".obj" ? obj : glb;
+        ++format.files;
+
+        uint64_t size = 0;
+        int64_t time = 0;
+        MeshCache::sourceStamp(source, size, time);
+
+        // 每次都重新导入并覆盖写入，cold 始终是完整的缓存缺失路径
+        const bool fresh = cache.isFresh(source);
+        MeshData imported;
+        bool ok = false;
+        const double coldMs = measureMs([&] {
+            ok = engine::resource::importMesh(source, imported) &&
+                 MeshCache::writeFile(cache.cachePathFor(source), source, size, time, imported);
+        });
+        if (!ok)
+        {
+            ++format.failed;
+            std::fprintf(stderr, "mesh_cooker: 烘焙失败 %s\n", source.c_str());
+            continue;
+        }
+        fresh ? ++upToDate : ++cooked;
+
+        MeshData warm;
+        const double warmMs = measureMs([&] { ok = MeshCache::readFile(cache.cachePathFor(source), source, size, time, warm); });
+        if (!ok || warm.vertices.size() != imported.vertices.size() || warm.indices != imported.indices)
+        {
+            ++format.failed;
+            std::fprintf(stderr, "mesh_cooker: 缓存回读不一致 %s\n", source.c_str());
+            continue;
+        }
+        // 只统计冷热两条路径都成功的文件，失败文件不混进耗时与体积，各行之间可直接比较
+        format.sourceBytes += size;
+        format.coldMs += coldMs;
+        format.warmMs += warmMs;
+        format.cacheBytes += static_cast<uint64_t>(fs::file_size(cache.cachePathFor(source), ec));
+        format.vertices += warm.vertices.size();
+        format.triangles += warm.indices.size() / 3;
+    }
+
+    for (const FormatStats *format : {&obj, &glb})
+    {
+        total.files += format->files;
+        total.failed += format->failed;
+        total.sourceBytes += format->sourceBytes;
+        total.cacheBytes += format->cacheBytes;
+        total.vertices += format->vertices;
+        total.triangles += format->triangles;
+        total.coldMs += format->coldMs;
+        total.warmMs += format->warmMs;
+    }
+
+    std::printf("mesh cooker: %s -> %s（新烘焙 %d，原缓存已是最新 %d，跳过 FBX %d）\n", modelsDir.c_str(), cacheDir.c_str(), cooked,
+                upToDate, skippedFbx);
+    std::printf("  %-5s %6s %6s %10s %10s %10s %10s %9s %9s %9s\n", "fmt", "files", "failed", "src KiB", "cache KiB",
+                "cold ms", "warm ms", "speedup", "verts", "tris");
+    printRow("obj", obj);
+    printRow("glb", glb);
+    printRow("all", total);
+    return total.failed == 0 ? 0 : 1;
+}